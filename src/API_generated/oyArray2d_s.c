@@ -444,9 +444,14 @@ int          oyArray2d_SetFocus      ( oyArray2d_s       * array,
  *  @memberof oyArray2d_s
  *  @brief    Reinitialise Array
  *
- *  @version  Oyranos: 0.9.0
+ *  Arrays with a own aligned row block keep it for the new geometry and
+ *  grow it only as needed. The rows then point into that block and
+ *  oyImage_FillArray() with allocate_method 0 clears them before
+ *  referencing image lines. Otherwise the rows are empty.
+ *
+ *  @version  Oyranos: 0.9.7
+ *  @date     2026/10/18
  *  @since    2012/10/20 (Oyranos: 0.9.0)
- *  @date     2012/10/20
  */
 OYAPI int OYEXPORT
                  oyArray2d_Reset     ( oyArray2d_s       * array,
@@ -456,7 +461,6 @@ OYAPI int OYEXPORT
 {
   oyArray2d_s_ * s = (oyArray2d_s_*)array;
   int error = 0;
-  int y_len = sizeof(unsigned char *) * (height + 1);
 
   if(!oyDataTypeGetSize(data_type))
     return 1;
@@ -470,17 +474,16 @@ OYAPI int OYEXPORT
     return 1;
 
   error = oyArray2d_ReleaseArray_( (oyArray2d_s*)s );
-  /* allocate the base array */
-  oyStruct_AllocHelper_m_( s->array2d, unsigned char *, height+1,
-                           s, error = 1; return 1 );
-  if(error <= 0)
-    error = !memset( s->array2d, 0, y_len );
 
+  /* allocates the base array */
   if(error <= 0)
   {
     error = oyArray2d_Init_( s, width, height, data_type );
   }
 
+  if(error <= 0 && s->slab_)
+    error = oyArray2d_SetSlab_( s, width, height );
+
   return error;
 }
 
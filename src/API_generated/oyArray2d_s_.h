@@ -39,6 +39,9 @@ typedef struct oyArray2d_s_ oyArray2d_s_;
 #include "oyArray2d_s.h"
 
 /* Include "Array2d.private.h" { */
+/** @internal
+ *  alignment of rows in bytes for oyArray2d_SetSlab_(), fits SIMD registers */
+#define OY_ARRAY2D_ROW_ALIGN 64
 
 /* } Include "Array2d.private.h" */
 
@@ -72,7 +75,12 @@ oyObject_s           oy_;            /**< Features name and hash. Do not change
                                             - 0 not owned by the object
                                             - 1 one own monolithic memory block
                                                 starting in array2d[0]
-                                            - 2 several owned memory blocks */
+                                            - 2 several owned memory blocks
+                                            - 3 one own block in slab_ with
+                                                OY_ARRAY2D_ROW_ALIGN aligned rows */
+  oyPointer            slab_;          /**< row memory for own_lines == 3;
+                                            kept over oyArray2d_Reset() */
+  size_t               slab_size_;     /**< allocated bytes in slab_ */
   oyStructList_s     * refs_;          /**< references of other arrays to this*/
   oyArray2d_s        * refered_;       /**< array this one refers to */
 
@@ -104,6 +112,9 @@ oyArray2d_s_ *
                                        oyObject_s          object );
 int
              oyArray2d_ReleaseArray_ ( oyArray2d_s       * obj );
+int              oyArray2d_SetSlab_  ( oyArray2d_s_      * s,
+                                       int                 width,
+                                       int                 height );
 int              oyArray2d_ToPPM_    ( oyArray2d_s_      * array,
                                        const char        * file_name );
 
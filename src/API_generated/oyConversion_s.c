@@ -662,6 +662,68 @@ int          oyConversion_GetOnePixel( oyConversion_s    * conversion,
   return error;
 }
 
+/* pick a job ticket of a previous run on the same output image and reset
+ * it to the whole image; the ticket keeps its graph and pooled arrays */
+static oyPixelAccess_s_ * oyConversion_TakeTicket_ (
+                                       oyConversion_s_   * s,
+                                       oyFilterPlug_s    * plug )
+{
+  oyPixelAccess_s_ * ticket = NULL;
+  oyFilterSocket_s_ * sock = ((oyFilterPlug_s_*)plug)->remote_socket_;
+  oyImage_s * image = sock ? (oyImage_s*)sock->data : NULL;
+  int i, n, w;
+
+  if(!s->tickets_ || !image)
+    return NULL;
+
+  oyObject_Lock( s->oy_, __FILE__, __LINE__ );
+  n = oyStructList_Count( s->tickets_ );
+  for(i = 0; i < n; ++i)
+  {
+    oyPixelAccess_s_ * t = (oyPixelAccess_s_*) oyStructList_GetRefType(
+                             s->tickets_, i, oyOBJECT_PIXEL_ACCESS_S );
+    if(t && t->output_image == image)
+    {
+      oyStructList_ReleaseAt( s->tickets_, i );
+      ticket = t;
+      break;
+    }
+    oyPixelAccess_Release( (oyPixelAccess_s**)&t );
+  }
+  oyObject_UnLock( s->oy_, __FILE__, __LINE__ );
+
+  if(ticket)
+  {
+    /* same as a fresh oyPixelAccess_Create(0,0,plug,oyPIXEL_ACCESS_IMAGE,0) */
+    w = oyImage_GetWidth( image );
+    ticket->start_xy[0] = ticket->start_xy_old[0] = 0;
+    ticket->start_xy[1] = ticket->start_xy_old[1] = 0;
+    ticket->index = 0;
+    oyRectangle_SetGeo( (oyRectangle_s*)ticket->output_array_roi, 0,0, 1.0,
+                        w ? oyImage_GetHeight( image ) / (double)w : 0 );
+    ticket->output_array_is_focussed = 0;
+    /* the rows are references into the image and might be outdated */
+    oyArray2d_Release( &ticket->array );
+  }
+
+  return ticket;
+}
+
+/* keep a job ticket for the next oyConversion_RunPixels( conversion, NULL ) */
+static void oyConversion_GiveTicket_ (oyConversion_s_   * s,
+                                       oyPixelAccess_s_ ** ticket )
+{
+  oyObject_Lock( s->oy_, __FILE__, __LINE__ );
+  if(!s->tickets_)
+    s->tickets_ = oyStructList_Create( s->type_, "tickets", 0 );
+  if(s->tickets_ &&
+     oyStructList_Count( s->tickets_ ) < OY_CONVERSION_TICKETS_MAX)
+    oyStructList_MoveIn( s->tickets_, (oyStruct_s**)ticket, -1, 0 );
+  oyObject_UnLock( s->oy_, __FILE__, __LINE__ );
+
+  oyPixelAccess_Release( (oyPixelAccess_s**)ticket );
+}
+
 /** Function  oyConversion_RunPixels
  *  @memberof oyConversion_s
  *  @brief    Iterate over a conversion graph
@@ -680,14 +742,20 @@ int          oyConversion_GetOnePixel( oyConversion_s    * conversion,
       if(is_allocated)
         free( image_data );
     } @endcode
+ *
+ *  Without pixel_access the job ticket is kept inside the conversion and
+ *  reused by the next call for the same output image. Together with the
+ *  ticket the intermediate arrays of the graph are recycled, which helps
+ *  for frequently repeated conversions of same sized frames.
+ *  oyConversion_Set() drops the kept tickets.
 
  *  @param[in,out] conversion          conversion object
  *  @param[in,out] pixel_access        optional pixel iterator configuration
  *  @return                            0 on success, else error
  *
- *  @version Oyranos: 0.1.10
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
  *  @since   2008/07/06 (Oyranos: 0.1.8)
- *  @date    2009/03/06
  */
 int                oyConversion_RunPixels (
                                        oyConversion_s    * conversion,
@@ -719,6 +787,13 @@ int                oyConversion_RunPixels (
 
   /* conversion->out_ has to be linear, so we access only the first plug */
 
+  if(!pixel_access_)
+  {
+    /* reuse the ticket of the previous frame */
+    pixel_access_ = oyConversion_TakeTicket_( s, plug );
+    tmp_ticket = 1;
+  }
+
   if(!pixel_access_)
   {
     /* create a very simple pixel iterator as job ticket */
@@ -864,7 +939,9 @@ int                oyConversion_RunPixels (
                                 pixel_access_->array, 0 );
   }
 
-  if(tmp_ticket)
+  if(tmp_ticket && error <= 0)
+    oyConversion_GiveTicket_( s, &pixel_access_ );
+  else if(tmp_ticket)
     oyPixelAccess_Release( (oyPixelAccess_s**)&pixel_access_ );
 
   oyImage_Release( &image_out );
@@ -873,6 +950,501 @@ int                oyConversion_RunPixels (
   return error;
 }
 
+#ifdef _OPENMP
+#include <omp.h> /* omp_get_num_procs() */
+#endif
+#include "oyBlob_s.h"
+#include "oyranos_threads.h"
+
+/* one share of tiles for a worker; tiles first, first+step, ... */
+typedef struct {
+  oyConversion_s   * conversion;
+  oyFilterPlug_s   * plug;
+  oyImage_s        * image;
+  oyPixelAccess_s ** tickets;
+  oyRectangle_s   ** image_rois;
+  int                samples;
+  oyDATATYPE_e       data_type;
+  int                tiles_n;
+  int                first;
+  int                step;
+  int              * done;
+  int              * error;
+} oyConversionTiles_s;
+
+/* run the graph on a band array and copy the band into the output image */
+static int   oyConversion_RunTile_   ( oyConversionTiles_s * t,
+                                       int                 i )
+{
+  oyConversion_s_ * s = (oyConversion_s_*)t->conversion;
+  oyPixelAccess_s_ * ticket = (oyPixelAccess_s_*)t->tickets[i];
+  oyRectangle_s * pix = 0;
+  oyArray2d_s * band = 0;
+  int error;
+
+  /* the band lives only while the tile is processed */
+  oyPixelAccess_RoiToPixels( (oyPixelAccess_s*)ticket, NULL, &pix );
+  band = oyArray2d_Create( NULL, t->samples,
+                           OY_ROUND( oyRectangle_GetGeo1( pix, 3 ) ),
+                           t->data_type, s->oy_ );
+  error = !band;
+  if(error <= 0)
+    error = oyPixelAccess_SetArray( (oyPixelAccess_s*)ticket, band, 0 );
+
+  if(error <= 0)
+    error = s->out_->api7_->oyCMMFilterPlug_Run( t->plug,
+                                                 (oyPixelAccess_s*)ticket );
+
+  if(error <= 0 && t->image)
+  {
+    oyPixelAccess_SetArrayFocus( (oyPixelAccess_s*)ticket, 0 );
+    error = oyImage_ReadArray( t->image, t->image_rois[i], band, NULL );
+  }
+
+  oyArray2d_Release( &ticket->array );
+  oyArray2d_Release( &band );
+  oyRectangle_Release( &pix );
+
+  return error;
+}
+static int   oyConversion_RunTiles_  ( oyConversionTiles_s * t )
+{
+  int i, error = 0;
+
+  for(i = t->first; i < t->tiles_n; i += t->step)
+  {
+    int e = oyConversion_RunTile_( t, i );
+    if(e > 0 || error == 0)
+      error = e;
+  }
+
+  return error;
+}
+static int   oyConversion_TilesWork_ ( oyJob_s           * job )
+{
+  oyConversionTiles_s * t = (oyConversionTiles_s*)
+                             oyBlob_GetPointer( (oyBlob_s*)job->context );
+  return oyConversion_RunTiles_( t );
+}
+static int   oyConversion_TilesFinish_(oyJob_s           * job )
+{
+  oyConversionTiles_s * t = (oyConversionTiles_s*)
+                             oyBlob_GetPointer( (oyBlob_s*)job->context );
+  if(job->status_work_return > 0 || *t->error == 0)
+    *t->error = job->status_work_return;
+  oyAtomicAdd_m_( t->done, 1 );
+  oyDeAllocateFunc_( t );
+  return 0;
+}
+/* private job groups, apart from the positive IDs of applications */
+static int oy_conversion_tiles_group_ = 0;
+
+/** Function  oyConversion_RunPixelsTiled
+ *  @memberof oyConversion_s
+ *  @brief    Iterate over a conversion graph in parallel tiles
+ *
+ *  The output ROI of the ticket is split into bands of tile_height lines.
+ *  Each band obtains its own ticket from oyPixelAccess_Copy() and
+ *  oyPixelAccess_ChangeRectangle() and is run through the whole graph with
+ *  a band sized array, as in oyConversion_RunPixelsStreamed(). The array is
+ *  then copied into the output image. The bands are shared between the
+ *  calling thread and oyJob_s workers from the threads module. Thus all
+ *  nodes in the graph work in parallel, not only the CMM. A share, which
+ *  the threads module does not take, runs in the calling thread.
+ *
+ *  The first band is processed before any worker starts. This prepares the
+ *  graph contexts and resolves the image data.
+ *
+ *  As oyJobGroupWait() is used for waiting, call the function from the
+ *  thread, which manages the oyJob_s queue, usually the main thread.
+ *
+ *  A ticket with a own array is processed by oyConversion_RunPixels().
+ *
+ *  @param[in,out] conversion          conversion object
+ *  @param[in,out] pixel_access        optional pixel iterator configuration
+ *  @param[in]     tile_height         lines per band; 0 - automatic
+ *  @param[in]     threads             number of parallel bands including the
+ *                                     calling thread; 0 - one per oyJobPool()
+ *                                     worker and the calling thread;
+ *                                     1 - run serial
+ *  @return                            0 on success, else error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+int                oyConversion_RunPixelsTiled (
+                                       oyConversion_s    * conversion,
+                                       oyPixelAccess_s   * pixel_access,
+                                       int                 tile_height,
+                                       int                 threads )
+{
+  oyConversion_s_ * s = (oyConversion_s_*)conversion;
+  oyFilterPlug_s * plug = 0;
+  oyFilterNode_s * node_out = 0;
+  oyPixelAccess_s * ticket = 0,
+                 ** tickets = 0;
+  oyRectangle_s * roi_pix = 0,
+               ** image_rois = 0;
+  oyImage_s * image = 0,
+            * image_out = 0;
+  oyConversionTiles_s tiles;
+  int error = 0, tiles_n = 0, i, width, height, band_width, channels, y,
+      done = 0, jobs_n = 0, group, tiles_error = 0;
+  double start_x, start_y;
+
+  oyCheckType__m( oyOBJECT_CONVERSION_S, return 1 )
+
+  if(threads <= 0)
+  {
+    threads = oyJobPool( -1, NULL, 0 ) + 1;
+#if defined(_OPENMP)
+    if(threads <= 1)
+      threads = omp_get_num_procs();
+#endif
+  }
+
+  node_out = oyConversion_GetNode( conversion, OY_OUTPUT );
+  plug = oyFilterNode_GetPlug( node_out, 0 );
+  oyFilterNode_Release( &node_out );
+  if(!plug)
+  {
+    WARNc1_S("graph incomplete [%d]", oyObject_GetId( s->oy_ ))
+    return 1;
+  }
+
+  if(pixel_access)
+    ticket = oyPixelAccess_Copy( pixel_access, 0 );
+  else
+    ticket = oyPixelAccess_Create( 0,0, plug, oyPIXEL_ACCESS_IMAGE, 0 );
+
+  if(!ticket)
+  {
+    oyFilterPlug_Release( &plug );
+    return 1;
+  }
+
+  /* only tickets without array can be split */
+  {
+    oyArray2d_s * a = oyPixelAccess_GetArray( ticket );
+    if(a)
+      threads = 1;
+    oyArray2d_Release( &a );
+  }
+  if(threads == 1)
+  {
+    error = oyConversion_RunPixels( conversion, ticket );
+    oyPixelAccess_Release( &ticket );
+    oyFilterPlug_Release( &plug );
+    return error;
+  }
+
+  image = oyPixelAccess_GetOutputImage( ticket );
+  image_out = oyConversion_GetImage( conversion, OY_OUTPUT );
+  width = oyImage_GetWidth( image );
+  channels = oyImage_GetPixelLayout( image, oyCHANS );
+  oyPixelAccess_RoiToPixels( ticket, NULL, &roi_pix );
+  band_width = OY_ROUND( oyRectangle_GetGeo1( roi_pix, 2 ) );
+  height = OY_ROUND( oyRectangle_GetGeo1( roi_pix, 3 ) );
+  start_x = oyPixelAccess_GetStart( ticket, 0 );
+  start_y = oyPixelAccess_GetStart( ticket, 1 );
+
+  if(tile_height <= 0)
+    tile_height = OY_MAX( 16, height / (threads * 4) );
+  if(width > 0 && band_width > 0 && height > 0)
+    tiles_n = (height + tile_height - 1) / tile_height;
+  if(tiles_n)
+  {
+    tickets = (oyPixelAccess_s**) oyAllocateFunc_( sizeof(oyPixelAccess_s*) *
+                                                   tiles_n );
+    image_rois = (oyRectangle_s**) oyAllocateFunc_( sizeof(oyRectangle_s*) *
+                                                    tiles_n );
+  }
+  if(!tickets || !image_rois)
+    error = 1;
+  else
+  {
+    memset( tickets, 0, sizeof(oyPixelAccess_s*) * tiles_n );
+    memset( image_rois, 0, sizeof(oyRectangle_s*) * tiles_n );
+  }
+
+  /* one ticket per band; the ROI is relative to the band array */
+  for(i = 0, y = 0; error <= 0 && i < tiles_n; ++i, y += tile_height)
+  {
+    oyPixelAccess_s_ * t = (oyPixelAccess_s_*)oyPixelAccess_Copy( ticket,
+                                                                  s->oy_ );
+    int lines = OY_MIN( tile_height, height - y );
+    oyRectangle_s * roi = oyRectangle_NewWith( 0,0, band_width, lines, 0 );
+
+    oyArray2d_Release( &t->array );
+    oyRectangle_Scale( roi, 1.0 / width );
+    error = oyPixelAccess_ChangeRectangle( (oyPixelAccess_s*)t,
+                                           start_x, start_y + y /(double)width,
+                                           roi );
+    tickets[i] = (oyPixelAccess_s*)t;
+    image_rois[i] = oyRectangle_NewWith( oyRectangle_GetGeo1( roi_pix, 0 ),
+                                         oyRectangle_GetGeo1( roi_pix, 1 ) + y,
+                                         band_width, lines, 0 );
+    oyRectangle_Scale( image_rois[i], 1.0 / width );
+    oyRectangle_Release( &roi );
+  }
+
+  tiles.conversion = conversion;
+  tiles.plug = plug;
+  tiles.image = image_out;
+  tiles.tickets = tickets;
+  tiles.image_rois = image_rois;
+  tiles.samples = band_width * channels;
+  tiles.data_type = oyToDataType_m( oyImage_GetPixelLayout( image,
+                                                            oyLAYOUT ) );
+  tiles.tiles_n = tiles_n;
+  tiles.done = &done;
+  tiles.error = &tiles_error;
+
+  /* the first band prepares the graph, as is done in
+   * oyConversion_RunPixels() */
+  if(error <= 0)
+  {
+    error = oyConversion_RunTile_( &tiles, 0 );
+    if(error != 0)
+    {
+      oyFilterGraph_s * graph = oyPixelAccess_GetGraph( tickets[0] );
+      oyImage_s * image_input;
+
+      oyFilterGraph_SetFromNode( graph, (oyFilterNode_s*)s->input, 0, 0 );
+      image_input = oyFilterPlug_ResolveImage( plug,
+                            (oyFilterSocket_s*)((oyFilterPlug_s_*)plug)->remote_socket_,
+                                               tickets[0] );
+      oyImage_Release( &image_input );
+      oyFilterGraph_PrepareContexts( graph, 0 );
+      oyFilterGraph_Release( &graph );
+      error = oyConversion_RunTile_( &tiles, 0 );
+    }
+  }
+
+  if(error <= 0 && tiles_n > 1)
+  {
+    jobs_n = OY_MIN( threads, tiles_n - 1 ) - 1;
+    group = -oyAtomicAdd_m_( &oy_conversion_tiles_group_, 1 );
+    for(i = 0; i < jobs_n; ++i)
+    {
+      oyConversionTiles_s * t = (oyConversionTiles_s*)
+                        oyAllocateFunc_( sizeof(oyConversionTiles_s) );
+      oyJob_s * job = oyJob_New( 0 );
+      oyBlob_s * context = oyBlob_New( 0 );
+
+      *t = tiles;
+      t->first = 2 + i;
+      t->step = jobs_n + 1;
+      oyBlob_SetFromStatic( context, t, 0, "oyConversionTiles_s" );
+      job->context = (oyStruct_s*)context;
+      job->work = oyConversion_TilesWork_;
+      job->finish = oyConversion_TilesFinish_;
+      job->cb_progress = NULL;
+      job->group = group;
+      oyJob_Add( &job, 0, 0 );
+
+      /* no threads handler; do the share here */
+      if(job)
+      {
+        job->status_work_return = oyConversion_TilesWork_( job );
+        oyConversion_TilesFinish_( job );
+        oyJob_Release( &job );
+      }
+    }
+
+    /* the calling thread takes its own share */
+    tiles.first = 1;
+    tiles.step = jobs_n + 1;
+    error = oyConversion_RunTiles_( &tiles );
+
+    /* -1: the handler can not tell about groups; count the finished */
+    while(oyAtomicGet_m_( &done ) < jobs_n)
+      if(oyJobGroupWait( group, 0.1 ) == 0)
+        break;
+
+    if(tiles_error > 0 || error == 0)
+      error = tiles_error;
+  }
+
+  for(i = 0; i < tiles_n; ++i)
+  {
+    if(tickets) oyPixelAccess_Release( &tickets[i] );
+    if(image_rois) oyRectangle_Release( &image_rois[i] );
+  }
+  if(tickets)
+    oyDeAllocateFunc_( tickets );
+  if(image_rois)
+    oyDeAllocateFunc_( image_rois );
+  oyRectangle_Release( &roi_pix );
+  oyImage_Release( &image );
+  oyImage_Release( &image_out );
+  oyPixelAccess_Release( &ticket );
+  oyFilterPlug_Release( &plug );
+
+  return error;
+}
+
+/** Function  oyConversion_RunPixelsStreamed
+ *  @memberof oyConversion_s
+ *  @brief    Iterate over a conversion graph in bands with bounded memory
+ *
+ *  The output ROI of the ticket is processed from top to bottom in bands of
+ *  band_height lines. A single band sized oyArray2d_s is allocated for the
+ *  ticket and reused for all bands. Thus the memory of the ticket depends
+ *  on the band size and not on the image height.
+ *
+ *  After each band the array is written to the output image through its
+ *  oyImage_SetLine_f. A output image without pixel storage, e.g. from
+ *  oyImage_Create() without pixels, is not written. Instead a file writing
+ *  node like "//" OY_TYPE_STD "/file_write" in the graph consumes the
+ *  bands one after the other from the ticket. The ticket carries the
+ *  "//" OY_TYPE_STD "/streamed" marker in its
+ *  oyPixelAccess_GetRequestQueue() to tell such nodes to append the band.
+ *
+ *  @param[in,out] conversion          conversion object
+ *  @param[in,out] pixel_access        optional pixel iterator configuration
+ *  @param[in]     band_height         lines per band; 0 - automatic
+ *  @return                            0 on success, else error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+int                oyConversion_RunPixelsStreamed (
+                                       oyConversion_s    * conversion,
+                                       oyPixelAccess_s   * pixel_access,
+                                       int                 band_height )
+{
+  oyConversion_s_ * s = (oyConversion_s_*)conversion;
+  oyFilterPlug_s * plug = 0;
+  oyFilterNode_s * node_out = 0;
+  oyPixelAccess_s * ticket = 0;
+  oyArray2d_s * band = 0;
+  oyRectangle_s * roi_pix = 0;
+  oyImage_s * image = 0;
+  oyImage_SetLine_f setLine = 0;
+  int error = 0, width = 0, height = 0, band_width = 0, channels, y;
+  double start_x, start_y;
+
+  oyCheckType__m( oyOBJECT_CONVERSION_S, return 1 )
+
+  node_out = oyConversion_GetNode( conversion, OY_OUTPUT );
+  plug = oyFilterNode_GetPlug( node_out, 0 );
+
+  if(!plug)
+  {
+    WARNc1_S("graph incomplete [%d]", oyObject_GetId( s->oy_ ))
+    oyFilterNode_Release( &node_out );
+    return 1;
+  }
+
+  /* a own ticket, as the array is replaced by the band */
+  if(pixel_access)
+    ticket = oyPixelAccess_Copy( pixel_access, s->oy_ );
+  else
+    ticket = oyPixelAccess_Create( 0,0, plug, oyPIXEL_ACCESS_IMAGE, s->oy_ );
+  error = !ticket;
+
+  if(error <= 0)
+  {
+    oyArray2d_Release( &((oyPixelAccess_s_*)ticket)->array );
+    /* file writers append bands only for this marker */
+    oyOptions_SetFromInt( &((oyPixelAccess_s_*)ticket)->request_queue,
+                          "//" OY_TYPE_STD "/streamed", 1, 0, OY_CREATE_NEW );
+    image = oyPixelAccess_GetOutputImage( ticket );
+    width = oyImage_GetWidth( image );
+    channels = oyImage_GetPixelLayout( image, oyCHANS );
+    oyPixelAccess_RoiToPixels( ticket, NULL, &roi_pix );
+    band_width = OY_ROUND( oyRectangle_GetGeo1( roi_pix, 2 ) );
+    height = OY_ROUND( oyRectangle_GetGeo1( roi_pix, 3 ) );
+    start_x = oyPixelAccess_GetStart( ticket, 0 );
+    start_y = oyPixelAccess_GetStart( ticket, 1 );
+    setLine = oyImage_GetSetLineF( image );
+
+    if(band_height <= 0)
+      band_height = 64;
+    band_height = OY_MIN( band_height, height );
+    if(width <= 0 || band_width <= 0 || band_height <= 0)
+      error = 1;
+  }
+
+  if(error <= 0)
+  {
+    band = oyArray2d_Create( NULL, band_width * channels, band_height,
+                             oyToDataType_m( oyImage_GetPixelLayout( image,
+                                                             oyLAYOUT ) ),
+                             s->oy_ );
+    error = !band;
+  }
+  /* shrink the ROI to the band before the array, to avoid a failing focus */
+  if(error <= 0)
+  {
+    oyRectangle_s * band_roi = oyRectangle_NewWith( 0,0, band_width,
+                                                    band_height, 0 );
+    oyRectangle_Scale( band_roi, 1.0 / width );
+    error = oyPixelAccess_ChangeRectangle( ticket, start_x, start_y, band_roi );
+    oyRectangle_Release( &band_roi );
+  }
+  if(error <= 0)
+    error = oyPixelAccess_SetArray( ticket, band, 0 );
+
+  for(y = 0; error <= 0 && y < height; y += band_height)
+  {
+    int lines = OY_MIN( band_height, height - y );
+    oyRectangle_s * pix = oyRectangle_NewWith( 0,0, band_width, lines, 0 ),
+                  * roi = 0;
+
+    oyPixelAccess_PixelsToRoi( ticket, pix, &roi );
+    error = oyPixelAccess_ChangeRectangle( ticket, start_x,
+                                           start_y + y / (double)width, roi );
+    if(error <= 0)
+      error = oyFilterNodePriv_m(node_out)->api7_->oyCMMFilterPlug_Run( plug,
+                                                                      ticket );
+    /* prepare the graph once, as is done in oyConversion_RunPixels() */
+    if(error != 0 && y == 0)
+    {
+      oyFilterGraph_s * graph = oyPixelAccess_GetGraph( ticket );
+      oyImage_s * image_input;
+
+      oyFilterGraph_SetFromNode( graph, (oyFilterNode_s*)s->input, 0, 0 );
+      image_input = oyFilterPlug_ResolveImage( plug,
+                            (oyFilterSocket_s*)((oyFilterPlug_s_*)plug)->remote_socket_,
+                                               ticket );
+      oyImage_Release( &image_input );
+      oyFilterGraph_PrepareContexts( graph, 0 );
+      oyFilterGraph_Release( &graph );
+      error = oyFilterNodePriv_m(node_out)->api7_->oyCMMFilterPlug_Run( plug,
+                                                                      ticket );
+    }
+
+    /* hand the band over to the output image */
+    if(error <= 0 && setLine)
+    {
+      oyRectangle_s * image_roi = oyRectangle_NewWith(
+                                   oyRectangle_GetGeo1( roi_pix, 0 ),
+                                   oyRectangle_GetGeo1( roi_pix, 1 ) + y,
+                                   band_width, lines, 0 );
+      oyRectangle_Scale( image_roi, 1.0 / width );
+      oyPixelAccess_SetArrayFocus( ticket, 0 );
+      error = oyImage_ReadArray( image, image_roi, band, roi );
+      oyRectangle_Release( &image_roi );
+    }
+
+    oyRectangle_Release( &roi );
+    oyRectangle_Release( &pix );
+  }
+
+  oyArray2d_Release( &band );
+  oyRectangle_Release( &roi_pix );
+  oyImage_Release( &image );
+  oyPixelAccess_Release( &ticket );
+  oyFilterPlug_Release( &plug );
+  oyFilterNode_Release( &node_out );
+
+  return error;
+}
+
 /** Function  oyConversion_Set
  *  @memberof oyConversion_s
  *  @brief    Set input and output of a conversion graph
@@ -901,6 +1473,10 @@ int                oyConversion_Set  ( oyConversion_s    * conversion,
   if(output)
     s->out_ = (oyFilterNode_s_*)output;
 
+  /* pooled tickets hold the old graph */
+  if(input || output)
+    oyStructList_Release( &s->tickets_ );
+
   return error;
 }
 
@@ -268,6 +268,17 @@ OYAPI int  OYEXPORT
                  oyConversion_RunPixels (
                                        oyConversion_s    * conversion,
                                        oyPixelAccess_s   * pixel_access );
+OYAPI int  OYEXPORT
+                 oyConversion_RunPixelsTiled (
+                                       oyConversion_s    * conversion,
+                                       oyPixelAccess_s   * pixel_access,
+                                       int                 tile_height,
+                                       int                 threads );
+OYAPI int  OYEXPORT
+                 oyConversion_RunPixelsStreamed (
+                                       oyConversion_s    * conversion,
+                                       oyPixelAccess_s   * pixel_access,
+                                       int                 band_height );
 OYAPI int  OYEXPORT
                  oyConversion_Set  ( oyConversion_s    * conversion,
                                        oyFilterNode_s    * input,
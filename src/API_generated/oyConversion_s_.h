@@ -40,6 +40,9 @@ typedef struct oyConversion_s_ oyConversion_s_;
 #include "oyConversion_s.h"
 
 /* Include "Conversion.private.h" { */
+/** @internal
+ *  the number of job tickets oyConversion_RunPixels() keeps for reuse */
+#define OY_CONVERSION_TICKETS_MAX 4
 
 /* } Include "Conversion.private.h" */
 
@@ -64,6 +67,7 @@ oyObject_s           oy_;            /**< Features name and hash. Do not change
 /* Include "Conversion.members.h" { */
   oyFilterNode_s_    * input;          /**< the input image filter; Most users will start logically with this pice and chain their filters to get the final result. */
   oyFilterNode_s_    * out_;           /**< @private the Oyranos output image. Oyranos will stream the filters starting from the end. This element will be asked on its first plug. */
+  oyStructList_s     * tickets_;       /**< @private kept job tickets of oyConversion_RunPixels() */
 
 /* } Include "Conversion.members.h" */
 
@@ -226,6 +226,11 @@ OYAPI int  OYEXPORT
                 oyFilterNode_Run     ( oyFilterNode_s    * node,
                                        oyFilterPlug_s *    plug,
                                        oyPixelAccess_s *   ticket );
+OYAPI int  OYEXPORT
+                 oyFilterNode_RunFused(oyFilterNode_s    * node,
+                                       oyFilterPlug_s    * requestor_plug,
+                                       oyPixelAccess_s   * ticket,
+                                       int               * result );
 OYAPI oyFilterSocket_s * OYEXPORT
                oyFilterNode_GetSocket( oyFilterNode_s    * node,
                                        int                 pos );
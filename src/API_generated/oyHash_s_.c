@@ -87,13 +87,13 @@ void oyHash_Release__Members( oyHash_s_ * hash )
  */
 int oyHash_Init__Members( oyHash_s_ * hash )
 {
-  oyStruct_AllocHelper_m_( hash->oy_->hash_ptr_,
-                    unsigned char,
-                    OY_HASH_SIZE*2,
-                    hash,
-                    oyHash_Release_( &hash ));
+  /* the object allocates and releases the hash memory */
+  int error = oyObject_HashSet( hash->oy_, NULL );
 
-  return 0;
+  if(error)
+    WARNc_S( "Can not allocate memory for: hash->oy_->hash_ptr_" );
+
+  return error;
 }
 
 /** @internal
@@ -222,7 +222,7 @@ oyHash_s_ * oyHash_New_ ( oyObject_s object )
   oyHash_s_ * s = 0;
 
   if(s_obj)
-    s = (oyHash_s_*)s_obj->allocateFunc_(sizeof(oyHash_s_));
+    s = (oyHash_s_*)oySlabAllocateFunc_( sizeof(oyHash_s_), s_obj->allocateFunc_, s_obj->deallocateFunc_ );
   else
   {
     WARNc_S(_("MEM Error."));
@@ -423,6 +423,7 @@ int oyHash_Release_( oyHash_s_ **hash )
 
   if(s->oy_->deallocateFunc_)
   {
+    oyAlloc_f allocateFunc = s->oy_->allocateFunc_;
     oyDeAlloc_f deallocateFunc = s->oy_->deallocateFunc_;
     int id = s->oy_->id_;
 
@@ -430,7 +431,7 @@ int oyHash_Release_( oyHash_s_ **hash )
     if(track_name)
       fprintf( stderr, "%s[%d] untracked\n", track_name, id);
 
-    deallocateFunc( s );
+    oySlabDeAllocateFunc_( s, sizeof(oyHash_s_), allocateFunc, deallocateFunc );
   }
 
   return 0;
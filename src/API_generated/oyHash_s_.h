@@ -59,6 +59,7 @@ oyObject_s           oy_;            /**< Features name and hash. Do not change
 
 /* Include "Hash.members.h" { */
   oyStruct_s         * entry;          /**< holds a pointer to something */
+  uint32_t             access_;        /**< @private last cache access stamp */
 
 /* } Include "Hash.members.h" */
 
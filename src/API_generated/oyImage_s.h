@@ -314,6 +314,11 @@ int            oyImage_PixelsToSamples(oyImage_s         * image,
 int            oyImage_WritePPM      ( oyImage_s         * image,
                                        const char        * file_name,
                                        const char        * comment );
+int            oyImage_WritePPMLines ( oyImage_s         * image,
+                                       const char        * file_name,
+                                       const char        * free_text,
+                                       oyArray2d_s       * lines,
+                                       int                 y );
 
 /* } Include "Image.public_methods_declarations.h" */
 
@@ -25,21 +25,9 @@
 /* Include "Object.public_methods_definitions.c" { */
 #include "oyranos_types.h"           /* uint64_t uintptr_t */
 
-#if OY_USE_OBJECT_POOL_
-static oyObject_s oy_object_pool_[100] = {
-0,0,0,0,0, 0,0,0,0,0,
-0,0,0,0,0, 0,0,0,0,0,
-0,0,0,0,0, 0,0,0,0,0,
-0,0,0,0,0, 0,0,0,0,0,
-0,0,0,0,0, 0,0,0,0,0,
-
-0,0,0,0,0, 0,0,0,0,0,
-0,0,0,0,0, 0,0,0,0,0,
-0,0,0,0,0, 0,0,0,0,0,
-0,0,0,0,0, 0,0,0,0,0,
-0,0,0,0,0, 0,0,0,0,0
-};
-#endif
+/* parent_types_ holds the count and the types and is zero terminated */
+#define oyObjectParentTypesSize_m_(o) \
+        (sizeof(oyOBJECT_e) * ((o)->parent_types_[0] + 2))
 
 /* oyObject common object Functions { */
 
@@ -61,9 +49,12 @@ void               oyObject_UnTrack    ( oyObject_s          obj );
 /** @brief   object management 
  *  @ingroup  objects_generic
  *
- *  @version Oyranos: 0.1.10
+ *  With the default allocators the object memory comes from a per thread
+ *  free list.
+ *
+ *  @version Oyranos: 0.9.7
  *  @since   2007/11/00 (Oyranos: 0.1.8)
- *  @date    2009/06/02
+ *  @date    2026/10/18
  */
 oyObject_s         oyObject_NewWithAllocators (
                                        oyAlloc_f           allocateFunc,
@@ -72,28 +63,12 @@ oyObject_s         oyObject_NewWithAllocators (
   oyObject_s o = 0;
   int error = 0;
   int len = sizeof(struct oyObject_s_);
-#if OY_USE_OBJECT_POOL_
-  int old_obj = 0, i = 0;
-
-  for(i = 0; i < 100; ++i)
-    if(oy_object_pool_[i] != 0)
-    {
-      old_obj = 1;
-      o = oy_object_pool_[i];
-      oy_object_pool_[i] = 0;
-      break;
-    }
 
-  if(old_obj == 0)
-#endif
-    o = oyAllocateWrapFunc_( len, allocateFunc );
+  o = oySlabAllocateFunc_( len, allocateFunc, deallocateFunc );
 
   if(!o) return 0;
 
-#if OY_USE_OBJECT_POOL_
-  if(old_obj == 0)
-#endif
-    error = !memset( o, 0, len );
+  error = !memset( o, 0, len );
 
   if(error)
     return NULL;
@@ -102,19 +77,17 @@ oyObject_s         oyObject_NewWithAllocators (
   o->copy = (oyStruct_Copy_f) oyObject_Copy;
   o->release = (oyStruct_Release_f) oyObject_Release;
   o->ref_ = 1;
- 
-#if OY_USE_OBJECT_POOL_
-  if(old_obj)
-    return o;
-#endif
 
   o->id_ = oyGetNewObjectID();
   o->type_ = oyOBJECT_OBJECT_S;
   o->version_ = oyVersion(0);
   o->hash_ptr_ = 0;
   o->lock_ = NULL;
-  o->parent_types_ = o->allocateFunc_(sizeof(oyOBJECT_e)*2);
-  memset(o->parent_types_,0,sizeof(oyOBJECT_e)*2);
+  o->parent_types_ = oySlabAllocateFunc_( sizeof(oyOBJECT_e)*2,
+                                          o->allocateFunc_,
+                                          o->deallocateFunc_ );
+  if(o->parent_types_)
+    memset(o->parent_types_,0,sizeof(oyOBJECT_e)*2);
 
   if(oy_debug_objects >= 0)
     oyObject_Track(o);
@@ -213,34 +186,27 @@ int          oyObject_Release         ( oyObject_s      * obj )
 
   oyName_release_( &s->name_, s->deallocateFunc_ );
 
-#if OY_USE_OBJECT_POOL_
-  {
-  int i;
-  for(i = 0; i < 100; ++i)
-    if(oy_object_pool_[i] == 0)
-    {
-      if(s->hash_ptr_)
-        memset( s->hash_ptr_, 0, OY_HASH_SIZE*2 );
-      oy_object_pool_[i] = s;
-      s->ref_ = 0;
-      s->parent_ = 0;
-      return 0;
-    }
-  }
-#endif
-
   s->id_ = 0;
 
   if(s->deallocateFunc_)
   {
+    oyAlloc_f allocateFunc = s->allocateFunc_;
     oyDeAlloc_f deallocateFunc = s->deallocateFunc_;
     oyPointer lock = s->lock_;
 
     if(s->hash_ptr_)
-    { deallocateFunc(s->hash_ptr_); s->hash_ptr_ = 0; }
+    {
+      oySlabDeAllocateFunc_( s->hash_ptr_, OY_HASH_SIZE*2,
+                             allocateFunc, deallocateFunc );
+      s->hash_ptr_ = 0;
+    }
 
     if(s->parent_types_)
-    { deallocateFunc( s->parent_types_ ); s->parent_types_ = 0; }
+    {
+      oySlabDeAllocateFunc_( s->parent_types_, oyObjectParentTypesSize_m_(s),
+                             allocateFunc, deallocateFunc );
+      s->parent_types_ = 0;
+    }
 
     if(s->backdoor_)
     { deallocateFunc( s->backdoor_ ); s->backdoor_ = 0; }
@@ -248,7 +214,8 @@ int          oyObject_Release         ( oyObject_s      * obj )
     if(s->handles_ && s->handles_->release)
     { s->handles_->release( (oyStruct_s**)&s->handles_ ); }
 
-    deallocateFunc( s );
+    oySlabDeAllocateFunc_( s, sizeof(struct oyObject_s_),
+                           allocateFunc, deallocateFunc );
     if(lock)
       oyLockReleaseFunc_( lock, __FILE__, __LINE__ );
   }
@@ -289,11 +256,15 @@ oyObject_s   oyObject_SetParent      ( oyObject_s        o,
     oyOBJECT_e * tmp = 0;
     if(type != oyOBJECT_NONE)
     {
-      tmp = o->allocateFunc_( sizeof(oyOBJECT_e) * (o->parent_types_[0] + 3 ));
+      tmp = oySlabAllocateFunc_( sizeof(oyOBJECT_e) * (o->parent_types_[0] + 3),
+                                 o->allocateFunc_, o->deallocateFunc_ );
+      if(!tmp)
+        return o;
       memset(tmp,0,sizeof(oyOBJECT_e) *  (o->parent_types_[0] + 3 ));
       memcpy(tmp, o->parent_types_, sizeof(oyOBJECT_e)*(o->parent_types_[0]+1));
 
-      if(o->deallocateFunc_) o->deallocateFunc_( o->parent_types_ );
+      oySlabDeAllocateFunc_( o->parent_types_, oyObjectParentTypesSize_m_(o),
+                             o->allocateFunc_, o->deallocateFunc_ );
       o->parent_types_ = tmp;
       tmp = 0;
 
@@ -561,7 +532,7 @@ int            oyObject_GetRefCount  ( oyObject_s          obj )
     return -1;
 
   if(obj)
-    return obj->ref_;
+    return oyAtomicGet_m_( &obj->ref_ );
 
   return -1;
 }
@@ -571,8 +542,10 @@ int            oyObject_GetRefCount  ( oyObject_s          obj )
  *  @ingroup  objects_generic
  *  @brief   decrease the ref counter and return the above zero ref value
  *
- *  @version Oyranos: 0.1.8
- *  @date    2008/02/07
+ *  The counter is changed atomically through oyAtomicAdd_m_().
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
  *  @since   2008/02/07 (Oyranos: 0.1.8)
  */
 int          oyObject_UnRef          ( oyObject_s          obj )
@@ -586,26 +559,25 @@ int          oyObject_UnRef          ( oyObject_s          obj )
 
   if(error <= 0)
   {
-    oyObject_Lock( s, __FILE__, __LINE__ );
+    int refs;
 
-    if(s->ref_ < 0)
-      ref = 0;
+    refs = oyAtomicAdd_m_( &s->ref_, -1 );
 
-    if(error <= 0 && --s->ref_ > 0)
-      ref = s->ref_;
+    if(refs > 0)
+      ref = refs;
 
     if(oy_debug_objects >= 0 && s->id_ > 0)
       /* track object */
       oyObject_GetId( obj );
 
 #   ifndef DEBUG_OBJECT
-    if(s->ref_ < -1)
+    if(refs < -1)
 #   else
     if(s->id_ == 247)
 #   endif
       WARNc3_S( "%s ID: %d refs: %d",
                 oyStructTypeToText( s->parent_types_[s->parent_types_[0]] ),
-                s->id_, s->ref_ )
+                s->id_, refs )
 
     if((uintptr_t)obj->parent_types_ < (uintptr_t)oyOBJECT_MAX)
     {
@@ -620,8 +592,6 @@ int          oyObject_UnRef          ( oyObject_s          obj )
       error = pow(e_a,2.1);
       error = e_a;
     }
-
-    oyObject_UnLock( s, __FILE__, __LINE__ );
   }
 
   return ref;
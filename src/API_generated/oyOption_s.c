@@ -652,6 +652,8 @@ int            oyOption_Clear        ( oyOption_s        * obj )
 
     s->value_type = oyVAL_NONE;
 
+    oyRegPatternRelease_( &s->pattern_, s->oy_->allocateFunc_,
+                          deallocateFunc );
     if(s->registration)
       deallocateFunc( s->registration );
     s->registration = 0;
@@ -811,9 +813,9 @@ oyPointer      oyOption_GetData      ( oyOption_s        * option,
  *  @param[in]     registration        the option's registration and key name
  *  @return                            error
  *
- *  @version Oyranos: 0.1.10
+ *  @version Oyranos: 0.9.7
  *  @since   2009/01/24 (Oyranos: 0.1.10)
- *  @date    2009/01/24
+ *  @date    2026/10/18
  */
 int            oyOption_SetRegistration (
                                        oyOption_s        * option,
@@ -828,8 +830,11 @@ int            oyOption_SetRegistration (
   oyCheckType__m( oyOBJECT_OPTION_S, return 1 )
 
   if(registration)
+  {
     s->registration = oyStringCopy_( registration,
                                      s->oy_->allocateFunc_ );
+    oyOption_SetPattern_( s );
+  }
 
   return error;
 }
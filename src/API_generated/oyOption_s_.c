@@ -138,6 +138,7 @@ int oyOption_Copy__Members( oyOption_s_ * dst, oyOption_s_ * src)
    oyStruct_EnableSignalSend( (oyStruct_s*)dst );
 
    dst->registration = oyStringCopy_( src->registration, allocateFunc_ );
+   oyOption_SetPattern_( dst );
    dst->value_type = src->value_type;
    dst->value = allocateFunc_(sizeof(oyValue_u));
    memset(dst->value, 0, sizeof(oyValue_u));
@@ -248,7 +249,7 @@ oyOption_s_ * oyOption_New_ ( oyObject_s object )
   oyOption_s_ * s = 0;
 
   if(s_obj)
-    s = (oyOption_s_*)s_obj->allocateFunc_(sizeof(oyOption_s_));
+    s = (oyOption_s_*)oySlabAllocateFunc_( sizeof(oyOption_s_), s_obj->allocateFunc_, s_obj->deallocateFunc_ );
   else
   {
     WARNc_S(_("MEM Error."));
@@ -446,6 +447,7 @@ int oyOption_Release_( oyOption_s_ **option )
 
   if(s->oy_->deallocateFunc_)
   {
+    oyAlloc_f allocateFunc = s->oy_->allocateFunc_;
     oyDeAlloc_f deallocateFunc = s->oy_->deallocateFunc_;
     int id = s->oy_->id_;
 
@@ -453,7 +455,7 @@ int oyOption_Release_( oyOption_s_ **option )
     if(track_name)
       fprintf( stderr, "%s[%d] untracked\n", track_name, id);
 
-    deallocateFunc( s );
+    oySlabDeAllocateFunc_( s, sizeof(oyOption_s_), allocateFunc, deallocateFunc );
   }
 
   return 0;
@@ -501,6 +503,56 @@ int            oyOption_Match_       ( oyOption_s_        * option_a,
   return erg;
 }
 
+/**
+ *  @internal
+ *  Function oyOption_SetPattern_
+ *  @memberof oyOption_s
+ *  @brief   compile the registration for oyOption_MatchPattern_()
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+void           oyOption_SetPattern_  ( oyOption_s_       * option )
+{
+  oyAlloc_f allocateFunc = option->oy_->allocateFunc_;
+  oyDeAlloc_f deallocateFunc = option->oy_->deallocateFunc_;
+
+  oyRegPatternRelease_( &option->pattern_, allocateFunc, deallocateFunc );
+
+  if(option->registration)
+    option->pattern_ = oyRegPatternNew_( option->registration,
+                                         allocateFunc, deallocateFunc );
+}
+
+/**
+ *  @internal
+ *  Function oyOption_MatchPattern_
+ *  @memberof oyOption_s
+ *  @brief   match the registration against a pattern
+ *
+ *  The same as oyFilterRegistrationMatch() on the registration. With a
+ *  compiled pattern the texts are not scanned again.
+ *
+ *  @param[in]     option              the option
+ *  @param[in]     pattern             the compiled pattern_text or NULL
+ *  @param[in]     pattern_text        the pattern
+ *  @return                            match, useable for ranking
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+int            oyOption_MatchPattern_( oyOption_s_       * option,
+                                       const struct oyRegPattern_s * pattern,
+                                       const char        * pattern_text )
+{
+  if(option->pattern_ && pattern)
+    return oyRegPatternMatch_( option->pattern_, pattern, oyOBJECT_NONE, 0 );
+
+  return oyFilterRegistrationMatch( option->registration, pattern_text, 0 );
+}
+
 /**
  *  @internal
  *  Function oyOption_UpdateFlags_
@@ -65,6 +65,7 @@ oyObject_s           oy_;            /**< Features name and hash. Do not change
   oyValue_u          * value;          /**< the actual value */
   oyOPTIONSOURCE_e     source;         /**< the source of this value */
   uint32_t             flags;          /**< | oyOPTIONATTRIBUTE_e */
+  struct oyRegPattern_s * pattern_;    /**< @private compiled registration */
 
 /* } Include "Option.members.h" */
 
@@ -98,6 +99,10 @@ int            oyOption_SetFromInt_  ( oyOption_s_       * obj,
                                        uint32_t            flags );
 int            oyOption_MoveInStruct_( oyOption_s_       * option,
                                        oyStruct_s       ** s );
+void           oyOption_SetPattern_  ( oyOption_s_       * option );
+int            oyOption_MatchPattern_( oyOption_s_       * option,
+                                       const struct oyRegPattern_s * pattern,
+                                       const char        * pattern_text );
 
 /* } Include "Option.private_methods_declarations.h" */
 
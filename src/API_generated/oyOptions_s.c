@@ -1014,6 +1014,8 @@ int            oyOptions_Filter      ( oyOptions_s      ** add_list,
   int n, i;
   int32_t c = 0;
   uint32_t options_source = 0;
+  oyRegPatternBuf_s buf;
+  const oyRegPattern_s * pattern = oyRegPatternFromText_( &buf, registration );
 
   oyCheckType__m( oyOBJECT_OPTIONS_S, return 1 )
 
@@ -1030,15 +1032,13 @@ int            oyOptions_Filter      ( oyOptions_s      ** add_list,
     for(i = 0; i < n; ++i)
     {
       int found = 1;
-      const char * o_registration;
       oyOPTIONSOURCE_e o_source;
 
       o = oyOptions_Get( s, i );
-      o_registration = oyOptionPriv_m(o)->registration;
       o_source = oyOptionPriv_m(o)->source;
 
       if(found && registration &&
-         !oyFilterRegistrationMatch( o_registration, registration, 0 ))
+         !oyOption_MatchPattern_( oyOptionPriv_m(o), pattern, registration ))
           found = 0;
 
       options_source = flags & oyOPTIONSOURCE_FILTER ? oyOPTIONSOURCE_FILTER :0;
@@ -1320,6 +1320,8 @@ int            oyOptions_CountType   ( oyOptions_s       * options,
   int i, n, m = 0, found;
   oyOption_s_ * o = 0;
   oyOptions_s * s = options;
+  oyRegPatternBuf_s buf;
+  const oyRegPattern_s * pattern = oyRegPatternFromText_( &buf, registration );
 
 
   if(!error)
@@ -1332,7 +1334,7 @@ int            oyOptions_CountType   ( oyOptions_s       * options,
       found = 1;
 
       if(found && registration &&
-         !oyFilterRegistrationMatch( o->registration, registration, 0 ))
+         !oyOption_MatchPattern_( o, pattern, registration ))
           found = 0;
 
       if(found && type &&
@@ -1392,6 +1394,8 @@ oyOption_s *   oyOptions_Find        ( oyOptions_s       * options,
   oyOption_s * o = 0,
              * option = 0;
   int found;
+  oyRegPatternBuf_s buf;
+  const oyRegPattern_s * pattern = NULL;
 
   if(type != oyNAME_REGISTRATION &&
      type != oyNAME_PATTERN)
@@ -1405,6 +1409,9 @@ oyOption_s *   oyOptions_Find        ( oyOptions_s       * options,
     oyOptions_s * set_a = options;
     int set_an = oyOptions_Count( set_a ), i;
 
+    if(type == oyNAME_PATTERN)
+      pattern = oyRegPatternFromText_( &buf, registration );
+
     for(i = 0; i < set_an; ++i)
     {
       o = oyOptions_Get( options, i );
@@ -1412,7 +1419,9 @@ oyOption_s *   oyOptions_Find        ( oyOptions_s       * options,
 
       if(found && registration)
       {
-         if(!oyOptionRegistrationMatch( oyOptionPriv_m(o)->registration, registration, type ))
+         if(type == oyNAME_PATTERN ?
+            !oyOption_MatchPattern_( oyOptionPriv_m(o), pattern, registration ) :
+            !oyOptionRegistrationMatch( oyOptionPriv_m(o)->registration, registration, type ))
           found = 0;
       }
 
@@ -1839,10 +1848,15 @@ int            oyOptions_GetType2    ( oyOptions_s       * options,
   oyOption_s_ * o = 0;
   oyOptions_s * s = options;
   oyStruct_s * st = 0;
+  oyRegPatternBuf_s buf;
+  const oyRegPattern_s * pattern_c = NULL;
 
   if(!error)
     oyCheckType__m( oyOBJECT_OPTIONS_S, return 0 );
 
+    if(pattern_type == oyNAME_PATTERN)
+      pattern_c = oyRegPatternFromText_( &buf, pattern );
+
     n = oyOptions_Count( options );
     for(i = 0; i < n;  ++i)
     {
@@ -1850,7 +1864,9 @@ int            oyOptions_GetType2    ( oyOptions_s       * options,
       found = 1;
 
       if(found && pattern &&
-         !oyOptionRegistrationMatch( o->registration, pattern, pattern_type ))
+         (pattern_type == oyNAME_PATTERN ?
+          !oyOption_MatchPattern_( o, pattern_c, pattern ) :
+          !oyOptionRegistrationMatch( o->registration, pattern, pattern_type )))
           found = 0;
 
       if(found && object_type &&
@@ -248,6 +248,7 @@ oyPixelAccess_s *  oyPixelAccess_Create (
       s->output_array_roi->height = oyImage_GetHeight( image ) / (double)w;
     s->output_image = oyImage_Copy( image, 0 );
     s->graph = (oyFilterGraph_s_*)oyFilterGraph_FromNode( (oyFilterNode_s*)sock->node, 0 );
+    s->pool_ = oyStructList_Create( s->type_, "pool", 0 );
 
     if(type == oyPIXEL_ACCESS_POINT)
     {
@@ -1028,6 +1029,129 @@ int                oyPixelAccess_SetOldStart (
     s->start_xy_old[1] = start;
   return 0;
 }
+/** Function  oyPixelAccess_TakeArray
+ *  @memberof oyPixelAccess_s
+ *  @brief    Get a recycled or new intermediate array
+ *
+ *  Filters, which need a own array for a upstream request, can take it from
+ *  the tickets pool instead of allocating it for each run. The pool is
+ *  shared among the ticket and its copies, so repeated runs with a kept
+ *  ticket, e.g. from oyConversion_RunPixels( conversion, NULL ), see the
+ *  arrays of the previous run again. The content of a recycled array is
+ *  undefined. Return the array with oyPixelAccess_GiveArray().
+ *
+ *  @param[in]     pixel_access        the ticket
+ *  @param[in]     width               width in samples
+ *  @param[in]     height              height in lines
+ *  @param[in]     data_type           the sample type
+ *  @return                            a array of the requested geometry
+ *
+ *  @version  Oyranos: 0.9.7
+ *  @date     2026/10/18
+ *  @since    2026/10/18 (Oyranos: 0.9.7)
+ */
+oyArray2d_s *      oyPixelAccess_TakeArray (
+                                       oyPixelAccess_s   * pixel_access,
+                                       int                 width,
+                                       int                 height,
+                                       oyDATATYPE_e        data_type )
+{
+  oyPixelAccess_s_ * s = (oyPixelAccess_s_*)pixel_access;
+  oyArray2d_s * a = NULL;
+  int i, n;
+
+  if(!s)
+    return NULL;
+
+  oyCheckType__m( oyOBJECT_PIXEL_ACCESS_S, return NULL )
+
+  if(s->pool_)
+  {
+    oyObject_Lock( s->pool_->oy_, __FILE__, __LINE__ );
+    n = oyStructList_Count( s->pool_ );
+    for(i = n - 1; i >= 0; --i)
+    {
+      a = (oyArray2d_s*) oyStructList_GetRefType( s->pool_, i,
+                                                  oyOBJECT_ARRAY2D_S );
+      if(a && oyArray2d_GetType( a ) == data_type &&
+         oyArray2d_GetDataGeo1( a, 2 ) == width &&
+         oyArray2d_GetDataGeo1( a, 3 ) == height)
+      {
+        oyStructList_ReleaseAt( s->pool_, i );
+        break;
+      }
+      oyArray2d_Release( &a );
+    }
+    oyObject_UnLock( s->pool_->oy_, __FILE__, __LINE__ );
+  }
+
+  if(!a)
+    a = oyArray2d_Create( NULL, width, height, data_type, s->oy_ );
+
+  return a;
+}
+
+/** Function  oyPixelAccess_GiveArray
+ *  @memberof oyPixelAccess_s
+ *  @brief    Release a array into the tickets pool
+ *
+ *  The array is kept for a later oyPixelAccess_TakeArray() only, if no
+ *  other object holds a reference to it. Otherwise it is just released.
+ *
+ *  @param[in,out] pixel_access        the ticket
+ *  @param[in,out] array               the array; will be taken over
+ *  @return                            0 on success, else error
+ *
+ *  @version  Oyranos: 0.9.7
+ *  @date     2026/10/18
+ *  @since    2026/10/18 (Oyranos: 0.9.7)
+ */
+int                oyPixelAccess_GiveArray (
+                                       oyPixelAccess_s   * pixel_access,
+                                       oyArray2d_s      ** array )
+{
+  oyPixelAccess_s_ * s = (oyPixelAccess_s_*)pixel_access;
+  oyArray2d_s * a;
+
+  if(!s || !array)
+    return 1;
+
+  oyCheckType__m( oyOBJECT_PIXEL_ACCESS_S, return 1 )
+
+  a = *array;
+  if(a && a->type_ == oyOBJECT_ARRAY2D_S &&
+     oyObject_GetRefCount( a->oy_ ) == 1)
+  {
+    oyRectangle_s_ r = {oyOBJECT_RECTANGLE_S,0,0,0, 0,0,0,0};
+
+    /* undo any focus */
+    r.width = oyArray2d_GetDataGeo1( a, 2 );
+    r.height = oyArray2d_GetDataGeo1( a, 3 );
+    if(oyArray2d_GetDataGeo1( a, 0 ) != 0 ||
+       oyArray2d_GetDataGeo1( a, 1 ) != 0 ||
+       oyArray2d_GetWidth( a ) != r.width ||
+       oyArray2d_GetHeight( a ) != r.height)
+      oyArray2d_SetFocus( a, (oyRectangle_s*)&r );
+
+    oyObject_Lock( s->oy_, __FILE__, __LINE__ );
+    if(!s->pool_)
+      s->pool_ = oyStructList_Create( s->type_, "pool", 0 );
+    oyObject_UnLock( s->oy_, __FILE__, __LINE__ );
+
+    if(s->pool_)
+    {
+      oyObject_Lock( s->pool_->oy_, __FILE__, __LINE__ );
+      if(oyStructList_Count( s->pool_ ) >= OY_PIXEL_ACCESS_POOL_MAX)
+        oyStructList_ReleaseAt( s->pool_, 0 );
+      oyStructList_MoveIn( s->pool_, (oyStruct_s**)array, -1, 0 );
+      oyObject_UnLock( s->pool_->oy_, __FILE__, __LINE__ );
+    }
+  }
+
+  oyArray2d_Release( array );
+
+  return 0;
+}
 
 /* } Include "PixelAccess.public_methods_definitions.c" */
 
@@ -59,6 +59,7 @@ void oyPixelAccess_Release__Members( oyPixelAccess_s_ * pixelaccess )
   oyRectangle_Release( (oyRectangle_s**)&pixelaccess->output_array_roi );
   oyImage_Release( &pixelaccess->output_image );
   oyFilterGraph_Release( (oyFilterGraph_s**)&pixelaccess->graph );
+  oyStructList_Release( &pixelaccess->pool_ );
 
   if(pixelaccess->oy_->deallocateFunc_)
   {
@@ -145,6 +146,7 @@ int oyPixelAccess_Copy__Members( oyPixelAccess_s_ * dst, oyPixelAccess_s_ * src)
   dst->index = 0;
   dst->pixels_n = src->pixels_n;
   dst->workspace_id = src->workspace_id;
+  oyRectangle_Release( (oyRectangle_s**)&dst->output_array_roi );
   dst->output_array_roi = (oyRectangle_s_*)oyRectangle_Copy( (oyRectangle_s*)src->output_array_roi, dst->oy_ );
   dst->output_image = oyImage_Copy( src->output_image, 0 );
   dst->array = oyArray2d_Copy( src->array, 0 );
@@ -153,6 +155,7 @@ int oyPixelAccess_Copy__Members( oyPixelAccess_s_ * dst, oyPixelAccess_s_ * src)
   else
     dst->user_data = src->user_data;
   dst->graph = (oyFilterGraph_s_*)oyFilterGraph_Copy( (oyFilterGraph_s*)src->graph, 0 );
+  dst->pool_ = oyStructList_Copy( src->pool_, 0 );
 
   return error;
 }
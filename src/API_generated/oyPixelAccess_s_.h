@@ -40,7 +40,9 @@ typedef struct oyPixelAccess_s_ oyPixelAccess_s_;
 #include "oyPixelAccess_s.h"
 
 /* Include "PixelAccess.private.h" { */
-
+/** @internal
+ *  the number of arrays a oyPixelAccess_s pool keeps for reuse */
+#define OY_PIXEL_ACCESS_POOL_MAX 8
 /* } Include "PixelAccess.private.h" */
 
 /** @internal
@@ -85,6 +87,7 @@ oyObject_s           oy_;            /**< Features name and hash. Do not change
   oyImage_s      * output_image;       /**< the image which issued the request*/
   oyFilterGraph_s_ * graph;            /**< the graph to process */
   oyOptions_s    * request_queue;      /**< messaging; requests to resolve */
+  oyStructList_s * pool_;             /**< @private recycled intermediate arrays; shared with copies */
 
 /* } Include "PixelAccess.members.h" */
 
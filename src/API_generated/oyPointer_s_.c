@@ -270,7 +270,7 @@ oyPointer_s_ * oyPointer_New_ ( oyObject_s object )
   oyPointer_s_ * s = 0;
 
   if(s_obj)
-    s = (oyPointer_s_*)s_obj->allocateFunc_(sizeof(oyPointer_s_));
+    s = (oyPointer_s_*)oySlabAllocateFunc_( sizeof(oyPointer_s_), s_obj->allocateFunc_, s_obj->deallocateFunc_ );
   else
   {
     WARNc_S(_("MEM Error."));
@@ -468,6 +468,7 @@ int oyPointer_Release_( oyPointer_s_ **pointer )
 
   if(s->oy_->deallocateFunc_)
   {
+    oyAlloc_f allocateFunc = s->oy_->allocateFunc_;
     oyDeAlloc_f deallocateFunc = s->oy_->deallocateFunc_;
     int id = s->oy_->id_;
 
@@ -475,7 +476,7 @@ int oyPointer_Release_( oyPointer_s_ **pointer )
     if(track_name)
       fprintf( stderr, "%s[%d] untracked\n", track_name, id);
 
-    deallocateFunc( s );
+    oySlabDeAllocateFunc_( s, sizeof(oyPointer_s_), allocateFunc, deallocateFunc );
   }
 
   return 0;
@@ -339,8 +339,8 @@ oyProfile_s * oyProfile_FromMatrix   ( double              pandg[9],
     oyProfile_s * p = oyProfile_FromName( "rgb", icc_profile_flags, NULL );
     @endcode
  *
- *  @version Oyranos: 0.9.6
- *  @date    2014/05/06
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
  *  @since   2014/05/06 (Oyranos: 0.9.6)
  */
 OYAPI oyProfile_s * OYEXPORT oyProfile_FromName (
@@ -424,7 +424,8 @@ OYAPI oyProfile_s * OYEXPORT oyProfile_FromName (
     uint32_t count = 0, i;
     const char * t = 0;
 
-    names = /*(const char**)*/ oyProfileListGet ( NULL, &count, oyAllocateFunc_ );
+    /* only profiles with a matching description are loaded */
+    names = oyProfileIndexFindDescription_( name, &count );
 
     for(i = 0; (uint32_t)i < count; ++i)
     {
@@ -468,6 +469,11 @@ OYAPI oyProfile_s * OYEXPORT oyProfile_FromName (
  *  - ::OY_ICC_VERSION_2 and ::OY_ICC_VERSION_4 let select version 2 and 4 profiles separately.
  *  - ::OY_NO_REPAIR skip automatic adding a ID hash if missed, useful for pure analysis
  *  - ::OY_SKIP_NON_DEFAULT_PATH ignore profiles outside of default paths
+ *  - ::OY_MAP_FILE map the file read-only instead of reading it; processes
+ *    loading the same profile share the memory pages; a cached profile is
+ *    returned as is; a other writer, which truncates the file in place,
+ *    lets access to the mapping fail with SIGBUS; Oyranos itself replaces
+ *    profile files by renaming
  *  - ::OY_NO_LOAD do not load profile, create path name fragment; with a given "meta:" prefix, 
  *    the string is parsed right after the prefix as key until the semicolon ';' sign appears.
  *    after that the string is taken as value. A star '*', at begin or end, is kept in the profile
@@ -603,7 +609,9 @@ oyProfile_FromMem             ( size_t            size,
     }
   }
 
-  s = oyProfile_FromMemMove_( size_, &block_, flags, &error, object );
+  /* the copy is never a file mapping */
+  s = oyProfile_FromMemMove_( size_, &block_, flags & ~OY_MAP_FILE, &error,
+                              object );
 
   oyProfile_GetID( (oyProfile_s*)s );
 
@@ -652,8 +660,11 @@ OYAPI oyProfile_s * OYEXPORT
  *  @param[in]    object         the optional base
  *  @return                      a profile
  *
- *  @version Oyranos: 0.9.6
- *  @date    2015/01/03
+ *  The profile index maps the hash sums to file names. Only matching
+ *  profiles are loaded and compared.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
  *  @since   2009/03/20 (Oyranos: 0.1.10)
  */
 OYAPI oyProfile_s * OYEXPORT oyProfile_FromMD5 (
@@ -672,7 +683,7 @@ OYAPI oyProfile_s * OYEXPORT oyProfile_FromMD5 (
 
   if(error <= 0)
   {
-    names = oyProfileListGet_ ( NULL, 0, &count );
+    names = oyProfileIndexFindMD5_( md5, &count );
 
     for(i = 0; i < count; ++i)
     {
@@ -689,6 +700,14 @@ OYAPI oyProfile_s * OYEXPORT oyProfile_FromMD5 (
           equal = memcmp( md5, tmp->oy_->hash_ptr_, OY_HASH_SIZE );
         else
           equal = 1;
+        /* a cached profile can be older than a file overwritten in place */
+        if(equal != 0 && !oyToNoCacheRead_m(flags))
+        {
+          oyProfile_Release( &tmp );
+          tmp = oyProfile_FromFile( names[i], flags | OY_NO_CACHE_READ, object );
+          if(tmp && tmp->oy_->hash_ptr_)
+            equal = memcmp( md5, tmp->oy_->hash_ptr_, OY_HASH_SIZE );
+        }
         if(equal == 0)
           {
             s = tmp;
@@ -1122,6 +1141,13 @@ OYAPI int OYEXPORT
     return error;
   }
 
+  /* the header is compared against the file on a later full load */
+  if(error <= 0)
+    oyProfile_LoadBlock_( s );
+  /* a file mapping is read-only */
+  if(error <= 0)
+    error = oyProfile_UnMap_( s );
+
   if(error <= 0 && !s->block_)
   {
     oyStruct_AllocHelper_m_( block_, char, size_, s, error = 1 );
@@ -1608,6 +1634,8 @@ OYAPI oyPointer OYEXPORT
 
   if(error <= 0 && s->type_ == oyOBJECT_PROFILE_S)
   {
+    oyProfile_LoadBlock_( s );
+
     if(s->size_ && s->block_ && !s->tags_modified_)
     {
       block = oyAllocateWrapFunc_( s->size_, allocateFunc );
@@ -1626,9 +1654,7 @@ OYAPI oyPointer OYEXPORT
       if(s->file_name_)
         profile->oy_->deallocateFunc_( s->file_name_ );
       s->file_name_ = 0;
-      if(s->block_ && s->size_)
-        profile->oy_->deallocateFunc_( s->block_ );
-      s->size_ = 0;
+      oyProfile_FreeBlock_( s );
       s->block_ = oyAllocateWrapFunc_( *size,
                                              profile->oy_->allocateFunc_ );
       error = !memcpy( s->block_, block, *size );
@@ -1737,11 +1763,15 @@ OYAPI oyProfileTag_s * OYEXPORT
  *  @memberof oyProfile_s
  *  @brief    Get a profile tag by its tag signature
  *
+ *  A profile loaded with header and tag table only reads just the
+ *  requested tag data from disk.
+ *
  *  @param[in]     profile             the profile
  *  @param[in]     id                  icTagSignature
  *
- *  @since Oyranos: version 0.1.8
- *  @date  2 january 2008 (API 0.1.8)
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2008/01/02 (Oyranos: 0.1.8)
  */
 OYAPI oyProfileTag_s * OYEXPORT
                  oyProfile_GetTagById( oyProfile_s       * profile,
@@ -1759,6 +1789,11 @@ OYAPI oyProfileTag_s * OYEXPORT
 
   oyCheckType__m( oyOBJECT_PROFILE_S, return 0 )
 
+  /* read only the requested tag, as long as the tag list is not parsed */
+  if(error <= 0 && s->lazy_ && !oyStructList_Count( s->tags_ ) &&
+     oyProfile_ReadTag_( s, id, &tag ) == 0)
+    return tag;
+
   if(error <= 0)
     n = oyProfile_GetTagCount_( s );
 
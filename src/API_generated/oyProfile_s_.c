@@ -40,6 +40,14 @@
 #include "oyranos_cache.h"
 #include "oyranos_io.h"
 #include "oyranos_generic_internal.h"
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define OY_PROFILE_MMAP 1
+#endif
   
 
 
@@ -89,8 +97,10 @@ void oyProfile_Release__Members( oyProfile_s_ * profile )
     if(profile->names_chan_)
     { deallocateFunc( profile->names_chan_ ); profile->names_chan_ = 0; }
 
-    if(profile->block_)
-    { deallocateFunc( profile->block_ ); profile->block_ = 0; profile->size_ = 0; }
+    oyProfile_FreeBlock_( profile );
+
+    if(profile->head_)
+    { deallocateFunc( profile->head_ ); profile->head_ = 0; }
 
     if(profile->file_name_)
     { deallocateFunc( profile->file_name_ ); profile->file_name_ = 0; }
@@ -151,13 +161,18 @@ int oyProfile_Copy__Members( oyProfile_s_ * dst, oyProfile_s_ * src)
   /* Copy each value of src to dst here */
   if(src->block_ && src->size_)
   {
-    dst->block_ = allocateFunc_( src->size_ );
+    /* a partly loaded profile stays partial */
+    size_t lazy = src->lazy_,
+           size = lazy ? lazy : src->size_;
+
+    dst->block_ = allocateFunc_( size );
     if(!dst->block_)
       error = 1;
     else
     {
       dst->size_ = src->size_;
-      error = !memcpy( dst->block_, src->block_, src->size_ );
+      dst->lazy_ = lazy;
+      error = !memcpy( dst->block_, src->block_, size );
       if(error) { WARNc_S("Unable to copy CMM name"); }
     }
   }
@@ -583,6 +598,7 @@ int oyProfile_GetHash_               ( oyProfile_s_      * s,
     if(flags & OY_COMPUTE ||
        !has_id)
     {
+      oyProfile_LoadBlock_( s );
       error = oyProfileGetMD5( s->block_, s->size_, s->oy_->hash_ptr_ );
       if(error == -2)
         oyMessageFunc_p( oyMSG_WARN,(oyStruct_s*)s,
@@ -608,6 +624,235 @@ int oyProfile_GetHash_               ( oyProfile_s_      * s,
   }
   return error;
 }
+
+/* forget a profile in oy_profile_s_file_cache_ */
+static void oyProfile_FileCacheDrop_ ( oyProfile_s_      * s )
+{
+  oyStructList_s * cache = (oyStructList_s*)oy_profile_s_file_cache_;
+  int i;
+
+  if(!cache)
+    return;
+
+  oyObject_Lock( cache->oy_, __FILE__, __LINE__ );
+  for(i = oyStructList_Count( cache ) - 1; i >= 0; --i)
+  {
+    oyHash_s_ * entry = (oyHash_s_*) oyStructList_Get_( oy_profile_s_file_cache_,
+                                                        i );
+    if(entry && entry->type_ == oyOBJECT_HASH_S &&
+       entry->entry == (oyStruct_s*)s)
+      oyStructList_ReleaseAt( cache, i );
+  }
+  oyObject_UnLock( cache->oy_, __FILE__, __LINE__ );
+}
+
+/** @internal
+ *  @memberof oyProfile_s
+ *  @brief   load the complete ICC profile
+ *
+ *  oyProfile_FromFile_() keeps only header and tag table of profiles with
+ *  a ICC profile ID in memory. The tag data is read here on first request.
+ *  A file, which changed on disk meanwhile, is reported and fails. The
+ *  profile has no block afterwards, as its tag table might not match the
+ *  file anymore. It is removed from the file cache, so the next
+ *  oyProfile_FromFile() reads the file again.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+int oyProfile_LoadBlock_      ( oyProfile_s_      * s )
+{
+  int error = 0;
+
+  if(!s->lazy_)
+    return error;
+
+  oyObject_Lock( s->oy_, __FILE__, __LINE__ );
+  if(s->lazy_)
+  {
+    size_t size = 0;
+    char * block = NULL;
+
+    if(s->file_name_)
+      block = oyReadFileToMem_( s->file_name_, &size, s->oy_->allocateFunc_ );
+
+    if(block && size == s->size_ &&
+       memcmp( block, s->block_, s->lazy_ ) == 0)
+    {
+      /* the header stays valid for concurrent readers until release */
+      s->head_ = s->block_;
+      s->block_ = block;
+    } else
+    {
+      oyMessageFunc_p( oyMSG_WARN,(oyStruct_s*)s,
+                       OY_DBG_FORMAT_"\n\t%s: \"%s\"", OY_DBG_ARGS_,
+                _("Profile changed on disk"),
+                s->file_name_?s->file_name_:OY_PROFILE_NONE );
+      if(block)
+        s->oy_->deallocateFunc_( block );
+      s->head_ = s->block_;
+      s->block_ = NULL;
+      s->size_ = 0;
+      error = 1;
+    }
+    s->lazy_ = 0;
+  }
+  oyObject_UnLock( s->oy_, __FILE__, __LINE__ );
+
+  if(error)
+    oyProfile_FileCacheDrop_( s );
+
+  return error;
+}
+
+/** @internal
+ *  @memberof oyProfile_s
+ *  @brief   release the ICC profile data
+ *
+ *  Unmaps a file mapping from OY_MAP_FILE or deallocates the block.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+void oyProfile_FreeBlock_     ( oyProfile_s_      * s )
+{
+  if(!s->block_)
+    return;
+
+#if defined(OY_PROFILE_MMAP)
+  if(s->map_size_)
+    munmap( s->block_, s->map_size_ );
+  else
+#endif
+    s->oy_->deallocateFunc_( s->block_ );
+
+  s->block_ = 0;
+  s->size_ = 0;
+  s->map_size_ = 0;
+}
+
+/** @internal
+ *  @memberof oyProfile_s
+ *  @brief   replace a read-only file mapping by a private copy
+ *
+ *  Needed before modifying oyProfile_s::block_ in place.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+int oyProfile_UnMap_          ( oyProfile_s_      * s )
+{
+  oyPointer block = 0;
+  size_t size = s->size_;
+  int error = 0;
+
+  if(!s->map_size_)
+    return error;
+
+  oyStruct_AllocHelper_m_( block, char, size, s, error = 1 );
+  if(error <= 0)
+  {
+    memcpy( block, s->block_, size );
+    oyProfile_FreeBlock_( s );
+    s->block_ = block;
+    s->size_ = size;
+  }
+
+  return error;
+}
+
+/** @internal
+ *  @memberof oyProfile_s
+ *  @brief   read a single tag of a partly loaded profile
+ *
+ *  Only the tag data is read from disk. The tag is not added to
+ *  oyProfile_s::tags_.
+ *
+ *  @param[in]     s                   the profile
+ *  @param[in]     id                  the tag signature
+ *  @param[out]    tag                 the tag or NULL, if not in the profile
+ *  @return                            0 - handled, 1 - load the full profile
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+int oyProfile_ReadTag_        ( oyProfile_s_      * s,
+                                       icTagSignature      id,
+                                       oyProfileTag_s   ** tag )
+{
+  char * data = s->block_;
+  icTag * tag_list = (icTag*)&data[132];
+  uint32_t tag_count, i;
+  size_t offset = 0, tag_size = 0;
+  char * tag_block = NULL;
+  oySTATUS_e status = oyOK;
+  icTagTypeSignature tag_type = 0;
+  icSignature profile_cmmId;
+  char profile_cmm[5] = {0,0,0,0,0};
+  oyProfileTag_s * tag_;
+  int error = 0;
+
+  *tag = NULL;
+  if(!s->lazy_ || !s->file_name_)
+    return 1;
+
+  tag_count = oyValueUInt32( ((icProfile*)data)->count );
+  for(i = 0; i < tag_count; ++i)
+    if((icTagSignature)oyValueUInt32( tag_list[i].sig ) == id)
+      break;
+  if(i == tag_count)
+    return 0;
+
+  offset = oyValueUInt32( tag_list[i].offset );
+  tag_size = oyValueUInt32( tag_list[i].size );
+
+  tag_ = oyProfileTag_New( 0 );
+
+  if((offset+tag_size) > s->size_ || tag_size < 4)
+    status = oyCORRUPTED;
+  else
+  {
+    oyStruct_AllocHelper_m_( tag_block, char, tag_size, tag_,
+                             oyProfileTag_Release( &tag_ ); return 1 );
+    if((offset+tag_size) <= s->lazy_)
+      memcpy( tag_block, &data[offset], tag_size );
+    else
+    {
+      FILE * fp = fopen( s->file_name_, "rb" );
+      error = !fp || fseek( fp, offset, SEEK_SET ) != 0 ||
+              fread( tag_block, 1, tag_size, fp ) != tag_size;
+      if(fp) fclose( fp );
+    }
+
+    if(error)
+    {
+      tag_->oy_->deallocateFunc_( tag_block );
+      oyProfileTag_Release( &tag_ );
+      return 1;
+    }
+
+    tag_type = oyValueUInt32( ((icTagBase*) tag_block)->sig );
+  }
+
+  profile_cmmId = oyProfile_GetSignature( (oyProfile_s*)s, oySIGNATURE_CMM );
+  profile_cmmId = oyValueUInt32( profile_cmmId );
+  memcpy( profile_cmm, &profile_cmmId, 4 );
+
+  error = oyProfileTag_Set( tag_, (icTagSignature)oyValueUInt32( tag_list[i].sig ),
+                            tag_type, status, tag_size, (oyPointer*)&tag_block );
+  if(error <= 0)
+    error = oyProfileTag_SetOffset( tag_, offset );
+  if(error <= 0)
+    error = oyProfileTag_SetCMM( tag_, profile_cmm );
+
+  *tag = tag_;
+
+  return 0;
+}
 /* } Static helper functions */
 
 #include "oyranos_check.h"
@@ -641,6 +886,9 @@ oyProfile_s_* oyProfile_FromMemMove_  ( size_t              size,
   {
     s->block_ = *block;
     *block = 0;
+    /* the block comes from oyProfile_MapFile_() */
+    if(flags & OY_MAP_FILE)
+      s->map_size_ = size;
 
     if(size > 128)
     {
@@ -740,6 +988,82 @@ oyProfile_s_* oyProfile_FromMemMove_  ( size_t              size,
   return s;
 }
 
+#if defined(OY_PROFILE_MMAP)
+/* Map a profile file read-only. Other processes mapping the same file
+ * share its pages through the page cache. */
+static oyPointer oyProfile_MapFile_  ( const char        * file_name,
+                                       size_t            * size )
+{
+  struct stat st;
+  oyPointer block = NULL;
+  int fd = file_name ? open( file_name, O_RDONLY ) : -1;
+
+  if(fd >= 0 && fstat( fd, &st ) == 0 && st.st_size > 0)
+  {
+    block = mmap( NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    if(block == MAP_FAILED)
+      block = NULL;
+    else
+      *size = st.st_size;
+  }
+  if(fd >= 0)
+    close( fd );
+
+  return block;
+}
+#endif /* OY_PROFILE_MMAP */
+
+#define oyPROFILE_HEAD_SIZE 4096
+/* Read only header and tag table of profiles with a ICC profile ID.
+ * *lazy is set to the bytes read, otherwise the whole file is loaded. */
+static oyPointer oyProfile_ReadHead_ ( const char        * file_name,
+                                       uint32_t            flags,
+                                       size_t            * size,
+                                       size_t            * lazy,
+                                       oyAlloc_f           allocateFunc )
+{
+  char head[oyPROFILE_HEAD_SIZE];
+  size_t n = 0;
+  long file_size = 0;
+  oyPointer block = NULL;
+  FILE * fp = NULL;
+
+  *lazy = 0;
+  if(!(flags & OY_COMPUTE) && file_name)
+    fp = fopen( file_name, "rb" );
+  if(fp)
+  {
+    n = fread( head, 1, oyPROFILE_HEAD_SIZE, fp );
+    if(fseek( fp, 0L, SEEK_END ) == 0)
+      file_size = ftell( fp );
+    fclose( fp );
+  }
+
+  if(n == oyPROFILE_HEAD_SIZE && file_size > oyPROFILE_HEAD_SIZE)
+  {
+    uint32_t id[4], tag_count;
+
+    memcpy( id, &head[84], 16 );
+    memcpy( &tag_count, &head[128], 4 );
+    tag_count = oyValueUInt32( tag_count );
+
+    if((id[0] || id[1] || id[2] || id[3]) &&
+       tag_count <= (oyPROFILE_HEAD_SIZE - 132) / sizeof(icTag))
+    {
+      block = oyAllocateWrapFunc_( n, allocateFunc );
+      if(block)
+      {
+        memcpy( block, head, n );
+        *size = file_size;
+        *lazy = n;
+        return block;
+      }
+    }
+  }
+
+  return oyGetProfileBlock( file_name, size, allocateFunc );
+}
+
 #ifdef COMPILE_STATIC
 #include "Gray-CIE_L.h"
 #include "ISOcoated_v2_bas.h"
@@ -750,6 +1074,58 @@ oyProfile_s_* oyProfile_FromMemMove_  ( size_t              size,
 #include "XYZ.h"
 #endif
 
+/* Write s with the ICC ID to file_name. The file is replaced by a
+ * temporary sibling and not written into, as a mapping of the file, e.g.
+ * from OY_MAP_FILE, would see the truncation. A symlink is followed to its
+ * target. Mode and ownership are kept, otherwise the file stays as is. */
+static int oyProfile_ReplaceFile_    ( oyProfile_s_      * s,
+                                       const char        * file_name )
+{
+  char * real_name = NULL, * temp_name = NULL;
+  int error;
+#if !defined(_WIN32)
+  struct stat st;
+  char * t = file_name ? realpath( file_name, NULL ) : NULL;
+
+  if(t)
+  {
+    real_name = oyStringCopy_( t, oyAllocateFunc_ );
+    free( t );
+  }
+  error = !real_name || stat( real_name, &st ) != 0 || !S_ISREG( st.st_mode );
+#else
+  real_name = oyStringCopy_( file_name, oyAllocateFunc_ );
+  error = !real_name;
+#endif
+
+  /* "r+b" tests for write access without truncating the file */
+  if(!error && !oyIsFileFull_( real_name, "r+b" ))
+    error = 1;
+
+  if(!error)
+  {
+    temp_name = oyGetTempSiblingName_( real_name );
+    error = !temp_name || oyProfile_ToFile_( s, temp_name );
+  }
+#if !defined(_WIN32)
+  /* chown() can clear the set-user-ID bit; chmod() follows */
+  if(!error)
+    error = chown( temp_name, st.st_uid, st.st_gid ) != 0 ||
+            chmod( temp_name, st.st_mode & 07777 ) != 0;
+#endif
+  if(!error)
+    error = rename( temp_name, real_name ) != 0;
+  if(error && temp_name)
+    oyRemoveFile_( temp_name );
+
+  if(temp_name)
+    oyFree_m_( temp_name );
+  if(real_name)
+    oyFree_m_( real_name );
+
+  return error;
+}
+
 /** @internal
  *  Function  oyProfile_FromFile_
  *  @memberof oyProfile_s
@@ -764,8 +1140,12 @@ oyProfile_s_* oyProfile_FromMemMove_  ( size_t              size,
  *  scanning large numbers of profiles. OY_COMPUTE and OY_ICC_VERSION_2 and
  *  OY_ICC_VERSION_4 and OY_NO_REPAIR are supported too.
  *
- *  @version Oyranos: 0.9.6
- *  @date    2014/06/25
+ *  Profiles with a ICC profile ID are loaded with header and tag table only,
+ *  unless OY_COMPUTE is set. The tag data follows on demand through
+ *  oyProfile_LoadBlock_(). OY_MAP_FILE maps the whole file instead.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
  *  @since   2007/11/0 (Oyranos: 0.1.9)
  */
 oyProfile_s_ *  oyProfile_FromFile_  ( const char        * name,
@@ -779,6 +1159,8 @@ oyProfile_s_ *  oyProfile_FromFile_  ( const char        * name,
   oyAlloc_f allocateFunc = 0;
   oyHash_s_ * entry = 0;
   char * file_name = 0;
+  size_t lazy = 0;
+  uint32_t move_flags = flags & ~OY_MAP_FILE;
 
   if(object)
     allocateFunc = object->allocateFunc_;
@@ -818,7 +1200,15 @@ oyProfile_s_ *  oyProfile_FromFile_  ( const char        * name,
   if(name && !s)
   {
     file_name = oyFindProfile_( name, flags );
-    block = oyGetProfileBlock( file_name, &size, allocateFunc );
+#if defined(OY_PROFILE_MMAP)
+    if(flags & OY_MAP_FILE)
+      block = oyProfile_MapFile_( file_name, &size );
+    if(block)
+      move_flags |= OY_MAP_FILE;
+    else
+#endif
+    block = oyProfile_ReadHead_( file_name, flags, &size, &lazy,
+                                 allocateFunc );
     if(!block || !size)
       error = 1;
   }
@@ -829,7 +1219,15 @@ oyProfile_s_ *  oyProfile_FromFile_  ( const char        * name,
     uint32_t md5[4];
 
     if(block && size)
-      s = oyProfile_FromMemMove_( size, &block, flags, &error, object );
+    {
+      s = oyProfile_FromMemMove_( lazy ? lazy : size, &block, move_flags,
+                                  &error, object );
+      if(s && lazy)
+      {
+        s->size_ = size;
+        s->lazy_ = lazy;
+      }
+    }
 #ifdef COMPILE_STATIC
     else
     {
@@ -916,14 +1314,10 @@ oyProfile_s_ *  oyProfile_FromFile_  ( const char        * name,
     if(repair && !(flags & OY_NO_REPAIR))
     {
       error = oyProfile_GetMD5( (oyProfile_s*)s, OY_COMPUTE, md5 );
-      if(oyIsFileFull_( file_name, "wb" ))
-      {
-        error = oyProfile_ToFile_( s, file_name );
-        if(!error)
-          oyMessageFunc_p( oyMSG_WARN,(oyStruct_s*)s,
+      if(file_name && oyProfile_ReplaceFile_( s, file_name ) == 0)
+        oyMessageFunc_p( oyMSG_WARN,(oyStruct_s*)s,
                        OY_DBG_FORMAT_"\n\t%s: \"%s\"", OY_DBG_ARGS_,
                 _("ICC profile id written"), t?t:OY_PROFILE_NONE );
-      }
     }
 
     /* We expect a incomplete filename attached to s and try to correct this. */
@@ -1300,6 +1694,10 @@ oyProfileTag_s * oyProfile_GetTagByPos_( oyProfile_s_    * profile,
     return tag;
   }
 
+  /* fetch the tag data of a partly loaded profile */
+  if(error <= 0 && s->lazy_)
+    oyProfile_LoadBlock_( s );
+
   /* parse the ICC profile struct */
   if(error <= 0 && s->block_)
   {
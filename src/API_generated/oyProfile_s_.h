@@ -69,6 +69,9 @@ oyObject_s           oy_;            /**< Features name and hash. Do not change
   char               * file_name_;     /*!< @private file name for loading on request */
   size_t               size_;          /*!< @private ICC profile size */
   void               * block_;         /*!< @private ICC profile data */
+  size_t               lazy_;          /*!< @private bytes in block_, if only header and tag table are loaded */
+  void               * head_;          /*!< @private header block replaced by a later full load */
+  size_t               map_size_;      /*!< @private block_ is a read-only file mapping of this size */
   icColorSpaceSignature sig_;          /*!< @private ICC profile signature */
   oyPROFILE_e          use_default_;   /*!< @private if > 0 : take from settings */
   oyObject_s         * names_chan_;    /*!< @private user visible channel description */
@@ -134,6 +137,12 @@ oyPointer    oyProfile_WriteTagTable_( oyProfile_s_      * profile,
 int oyProfile_HasID_          ( oyProfile_s_      * s );
 int oyProfile_GetHash_        ( oyProfile_s_      * s,
                                        int                 flags );
+int oyProfile_LoadBlock_      ( oyProfile_s_      * s );
+void oyProfile_FreeBlock_     ( oyProfile_s_      * s );
+int oyProfile_UnMap_          ( oyProfile_s_      * s );
+int oyProfile_ReadTag_        ( oyProfile_s_      * s,
+                                       icTagSignature      id,
+                                       oyProfileTag_s   ** tag );
 #if 0
 oyChar *       oyProfile_GetCMMText_ ( oyProfile_s       * profile,
                                        oyNAME_e            type,
@@ -30,6 +30,7 @@
 #include "oyProfile_s_.h"
 #include "oyProfiles_s_.h"
 #include "oyConfig_s_.h"
+#include "lookup3.h"
   
 
 
@@ -297,6 +298,48 @@ int oyLowerStrcmpWrap_ (const void * a_, const void * b_)
 #endif
 }
 
+/* open addressing set of profiles, keyed by the profile md5 */
+typedef struct {
+  uint32_t             size;           /* a power of two */
+  oyProfile_s       ** slots;          /* not referenced */
+} oyProfilesHashSet_s;
+
+static int  oyProfilesHashSetInit_   ( oyProfilesHashSet_s * set,
+                                       uint32_t            n )
+{
+  set->size = 64;
+  /* keep the load factor below 1/2 */
+  while(set->size < n * 2 + 1)
+    set->size *= 2;
+  set->slots = oyAllocateFunc_( sizeof(oyProfile_s*) * set->size );
+  if(!set->slots)
+    return 1;
+  memset( set->slots, 0, sizeof(oyProfile_s*) * set->size );
+  return 0;
+}
+
+/* return 0 for a already contained equal profile, otherwise 1 */
+static int  oyProfilesHashSetAdd_    ( oyProfilesHashSet_s * set,
+                                       oyProfile_s       * p )
+{
+  uint32_t mask = set->size - 1, i;
+
+  /* not hashed profiles are never equal */
+  if(!p->oy_->hash_ptr_)
+    return 1;
+
+  i = oy_hashlittle( p->oy_->hash_ptr_, OY_HASH_SIZE, 0 ) & mask;
+  while(set->slots[i])
+  {
+    if(oyProfile_Equal( set->slots[i], p ))
+      return 0;
+    i = (i + 1) & mask;
+  }
+
+  set->slots[i] = p;
+  return 1;
+}
+
 /** Function oyProfiles_Create
  *  @memberof oyProfiles_s
  *  @brief   get a list of installed profiles
@@ -307,7 +350,9 @@ int oyLowerStrcmpWrap_ (const void * a_, const void * b_)
  *  @param         flags               
  *                                     - see oyProfile_FromFile()
  *                                     - ::OY_ALLOW_DUPLICATES - do not filter
- *                                     duplicate profile ID's
+ *                                     duplicate profile ID's; duplicates
+ *                                     are detected through a hash set of
+ *                                     the profile md5
  *  @param         object              the optional object
  *  @return                            the found and selected profiles
  *
@@ -333,8 +378,8 @@ int oyLowerStrcmpWrap_ (const void * a_, const void * b_)
     profiles = oyProfiles_Create( patterns, icc_profile_flags, 0 );
     oyProfiles_Release( &patterns );@endcode
  *
- *  @version Oyranos: 0.9.6
- *  @date    2014/08/31
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
  *  @since   2008/06/20 (Oyranos: 0.1.8)
  */
 OYAPI oyProfiles_s * OYEXPORT
@@ -348,52 +393,43 @@ OYAPI oyProfiles_s * OYEXPORT
   int error = 0;
 
   oyProfile_s * tmp = 0, * pattern = 0;
-  char  ** names = 0;
-#if !defined(HAVE_POSIX)
-  char *t;
-#endif
+  char  ** names = 0,
+        ** descriptions = 0;
   uint32_t names_n = 0, i = 0, j = 0, n = 0,
            patterns_n = oyProfiles_Count(patterns);
   int sorts = 0;
   const char ** sort = NULL;
+  oyProfilesHashSet_s set = { 0, NULL };
 
   error = !s;
 
   if(error <= 0)
   {
-    names = oyProfileListGet_ ( NULL, flags, &names_n );
+    /* the profile index knows the descriptions without loading profiles */
+    names = oyProfileIndexListGet_ ( NULL, flags, &descriptions, &names_n );
 
     if(!(flags & OY_ALLOW_DUPLICATES))
       flags |= OY_COMPUTE;
 
     if(oyProfiles_Count( oy_profile_list_cache_ ) != (int)names_n)
     {
-      oyProfiles_s * l = oyProfiles_New(0);
-      sorts = names_n;
-      sort = oyAllocateFunc_(sorts*sizeof(const char*)*2);
+      sort = oyAllocateFunc_(names_n*sizeof(const char*)*2 + 1);
       for(i = 0; i < names_n; ++i)
       {
-        if(names[i])
+        if(names[i] && oyStrcmp_(names[i], OY_PROFILE_NONE) != 0)
         {
-          if(oyStrcmp_(names[i], OY_PROFILE_NONE) != 0)
-          {
-            tmp = oyProfile_FromFile( names[i], OY_NO_CACHE_WRITE | flags, 0 );
 #if !defined(HAVE_POSIX)
-            t = 0;
-            oyStringAdd_(&t, oyProfile_GetText(tmp, oyNAME_DESCRIPTION), oyAllocateFunc_, 0);
-            n = strlen(t);
-            /* the following upper caseing is portable,
-             * still strcasecmp() might be faster? */
-            for(j = 0; j < n; ++j)
-              if(isalpha(t[j]))
-                t[j] = tolower(t[j]);
-            sort[i*2] = t;
-#else
-            sort[i*2] = oyProfile_GetText(tmp, oyNAME_DESCRIPTION);
+          char * t = descriptions[i];
+          n = strlen(t);
+          /* the following upper caseing is portable,
+           * still strcasecmp() might be faster? */
+          for(j = 0; j < n; ++j)
+            if(isalpha(t[j]))
+              t[j] = tolower(t[j]);
 #endif
-            sort[i*2+1] = names[i];
-            oyProfiles_MoveIn( l, &tmp, -1 );
-          }
+          sort[sorts*2] = descriptions[i];
+          sort[sorts*2+1] = names[i];
+          ++sorts;
         }
       }
       qsort( sort, sorts, sizeof(char**)*2, oyLowerStrcmpWrap_ );
@@ -401,12 +437,7 @@ OYAPI oyProfiles_s * OYEXPORT
       {
         tmp = oyProfile_FromFile( sort[i*2+1], OY_NO_CACHE_WRITE | flags, 0 );
         oyProfiles_MoveIn(tmps, &tmp, -1);
-#if !defined(HAVE_POSIX)
-        t = (char*)sort[i*2];
-        oyFree_m_(t);
-#endif
       }
-      oyProfiles_Release(&l);
       oyProfiles_Release(&oy_profile_list_cache_);
       oyObject_SetNames( tmps->oy_, name,name,name );
       oy_profile_list_cache_ = tmps;
@@ -416,9 +447,15 @@ OYAPI oyProfiles_s * OYEXPORT
     n = oyProfiles_Count( oy_profile_list_cache_ );
     if(oyProfiles_Count( oy_profile_list_cache_ ) != (int)names_n)
       WARNc2_S("updated oy_profile_list_cache_ differs: %d %d",n, names_n);
-    oyStringListRelease_( &names, names_n, oyDeAllocateFunc_ ); names_n = 0;
+    oyStringListRelease_( &names, names_n, oyDeAllocateFunc_ );
+    oyStringListRelease_( &descriptions, names_n, oyDeAllocateFunc_ );
+    names_n = 0;
 
-    for(i = 0; i < n; ++i)
+    if(!(flags & OY_ALLOW_DUPLICATES) &&
+       oyProfilesHashSetInit_( &set, n ))
+      error = 1;
+
+    for(i = 0; i < n && error <= 0; ++i)
     {
         int good = 1;
 
@@ -441,25 +478,19 @@ OYAPI oyProfiles_s * OYEXPORT
           }
         }
 
-        if(good &&
+        /* the cache list holds a reference for the set */
+        if(good && tmp &&
            !(flags & OY_ALLOW_DUPLICATES))
-        {
-          int count = oyProfiles_Count( s ),
-              j;
-          for(j = 0; j < count; ++j)
-          {
-            oyProfile_s * b = oyProfiles_Get( s, j );
-            if(oyProfile_Equal(b, tmp))
-              good = 0;
-            oyProfile_Release( &b );
-          }
-        }
+          good = oyProfilesHashSetAdd_( &set, tmp );
 
         if(good)
           oyProfiles_MoveIn( s, (oyProfile_s**)&tmp, -1);
 
         oyProfile_Release( &tmp );
     }
+
+    if(set.slots)
+      oyDeAllocateFunc_( set.slots );
   }
 
   return s;
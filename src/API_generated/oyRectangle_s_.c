@@ -184,7 +184,7 @@ oyRectangle_s_ * oyRectangle_New_ ( oyObject_s object )
   oyRectangle_s_ * s = 0;
 
   if(s_obj)
-    s = (oyRectangle_s_*)s_obj->allocateFunc_(sizeof(oyRectangle_s_));
+    s = (oyRectangle_s_*)oySlabAllocateFunc_( sizeof(oyRectangle_s_), s_obj->allocateFunc_, s_obj->deallocateFunc_ );
   else
   {
     WARNc_S(_("MEM Error."));
@@ -382,6 +382,7 @@ int oyRectangle_Release_( oyRectangle_s_ **rectangle )
 
   if(s->oy_->deallocateFunc_)
   {
+    oyAlloc_f allocateFunc = s->oy_->allocateFunc_;
     oyDeAlloc_f deallocateFunc = s->oy_->deallocateFunc_;
     int id = s->oy_->id_;
 
@@ -389,7 +390,7 @@ int oyRectangle_Release_( oyRectangle_s_ **rectangle )
     if(track_name)
       fprintf( stderr, "%s[%d] untracked\n", track_name, id);
 
-    deallocateFunc( s );
+    oySlabDeAllocateFunc_( s, sizeof(oyRectangle_s_), allocateFunc, deallocateFunc );
   }
 
   return 0;
@@ -53,6 +53,7 @@ void oyStructList_Release__Members( oyStructList_s_ * structlist )
    */
 
   oyStructList_Clear((oyStructList_s*)structlist);
+  oyCacheListIndexRelease_((oyStructList_s*)structlist);
 
   if(structlist->oy_->deallocateFunc_)
   {
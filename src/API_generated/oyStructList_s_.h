@@ -63,6 +63,7 @@ int                  n_;             /**< @private the number of visible pointer
 int                  n_reserved_;    /**< @private the number of allocated pointers */
 char               * list_name;      /**< name of list */
 oyOBJECT_e           parent_type_;   /**< @private parents struct type */
+oyPointer            hash_index_;    /**< @private optional oyHash_s lookup table */
 
 /* } Include "StructList.members.h" */
 
@@ -411,3 +411,250 @@ OYAPI oyImage_s * OYEXPORT
   return (oyImage_s*)image_input_;
 }
 
+
+#include "oyArray2d_s_.h"
+#include "oyCMMapi7_s_.h"
+#include "oyFilterNode_s_.h"
+#include "oyranos_threads.h"
+#include <stdlib.h> /* getenv() strtol() */
+
+/* tiles of oyFilterNode_RunFused() for oyParallelFor() */
+typedef struct {
+  oyPixelAccess_s  * ticket;
+  oyFilterNode_s_ ** nodes;
+  oyFilterPlug_s  ** plugs;
+  int                nodes_n;
+  unsigned char   ** rows;
+  int                width;
+  oyDATATYPE_e       data_type;
+  double             pix_width;
+  double             roi_x;
+  double             roi_width;
+  int                start_y;
+  int                height;
+  int                tile_height;
+  int                error;
+} oyFilterNodeFused_s;
+static void  oyFilterNode_FusedTiles_( int                 start,
+                                       int                 end,
+                                       void              * data )
+{
+  oyFilterNodeFused_s * f = (oyFilterNodeFused_s*)data;
+  oyPixelAccess_s_ * tile = (oyPixelAccess_s_*)oyPixelAccess_Copy( f->ticket,
+                                                         f->ticket->oy_ );
+  int i, j, error = 0;
+
+  if(!tile)
+  {
+    f->error = 1;
+    return;
+  }
+
+  /* mark the ticket for the point filters */
+  oyOptions_SetFromInt( &tile->request_queue, "//" OY_TYPE_STD "/fused", 1,
+                        0, OY_CREATE_NEW );
+
+  for(i = start; i < end && error <= 0; ++i)
+  {
+    int y = i * f->tile_height,
+        height = OY_MIN( f->tile_height, f->height - y );
+    oyArray2d_s * view = (oyArray2d_s*) oyArray2d_Create_( f->width, height,
+                                                          f->data_type, 0 );
+
+    /* the tile array references the rows of the ticket array */
+    error = !view ||
+            oyArray2d_SetRows( view, (oyPointer*)&f->rows[f->start_y + y], 0 );
+    oyArray2d_Release( &tile->array );
+    tile->array = view;
+    oyRectangle_SetGeo( (oyRectangle_s*)tile->output_array_roi,
+                        f->roi_x, 0, f->roi_width, height / f->pix_width );
+
+    /* upstream nodes first */
+    for(j = f->nodes_n - 1; j >= 0 && error <= 0; --j)
+      error = f->nodes[j]->api7_->oyCMMFilterPlug_Run( f->plugs[j],
+                                                   (oyPixelAccess_s*)tile );
+  }
+
+  if(error > 0)
+    f->error = error;
+
+  oyOptions_Release( &tile->request_queue );
+  oyPixelAccess_Release( (oyPixelAccess_s**)&tile );
+}
+
+/* detect a "pixel=point" filter */
+static int   oyFilterNode_IsPoint_   ( oyFilterNode_s_   * node )
+{
+  int i;
+
+  if(!node || !node->api7_ || !node->api7_->properties ||
+     node->api7_->plugs_n != 1)
+    return 0;
+
+  for(i = 0; node->api7_->properties[i]; ++i)
+    if(strcmp( node->api7_->properties[i], "pixel=point" ) == 0)
+      return 1;
+
+  return 0;
+}
+
+/** Function  oyFilterNode_RunFused
+ *  @memberof oyFilterNode_s
+ *  @brief    Run a chain of point filters in one pass
+ *
+ *  Filters, which change each pixel independently of its neighbours, can
+ *  declare the "pixel=point" property in their oyCMMapi7_s::properties.
+ *  Such a filter calls this function from its oyCMMFilterPlug_Run_f before
+ *  it requests its input. When its input node is a point filter too, the
+ *  complete chain of point filters is processed here. The first non point
+ *  node of the chain fills the ticket array as usual. Then each cache sized
+ *  tile of the array is passed through all point filters before the next
+ *  tile is touched. The tiles reference the rows of the ticket array
+ *  without intermediate copies and are distributed with oyParallelFor().
+ *
+ *  The ::OY_FUSED_TILE_BYTES environment variable sets the tile size and
+ *  "0" disables the fusion.
+ *
+ *  @param[in]     node                the calling point filter node
+ *  @param[in]     requestor_plug      the plug, which requests from node
+ *  @param[in,out] ticket              the job ticket
+ *  @param[out]    result              the error of the chain for return 2
+ *  @return                            - 0 : not fused; run the input node
+ *                                       and process the ticket array
+ *                                     - 1 : the ticket is a tile of a
+ *                                       chain; process only the ticket
+ *                                       array and do not run the input
+ *                                     - 2 : the chain is processed
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+OYAPI int  OYEXPORT
+                 oyFilterNode_RunFused(oyFilterNode_s    * node,
+                                       oyFilterPlug_s    * requestor_plug,
+                                       oyPixelAccess_s   * ticket,
+                                       int               * result )
+{
+  oyPixelAccess_s_ * t = (oyPixelAccess_s_*)ticket;
+  oyFilterNode_s_ ** nodes = 0,
+                  * input = 0;
+  oyFilterPlug_s ** plugs = 0,
+                  * plug = 0;
+  oyArray2d_s_ * array = 0;
+  int32_t fused = 0;
+  long tile_bytes = 256 * 1024;
+  const char * v = getenv( OY_FUSED_TILE_BYTES );
+  int nodes_n = 0, i, error = 0, channels;
+
+  if(!node || !requestor_plug || !t ||
+     t->type_ != oyOBJECT_PIXEL_ACCESS_S)
+    return 0;
+
+  oyOptions_FindInt( t->request_queue, "fused", 0, &fused );
+  if(fused)
+    return 1;
+
+  if(v && v[0])
+    tile_bytes = strtol( v, NULL, 10 );
+  if(tile_bytes <= 0 ||
+     !oyFilterNode_IsPoint_( (oyFilterNode_s_*)node ))
+    return 0;
+
+  /* count the point filters from node upstream */
+  input = (oyFilterNode_s_*)oyFilterNode_GetPlugNode( node, 0 );
+  nodes_n = 1;
+  while(oyFilterNode_IsPoint_( input ))
+  {
+    oyFilterNode_s_ * next = (oyFilterNode_s_*)oyFilterNode_GetPlugNode(
+                                                 (oyFilterNode_s*)input, 0 );
+    oyFilterNode_Release( (oyFilterNode_s**)&input );
+    input = next;
+    ++nodes_n;
+  }
+  oyFilterNode_Release( (oyFilterNode_s**)&input );
+  if(nodes_n < 2)
+    return 0;
+
+  nodes = (oyFilterNode_s_**) oyAllocateFunc_( sizeof(oyFilterNode_s_*) *
+                                               nodes_n );
+  plugs = (oyFilterPlug_s**) oyAllocateFunc_( sizeof(oyFilterPlug_s*) *
+                                              nodes_n );
+  if(!nodes || !plugs)
+  {
+    if(nodes) oyFree_m_( nodes );
+    if(plugs) oyFree_m_( plugs );
+    return 0;
+  }
+
+  /* plugs[i] requests from nodes[i] */
+  nodes[0] = (oyFilterNode_s_*)oyFilterNode_Copy( node, 0 );
+  plugs[0] = oyFilterPlug_Copy( requestor_plug, 0 );
+  for(i = 1; i < nodes_n; ++i)
+  {
+    plugs[i] = oyFilterNode_GetPlug( (oyFilterNode_s*)nodes[i-1], 0 );
+    nodes[i] = (oyFilterNode_s_*)oyFilterNode_GetPlugNode(
+                                           (oyFilterNode_s*)nodes[i-1], 0 );
+  }
+
+  /* the source of the chain fills the ticket array */
+  input = (oyFilterNode_s_*)oyFilterNode_GetPlugNode(
+                                       (oyFilterNode_s*)nodes[nodes_n-1], 0 );
+  plug = oyFilterNode_GetPlug( (oyFilterNode_s*)nodes[nodes_n-1], 0 );
+  error = oyFilterNode_Run( (oyFilterNode_s*)input, plug, ticket );
+  oyFilterPlug_Release( &plug );
+
+  array = (oyArray2d_s_*)t->array;
+  channels = oyImage_GetPixelLayout( t->output_image, oyCHANS );
+  if(!channels) channels = 1;
+  if(error <= 0 && array && array->width >= channels)
+  {
+    oyRectangle_s_  roi_= {oyOBJECT_RECTANGLE_S,0,0,0, 0,0,0,0};
+    oyRectangle_s * roi = (oyRectangle_s*)&roi_;
+    oyFilterNodeFused_s f;
+    int row_bytes = array->width * oyDataTypeGetSize( array->t ),
+        tiles_n;
+
+    f.ticket = ticket;
+    f.nodes = nodes;
+    f.plugs = plugs;
+    f.nodes_n = nodes_n;
+    f.rows = array->array2d;
+    f.width = array->width;
+    f.data_type = array->t;
+    f.pix_width = (int)(array->width / channels);
+    f.roi_x = t->output_array_roi->x;
+    f.roi_width = t->output_array_roi->width;
+    oyRectangle_SetByRectangle( roi, (oyRectangle_s*)t->output_array_roi );
+    oyRectangle_Scale( roi, f.pix_width );
+    f.start_y = OY_ROUND(roi_.y);
+    f.height = array->height - f.start_y;
+    f.tile_height = OY_MAX( 1, tile_bytes / row_bytes );
+    f.error = 0;
+
+    tiles_n = f.height > 0 ? (f.height + f.tile_height - 1) / f.tile_height
+                           : 0;
+    if(oy_debug)
+      oyMessageFunc_p( oyMSG_DBG, (oyStruct_s*)ticket, OY_DBG_FORMAT_
+                       "fused %d point filters in %d tiles of %d lines",
+                       OY_DBG_ARGS_, nodes_n, tiles_n, f.tile_height );
+
+    oyParallelFor( tiles_n, oyFilterNode_FusedTiles_, &f, 1 );
+    error = f.error;
+  } else if(error <= 0)
+    error = 1;
+
+  for(i = 0; i < nodes_n; ++i)
+  {
+    oyFilterNode_Release( (oyFilterNode_s**)&nodes[i] );
+    oyFilterPlug_Release( &plugs[i] );
+  }
+  oyFree_m_( nodes );
+  oyFree_m_( plugs );
+  oyFilterNode_Release( (oyFilterNode_s**)&input );
+
+  if(result)
+    *result = error;
+
+  return 2;
+}
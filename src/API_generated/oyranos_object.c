@@ -6,6 +6,7 @@
 #include "oyranos_i18n.h"
 #include "oyranos_module.h"
 #include "oyranos_object.h"
+#include "oyranos_object_internal.h"
 #include "oyranos_string.h"
 
 /** @internal
@@ -527,6 +528,331 @@ int    oyFilterStringMatch           ( const char        * registration,
   return match;
 }
 
+#define oyIsApiNumber_m(c) ((c) >= '4' && (c) <= '9')
+
+/* split one level into keys as done in oyFilterStringMatch() */
+static int oyRegPatternSetKeys_      ( oyRegPattern_s    * p,
+                                       oyRegKey_s        * keys,
+                                       int                 keys_max,
+                                       const char        * level_text,
+                                       int                 level_len,
+                                       char                key_separator,
+                                       int                 flags )
+{
+  int n = oyStringSegmentsN_( level_text, level_len, key_separator ), k;
+
+  for(k = 0; k < n; ++k)
+  {
+    int len = 0;
+    const char * t = oyStringSegmentN_( (char*)level_text, level_len,
+                                        key_separator, k, &len );
+    oyRegKey_s key;
+    const char * r = t, * pt = t;
+    int r_len = len, pt_len = len;
+
+    key.api = 0;
+    key.type = '+';
+
+    if(oyIsApiNumber_m(pt[0]))
+    {
+      key.api = pt[0];
+      ++pt; --pt_len;
+      if(!(flags & OY_SYNTAX_SKIP_PATTERN))
+      {
+        key.type = pt[0];
+        ++pt; --pt_len;
+      }
+    } else
+    if(!(flags & OY_SYNTAX_SKIP_PATTERN) &&
+       (pt[0] == '_' || pt[0] == '-' || pt[0] == '+'))
+    {
+      key.type = pt[0];
+      ++pt; --pt_len;
+    }
+
+    if(oyIsApiNumber_m(r[0]))
+    {
+      r += 2;
+      r_len -= 2;
+    } else
+    if(!(flags & OY_SYNTAX_SKIP_REG) && (r[0] == '_' || r[0] == '-'))
+    {
+      ++r; --r_len;
+    }
+
+    key.r_off = (short)(r - p->text);
+    key.r_len = (short)r_len;
+    key.p_off = (short)(pt - p->text);
+    key.p_len = (short)pt_len;
+
+    if(p->keys_n < keys_max && keys)
+      keys[p->keys_n] = key;
+    ++p->keys_n;
+  }
+
+  return n;
+}
+
+/** @internal
+ *  @brief   split a registration or pattern string
+ *
+ *  No memory is allocated. The keys point into text, which must stay
+ *  valid as long as p is used.
+ *
+ *  @param[out]    p                   the compiled string
+ *  @param[out]    keys                storage for the keys
+ *  @param[in]     keys_max            number of keys fitting into keys
+ *  @param[in]     text                the string to split
+ *  @param[in]     path_separator      as for oyFilterStringMatch()
+ *  @param[in]     key_separator       as for oyFilterStringMatch()
+ *  @param[in]     flags               OY_SYNTAX_SKIP_REG and
+ *                                     OY_SYNTAX_SKIP_PATTERN
+ *  @return                            0 - success; -1 - not supported;
+ *                                     otherwise the needed keys_max
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+int    oyRegPatternSet_              ( oyRegPattern_s    * p,
+                                       oyRegKey_s        * keys,
+                                       int                 keys_max,
+                                       const char        * text,
+                                       char                path_separator,
+                                       char                key_separator,
+                                       int                 flags )
+{
+  int i, len = 0;
+  const char * t;
+
+  if(!p || !text)
+    return -1;
+
+  memset( p, 0, sizeof(oyRegPattern_s) );
+  p->text = text;
+  p->keys = keys;
+  p->levels_n = oyStringSegments_( text, path_separator );
+
+  if(p->levels_n > OY_REG_LEVELS_MAX || oyStrlen_(text) > 0x7ff0)
+    return -1;
+
+  for(i = 0; i < p->levels_n; ++i)
+  {
+    p->level[i] = (unsigned char) p->keys_n;
+    t = oyStringSegment_( (char*)text, path_separator, i, &len );
+    oyRegPatternSetKeys_( p, keys, keys_max, t, len, key_separator, flags );
+  }
+  p->level[i] = (unsigned char) p->keys_n;
+
+  /* a pattern with one level is compared against the key name */
+  if(path_separator == OY_SLASH_C)
+  {
+    p->field[0] = p->level[p->levels_n - 1];
+    p->field[1] = p->level[p->levels_n];
+  } else
+  {
+    p->field[0] = (unsigned char) p->keys_n;
+    t = oyFilterRegistrationToSTextField( text, oyFILTER_REG_MAX, &len );
+    if(t)
+      oyRegPatternSetKeys_( p, keys, keys_max, t, len, key_separator, flags );
+    p->field[1] = (unsigned char) p->keys_n;
+  }
+
+  if(p->keys_n > 255)
+    return -1;
+
+  if(p->keys_n > keys_max)
+    return p->keys_n;
+
+  return 0;
+}
+
+/** @internal
+ *  @brief   compile a registration or pattern into buf
+ *
+ *  The '/' and '.' separators of oyFilterRegistrationMatch() are used.
+ *
+ *  @param[out]    buf                 the storage
+ *  @param[in]     text                the string to split
+ *  @return                            the compiled text in buf or NULL
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+const oyRegPattern_s * oyRegPatternFromText_ (
+                                       oyRegPatternBuf_s * buf,
+                                       const char        * text )
+{
+  if(text && oyRegPatternSet_( &buf->p, buf->keys, OY_REG_KEYS_MAX, text,
+                               OY_SLASH_C, '.', 0 ) == 0)
+    return &buf->p;
+
+  return NULL;
+}
+
+/** @internal
+ *  @brief   compile a registration with '/' and '.' separators
+ *
+ *  The result holds a reference to registration, which must outlive it.
+ *
+ *  @param[in]     registration        the string to split
+ *  @param[in]     allocateFunc        the allocator
+ *  @param[in]     deallocateFunc      the deallocator
+ *  @return                            the compiled registration or NULL
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+oyRegPattern_s * oyRegPatternNew_    ( const char        * registration,
+                                       oyAlloc_f           allocateFunc,
+                                       oyDeAlloc_f         deallocateFunc )
+{
+  oyRegPatternBuf_s buf;
+  const oyRegPattern_s * tmp = oyRegPatternFromText_( &buf, registration );
+  oyRegPattern_s * p = NULL;
+  size_t size;
+
+  if(!tmp)
+    return NULL;
+
+  size = sizeof(oyRegPattern_s) + sizeof(oyRegKey_s) * tmp->keys_n;
+  p = oySlabAllocateFunc_( size, allocateFunc, deallocateFunc );
+  if(!p)
+    return NULL;
+
+  *p = *tmp;
+  p->keys = (oyRegKey_s*) (p + 1);
+  memcpy( p->keys, buf.keys, sizeof(oyRegKey_s) * tmp->keys_n );
+
+  return p;
+}
+
+/** @internal
+ *  @brief   release a oyRegPatternNew_() object
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+void   oyRegPatternRelease_          ( oyRegPattern_s   ** p,
+                                       oyAlloc_f           allocateFunc,
+                                       oyDeAlloc_f         deallocateFunc )
+{
+  if(!p || !*p)
+    return;
+
+  oySlabDeAllocateFunc_( *p, sizeof(oyRegPattern_s) +
+                             sizeof(oyRegKey_s) * (*p)->keys_n,
+                         allocateFunc, deallocateFunc );
+  *p = NULL;
+}
+
+/** @internal
+ *  @brief   compare compiled strings
+ *
+ *  The rules are the ones of oyFilterStringMatch(). No memory is
+ *  allocated.
+ *
+ *  @param         registration        compiled registration
+ *  @param         pattern             compiled pattern
+ *  @param         api_number          select object type
+ *  @param         flags               OY_MATCH_SUB_STRING; the OY_SYNTAX
+ *                                     flags are applied in oyRegPatternSet_()
+ *  @return                            match, useable for ranking
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+int    oyRegPatternMatch_            ( const oyRegPattern_s * registration,
+                                       const oyRegPattern_s * pattern,
+                                       oyOBJECT_e          api_number,
+                                       int                 flags )
+{
+  int     match = 0, match_tmp = 0, i,j,k, api_num = oyOBJECT_NONE;
+  int     (*memmatch) (const void *s1, size_t s1n,
+                       const void *s2, size_t s2n) = oyMemCmp;
+
+  if(flags & OY_MATCH_SUB_STRING)
+    memmatch = (int(*)(const void *,size_t,
+                       const void *,size_t)) oyMemMem;
+
+  if(registration && pattern)
+  {
+    const oyRegPattern_s * reg = registration,
+                         * p = pattern;
+    int reg_n = reg->levels_n,
+        p_n = p->levels_n;
+
+    api_num = oyCMMapiNumberToChar(api_number);
+    match_tmp = 1;
+
+    for( i = 0; i < reg_n && i < p_n; ++i)
+    {
+      int r0, r1, p0 = p->level[i], p1 = p->level[i+1];
+
+      /* allow a key only in *pattern to filter from *registration */
+      if(p_n == 1)
+      {
+        r0 = reg->field[0];
+        r1 = reg->field[1];
+        i = reg_n;
+      } else
+      /* level by level comparision */
+      {
+        r0 = reg->level[i];
+        r1 = reg->level[i+1];
+      }
+
+      if(match_tmp && p1 > p0 && r1 > r0)
+      {
+        for( j = p0; j < p1; ++j)
+        {
+          const oyRegKey_s * pk = &p->keys[j];
+          const char * pc_text = p->text + pk->p_off;
+          int pc_len = pk->p_len;
+
+          match_tmp = 0;
+
+          for( k = r0; k < r1; ++k )
+          {
+            const oyRegKey_s * rk = &reg->keys[k];
+            const char * regc_text = reg->text + rk->r_off;
+            int regc_len = rk->r_len;
+
+            if((!pk->api || api_num == pk->api) &&
+               memmatch( regc_text, regc_len, pc_text, pc_len ) &&
+               (flags & OY_MATCH_SUB_STRING ||
+                regc_len == pc_len || !regc_len || !pc_len))
+            {
+              if(pk->type == '+' ||
+                 pk->type == '_')
+              {
+                ++ match;
+                match_tmp = 1;
+              } else /* if(pk->type == '-') */
+                return 0;
+            }
+          }
+
+          if(pk->type == '+' && !match_tmp)
+            return 0;
+        }
+      }
+    }
+  } else
+    if((flags & OY_MATCH_SUB_STRING) &&
+       registration && !pattern)
+      match = 1;
+
+  if(match_tmp == 1 && !match)
+    match = 1;
+
+  return match;
+}
+
 /** Function oyFilterRegistrationMatch 
  *  @brief   analyse registration string and compare with a given pattern
  *
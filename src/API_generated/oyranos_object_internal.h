@@ -76,6 +76,70 @@ int    oyTextIccDictMatch            ( const char        * text,
                                        char                key_separator );
 int    oyPointerRelease              ( oyPointer         * ptr );
 
+/* --- compiled registration strings --- */
+
+#define OY_REG_LEVELS_MAX 16           /* path levels of a oyRegPattern_s */
+#define OY_REG_KEYS_MAX   64           /* keys for oyRegPattern_s on stack */
+
+/** @internal
+ *  @brief   one key of a compiled registration string
+ *
+ *  The same key is prepared for both sides of a match. Offsets are
+ *  relative to oyRegPattern_s::text.
+ */
+typedef struct {
+  short                r_off;          /**< key start as registration */
+  short                r_len;          /**< key length as registration */
+  short                p_off;          /**< key start as pattern */
+  short                p_len;          /**< key length as pattern */
+  char                 api;            /**< pattern api number '4'-'9' or 0 */
+  char                 type;           /**< pattern match type '+','-','_' */
+} oyRegKey_s;
+
+/** @internal
+ *  @brief   registration string split into levels and keys
+ *
+ *  Comparing two oyRegPattern_s with oyRegPatternMatch_() gives the same
+ *  result like oyFilterStringMatch() on the texts, without scanning them.
+ */
+typedef struct oyRegPattern_s {
+  const char         * text;           /**< the not owned source string */
+  int                  levels_n;       /**< number of path levels */
+  unsigned char        level[OY_REG_LEVELS_MAX+1]; /**< first key per level */
+  unsigned char        field[2];       /**< key range of the key name */
+  int                  keys_n;         /**< number of keys */
+  oyRegKey_s         * keys;           /**< the keys */
+} oyRegPattern_s;
+
+/** @internal
+ *  @brief   storage for a compiled pattern on stack
+ */
+typedef struct {
+  oyRegPattern_s       p;
+  oyRegKey_s           keys[OY_REG_KEYS_MAX];
+} oyRegPatternBuf_s;
+
+int    oyRegPatternSet_              ( oyRegPattern_s    * p,
+                                       oyRegKey_s        * keys,
+                                       int                 keys_max,
+                                       const char        * text,
+                                       char                path_separator,
+                                       char                key_separator,
+                                       int                 flags );
+const oyRegPattern_s * oyRegPatternFromText_ (
+                                       oyRegPatternBuf_s * buf,
+                                       const char        * text );
+oyRegPattern_s * oyRegPatternNew_    ( const char        * registration,
+                                       oyAlloc_f           allocateFunc,
+                                       oyDeAlloc_f         deallocateFunc );
+void   oyRegPatternRelease_          ( oyRegPattern_s   ** p,
+                                       oyAlloc_f           allocateFunc,
+                                       oyDeAlloc_f         deallocateFunc );
+int    oyRegPatternMatch_            ( const oyRegPattern_s * registration,
+                                       const oyRegPattern_s * pattern,
+                                       oyOBJECT_e          api_number,
+                                       int                 flags );
+
 #ifdef __cplusplus
 } /* extern "C" */
 /*}*/ /* namespace oyranos */
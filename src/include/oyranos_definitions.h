@@ -89,6 +89,84 @@
  *  @since 0.1.8
  */
 #define OY_MODULE_PATH                 "OY_MODULE_PATH"
+/** @brief Oyranos cache size environment variable
+ *
+ *  Byte budget for each of the in memory module and profile caches.
+ *
+ *  @see @ref runtime_vars
+ *
+ *  @since 0.9.7
+ */
+#define OY_CACHE_MAX_BYTES             "OY_CACHE_MAX_BYTES"
+/** @brief Oyranos cache entries environment variable
+ *
+ *  Maximum number of entries for each of the in memory module and profile
+ *  caches.
+ *
+ *  @see @ref runtime_vars
+ *
+ *  @since 0.9.7
+ */
+#define OY_CACHE_MAX_ENTRIES           "OY_CACHE_MAX_ENTRIES"
+/** @brief Oyranos device link disk cache environment variable
+ *
+ *  Directory for persistent device links. The value "1" selects the
+ *  users device link cache directory. Unset disables the disk cache.
+ *
+ *  @see @ref runtime_vars
+ *
+ *  @since 0.9.7
+ */
+#define OY_DEVICE_LINK_CACHE_PATH      "OY_DEVICE_LINK_CACHE_PATH"
+/** @brief Oyranos device link disk cache size environment variable
+ *
+ *  Byte budget of the ::OY_DEVICE_LINK_CACHE_PATH directory.
+ *
+ *  @see @ref runtime_vars
+ *
+ *  @since 0.9.7
+ */
+#define OY_DEVICE_LINK_CACHE_MAX_BYTES "OY_DEVICE_LINK_CACHE_MAX_BYTES"
+/** @brief Oyranos profile index environment variable
+ *
+ *  File for the persistent index of installed profiles. Unset selects the
+ *  users cache directory. The value "0" keeps the index in memory only.
+ *
+ *  @see @ref runtime_vars
+ *
+ *  @since 0.9.7
+ */
+#define OY_PROFILE_INDEX_PATH          "OY_PROFILE_INDEX_PATH"
+/** @brief Oyranos worker threads environment variable
+ *
+ *  Number of job worker threads. Unset or "0" selects one less than the
+ *  available CPUs, as limited by the CPU affinity and a cgroup CPU quota.
+ *
+ *  @see @ref runtime_vars
+ *
+ *  @since 0.9.7
+ */
+#define OY_THREADS                     "OY_THREADS"
+/** @brief Oyranos worker threads CPU affinity environment variable
+ *
+ *  CPU list like "0-7,16" to pin the job worker threads to.
+ *
+ *  @see @ref runtime_vars
+ *
+ *  @since 0.9.7
+ */
+#define OY_THREADS_AFFINITY            "OY_THREADS_AFFINITY"
+/** @brief Oyranos fused point filter tile size environment variable
+ *
+ *  Bytes per tile for chains of "pixel=point" filters, which
+ *  oyFilterNode_RunFused() processes in one pass. The default is 262144.
+ *  "0" disables the fusion.
+ *
+ *  @see @ref runtime_vars
+ *
+ *  @since 0.9.7
+ */
+#define OY_FUSED_TILE_BYTES            "OY_FUSED_TILE_BYTES"
 /** @brief Oyranos modules/CMM's suffix after the four byte CMM ID
  *
  *  for instance LittleCMS has ID lcms, thus we get lcms_cmm_module
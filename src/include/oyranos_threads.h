@@ -39,8 +39,13 @@ typedef struct oyJob_s oyJob_s;
  *  A generic job is added to the single job queue with oyJob_Add().
  *  The job queue is worked on by an internal maintained thead.
  *
- *  @version Oyranos: 0.9.6
- *  @date    2016/05/01
+ *  Jobs with a higher oyJob_s::priority are started first. oyJob_DependsOn()
+ *  lets a job wait for other jobs, so a small graph of jobs can be queued
+ *  at once. Jobs sharing a oyJob_s::group can be joined with
+ *  oyJobGroupWait(). oyJob_Cancel() asks jobs to stop.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
  *  @since   2014/01/27 (Oyranos: 0.9.5)
  */
 struct oyJob_s {
@@ -69,9 +74,19 @@ struct oyJob_s {
   int thread_id_;                      /**< thread plug-in provided ID; keep read only */
   int status_done_;                    /**< Oyranos internal variable */
   int flags_;                          /**< oyJob_Add() provided flags; keep read only */
+
+  /* scheduling */
+  int priority;                        /**< @brief jobs with a higher value start first; default 0 */
+  int group;                           /**< @brief group ID for oyJobGroupWait() and oyJob_Cancel(); 0 means no group */
+  int status_cancel_;                  /**< set by oyJob_Cancel(); poll with oyJob_IsCancelled() */
+  int * depends_;                      /**< IDs of jobs to wait for; set with oyJob_DependsOn() */
+  int depends_n_;                      /**< number of oyJob_s::depends_ */
 };
 oyJob_s *         oyJob_New          ( oyObject_s          object );
 void              oyJob_Release      ( oyJob_s          ** job );
+int               oyJob_DependsOn    ( oyJob_s           * job,
+                                       int                 job_id );
+int               oyJob_IsCancelled  ( oyJob_s           * job );
 
 #define oyJOB_ADD_PERSISTENT_JOB 0x01
 typedef int      (*oyJob_Add_f)      ( oyJob_s          ** job,
@@ -83,17 +98,43 @@ typedef int      (*oyMsg_Add_f)      ( oyJob_s           * job,
                                        double              progress_zero_till_one,
                                        char             ** status_text );
 typedef void     (*oyJobResult_f)    ( void );
+typedef int      (*oyJobResultWait_f)( double              seconds );
+typedef int      (*oyJob_Cancel_f)   ( int                 job_id,
+                                       int                 group );
+typedef int      (*oyJobGroupWait_f) ( int                 group,
+                                       double              seconds );
+#define oyJOB_POOL_SHUTDOWN 0x01
+typedef int      (*oyJobPool_f)      ( int                 workers,
+                                       const char        * cpus,
+                                       int                 flags );
+typedef void     (*oyParallelBody_f) ( int                 start,
+                                       int                 end,
+                                       void              * data );
+typedef int      (*oyParallelFor_f)  ( int                 n,
+                                       oyParallelBody_f    body,
+                                       void              * data,
+                                       int                 grain );
 
 extern oyJob_Add_f oyJob_Add;
 extern oyJob_Get_f oyJob_Get;
 extern oyMsg_Add_f oyMsg_Add;
 extern oyJobResult_f oyJobResult;
+extern oyJobResultWait_f oyJobResultWait;
+extern oyJob_Cancel_f oyJob_Cancel;
+extern oyJobGroupWait_f oyJobGroupWait;
+extern oyJobPool_f oyJobPool;
+extern oyParallelFor_f oyParallelFor;
 
 void              oyJobHandlingSet   ( oyJob_Add_f         jadd,
                                        oyJob_Get_f         jget,
                                        oyMsg_Add_f         madd,
                                        oyJobResult_f       result,
                                        const char        * nick );
+void              oyJobResultWaitSet ( oyJobResultWait_f   wait );
+void              oyJobSchedulingSet ( oyJob_Cancel_f      cancel,
+                                       oyJobGroupWait_f    group_wait );
+void              oyJobPoolSet       ( oyJobPool_f         pool );
+void              oyParallelForSet   ( oyParallelFor_f     parallel_for );
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -17,10 +17,16 @@
 #ifndef OYRANOS_CACHE_H
 #define OYRANOS_CACHE_H
 
+#include "oyHash_s.h"
 #include "oyProfile_s_.h"
 #include "oyProfiles_s.h"
 #include "oyOptions_s.h"
 #include "oyStructList_s_.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
 extern oyStructList_s_ * oy_profile_s_file_cache_;
 extern oyStructList_s  * oy_cmm_cache_;
 extern oyStructList_s  * oy_cmm_infos_;
@@ -32,4 +38,28 @@ extern oyOptions_s     * oy_db_cache_;
 int      oyObjectUsedByCache_        ( int                 id );
 int *    get_oy_db_cache_init_();
 
+void     oyCacheSetLimits_           ( size_t              max_bytes,
+                                       int                 max_entries );
+void     oyCacheGetLimits_           ( size_t            * max_bytes,
+                                       int               * max_entries );
+size_t   oyCacheEntryGetSize_        ( oyHash_s          * entry );
+
+const char * oyCacheDiskGetDir_      ( void );
+void     oyCacheDiskSetDir_          ( const char        * dir );
+oyPointer oyCacheDiskRead_           ( oyHash_s          * entry,
+                                       const char        * type,
+                                       size_t            * size,
+                                       oyAlloc_f           allocateFunc );
+int      oyCacheDiskWrite_           ( oyHash_s          * entry,
+                                       const char        * type,
+                                       oyPointer           ptr,
+                                       size_t              size );
+int      oyCacheDiskTrim_            ( const char        * dir,
+                                       size_t              max_bytes,
+                                       long                max_age );
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif /* __cplusplus */
+
 #endif /* OYRANOS_CACHE_H */
@@ -42,6 +42,15 @@ void* oyAllocateFunc_           (size_t        size);
 void* oyAllocateWrapFunc_       (size_t        size,
                                  oyAlloc_f     allocate_func);
 void  oyDeAllocateFunc_         (void *        data);
+void* oySlabAllocateFunc_       (size_t        size,
+                                 oyAlloc_f     allocate_func,
+                                 oyDeAlloc_f   deallocate_func);
+void  oySlabDeAllocateFunc_     (void *        block,
+                                 size_t        size,
+                                 oyAlloc_f     allocate_func,
+                                 oyDeAlloc_f   deallocate_func);
+void  oySlabGetCounts_          (size_t      * allocs,
+                                 size_t      * reuses);
 
 
 
@@ -87,6 +96,8 @@ int     oyRecursivePaths_      (int (*doInPath) (oyFileList_s *,
                                 struct oyFileList_s        * data,
                                 const char ** path_names,
                                 int           path_count);
+int     oyStrcmpWrap           ( const void        * a,
+                                 const void        * b );
 char **            oyGetFiles_       ( const char        * path,
                                        int               * size );
 
@@ -102,6 +113,7 @@ int   oyWriteMemToFile_ (const char* name, const void* mem, size_t size);
 #define OY_FILE_APPEND 0x01
 #define OY_FILE_NAME_SEARCH 0x02
 #define OY_FILE_TEMP_DIR 0x04
+char * oyGetTempSiblingName_         ( const char        * file_name );
 char * oyGetTempFileName_            ( const char        * name,
                                        const char        * end_part,
                                        uint32_t            flags,
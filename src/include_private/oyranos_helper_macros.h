@@ -159,6 +159,25 @@ char    oyToupper_( char c_ );
 /* positive rounding */
 #define OY_ROUNDp(a)   ((int) ((a)+.5))
 
+/* --- atomic counters --- */
+
+/* oyAtomicAdd_m_ (int*, int) returns the new value */
+#if defined(__GNUC__) || defined(__clang__)
+#define oyAtomicAdd_m_(ptr_, n_) __atomic_add_fetch( (ptr_), (n_), __ATOMIC_ACQ_REL )
+#define oyAtomicGet_m_(ptr_)     __atomic_load_n( (ptr_), __ATOMIC_ACQUIRE )
+#elif defined(_MSC_VER)
+#include <intrin.h>
+#define oyAtomicAdd_m_(ptr_, n_) (_InterlockedExchangeAdd( (volatile long*)(ptr_), (n_) ) + (n_))
+#define oyAtomicGet_m_(ptr_)     _InterlockedOr( (volatile long*)(ptr_), 0 )
+#else
+/* other compilers serialise on one mutex, see oyranos_helper.c */
+#define OY_ATOMIC_LOCKED_ 1
+int     oyAtomicAdd_ ( volatile int * ptr_, int n_ );
+int     oyAtomicGet_ ( volatile int * ptr_ );
+#define oyAtomicAdd_m_(ptr_, n_) oyAtomicAdd_( (ptr_), (n_) )
+#define oyAtomicGet_m_(ptr_)     oyAtomicGet_( (ptr_) )
+#endif
+
 /* --- miscellaneous helpers --- */
 
 #ifndef TRUE
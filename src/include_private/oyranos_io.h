@@ -52,6 +52,7 @@ extern "C" {
 
 #define OY_WEB_RGB "sRGB.icc"
 #define OY_COLOR_DL_CACHE_PATH "openicc/device_link"
+#define OY_COLOR_PROFILE_INDEX "openicc/profile_index"
 
 #if defined(__APPLE__)
   /* Apples ColorSync default paths */
@@ -67,6 +68,7 @@ extern "C" {
 # define CSNetworkPath                 "/Network/Library"  OS_ICC_PATH
 
 # define OS_CACHE_PATH       "/Caches/org.freedesktop." OY_COLOR_DL_CACHE_PATH
+# define OS_PROFILE_INDEX_PATH "/Caches/org.freedesktop." OY_COLOR_PROFILE_INDEX
 # define OS_SETTING_PATH     "/Preferences/org.freedesktop.openicc/" OY_SETTINGSDIRNAME
 # define OS_SETTINGS_USER_DIR          OS_USER_DIR           OS_SETTING_PATH
 # define OS_SETTINGS_SYSTEM_DIR        OS_GLOBAL_DIR         OS_SETTING_PATH
@@ -84,6 +86,7 @@ extern "C" {
 # define OS_ICC_MACHINE_DIR            OS_MACHINE_DIR "lib/" OS_ICC_PATH
 
 # define OS_CACHE_PATH       "cache/color/" OY_COLOR_DL_CACHE_PATH
+# define OS_PROFILE_INDEX_PATH "cache/color/" OY_COLOR_PROFILE_INDEX
 # define OS_SETTING_PATH     "color/" OY_SETTINGSDIRNAME
 # define OS_SETTINGS_USER_DIR          OS_USER_DIR "config/" OS_SETTING_PATH
 # define OS_SETTINGS_SYSTEM_DIR        OS_GLOBAL_DIR         OS_SETTING_PATH
@@ -93,6 +96,7 @@ extern "C" {
 # define OS_DL_CACHE_USER_DIR          OS_USER_DIR           OS_CACHE_PATH
 # define OS_DL_CACHE_SYSTEM_DIR        OS_MACHINE_DIR        OS_CACHE_PATH
 # define OS_DL_CACHE_MACHINE_DIR       OS_MACHINE_DIR        OS_CACHE_PATH
+# define OS_PROFILE_INDEX_USER_FILE    OS_USER_DIR           OS_PROFILE_INDEX_PATH
 
 
 extern int oy_warn_;
@@ -109,6 +113,17 @@ char *   oyGetPathFromProfileName_   ( const char        * profilename,
 char **  oyProfileListGet_           ( const char        * colorsig,
                                        uint32_t            flags,
                                        uint32_t          * size );
+char **  oyProfileIndexListGet_      ( const char        * colorsig,
+                                       uint32_t            flags,
+                                       char            *** descriptions,
+                                       uint32_t          * size );
+char **  oyProfileIndexFindMD5_      ( const uint32_t    * md5,
+                                       uint32_t          * count );
+char **  oyProfileIndexFindDescription_(const char       * description,
+                                       uint32_t          * count );
+const char * oyProfileIndexGetFile_  ( void );
+void     oyProfileIndexSetFile_      ( const char        * file );
+void     oyProfileIndexRelease_      ( void );
 
 size_t	 oyGetProfileSize_           ( const char        * fullFileName );
 void *   oyGetProfileBlock_          ( const char        * fullFileName,
@@ -57,9 +57,6 @@
 #define DEBUG_OBJECT 1
 #endif
 
-#ifndef NO_OPT
-#define OY_USE_OBJECT_POOL_ 0
-#endif
 
 
 
@@ -14,18 +14,24 @@
  */
 
 #include <assert.h>
+#include <dirent.h>
 #include <errno.h>
 #include <sys/stat.h>
 #include <stdlib.h>
 #include <stdio.h>
 #include <string.h>
 #include <math.h>
+#include <time.h>
+#ifdef _OPENMP
+#include <omp.h>                       /* omp_get_num_procs() */
+#endif
 
 #include "oyranos_config_internal.h"
 #include "oyranos.h"
 #include "oyranos_check.h"
 #include "oyranos_debug.h"
 #include "oyranos_helper.h"
+#include "oyranos_icc.h"
 #include "oyranos_internal.h"
 #include "oyranos_io.h"
 #include "oyranos_sentinel.h"
@@ -33,6 +39,8 @@
 #include "oyranos_xml.h"
 
 #include "oyProfile_s.h"
+#include "oyranos_threads.h"
+#include "lookup3.h"
 
 /* --- Helpers  --- */
 
@@ -428,48 +436,1274 @@ int oyPolicyListCb_ (oyFileList_s * data,
 }
 
 
-char **  oyProfileListGet_           ( const char        * colorsig,
+/* persistent profile index */
+
+#define oyPROFILE_INDEX_MAGIC   "OYPI 1"
+#define oyPROFILE_INDEX_HEADER  0x01   /* a ICC header was found */
+#define oyPROFILE_INDEX_DETAILS 0x02   /* md5 and description are valid */
+#define oyPROFILE_INDEX_PENDING 0x04   /* found in a directory; not checked */
+#define oyPROFILE_INDEX_GONE    0x08   /* not a readable file */
+#define oyPROFILE_INDEX_MAX_DEPTH 64
+#define oyPROFILE_INDEX_SHARE   64     /* minimal pending files per thread */
+
+typedef struct {
+  char        * path;                  /* full file name */
+  long long     size;                  /* file size */
+  long long     mtime;                 /* file mtime; 0 - recheck next time */
+  int           flags;                 /* oyPROFILE_INDEX_HEADER | _DETAILS */
+  int           moved;                 /* taken over by a newer index */
+  int           reuse;                 /* old index position + 1 */
+  uint32_t      md5[4];                /* computed profile ID */
+  char          header[128];           /* ICC header */
+  char        * description;
+} oyProfileIndexEntry_s;
+
+typedef struct {
+  char        * path;                  /* full directory name */
+  long long     mtime;                 /* dir mtime; 0 - rescan next time */
+} oyProfileIndexDir_s;
+
+typedef struct {
+  uint32_t      key;                   /* oy_hashlittle() of the key */
+  int           pos;                   /* file position + 1; 0 - empty */
+} oyProfileIndexSlot_s;
+
+typedef struct {
+  oyProfileIndexEntry_s * files;
+  int           files_n;
+  int           files_reserved;
+  oyProfileIndexDir_s * dirs;
+  int           dirs_n;
+  int           dirs_reserved;
+  int           changed;
+  time_t        now;
+  char       ** roots;                 /* the scanned profile paths */
+  int           roots_n;
+  oyProfileIndexSlot_s * md5_slots;    /* md5 and ICC ID -> file */
+  uint32_t      md5_size;
+  oyProfileIndexSlot_s * text_slots;   /* description -> file */
+  uint32_t      text_size;
+} oyProfileIndex_s;
+
+static oyProfileIndex_s oy_profile_index_ = {NULL,0,0,NULL,0,0,0,0,
+                                             NULL,0,NULL,0,NULL,0};
+static int    oy_profile_index_loaded_ = 0;
+static int    oy_profile_index_lock_ = 0;   /* atomic; 1 - index is in use */
+static char * oy_profile_index_file_ = NULL;
+static int    oy_profile_index_file_init_ = 0;
+
+/** @internal
+ *  @brief get the persistent profile index file name
+ *
+ *  ::OY_PROFILE_INDEX_PATH names the file. Unset selects the users cache
+ *  directory and "0" keeps the index in memory only.
+ *
+ *  @return                            the file name or NULL if not persistent
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+const char * oyProfileIndexGetFile_  ( void )
+{
+  if(!oy_profile_index_file_init_)
+  {
+    const char * t = getenv(OY_PROFILE_INDEX_PATH);
+
+    if(!t || !t[0])
+      oy_profile_index_file_ = oyResolveDirFileName_( OS_PROFILE_INDEX_USER_FILE );
+    else if(strcmp( t, "0" ) != 0)
+      oy_profile_index_file_ = oyResolveDirFileName_( t );
+
+    oy_profile_index_file_init_ = 1;
+  }
+
+  return oy_profile_index_file_;
+}
+
+/* The index is used by one thread at a time. A nested caller, e.g. from
+ * the threads handler initialisation during a scan, or a concurrent one
+ * does not wait and walks the profile paths itself. */
+static int oyProfileIndexTryLock_    ( void )
+{
+  if(oyAtomicAdd_m_( &oy_profile_index_lock_, 1 ) == 1)
+    return 1;
+
+  oyAtomicAdd_m_( &oy_profile_index_lock_, -1 );
+  return 0;
+}
+static void oyProfileIndexUnLock_    ( void )
+{
+  oyAtomicAdd_m_( &oy_profile_index_lock_, -1 );
+}
+
+/* the lookup tables are build on demand */
+static void oyProfileIndexDropTables_( oyProfileIndex_s  * index )
+{
+  if(index->md5_slots)
+    oyDeAllocateFunc_( index->md5_slots );
+  if(index->text_slots)
+    oyDeAllocateFunc_( index->text_slots );
+  index->md5_slots = index->text_slots = NULL;
+  index->md5_size = index->text_size = 0;
+}
+
+static void oyProfileIndexClear_     ( oyProfileIndex_s  * index )
+{
+  int i;
+
+  for(i = 0; i < index->files_n; ++i)
+    if(!index->files[i].moved)
+    {
+      oyDeAllocateFunc_( index->files[i].path );
+      if(index->files[i].description)
+        oyDeAllocateFunc_( index->files[i].description );
+    }
+  for(i = 0; i < index->dirs_n; ++i)
+    oyDeAllocateFunc_( index->dirs[i].path );
+  if(index->files)
+    oyDeAllocateFunc_( index->files );
+  if(index->dirs)
+    oyDeAllocateFunc_( index->dirs );
+  if(index->roots)
+    oyStringListRelease_( &index->roots, index->roots_n, oyDeAllocateFunc_ );
+  oyProfileIndexDropTables_( index );
+  memset( index, 0, sizeof(oyProfileIndex_s) );
+}
+
+/** @internal
+ *  @brief set the persistent profile index file name
+ *
+ *  The value overrides ::OY_PROFILE_INDEX_PATH. The in memory index is
+ *  dropped and will be read from the new file.
+ *
+ *  @param[in]     file                the file name; NULL - memory only
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+void     oyProfileIndexSetFile_      ( const char        * file )
+{
+  if(!oyProfileIndexTryLock_())
+  {
+    WARNc1_S( "profile index in use; file not changed: %s",
+              oyNoEmptyString_m_( file ) );
+    return;
+  }
+
+  oyProfileIndexGetFile_();
+  if(oy_profile_index_file_)
+    oyFree_m_( oy_profile_index_file_ );
+  if(file)
+    oy_profile_index_file_ = oyResolveDirFileName_( file );
+  oyProfileIndexClear_( &oy_profile_index_ );
+  oy_profile_index_loaded_ = 0;
+
+  oyProfileIndexUnLock_();
+}
+
+/** @internal
+ *  @brief release the in memory profile index
+ *
+ *  A index in use by a other thread is kept.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+void     oyProfileIndexRelease_      ( void )
+{
+  if(!oyProfileIndexTryLock_())
+    return;
+
+  oyProfileIndexClear_( &oy_profile_index_ );
+  oy_profile_index_loaded_ = 0;
+
+  oyProfileIndexUnLock_();
+}
+
+static oyProfileIndexEntry_s * oyProfileIndexAddFile_ (
+                                       oyProfileIndex_s  * index )
+{
+  if(index->files_n >= index->files_reserved)
+  {
+    int n = index->files_reserved ? index->files_reserved * 2 : 256;
+    oyProfileIndexEntry_s * files = (oyProfileIndexEntry_s*)
+                        oyAllocateFunc_( sizeof(oyProfileIndexEntry_s) * n );
+    if(!files)
+      return NULL;
+    if(index->files_n)
+      memcpy( files, index->files,
+              sizeof(oyProfileIndexEntry_s) * index->files_n );
+    if(index->files)
+      oyDeAllocateFunc_( index->files );
+    index->files = files;
+    index->files_reserved = n;
+  }
+
+  memset( &index->files[index->files_n], 0, sizeof(oyProfileIndexEntry_s) );
+  return &index->files[index->files_n++];
+}
+
+static oyProfileIndexDir_s * oyProfileIndexAddDir_ (
+                                       oyProfileIndex_s  * index,
+                                       const char        * path,
+                                       long long           mtime )
+{
+  oyProfileIndexDir_s * dir;
+
+  if(index->dirs_n >= index->dirs_reserved)
+  {
+    int n = index->dirs_reserved ? index->dirs_reserved * 2 : 16;
+    oyProfileIndexDir_s * dirs = (oyProfileIndexDir_s*)
+                        oyAllocateFunc_( sizeof(oyProfileIndexDir_s) * n );
+    if(!dirs)
+      return NULL;
+    if(index->dirs_n)
+      memcpy( dirs, index->dirs, sizeof(oyProfileIndexDir_s) * index->dirs_n );
+    if(index->dirs)
+      oyDeAllocateFunc_( index->dirs );
+    index->dirs = dirs;
+    index->dirs_reserved = n;
+  }
+
+  dir = &index->dirs[index->dirs_n++];
+  dir->path = oyStringCopy_( path, oyAllocateFunc_ );
+  dir->mtime = mtime;
+  return dir;
+}
+
+/* both record types start with the path */
+static int oyProfileIndexComparePath_( const void        * a,
+                                       const void        * b )
+{
+  return strcmp( *(const char * const *)a, *(const char * const *)b );
+}
+
+/* sort by file name like oyRecursivePaths_(), then by path */
+static int oyProfileIndexCompareName_( const void        * a,
+                                       const void        * b )
+{
+  int r = oyStrcmpWrap( a, b );
+  return r ? r : oyProfileIndexComparePath_( a, b );
+}
+
+/* first position in a path sorted array, which is not less than key */
+static int oyProfileIndexLowerBound_ ( const void        * base,
+                                       int                 n,
+                                       size_t              stride,
+                                       const char        * key )
+{
+  int lo = 0, hi = n;
+
+  while(lo < hi)
+  {
+    int mid = (lo + hi) / 2;
+    const char * path = *(const char * const *)((const char*)base + mid * stride);
+    if(strcmp( path, key ) < 0)
+      lo = mid + 1;
+    else
+      hi = mid;
+  }
+
+  return lo;
+}
+
+/* is path a direct child of dir ? */
+static int oyProfileIndexIsChild_    ( const char        * path,
+                                       const char        * dir,
+                                       size_t              dir_len )
+{
+  return strncmp( path, dir, dir_len ) == 0 &&
+         path[dir_len] == OY_SLASH_C &&
+         path[dir_len+1] &&
+         strchr( &path[dir_len+1], OY_SLASH_C ) == NULL;
+}
+
+static void oyProfileIndexReadHeader_( oyProfileIndexEntry_s * entry )
+{
+  FILE * fp = fopen( entry->path, "rb" );
+
+  entry->flags = 0;
+  if(fp)
+  {
+    if(fread( entry->header, 1, 128, fp ) == 128 &&
+       oyCheckProfileMem_( entry->header, 128, NULL, 0 ) == 0)
+      entry->flags |= oyPROFILE_INDEX_HEADER;
+    fclose( fp );
+  }
+}
+
+/* fill md5 and description from the loaded profile */
+static void oyProfileIndexReadDetails_( oyProfileIndexEntry_s * entry )
+{
+  oyProfile_s * p;
+  const char * t;
+
+  if(!(entry->flags & oyPROFILE_INDEX_HEADER) ||
+     entry->flags & oyPROFILE_INDEX_DETAILS)
+    return;
+
+  /* the file cache can hold a older version of the file */
+  p = oyProfile_FromFile( entry->path, OY_NO_CACHE_READ | OY_NO_CACHE_WRITE |
+                                       OY_COMPUTE, 0 );
+  if(p)
+  {
+    oyProfile_GetMD5( p, OY_COMPUTE, entry->md5 );
+    t = oyProfile_GetText( p, oyNAME_DESCRIPTION );
+    entry->description = oyStringCopy_( t ? t : "", oyAllocateFunc_ );
+    oyProfile_Release( &p );
+  } else
+    entry->description = oyStringCopy_( "", oyAllocateFunc_ );
+
+  entry->flags |= oyPROFILE_INDEX_DETAILS;
+  oy_profile_index_.changed = 1;
+  oyProfileIndexDropTables_( &oy_profile_index_ );
+}
+
+static void oyProfileIndexScanDir_   ( oyProfileIndex_s  * old,
+                                       oyProfileIndex_s  * index,
+                                       const char        * path,
+                                       int                 depth )
+{
+  struct stat st;
+  oyProfileIndexDir_s * known = NULL;
+  long long mtime;
+  size_t len = strlen( path );
+  int i, pos, slot;
+
+  if(depth >= oyPROFILE_INDEX_MAX_DEPTH)
+  {
+    WARNc1_S("max path depth reached: %d", oyPROFILE_INDEX_MAX_DEPTH);
+    return;
+  }
+
+  /* a directory can be reached from more than one search path */
+  for(i = 0; i < index->dirs_n; ++i)
+    if(strcmp( index->dirs[i].path, path ) == 0)
+      return;
+
+  if(stat( path, &st ) != 0 || !S_ISDIR( st.st_mode ))
+    return;
+
+  mtime = (long long) st.st_mtime;
+  /* a change within the same second as this scan might be missed */
+  if(mtime >= (long long) index->now - 1)
+    mtime = 0;
+
+  pos = oyProfileIndexLowerBound_( old->dirs, old->dirs_n,
+                                   sizeof(oyProfileIndexDir_s), path );
+  if(pos < old->dirs_n && strcmp( old->dirs[pos].path, path ) == 0)
+    known = &old->dirs[pos];
+
+  if(!oyProfileIndexAddDir_( index, path, mtime ))
+    return;
+  /* subdirectories are appended while reading this one */
+  slot = index->dirs_n - 1;
+
+  if(known && known->mtime && known->mtime == mtime)
+  {
+    /* the entry list is unchanged; a file overwritten in place keeps the
+     * directory mtime, so oyProfileIndexCheckAll_() compares each of them */
+    pos = oyProfileIndexLowerBound_( old->files, old->files_n,
+                                     sizeof(oyProfileIndexEntry_s), path );
+    for(i = pos; i < old->files_n &&
+                 strncmp( old->files[i].path, path, len ) == 0; ++i)
+    {
+      oyProfileIndexEntry_s * e;
+      if(old->files[i].moved ||
+         !oyProfileIndexIsChild_( old->files[i].path, path, len ))
+        continue;
+      e = oyProfileIndexAddFile_( index );
+      if(!e) return;
+      e->path = oyStringCopy_( old->files[i].path, oyAllocateFunc_ );
+      e->flags = oyPROFILE_INDEX_PENDING;
+    }
+
+    /* and visit the known subdirectories */
+    pos = oyProfileIndexLowerBound_( old->dirs, old->dirs_n,
+                                     sizeof(oyProfileIndexDir_s), path );
+    for(i = pos; i < old->dirs_n &&
+                 strncmp( old->dirs[i].path, path, len ) == 0; ++i)
+      if(oyProfileIndexIsChild_( old->dirs[i].path, path, len ))
+        oyProfileIndexScanDir_( old, index, old->dirs[i].path, depth + 1 );
+  } else
+  {
+    DIR * dir = opendir( path );
+    struct dirent * entry;
+
+    index->changed = 1;
+    if(!dir)
+    {
+      WARNc2_S("\"%s\" %s", path, _("path is not readable"));
+      return;
+    }
+
+    while((entry = readdir( dir )) != NULL)
+    {
+      char * name = NULL;
+      oyProfileIndexEntry_s * e;
+      int is_dir = 0, is_file = 0;
+
+      if(strcmp( entry->d_name, "." ) == 0 ||
+         strcmp( entry->d_name, ".." ) == 0)
+        continue;
+
+      oyStringAddPrintf( &name, oyAllocateFunc_, oyDeAllocateFunc_,
+                         "%s%s%s", path, OY_SLASH, entry->d_name );
+
+#if defined(_DIRENT_HAVE_D_TYPE)
+      /* spare the stat() for plain files and directories */
+      if(entry->d_type == DT_DIR)
+        is_dir = 1;
+      else if(entry->d_type == DT_REG)
+        is_file = 1;
+      else
+#endif
+      if(stat( name, &st ) == 0)
+      {
+        is_dir = S_ISDIR( st.st_mode );
+        is_file = S_ISREG( st.st_mode );
+      }
+
+      if(is_dir)
+      {
+        oyProfileIndexScanDir_( old, index, name, depth + 1 );
+        oyFree_m_( name );
+        continue;
+      }
+
+      if(!is_file)
+      {
+        oyFree_m_( name );
+        continue;
+      }
+
+      /* such names can not be stored; rescan this directory next time */
+      if(strpbrk( entry->d_name, "\t\n" ))
+        index->dirs[slot].mtime = 0;
+
+      e = oyProfileIndexAddFile_( index );
+      if(!e)
+      {
+        oyFree_m_( name );
+        break;
+      }
+
+      /* stat() and header reading follow in oyProfileIndexCheckAll_() */
+      e->path = name;
+      e->flags = oyPROFILE_INDEX_PENDING;
+    }
+
+    closedir( dir );
+  }
+}
+
+/* stat a pending file; find it in the old index or read its header */
+static void oyProfileIndexCheck_     ( oyProfileIndex_s  * old,
+                                       oyProfileIndexEntry_s * e,
+                                       time_t              now )
+{
+  struct stat st;
+  int pos;
+
+  if(stat( e->path, &st ) != 0 || !S_ISREG( st.st_mode ))
+  {
+    e->flags = oyPROFILE_INDEX_GONE;
+    return;
+  }
+
+  /* the old index is only read here */
+  pos = oyProfileIndexLowerBound_( old->files, old->files_n,
+                                   sizeof(oyProfileIndexEntry_s), e->path );
+  if(pos < old->files_n && !old->files[pos].moved &&
+     strcmp( old->files[pos].path, e->path ) == 0 &&
+     old->files[pos].mtime &&
+     old->files[pos].mtime == (long long) st.st_mtime &&
+     old->files[pos].size == (long long) st.st_size)
+  {
+    e->reuse = pos + 1;
+    e->flags = 0;
+    return;
+  }
+
+  e->size = (long long) st.st_size;
+  e->mtime = (long long) st.st_mtime;
+  if(e->mtime >= (long long) now - 1)
+    e->mtime = 0;
+  oyProfileIndexReadHeader_( e );
+}
+
+/* pending files for oyParallelFor() */
+typedef struct {
+  oyProfileIndex_s  * old;
+  oyProfileIndexEntry_s ** pending;
+  time_t              now;
+} oyProfileIndexPending_s;
+
+static void oyProfileIndexCheckRange_( int                 start,
+                                       int                 end,
+                                       void              * data )
+{
+  oyProfileIndexPending_s * t = (oyProfileIndexPending_s*) data;
+  int i;
+
+  for(i = start; i < end; ++i)
+    oyProfileIndexCheck_( t->old, t->pending[i], t->now );
+}
+
+/* check all pending files, take over unchanged ones from the old index and
+ * remove the vanished ones */
+static void oyProfileIndexCheckAll_  ( oyProfileIndex_s  * old,
+                                       oyProfileIndex_s  * index )
+{
+  oyProfileIndexEntry_s ** pending = NULL;
+  int pending_n = 0, threads, grain, i, n;
+
+  for(i = 0; i < index->files_n; ++i)
+    if(index->files[i].flags & oyPROFILE_INDEX_PENDING)
+      ++pending_n;
+  if(!pending_n)
+    return;
+
+  pending = (oyProfileIndexEntry_s**) oyAllocateFunc_( sizeof(void*) *
+                                                       pending_n );
+  if(!pending)
+    return;
+  for(i = 0, n = 0; i < index->files_n; ++i)
+    if(index->files[i].flags & oyPROFILE_INDEX_PENDING)
+      pending[n++] = &index->files[i];
+
+  threads = oyJobPool( -1, NULL, 0 ) + 1;
+  if(threads <= 1)
+  {
+#if defined(_OPENMP)
+    threads = omp_get_num_procs();
+#else
+    threads = 1;
+#endif
+  }
+  /* file system latency dominates; spread larger scans over the workers */
+  grain = OY_MAX( (pending_n + threads - 1) / threads, oyPROFILE_INDEX_SHARE );
+
+  {
+    oyProfileIndexPending_s t = { old, pending, index->now };
+    oyParallelFor( pending_n, oyProfileIndexCheckRange_, &t, grain );
+  }
+
+  oyDeAllocateFunc_( pending );
+
+  for(i = 0, n = 0; i < index->files_n; ++i)
+  {
+    oyProfileIndexEntry_s * e = &index->files[i];
+
+    if(e->flags & oyPROFILE_INDEX_GONE)
+    {
+      oyDeAllocateFunc_( e->path );
+      continue;
+    }
+
+    if(e->reuse)
+    {
+      int pos = e->reuse - 1;
+      oyDeAllocateFunc_( e->path );
+      *e = old->files[pos];
+      old->files[pos].moved = 1;
+    }
+
+    index->files[n++] = *e;
+  }
+  index->files_n = n;
+}
+
+static void oyProfileIndexRead_      ( oyProfileIndex_s  * index,
+                                       const char        * file_name )
+{
+  size_t size = 0;
+  char * text = NULL, * line, * next;
+
+  if(file_name && oyIsFile_( file_name ))
+    text = oyReadFileToMem_( file_name, &size, oyAllocateFunc_ );
+  if(!text)
+    return;
+
+  if(size < strlen(oyPROFILE_INDEX_MAGIC) ||
+     memcmp( text, oyPROFILE_INDEX_MAGIC, strlen(oyPROFILE_INDEX_MAGIC) ) != 0)
+  {
+    oyFree_m_( text );
+    return;
+  }
+
+  /* the buffer is zero terminated behind size */
+  for(line = text; line && line < text + size; line = next)
+  {
+    char * tab;
+    next = strchr( line, '\n' );
+    if(next)
+      *next++ = '\000';
+
+    if(line[0] == 'd' && line[1] == ' ')
+    {
+      long long mtime = 0;
+      int n = 0;
+      if(sscanf( line, "d %lld %n", &mtime, &n ) == 1 && n && line[n])
+        oyProfileIndexAddDir_( index, &line[n], mtime );
+    } else
+    if(line[0] == 'f' && line[1] == ' ')
+    {
+      oyProfileIndexEntry_s e;
+      char md5[33], header[257];
+      int n = 0, i;
+
+      memset( &e, 0, sizeof(e) );
+      if(sscanf( line, "f %lld %lld %d %32s %256s %n", &e.size, &e.mtime,
+                 &e.flags, md5, header, &n ) != 5 || !n ||
+         strlen(md5) != 32 || strlen(header) != 256)
+        continue;
+
+      for(i = 0; i < 4; ++i)
+      {
+        char word[9];
+        memcpy( word, &md5[i*8], 8 ); word[8] = '\000';
+        e.md5[i] = (uint32_t) strtoul( word, NULL, 16 );
+      }
+      for(i = 0; i < 128; ++i)
+      {
+        char byte[3] = { header[i*2], header[i*2+1], '\000' };
+        e.header[i] = (char) strtoul( byte, NULL, 16 );
+      }
+
+      tab = strchr( &line[n], '\t' );
+      if(tab)
+        *tab++ = '\000';
+      if(!line[n])
+        continue;
+
+      e.path = oyStringCopy_( &line[n], oyAllocateFunc_ );
+      if(e.flags & oyPROFILE_INDEX_DETAILS)
+        e.description = oyStringCopy_( tab ? tab : "", oyAllocateFunc_ );
+      {
+        oyProfileIndexEntry_s * entry = oyProfileIndexAddFile_( index );
+        if(entry)
+          *entry = e;
+      }
+    }
+  }
+
+  oyFree_m_( text );
+
+  qsort( index->files, index->files_n, sizeof(oyProfileIndexEntry_s),
+         oyProfileIndexComparePath_ );
+  qsort( index->dirs, index->dirs_n, sizeof(oyProfileIndexDir_s),
+         oyProfileIndexComparePath_ );
+}
+
+/* write to a thread unique temporary file and rename it into place */
+static int oyProfileIndexWrite_      ( oyProfileIndex_s  * index,
+                                       const char        * file_name )
+{
+  char * temp_name = NULL, * path;
+  FILE * fp = NULL;
+  int i, j, error;
+
+  /* oyMakeDir_() needs a ending slash '/' */
+  path = oyExtractPathFromFileName_( file_name );
+  STRING_ADD( path, OY_SLASH );
+  error = oyMakeDir_( path );
+  oyFree_m_( path );
+
+  temp_name = oyGetTempSiblingName_( file_name );
+  if(!error && temp_name)
+    fp = fopen( temp_name, "wb" );
+  if(!fp)
+  {
+    if(temp_name)
+      oyFree_m_( temp_name );
+    return 1;
+  }
+
+  fprintf( fp, "%s\n", oyPROFILE_INDEX_MAGIC );
+  for(i = 0; i < index->dirs_n; ++i)
+    fprintf( fp, "d %lld %s\n", index->dirs[i].mtime, index->dirs[i].path );
+  for(i = 0; i < index->files_n; ++i)
+  {
+    oyProfileIndexEntry_s * e = &index->files[i];
+    char header[257];
+
+    if(strpbrk( e->path, "\t\n" ))
+      continue;
+
+    for(j = 0; j < 128; ++j)
+      sprintf( &header[j*2], "%02x", (unsigned char) e->header[j] );
+
+    fprintf( fp, "f %lld %lld %d %08x%08x%08x%08x %s %s\t",
+             e->size, e->mtime, e->flags,
+             (unsigned)e->md5[0], (unsigned)e->md5[1],
+             (unsigned)e->md5[2], (unsigned)e->md5[3],
+             header, e->path );
+    for(j = 0; e->description && e->description[j]; ++j)
+    {
+      char c = e->description[j];
+      fputc( c == '\t' || c == '\n' || c == '\r' ? ' ' : c, fp );
+    }
+    fputc( '\n', fp );
+  }
+
+  error = ferror( fp );
+  error |= fclose( fp ) != 0;
+  if(!error)
+    error = rename( temp_name, file_name ) != 0;
+  if(error)
+    oyRemoveFile_( temp_name );
+
+  oyFree_m_( temp_name );
+
+  return error;
+}
+
+/* are the scanned paths and all directory and file mtimes still the same ? */
+static int oyProfileIndexIsCurrent_  ( oyProfileIndex_s  * index,
+                                       char             ** path_names,
+                                       int                 count )
+{
+  struct stat st;
+  int i, pos;
+
+  if(!index->roots || index->roots_n != count)
+    return 0;
+  for(i = 0; i < count; ++i)
+    if(strcmp( index->roots[i], path_names[i] ) != 0)
+      return 0;
+
+  for(i = 0; i < index->dirs_n; ++i)
+    if(!index->dirs[i].mtime ||
+       stat( index->dirs[i].path, &st ) != 0 ||
+       (long long) st.st_mtime != index->dirs[i].mtime)
+      return 0;
+
+  /* a file can be overwritten without touching its directory */
+  for(i = 0; i < index->files_n; ++i)
+    if(!index->files[i].mtime ||
+       stat( index->files[i].path, &st ) != 0 ||
+       (long long) st.st_mtime != index->files[i].mtime ||
+       (long long) st.st_size != index->files[i].size)
+      return 0;
+
+  /* a not yet existing path might have been created */
+  for(i = 0; i < count; ++i)
+  {
+    pos = oyProfileIndexLowerBound_( index->dirs, index->dirs_n,
+                                     sizeof(oyProfileIndexDir_s),
+                                     path_names[i] );
+    if(!(pos < index->dirs_n &&
+         strcmp( index->dirs[pos].path, path_names[i] ) == 0) &&
+       stat( path_names[i], &st ) == 0)
+      return 0;
+  }
+
+  return 1;
+}
+
+/* bring the in memory index up to date with the profile paths */
+static void oyProfileIndexUpdate_    ( void )
+{
+  oyProfileIndex_s old = oy_profile_index_;
+  int count = 0, i;
+  char ** path_names;
+
+  path_names = oyProfilePathsGet_( &count, oyAllocateFunc_ );
+
+  if(oy_profile_index_loaded_ &&
+     oyProfileIndexIsCurrent_( &oy_profile_index_, path_names, count ))
+  {
+    oyStringListRelease_( &path_names, count, oyDeAllocateFunc_ );
+    return;
+  }
+
+  if(!oy_profile_index_loaded_)
+  {
+    memset( &old, 0, sizeof(old) );
+    oyProfileIndexRead_( &old, oyProfileIndexGetFile_() );
+    oy_profile_index_loaded_ = 1;
+  }
+
+  memset( &oy_profile_index_, 0, sizeof(oyProfileIndex_s) );
+  oy_profile_index_.now = time(NULL);
+  for(i = 0; i < count; ++i)
+    oyProfileIndexScanDir_( &old, &oy_profile_index_, path_names[i], 0 );
+  oyProfileIndexCheckAll_( &old, &oy_profile_index_ );
+  oy_profile_index_.roots = path_names;
+  oy_profile_index_.roots_n = count;
+
+  if(old.dirs_n != oy_profile_index_.dirs_n)
+    oy_profile_index_.changed = 1;
+  oy_profile_index_.changed |= old.changed;
+  oyProfileIndexClear_( &old );
+
+  qsort( oy_profile_index_.files, oy_profile_index_.files_n,
+         sizeof(oyProfileIndexEntry_s), oyProfileIndexComparePath_ );
+  qsort( oy_profile_index_.dirs, oy_profile_index_.dirs_n,
+         sizeof(oyProfileIndexDir_s), oyProfileIndexComparePath_ );
+}
+
+static void oyProfileIndexSave_      ( oyProfileIndex_s  * index )
+{
+  const char * file_name = oyProfileIndexGetFile_();
+
+  if(index->changed && file_name)
+  {
+    /* keep a not writeable index in memory only */
+    if(oyProfileIndexWrite_( index, file_name ) != 0)
+    {
+      DBG_PROG1_S( "could not write profile index: %s", file_name );
+      oyFree_m_( oy_profile_index_file_ );
+    }
+  }
+  index->changed = 0;
+}
+
+/* plain profile path walk for callers, which can not use the index now */
+static char ** oyProfileIndexWalk_   ( const char        * colorsig,
                                        uint32_t            flags,
+                                       char            *** descriptions,
                                        uint32_t          * size )
 {
   oyFileList_s l = {oyOBJECT_FILE_LIST_S_, 128, NULL, 0, 128, 0, 0};
-  int count = 0;
+  int count = 0, i;
   char ** path_names = NULL;
 
-  path_names = oyProfilePathsGet_( &count, oyAllocateFunc_ );
+  *size = 0;
+  if(descriptions)
+    *descriptions = NULL;
 
+  oyAllocHelper_m_(l.names, char*, l.mem_count, oyAllocateFunc_, return NULL);
   l.colorsig = colorsig;
+  l.flags = flags;
 
-  DBG_PROG_START
+  path_names = oyProfilePathsGet_( &count, oyAllocateFunc_ );
+  oyRecursivePaths_( oyProfileListCb_, &l,
+                     (const char**)path_names, count );
+  oyStringListRelease_( &path_names, count, oyDeAllocateFunc_ );
+
+  /* the same order as from the index */
+  if(l.count_files > 1)
+    qsort( l.names, l.count_files, sizeof(char*), oyProfileIndexCompareName_ );
 
-  if(oy_debug)
+  if(descriptions && l.count_files)
   {
-    int i;
-    DBG_PROG_S("searching in following paths:");
-    for(i = 0; i < count; ++i)
+    *descriptions = (char**) oyAllocateFunc_( sizeof(char*) * l.count_files );
+    for(i = 0; *descriptions && i < l.count_files; ++i)
     {
-      oyMessageFunc_p( oyMSG_DBG, 0, "  %d: %s", i, path_names[i] );
+      oyProfile_s * p = oyProfile_FromFile( l.names[i],
+                                            OY_NO_CACHE_WRITE | OY_COMPUTE, 0 );
+      const char * t = p ? oyProfile_GetText( p, oyNAME_DESCRIPTION ) : NULL;
+      (*descriptions)[i] = oyStringCopy_( t ? t : "", oyAllocateFunc_ );
+      oyProfile_Release( &p );
     }
   }
- 
+
+  *size = l.count_files;
+  return l.names;
+}
+
+/** @internal
+ *  @brief list profiles from the persistent profile index
+ *
+ *  The index keeps path, size, mtime, ICC header, computed MD5 and
+ *  description of all files below the profile paths. Only directories with
+ *  a changed mtime are read again. Known files are compared by size and
+ *  mtime, and only new or changed files are opened. The order is the one
+ *  of oyRecursivePaths_().
+ *  While the index is in use by a other thread or further up in the same
+ *  thread, the profile paths are walked without the index.
+ *
+ *  @param[in]     colorsig            ICC device class; NULL - all
+ *  @param[in]     flags               OY_ICC_VERSION_2, OY_ICC_VERSION_4
+ *  @param[out]    descriptions        optional descriptions in the order of
+ *                                     the returned list; this loads new
+ *                                     profiles once
+ *  @param[out]    size                number of returned profiles
+ *  @return                            the full file names
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+char **  oyProfileIndexListGet_      ( const char        * colorsig,
+                                       uint32_t            flags,
+                                       char            *** descriptions,
+                                       uint32_t          * size )
+{
+  oyProfileIndex_s * index = &oy_profile_index_;
+  char ** names = NULL, ** path_names;
+  oyProfileIndexEntry_s ** list = NULL;
+  int count = 0, i, j, n = 0, reserved = 0;
+
   oy_warn_ = 0;
+  if(!oyProfileIndexTryLock_())
+  {
+    names = oyProfileIndexWalk_( colorsig, flags, descriptions, size );
+    oy_warn_ = 1;
+    return names;
+  }
 
-  l.names = 0;
-  l.mem_count = l.hopp;
-  l.count_files = 0;
-  l.flags = flags;
+  oyProfileIndexUpdate_();
 
-  oyAllocHelper_m_(l.names, char*, l.mem_count, oyAllocateFunc_, return 0);
+  /* a directory inside several search paths is listed several times */
+  path_names = oyProfilePathsGet_( &count, oyAllocateFunc_ );
+  for(i = 0; i < count; ++i)
+  {
+    size_t len = strlen( path_names[i] );
+    int pos = oyProfileIndexLowerBound_( index->files, index->files_n,
+                                         sizeof(oyProfileIndexEntry_s),
+                                         path_names[i] );
+    for(j = 0; j < i; ++j)
+      if(strcmp( path_names[j], path_names[i] ) == 0)
+        break;
+    if(j < i)
+      continue;
+
+    for(j = pos; j < index->files_n &&
+                 strncmp( index->files[j].path, path_names[i], len ) == 0; ++j)
+    {
+      oyProfileIndexEntry_s * e = &index->files[j];
 
-  oyRecursivePaths_( oyProfileListCb_, &l,
-                     (const char**)path_names, count );
+      if(e->path[len] != OY_SLASH_C ||
+         !(e->flags & oyPROFILE_INDEX_HEADER) ||
+         oyCheckProfileMem_( e->header, 128, colorsig, flags ) != 0)
+        continue;
 
+      if(n >= reserved)
+      {
+        oyProfileIndexEntry_s ** tmp;
+        reserved = reserved ? reserved * 2 : 128;
+        tmp = (oyProfileIndexEntry_s**) oyAllocateFunc_( sizeof(void*) * reserved );
+        if(!tmp) break;
+        if(n) memcpy( tmp, list, sizeof(void*) * n );
+        if(list) oyDeAllocateFunc_( list );
+        list = tmp;
+      }
+      list[n++] = e;
+    }
+  }
   oyStringListRelease_( &path_names, count, oyDeAllocateFunc_ );
 
-  *size = l.count_files;
+  /* oyRecursivePaths_() sorts by file name */
+  if(n)
+  {
+    names = (char**) oyAllocateFunc_( sizeof(char*) * n );
+    for(i = 0; i < n; ++i)
+      names[i] = list[i]->path;
+    qsort( names, n, sizeof(char*), oyProfileIndexCompareName_ );
+    for(i = 0; i < n; ++i)
+      names[i] = oyStringCopy_( names[i], oyAllocateFunc_ );
+  }
+
+  if(descriptions)
+  {
+    *descriptions = n ? (char**) oyAllocateFunc_( sizeof(char*) * n ) : NULL;
+    for(i = 0; i < n; ++i)
+    {
+      oyProfileIndexEntry_s * e;
+      int pos = oyProfileIndexLowerBound_( index->files, index->files_n,
+                                           sizeof(oyProfileIndexEntry_s),
+                                           names[i] );
+      e = &index->files[pos];
+      oyProfileIndexReadDetails_( e );
+      (*descriptions)[i] = oyStringCopy_( e->description ? e->description : "",
+                                          oyAllocateFunc_ );
+    }
+  }
+
+  oyProfileIndexSave_( index );
+  oyProfileIndexUnLock_();
+
+  if(list)
+    oyDeAllocateFunc_( list );
+
   oy_warn_ = 1;
+  *size = n;
+  return names;
+}
+
+/* the embedded ICC profile ID in oyProfile_GetMD5() word order */
+static int oyProfileIndexHeaderID_   ( oyProfileIndexEntry_s * entry,
+                                       uint32_t          * id )
+{
+  int i;
+
+  if(!(entry->flags & oyPROFILE_INDEX_HEADER))
+    return 0;
+
+  memcpy( id, &entry->header[84], 16 );
+  for(i = 0; i < 4; ++i)
+    id[i] = oyValueUInt32( id[i] );
+
+  return id[0] || id[1] || id[2] || id[3];
+}
+
+static void oyProfileIndexSlotPut_   ( oyProfileIndexSlot_s * slots,
+                                       uint32_t            size,
+                                       uint32_t            key,
+                                       int                 pos )
+{
+  uint32_t mask = size - 1,
+           i = key & mask;
+
+  while(slots[i].pos)
+    i = (i + 1) & mask;
+
+  slots[i].key = key;
+  slots[i].pos = pos;
+}
+
+/* power of two with a load factor below 1/2 */
+static uint32_t oyProfileIndexSlotsSize_(int               n )
+{
+  uint32_t size = 64;
+
+  while(size < (uint32_t)n * 2 + 1)
+    size *= 2;
+
+  return size;
+}
+
+static int oyProfileIndexBuildTables_( oyProfileIndex_s  * index )
+{
+  int i;
+
+  if(index->md5_slots)
+    return 0;
+
+  /* a profile can have a computed md5 and a differing embedded ID */
+  index->md5_size = oyProfileIndexSlotsSize_( index->files_n * 2 );
+  index->text_size = oyProfileIndexSlotsSize_( index->files_n );
+  index->md5_slots = (oyProfileIndexSlot_s*)
+      oyAllocateFunc_( sizeof(oyProfileIndexSlot_s) * index->md5_size );
+  index->text_slots = (oyProfileIndexSlot_s*)
+      oyAllocateFunc_( sizeof(oyProfileIndexSlot_s) * index->text_size );
+  if(!index->md5_slots || !index->text_slots)
+  {
+    oyProfileIndexDropTables_( index );
+    return 1;
+  }
+  memset( index->md5_slots, 0, sizeof(oyProfileIndexSlot_s) * index->md5_size );
+  memset( index->text_slots, 0,
+          sizeof(oyProfileIndexSlot_s) * index->text_size );
+
+  for(i = 0; i < index->files_n; ++i)
+  {
+    oyProfileIndexEntry_s * e = &index->files[i];
+    uint32_t id[4];
+    int has_id = oyProfileIndexHeaderID_( e, id );
+
+    if(e->flags & oyPROFILE_INDEX_DETAILS)
+    {
+      oyProfileIndexSlotPut_( index->md5_slots, index->md5_size,
+                              oy_hashlittle( e->md5, 16, 0 ), i + 1 );
+      if(e->description && e->description[0])
+        oyProfileIndexSlotPut_( index->text_slots, index->text_size,
+                   oy_hashlittle( e->description, strlen(e->description), 0 ),
+                                i + 1 );
+    }
+    if(has_id && (!(e->flags & oyPROFILE_INDEX_DETAILS) ||
+                  memcmp( id, e->md5, 16 ) != 0))
+      oyProfileIndexSlotPut_( index->md5_slots, index->md5_size,
+                              oy_hashlittle( id, 16, 0 ), i + 1 );
+  }
+
+  return 0;
+}
+
+/* collect the file names matching md5 or description */
+static char ** oyProfileIndexLookup_ ( oyProfileIndex_s  * index,
+                                       const uint32_t    * md5,
+                                       const char        * description,
+                                       int               * count )
+{
+  oyProfileIndexSlot_s * slots;
+  uint32_t key, mask, i;
+  char ** names = NULL;
+
+  *count = 0;
+  if(oyProfileIndexBuildTables_( index ))
+    return NULL;
+
+  if(md5)
+  {
+    slots = index->md5_slots;
+    mask = index->md5_size - 1;
+    key = oy_hashlittle( md5, 16, 0 );
+  } else
+  {
+    slots = index->text_slots;
+    mask = index->text_size - 1;
+    key = oy_hashlittle( description, strlen(description), 0 );
+  }
+
+  for(i = key & mask; slots[i].pos; i = (i + 1) & mask)
+  {
+    oyProfileIndexEntry_s * e = &index->files[slots[i].pos - 1];
+    uint32_t id[4];
+
+    if(slots[i].key != key)
+      continue;
+
+    if(md5 ? ((e->flags & oyPROFILE_INDEX_DETAILS &&
+               memcmp( e->md5, md5, 16 ) == 0) ||
+              (oyProfileIndexHeaderID_( e, id ) &&
+               memcmp( id, md5, 16 ) == 0))
+           : (e->flags & oyPROFILE_INDEX_DETAILS &&
+              strcmp( e->description, description ) == 0))
+      oyStringListAddStaticString( &names, count, e->path,
+                                   oyAllocateFunc_, oyDeAllocateFunc_ );
+  }
+
+  return names;
+}
+
+/* refresh files, which changed without a changed directory */
+static int oyProfileIndexRefresh_    ( oyProfileIndex_s  * index,
+                                       char             ** names,
+                                       int                 count )
+{
+  struct stat st;
+  int i, refreshed = 0;
+
+  for(i = 0; i < count; ++i)
+  {
+    oyProfileIndexEntry_s * e;
+    int pos = oyProfileIndexLowerBound_( index->files, index->files_n,
+                                         sizeof(oyProfileIndexEntry_s),
+                                         names[i] );
+    if(!(pos < index->files_n && strcmp( index->files[pos].path, names[i] ) == 0))
+      continue;
+
+    e = &index->files[pos];
+    if(stat( e->path, &st ) != 0 ||
+       (e->mtime && e->mtime == (long long) st.st_mtime &&
+        e->size == (long long) st.st_size))
+      continue;
+
+    e->size = (long long) st.st_size;
+    e->mtime = (long long) st.st_mtime;
+    if(e->mtime >= (long long) time(NULL) - 1)
+      e->mtime = 0;
+    if(e->description)
+      oyFree_m_( e->description );
+    oyProfileIndexReadHeader_( e );
+    oyProfileIndexReadDetails_( e );
+    oyProfileIndexDropTables_( index );
+    index->changed = 1;
+    refreshed = 1;
+  }
+
+  return refreshed;
+}
+
+static char ** oyProfileIndexFind_   ( const uint32_t    * md5,
+                                       const char        * description,
+                                       uint32_t          * count )
+{
+  oyProfileIndex_s * index = &oy_profile_index_;
+  char ** names;
+  int n = 0, i;
+
+  oy_warn_ = 0;
+  /* all profiles are candidates */
+  if(!oyProfileIndexTryLock_())
+  {
+    names = oyProfileIndexWalk_( NULL, 0, NULL, count );
+    oy_warn_ = 1;
+    return names;
+  }
+
+  oyProfileIndexUpdate_();
+
+  names = oyProfileIndexLookup_( index, md5, description, &n );
+
+  if(n && oyProfileIndexRefresh_( index, names, n ))
+  {
+    oyStringListRelease_( &names, n, oyDeAllocateFunc_ );
+    names = oyProfileIndexLookup_( index, md5, description, &n );
+  }
+
+  /* hash profiles, which were never loaded before */
+  if(!n)
+  {
+    for(i = 0; i < index->files_n; ++i)
+      oyProfileIndexReadDetails_( &index->files[i] );
+    names = oyProfileIndexLookup_( index, md5, description, &n );
+  }
+
+  oyProfileIndexSave_( index );
+  oyProfileIndexUnLock_();
+
+  /* same order as oyProfileListGet_() */
+  if(n > 1)
+    qsort( names, n, sizeof(char*), oyProfileIndexCompareName_ );
+
+  oy_warn_ = 1;
+  *count = n;
+  return names;
+}
+
+/** @internal
+ *  @brief find profiles by md5 in the persistent profile index
+ *
+ *  The computed MD5 and the embedded profile ID are both looked up in a
+ *  hash table. Profiles without a known MD5 are loaded only, if nothing
+ *  was found. The result is a candidate list; callers should verify the
+ *  loaded profile. Without access to the index all profiles are returned.
+ *
+ *  @param[in]     md5                 the profile hash as of oyProfile_GetMD5()
+ *  @param[out]    count               number of returned file names
+ *  @return                            the full file names
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+char **  oyProfileIndexFindMD5_      ( const uint32_t    * md5,
+                                       uint32_t          * count )
+{
+  return oyProfileIndexFind_( md5, NULL, count );
+}
+
+/** @internal
+ *  @brief find profiles by description in the persistent profile index
+ *
+ *  @param[in]     description         the oyNAME_DESCRIPTION text
+ *  @param[out]    count               number of returned file names
+ *  @return                            the full file names
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+char **  oyProfileIndexFindDescription_(const char       * description,
+                                       uint32_t          * count )
+{
+  *count = 0;
+  if(!description || !description[0])
+    return NULL;
+
+  return oyProfileIndexFind_( NULL, description, count );
+}
+
+char **  oyProfileListGet_           ( const char        * colorsig,
+                                       uint32_t            flags,
+                                       uint32_t          * size )
+{
+  char ** names;
+
+  DBG_PROG_START
+
+  names = oyProfileIndexListGet_( colorsig, flags, NULL, size );
+
   DBG_PROG_ENDE
-  return l.names;
+  return names;
 }
 
 char **  oyPolicyListGet_            ( int               * size )
@@ -103,6 +103,8 @@ void     oyFinish_                   ( int                 flags )
 #include "oyProfiles_s.h"
 #include "oyStructList_s_.h"
 #include "oyranos_cache.h"
+#include "oyranos_generic_internal.h"
+#include "oyranos_io.h"
 
 /** @internal
  *
@@ -126,6 +128,7 @@ void     oyAlphaFinish_              ( int                 unused OY_UNUSED )
   }
   oyOptions_Release( &oy_db_cache_ );
   *get_oy_db_cache_init_() = 0;
+  oyProfileIndexRelease_();
 }
 
 #include "oyranos_alpha.h"
@@ -143,12 +146,14 @@ char *     oyAlphaPrint_             ( int                 verbose )
   char * text = NULL;
   const char * t;
   oyStringAddPrintf_( &text, 0,0,
-                      "oy_profile_list_cache_: %d\noy_cmm_cache_: %d\noy_cmm_infos_: %d\noy_cmm_handles_: %d\noy_profile_s_file_cache_: %d\noy_db_cache_: %d\n",
+                      "oy_profile_list_cache_: %d\noy_cmm_cache_: %d (%lu bytes)\noy_cmm_infos_: %d\noy_cmm_handles_: %d\noy_profile_s_file_cache_: %d (%lu bytes)\noy_db_cache_: %d\n",
   oyProfiles_Count( oy_profile_list_cache_ ),
   oyStructList_Count( oy_cmm_cache_ ), /* oyHash_s */
+  (unsigned long) oyCacheListGetSize_( oy_cmm_cache_, NULL ),
   oyStructList_Count( oy_cmm_infos_ ), /* oyCMMhandle_s */
   oyStructList_Count( oy_cmm_handles_ ), /* oyPointer_s */
   oyStructList_Count( (oyStructList_s*) oy_profile_s_file_cache_ ),
+  (unsigned long) oyCacheListGetSize_( (oyStructList_s*) oy_profile_s_file_cache_, NULL ),
   oyOptions_Count( oy_db_cache_ ) );
   if(verbose)
   {
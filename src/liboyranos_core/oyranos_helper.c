@@ -277,6 +277,234 @@ void* oyAllocateWrapFunc_       (size_t        size,
     return oyAllocateFunc_ (size);
 }
 
+/* --- atomic counters --- */
+
+#if defined(OY_ATOMIC_LOCKED_)
+#include <pthread.h>
+static pthread_mutex_t oy_atomic_mutex_ = PTHREAD_MUTEX_INITIALIZER;
+
+/** @internal
+ *  @brief    oyAtomicAdd_m_() for compilers without atomic builtins
+ *
+ *  @version  Oyranos: 0.9.7
+ *  @date     2026/10/18
+ *  @since    2026/10/18 (Oyranos: 0.9.7)
+ */
+int          oyAtomicAdd_            ( volatile int      * ptr,
+                                       int                 n )
+{
+  int val;
+  pthread_mutex_lock( &oy_atomic_mutex_ );
+  val = (*ptr += n);
+  pthread_mutex_unlock( &oy_atomic_mutex_ );
+  return val;
+}
+
+/** @internal
+ *  @brief    oyAtomicGet_m_() for compilers without atomic builtins
+ *
+ *  @version  Oyranos: 0.9.7
+ *  @date     2026/10/18
+ *  @since    2026/10/18 (Oyranos: 0.9.7)
+ */
+int          oyAtomicGet_            ( volatile int      * ptr )
+{
+  int val;
+  pthread_mutex_lock( &oy_atomic_mutex_ );
+  val = *ptr;
+  pthread_mutex_unlock( &oy_atomic_mutex_ );
+  return val;
+}
+#endif
+
+/* --- small block cache --- */
+
+#if (defined(__GNUC__) || defined(__clang__)) && !defined(_WIN32) && !defined(NO_OPT)
+#define OY_USE_SLAB_ 1
+#include <pthread.h>
+#else
+#define OY_USE_SLAB_ 0
+#endif
+
+#if OY_USE_SLAB_
+#define OY_SLAB_STEP_    16            /* block size granularity */
+#define OY_SLAB_CLASSES_ 16            /* cache blocks up to 256 byte */
+#define OY_SLAB_DEPTH_   512           /* cached blocks per class and thread */
+
+typedef struct oySlabBlock_s {
+  struct oySlabBlock_s * next;
+} oySlabBlock_s;
+
+typedef struct {
+  oySlabBlock_s      * list[OY_SLAB_CLASSES_];
+  int                  n[OY_SLAB_CLASSES_];
+  int                  registered;
+  size_t               allocs;         /* blocks taken from oyAllocateFunc_ */
+  size_t               reuses;         /* blocks served from the list */
+} oySlab_s;
+
+static __thread oySlab_s oy_slab_;
+static pthread_key_t     oy_slab_key_;
+static pthread_once_t    oy_slab_once_ = PTHREAD_ONCE_INIT;
+
+/* give the cached blocks of a ending thread back */
+static void oySlabFlush_             ( void              * ptr )
+{
+  oySlab_s * slab = (oySlab_s*) ptr;
+  int i;
+
+  for(i = 0; i < OY_SLAB_CLASSES_; ++i)
+  {
+    while(slab->list[i])
+    {
+      oySlabBlock_s * block = slab->list[i];
+      slab->list[i] = block->next;
+      oyDeAllocateFunc_( block );
+    }
+    slab->n[i] = 0;
+  }
+  slab->registered = 0;
+}
+
+static void oySlabKeyCreate_         ( void )
+{
+  pthread_key_create( &oy_slab_key_, oySlabFlush_ );
+}
+
+/* size class or -1 for blocks, which shall not be cached */
+static int  oySlabClass_             ( size_t              size,
+                                       oyAlloc_f           allocate_func,
+                                       oyDeAlloc_f         deallocate_func )
+{
+  if(size == 0 || size > OY_SLAB_STEP_ * OY_SLAB_CLASSES_ ||
+     (allocate_func && allocate_func != oyAllocateFunc_) ||
+     deallocate_func != oyDeAllocateFunc_)
+    return -1;
+
+  return (int)((size - 1) / OY_SLAB_STEP_);
+}
+#endif
+
+/** @internal
+ *  @brief   allocate a small fixed size block
+ *
+ *  Blocks for the default allocators come from a per thread free list,
+ *  which avoids malloc() for short living objects. Other allocators are
+ *  called directly. Release with oySlabDeAllocateFunc_() and the same
+ *  size and allocators. The memory is not initialised.
+ *
+ *  @param[in]     size                the block size
+ *  @param[in]     allocate_func       the objects allocator or NULL
+ *  @param[in]     deallocate_func     the objects deallocator
+ *  @return                            the block
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+void* oySlabAllocateFunc_       (size_t        size,
+                                 oyAlloc_f     allocate_func,
+                                 oyDeAlloc_f   deallocate_func)
+{
+#if OY_USE_SLAB_
+  int c = oySlabClass_( size, allocate_func, deallocate_func );
+
+  if(c >= 0)
+  {
+    oySlab_s * slab = &oy_slab_;
+    oySlabBlock_s * block = slab->list[c];
+
+    if(block)
+    {
+      slab->list[c] = block->next;
+      --slab->n[c];
+      ++slab->reuses;
+      return block;
+    }
+
+    ++slab->allocs;
+    /* the full class size lets any block of the class be reused */
+    return oyAllocateFunc_( (size_t)(c + 1) * OY_SLAB_STEP_ );
+  }
+#else
+  (void)deallocate_func;
+#endif
+
+  return oyAllocateWrapFunc_( size, allocate_func );
+}
+
+/** @internal
+ *  @brief   release a block from oySlabAllocateFunc_()
+ *
+ *  @param[in]     block               the block
+ *  @param[in]     size                the size as passed for allocation
+ *  @param[in]     allocate_func       the objects allocator or NULL
+ *  @param[in]     deallocate_func     the objects deallocator
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+void  oySlabDeAllocateFunc_     (void *        block,
+                                 size_t        size,
+                                 oyAlloc_f     allocate_func,
+                                 oyDeAlloc_f   deallocate_func)
+{
+#if OY_USE_SLAB_
+  int c = oySlabClass_( size, allocate_func, deallocate_func );
+
+  if(block && c >= 0)
+  {
+    oySlab_s * slab = &oy_slab_;
+
+    if(slab->n[c] < OY_SLAB_DEPTH_)
+    {
+      oySlabBlock_s * b = (oySlabBlock_s*) block;
+
+      if(!slab->registered)
+      {
+        /* flush the list, when the thread ends */
+        pthread_once( &oy_slab_once_, oySlabKeyCreate_ );
+        pthread_setspecific( oy_slab_key_, slab );
+        slab->registered = 1;
+      }
+
+      b->next = slab->list[c];
+      slab->list[c] = b;
+      ++slab->n[c];
+      return;
+    }
+  }
+#else
+  (void)size; (void)allocate_func;
+#endif
+
+  if(block && deallocate_func)
+    deallocate_func( block );
+}
+
+/** @internal
+ *  @brief   count small block allocations of the calling thread
+ *
+ *  @param[out]    allocs              blocks obtained from oyAllocateFunc_()
+ *  @param[out]    reuses              blocks served from the free list
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+void  oySlabGetCounts_          (size_t      * allocs,
+                                 size_t      * reuses)
+{
+#if OY_USE_SLAB_
+  if(allocs) *allocs = oy_slab_.allocs;
+  if(reuses) *reuses = oy_slab_.reuses;
+#else
+  if(allocs) *allocs = 0;
+  if(reuses) *reuses = 0;
+#endif
+}
+
 
 /** @internal
  *  @brief hash calculation
@@ -628,6 +628,21 @@ char *     oyGetTempName_            ( const char        * end_part )
   return name;
 }
 
+/* "file_name.pid-count.tmp"; unique for each call across threads and
+ * processes, for writing next to file_name and renaming into place */
+char * oyGetTempSiblingName_         ( const char        * file_name )
+{
+  static int count = 0;
+  char * name = NULL;
+  int n = oyAtomicAdd_m_( &count, 1 );
+
+  if(file_name)
+    oyStringAddPrintf_( &name, oyAllocateFunc_, oyDeAllocateFunc_,
+                        "%s.%d-%d.tmp", file_name, (int)OY_GETPID(), n );
+
+  return name;
+}
+
 char * oyGetTempFileName_            ( const char        * name,
                                        const char        * end_part,
                                        uint32_t            flags,
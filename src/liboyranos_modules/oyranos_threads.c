@@ -22,6 +22,15 @@
 #include "oyranos_debug.h"
 #include "oyranos_string.h"
 
+#if defined(_WIN32)
+#include <windows.h>                   /* Sleep() */
+#else
+#include <unistd.h>                    /* usleep() */
+#endif
+#ifdef _OPENMP
+#include <omp.h>                       /* omp_get_max_threads() */
+#endif
+
 /** @addtogroup misc
  *
  *  @{ *//* misc */
@@ -90,11 +99,98 @@
  *  job qeue after oyJob_s::work() returned. To access the oyJob_s use the
  *  oyJob_s::finish() callback. oyJobResult() is as well responsible to call 
  *  oyJob_s::finish() from the managing/UI thread for that.
+ *  A managing thread, which needs to block until its jobs are done, can call
+ *  oyJobResultWait() instead of polling oyJobResult() in a sleep loop.
+ *
+ *  @subsection scheduling Scheduling
+ *  Pending jobs with a higher oyJob_s::priority are started first, jobs of
+ *  equal priority in the order of oyJob_Add(). oyJob_DependsOn() holds a
+ *  job back until the work of other jobs is done. Thus a small graph of jobs
+ *  can be added at once. The jobs of one oyJob_s::group can be joined with
+ *  oyJobGroupWait().
+ *  oyJob_Cancel() removes not yet started jobs from the queue. Running jobs
+ *  are only flagged. oyJob_s::work() should poll oyJob_IsCancelled() or the
+ *  return value of oyMsg_Add() and return early. Jobs depending on a
+ *  cancelled job are cancelled as well. Cancelled jobs go through
+ *  oyJob_s::finish() like all other jobs.
+ *
+ *  @subsection worker_pool Worker Pool
+ *  The number of worker threads and their CPU affinity can be set with
+ *  oyJobPool() or with the ::OY_THREADS and ::OY_THREADS_AFFINITY
+ *  environment variables. The pool can be resized at any time. Call
+ *  oyJobPool() with oyJOB_POOL_SHUTDOWN to cancel pending jobs and to join
+ *  the workers, e.g. before unloading Oyranos.
+ *
+ *  @subsection parallel_for Parallel Loops
+ *  Pixel filters split their lines with oyParallelFor() instead of own
+ *  OpenMP teams. The loop runs on the same worker pool as the jobs. Thus
+ *  several conversions at once do not start more threads than the pool
+ *  has.
  *
  *  @{ *//* threads */
 
 static const char * oy_thread_api_nick = "dumy";
 
+/* fallback for thread handlers without a blocking oyJobResultWait() */
+static int         oyJobResultPoll_  ( double              seconds )
+{
+  oyJobResult();
+  if(seconds > 0.0)
+#if defined(_WIN32)
+    Sleep( 1 );
+#else
+    usleep( 1000 );
+#endif
+  return -1;
+}
+/* fallbacks for thread handlers without scheduling support */
+static int         oyJob_CancelNone_ ( int                 job_id OY_UNUSED,
+                                       int                 group OY_UNUSED )
+{
+  return -1;
+}
+static int         oyJobGroupWaitPoll_(int                 group OY_UNUSED,
+                                       double              seconds )
+{
+  oyJobResultWait( seconds );
+  return -1;
+}
+/* fallback for thread handlers without a parallel loop */
+static int         oyParallelForOmp_ ( int                 n,
+                                       oyParallelBody_f    body,
+                                       void              * data,
+                                       int                 grain )
+{
+  int i, chunks, threads = 1;
+
+  if(n <= 0 || !body)
+    return 0;
+  if(grain < 1)
+    grain = 1;
+  chunks = (n + grain - 1) / grain;
+
+#ifdef _OPENMP
+  if(chunks > 1)
+  {
+    threads = OY_MIN( omp_get_max_threads(), chunks );
+#pragma omp parallel for num_threads(threads)
+    for(i = 0; i < chunks; ++i)
+      body( i * grain, OY_MIN( n, (i + 1) * grain ), data );
+  } else
+#endif
+  for(i = 0; i < chunks; ++i)
+    body( i * grain, OY_MIN( n, (i + 1) * grain ), data );
+
+  return threads;
+}
+/* fallback for thread handlers without a configurable pool */
+static int         oyJobPoolNone_    ( int                 workers OY_UNUSED,
+                                       const char        * cpus OY_UNUSED,
+                                       int                 flags OY_UNUSED )
+{
+  return -1;
+}
+
 /**
  *  @brief   Initialise the oyJob_s APIs
  *  @extends oyStruct_s
@@ -117,9 +213,86 @@ void               oyJobHandlingSet  ( oyJob_Add_f         jadd,
   oyJob_Get = jget;
   oyMsg_Add = madd;
   oyJobResult = result;
+  oyJobResultWait = oyJobResultPoll_;
+  oyJob_Cancel = oyJob_CancelNone_;
+  oyJobGroupWait = oyJobGroupWaitPoll_;
+  oyJobPool = oyJobPoolNone_;
+  oyParallelFor = oyParallelForOmp_;
   oy_thread_api_nick = nick;
 }
 
+/**
+ *  @brief   Set a blocking oyJobResult() variant
+ *  @memberof oyJob_s
+ *
+ *  oyJobHandlingSet() resets oyJobResultWait() to poll oyJobResult().
+ *  A thread handling plug-in, which can sleep until a message or a
+ *  finished job arrives, shall call this function after
+ *  oyJobHandlingSet().
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+void               oyJobResultWaitSet( oyJobResultWait_f   wait )
+{
+  oyJobResultWait = wait ? wait : oyJobResultPoll_;
+}
+
+/**
+ *  @brief   Set cancellation and group joining
+ *  @memberof oyJob_s
+ *
+ *  oyJobHandlingSet() resets oyJob_Cancel() and oyJobGroupWait() to
+ *  functions, which can neither cancel nor tell about groups.
+ *  A thread handling plug-in, which supports both, shall call this function
+ *  after oyJobHandlingSet().
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+void               oyJobSchedulingSet( oyJob_Cancel_f      cancel,
+                                       oyJobGroupWait_f    group_wait )
+{
+  oyJob_Cancel = cancel ? cancel : oyJob_CancelNone_;
+  oyJobGroupWait = group_wait ? group_wait : oyJobGroupWaitPoll_;
+}
+
+/**
+ *  @brief   Set worker pool control
+ *  @memberof oyJob_s
+ *
+ *  oyJobHandlingSet() resets oyJobPool() to a function, which can not
+ *  configure workers. A thread handling plug-in with a worker pool shall
+ *  call this function after oyJobHandlingSet().
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+void               oyJobPoolSet      ( oyJobPool_f         pool )
+{
+  oyJobPool = pool ? pool : oyJobPoolNone_;
+}
+
+/**
+ *  @brief   Set the parallel loop
+ *  @memberof oyJob_s
+ *
+ *  oyJobHandlingSet() resets oyParallelFor() to a OpenMP loop, if
+ *  available. A thread handling plug-in shall call this function after
+ *  oyJobHandlingSet() to run the loops on its own threads.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+void               oyParallelForSet  ( oyParallelFor_f     parallel_for )
+{
+  oyParallelFor = parallel_for ? parallel_for : oyParallelForOmp_;
+}
+
 int                oyJob_AddInit     ( oyJob_s          ** job,
                                        int                 finished,
                                        int                 flags );
@@ -166,6 +339,46 @@ void               oyJobResultInit   ( void )
 { if(oyJobInitialise_() == 0)
     oyJobResult();
 }
+int                oyJobResultWaitInit(double              seconds )
+{ if(oyJobInitialise_() == 0)
+    return oyJobResultWait( seconds );
+  else
+    return -1;
+}
+int                oyJob_CancelInit  ( int                 job_id,
+                                       int                 group )
+{ if(oyJobInitialise_() == 0)
+    return oyJob_Cancel( job_id, group );
+  else
+    return -1;
+}
+int                oyJobGroupWaitInit( int                 group,
+                                       double              seconds )
+{ if(oyJobInitialise_() == 0)
+    return oyJobGroupWait( group, seconds );
+  else
+    return -1;
+}
+int                oyJobPoolInit     ( int                 workers,
+                                       const char        * cpus,
+                                       int                 flags )
+{ /* nothing to shut down before the first job */
+  if(flags & oyJOB_POOL_SHUTDOWN)
+    return 0;
+  if(oyJobInitialise_() == 0)
+    return oyJobPool( workers, cpus, flags );
+  else
+    return -1;
+}
+int                oyParallelForInit ( int                 n,
+                                       oyParallelBody_f    body,
+                                       void              * data,
+                                       int                 grain )
+{ /* run the loop in any case */
+  if(oyJobInitialise_() != 0 || oyParallelFor == oyParallelForInit)
+    oyParallelFor = oyParallelForOmp_;
+  return oyParallelFor( n, body, data, grain );
+}
 
 
 /** @typedef oyJob_Add_f
@@ -259,6 +472,173 @@ oyMsg_Add_f oyMsg_Add = oyMsg_AddInit;
  *  @date    2016/05/01
  */
 oyJobResult_f oyJobResult = oyJobResultInit;
+/** @typedef oyJobResultWait_f
+ *  @brief   Wait for new Jobs
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+/**
+ *  @brief   Wait for messages and finished jobs
+ *  @memberof oyJob_s
+ *  @see     oyJobResultWait_f
+ *
+ *  The function does the same as oyJobResult(). But if neither messages
+ *  nor finished jobs are available, it sleeps until one arrives or until
+ *  the timeout runs out. Use it from the managing thread instead of
+ *  calling oyJobResult() in a sleep loop.
+ *
+ *  @param   seconds                   timeout; negative values wait
+ *                                     without limit
+ *  @return                            the number of handled messages and
+ *                                     jobs; -1 if the thread handler can
+ *                                     not tell
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+oyJobResultWait_f oyJobResultWait = oyJobResultWaitInit;
+/** @typedef oyJob_Cancel_f
+ *  @brief   Cancel jobs
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+/**
+ *  @brief   Cancel jobs
+ *  @memberof oyJob_s
+ *  @see     oyJob_Cancel_f
+ *
+ *  Not yet started jobs are taken out of the queue and handed to
+ *  oyJobResult() with oyJob_s::status_work_return set to -1. Running jobs
+ *  are flagged for oyJob_IsCancelled().
+ *
+ *  @param   job_id                    the job to cancel as returned by
+ *                                     oyJob_Add(); or zero
+ *  @param   group                     cancel all jobs of this
+ *                                     oyJob_s::group, if job_id is zero
+ *  @return                            the number of cancelled jobs;
+ *                                     -1 if the thread handler can not cancel
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+oyJob_Cancel_f oyJob_Cancel = oyJob_CancelInit;
+/** @typedef oyJobGroupWait_f
+ *  @brief   Join a group of jobs
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+/**
+ *  @brief   Join a group of jobs
+ *  @memberof oyJob_s
+ *  @see     oyJobGroupWait_f
+ *
+ *  Messages and finished jobs of all groups are handled meanwhile as with
+ *  oyJobResult(). Call from the managing thread.
+ *
+ *  @param   group                     the oyJob_s::group; must not be zero
+ *  @param   seconds                   timeout; negative values wait
+ *                                     without limit
+ *  @return                            the number of not yet finished jobs
+ *                                     of the group; 0 after all jobs passed
+ *                                     oyJob_s::finish(); -1 if the thread
+ *                                     handler can not tell
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+oyJobGroupWait_f oyJobGroupWait = oyJobGroupWaitInit;
+/** @typedef oyJobPool_f
+ *  @brief   Configure the worker threads
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+/**
+ *  @brief   Configure the worker threads
+ *  @memberof oyJob_s
+ *  @see     oyJobPool_f
+ *
+ *  The pool is started with the first oyJob_Add() using ::OY_THREADS and
+ *  ::OY_THREADS_AFFINITY. This function changes both at any time. Shrinking
+ *  joins the superfluous workers after their current job. Workers running
+ *  a oyJOB_ADD_PERSISTENT_JOB job are not counted.
+ *  Call from the managing thread.
+ *
+ *  @param   workers                   the number of worker threads;
+ *                                     0 for automatic, -1 to keep
+ *  @param   cpus                      CPU list like "0-7,16" to pin the
+ *                                     workers to; "" for no pinning;
+ *                                     NULL to keep
+ *  @param   flags                     - oyJOB_POOL_SHUTDOWN - cancel
+ *                                     all pending jobs, join the workers and
+ *                                     call oyJob_s::finish() of the
+ *                                     remaining jobs; a later oyJob_Add()
+ *                                     starts the pool again
+ *  @return                            the number of workers; -1 on error or
+ *                                     if the thread handler has no pool
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+oyJobPool_f oyJobPool = oyJobPoolInit;
+/** @typedef oyParallelBody_f
+ *  @brief   Loop body of oyParallelFor()
+ *
+ *  @param   start                     first iteration
+ *  @param   end                       iteration after the last one
+ *  @param   data                      user data from oyParallelFor()
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+/** @typedef oyParallelFor_f
+ *  @brief   Run a loop in parallel
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+/**
+ *  @brief   Run a loop in parallel
+ *  @memberof oyJob_s
+ *  @see     oyParallelFor_f
+ *
+ *  The iterations 0 till n - 1 are split into ranges for body(). The
+ *  calling thread works on the loop itself and idle workers of the pool
+ *  join in. Workers, which run out of iterations, steal half of the
+ *  remaining iterations of another thread. The ranges become smaller
+ *  towards the end of the loop. The function returns after all
+ *  iterations are done.
+ *
+ *  Calling it from inside a oyJob_s::work() or from inside a body is
+ *  allowed. body() must not depend on other iterations.
+ *
+ *  @param   n                         number of iterations
+ *  @param   body                      the loop body
+ *  @param   data                      user data for body
+ *  @param   grain                     minimal number of iterations per
+ *                                     body() call; e.g. lines for about
+ *                                     1000 pixels; 0 selects 1
+ *  @return                            the number of threads, which took
+ *                                     part in the loop
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+oyParallelFor_f oyParallelFor = oyParallelForInit;
 
 /** @typedef oyJobCallback_f
  *  @brief   Progress callback for parallel job processing
@@ -336,11 +716,70 @@ void              oyJob_Release      ( oyJob_s          ** job )
       s->cb_progress_context->release( &s->cb_progress_context );
     s->cb_progress_context = NULL;
 
+    if(s->depends_)
+      oyDeAllocateFunc_( s->depends_ );
+    s->depends_ = NULL;
+    s->depends_n_ = 0;
+
     s->type_ = oyOBJECT_NONE;
     oyDeAllocateFunc_( s );
     *job = NULL;
   }
 }
 
+/** Function oyJob_DependsOn
+ *  @brief   Let a job wait for an other one
+ *  @memberof oyJob_s
+ *
+ *  Call before oyJob_Add(). The job will not be started before the
+ *  oyJob_s::work() of job_id returned. IDs of already finished jobs are
+ *  ignored.
+ *
+ *  @param   job                       the not yet added job
+ *  @param   job_id                    a ID returned by oyJob_Add()
+ *  @return                            error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+int               oyJob_DependsOn    ( oyJob_s           * job,
+                                       int                 job_id )
+{
+  int * depends;
+
+  if(!job || job->type_ != oyOBJECT_JOB_S || job_id <= 0)
+    return 1;
+
+  depends = (int*) oyAllocateFunc_( sizeof(int) * (job->depends_n_ + 1) );
+  if(!depends)
+    return 1;
+  if(job->depends_n_)
+    memcpy( depends, job->depends_, sizeof(int) * job->depends_n_ );
+  depends[job->depends_n_] = job_id;
+  if(job->depends_)
+    oyDeAllocateFunc_( job->depends_ );
+  job->depends_ = depends;
+  ++job->depends_n_;
+
+  return 0;
+}
+
+/** Function oyJob_IsCancelled
+ *  @brief   Check for oyJob_Cancel()
+ *  @memberof oyJob_s
+ *
+ *  oyJob_s::work() should poll this function in longer loops and return
+ *  early.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+int               oyJob_IsCancelled  ( oyJob_s           * job )
+{
+  return job && oyAtomicGet_m_( &job->status_cancel_ ) != 0;
+}
+
 /** @} *//* threads */
 /** @} *//* misc */
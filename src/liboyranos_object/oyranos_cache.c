@@ -14,8 +14,22 @@
 
 #include "oyranos_cache.h"
 
+#include <ctype.h>
+#include <dirent.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <time.h>
+#if !defined(_WIN32)
+#include <utime.h>
+#endif
+
 #include "oyObject_s.h"
 #include "oyObject_s_.h"
+#include "oyHash_s_.h"
+#include "oyPointer_s.h"
+#include "oyranos_helper.h"
+#include "oyranos_io.h"
+#include "oyranos_string.h"
 
 
 int      oyObjectUsedByStructList_   ( int                 id,
@@ -118,3 +132,496 @@ int      oyObjectUsedByCache_        ( int                 id )
 
   return 0;
 }
+
+static size_t oy_cache_max_bytes_ = 0;
+static int    oy_cache_max_entries_ = 0;
+static int    oy_cache_limits_init_ = 0;
+
+/** @internal
+ *  @brief set limits for the global caches
+ *
+ *  The limits apply to each of oy_cmm_cache_ and oy_profile_s_file_cache_.
+ *  Exceeding caches release their least recently used entries, which are
+ *  held by nothing but the cache itself. The values override
+ *  ::OY_CACHE_MAX_BYTES and ::OY_CACHE_MAX_ENTRIES.
+ *
+ *  @param[in]     max_bytes           byte budget; 0 - unlimited
+ *  @param[in]     max_entries         entry cap; 0 - unlimited
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+void     oyCacheSetLimits_           ( size_t              max_bytes,
+                                       int                 max_entries )
+{
+  oy_cache_limits_init_ = 1;
+  oy_cache_max_bytes_ = max_bytes;
+  oy_cache_max_entries_ = max_entries;
+}
+
+/** @internal
+ *  @brief get limits for the global caches
+ *
+ *  The first call reads ::OY_CACHE_MAX_BYTES and ::OY_CACHE_MAX_ENTRIES
+ *  from the environment.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+void     oyCacheGetLimits_           ( size_t            * max_bytes,
+                                       int               * max_entries )
+{
+  if(!oy_cache_limits_init_)
+  {
+    const char * t;
+
+    oy_cache_limits_init_ = 1;
+    t = getenv(OY_CACHE_MAX_BYTES);
+    if(t)
+      oy_cache_max_bytes_ = (size_t) strtoull( t, NULL, 10 );
+    t = getenv(OY_CACHE_MAX_ENTRIES);
+    if(t)
+      oy_cache_max_entries_ = atoi( t );
+  }
+
+  if(max_bytes)
+    *max_bytes = oy_cache_max_bytes_;
+  if(max_entries)
+    *max_entries = oy_cache_max_entries_;
+}
+
+/** @internal
+ *  @brief account the payload of a cache entry
+ *
+ *  Known are oyPointer_s with a size and oyProfile_s memory blocks.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+size_t   oyCacheEntryGetSize_        ( oyHash_s          * entry )
+{
+  oyStruct_s * st = entry ? ((oyHash_s_*)entry)->entry : NULL;
+  size_t size = 0;
+
+  if(!st)
+    return 0;
+
+  if(st->type_ == oyOBJECT_POINTER_S)
+  {
+    int s = oyPointer_GetSize( (oyPointer_s*)st );
+    if(s > 0)
+      size = s;
+  }
+  else if(st->type_ == oyOBJECT_PROFILE_S)
+    size = ((oyProfile_s_*)st)->size_;
+
+  return size;
+}
+
+static char * oy_cache_disk_dir_ = NULL;
+static size_t oy_cache_disk_max_bytes_ = 0;
+static int    oy_cache_disk_init_ = 0;
+static int    oy_cache_disk_writes_ = 0;  /* atomic */
+#define oyCACHE_DISK_MAX_BYTES   (128*1024*1024)
+#define oyCACHE_DISK_MAX_AGE     (30*24*60*60)
+#define oyCACHE_DISK_TRIM_WRITES 64
+
+/** @internal
+ *  @brief get the persistent device link cache directory
+ *
+ *  The disk cache is opt-in by ::OY_DEVICE_LINK_CACHE_PATH. The value "1"
+ *  selects the users device link cache directory. Any other value names the
+ *  directory. The first call reads as well
+ *  ::OY_DEVICE_LINK_CACHE_MAX_BYTES.
+ *
+ *  @return                            the directory or NULL if disabled
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+const char * oyCacheDiskGetDir_      ( void )
+{
+  if(!oy_cache_disk_init_)
+  {
+    const char * t = getenv(OY_DEVICE_LINK_CACHE_PATH);
+
+    if(t && t[0])
+    {
+      if(strcmp( t, "1" ) == 0)
+        oy_cache_disk_dir_ = oyResolveDirFileName_( OS_DL_CACHE_USER_DIR );
+      else
+        oy_cache_disk_dir_ = oyResolveDirFileName_( t );
+    }
+
+    oy_cache_disk_max_bytes_ = oyCACHE_DISK_MAX_BYTES;
+    t = getenv(OY_DEVICE_LINK_CACHE_MAX_BYTES);
+    if(t)
+      oy_cache_disk_max_bytes_ = (size_t) strtoull( t, NULL, 10 );
+
+    oy_cache_disk_init_ = 1;
+  }
+
+  return oy_cache_disk_dir_;
+}
+
+/** @internal
+ *  @brief set the persistent device link cache directory
+ *
+ *  The value overrides ::OY_DEVICE_LINK_CACHE_PATH.
+ *
+ *  @param[in]     dir                 the directory; NULL - disable
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+void     oyCacheDiskSetDir_          ( const char        * dir )
+{
+  oyCacheDiskGetDir_();
+  if(oy_cache_disk_dir_)
+    oyFree_m_( oy_cache_disk_dir_ );
+  if(dir)
+    oy_cache_disk_dir_ = oyResolveDirFileName_( dir );
+}
+
+/* "dir/md5-of-hash-text.type" */
+static char * oyCacheDiskFileName_   ( oyHash_s          * entry,
+                                       const char        * type )
+{
+  const char * dir = oyCacheDiskGetDir_(),
+             * text;
+  uint32_t md5[4];
+  char * file_name = NULL;
+
+  if(!dir || !entry)
+    return NULL;
+
+  text = oyObject_GetName( ((oyHash_s_*)entry)->oy_, oyNAME_NAME );
+  if(!text || !text[0])
+    return NULL;
+
+  oyMiscBlobGetMD5_( text, strlen(text), (unsigned char*)md5 );
+  oyStringAddPrintf_( &file_name, oyAllocateFunc_, oyDeAllocateFunc_,
+                      "%s%s%08x%08x%08x%08x.%s", dir, OY_SLASH,
+                      md5[0], md5[1], md5[2], md5[3],
+                      type ? type : "bin" );
+
+  return file_name;
+}
+
+/* on disk: "oyCD" magic, 4 byte type, 4 byte big endian payload size,
+ * 4 bytes zero, 16 byte payload MD5, payload */
+#define oyCACHE_DISK_HEADER 32
+
+static void oyCacheDiskHeader_       ( char              * header,
+                                       const char        * type,
+                                       const void        * ptr,
+                                       size_t              size )
+{
+  memset( header, 0, oyCACHE_DISK_HEADER );
+  memcpy( header, "oyCD", 4 );
+  if(type)
+    memcpy( &header[4], type, strlen(type) < 4 ? strlen(type) : 4 );
+  header[8]  = (char)((size >> 24) & 0xff);
+  header[9]  = (char)((size >> 16) & 0xff);
+  header[10] = (char)((size >>  8) & 0xff);
+  header[11] = (char)( size        & 0xff);
+  oyMiscBlobGetMD5_( ptr, size, (unsigned char*)&header[16] );
+}
+
+/** @internal
+ *  @brief read a blob from the persistent device link cache
+ *
+ *  The file header is checked against the type, the file size and the
+ *  payload MD5. A truncated or foreign file is removed and counts as miss.
+ *  A hit refreshes the file modification time, which oyCacheDiskTrim_()
+ *  uses for expiry.
+ *
+ *  @param[in]     entry               the cache key, e.g. from
+ *                                     oyFilterNode_GetHash_()
+ *  @param[in]     type                the blob type, e.g. "oyDL"
+ *  @param[out]    size                the blob size
+ *  @param[in]     allocateFunc        user allocator
+ *  @return                            the blob or NULL
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+oyPointer oyCacheDiskRead_           ( oyHash_s          * entry,
+                                       const char        * type,
+                                       size_t            * size,
+                                       oyAlloc_f           allocateFunc )
+{
+  char * file_name = oyCacheDiskFileName_( entry, type ),
+       * mem = NULL;
+  oyPointer ptr = NULL;
+  size_t n = 0, payload = 0;
+
+  if(!file_name)
+    return NULL;
+
+  if(oyIsFile_( file_name ))
+    mem = oyReadFileToMem_( file_name, &n, oyAllocateFunc_ );
+
+  if(mem && n > oyCACHE_DISK_HEADER)
+  {
+    char header[oyCACHE_DISK_HEADER];
+
+    payload = n - oyCACHE_DISK_HEADER;
+    oyCacheDiskHeader_( header, type, &mem[oyCACHE_DISK_HEADER], payload );
+    if(memcmp( header, mem, oyCACHE_DISK_HEADER ) == 0)
+      ptr = allocateFunc ? allocateFunc( payload ) : oyAllocateFunc_( payload );
+    if(ptr)
+      memcpy( ptr, &mem[oyCACHE_DISK_HEADER], payload );
+  }
+
+  if(ptr)
+  {
+#if !defined(_WIN32)
+    utime( file_name, NULL );
+#endif
+    DBG_NUM2_S( "disk cache hit: %s %lu", file_name, (unsigned long)payload );
+  } else if(mem)
+  {
+    WARNc2_S( "disk cache: drop invalid %s %lu", file_name, (unsigned long)n );
+    oyRemoveFile_( file_name );
+  }
+
+  if(size)
+    *size = ptr ? payload : 0;
+
+  if(mem)
+    oyDeAllocateFunc_( mem );
+  oyFree_m_( file_name );
+
+  return ptr;
+}
+
+/** @internal
+ *  @brief store a blob in the persistent device link cache
+ *
+ *  The blob and a checked header are written to a thread unique temporary
+ *  file and then renamed. Concurrent readers see either no file or a
+ *  complete one. Every oyCACHE_DISK_TRIM_WRITES writes trigger
+ *  oyCacheDiskTrim_().
+ *
+ *  @param[in]     entry               the cache key
+ *  @param[in]     type                the blob type, e.g. "oyDL"
+ *  @param[in]     ptr                 the blob
+ *  @param[in]     size                the blob size
+ *  @return                            0 - success, 1 - error, -1 - disabled
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+int      oyCacheDiskWrite_           ( oyHash_s          * entry,
+                                       const char        * type,
+                                       oyPointer           ptr,
+                                       size_t              size )
+{
+  char * file_name = oyCacheDiskFileName_( entry, type ),
+       * temp_name = NULL,
+       * mem = NULL;
+  int error = !ptr || !size || (size >> 16) >> 16;
+
+  if(!file_name)
+    return -1;
+
+  if(error <= 0)
+  {
+    mem = (char*) oyAllocateFunc_( oyCACHE_DISK_HEADER + size );
+    temp_name = oyGetTempSiblingName_( file_name );
+    error = !mem || !temp_name;
+  }
+
+  if(error <= 0)
+  {
+    oyCacheDiskHeader_( mem, type, ptr, size );
+    memcpy( &mem[oyCACHE_DISK_HEADER], ptr, size );
+    error = oyWriteMemToFile_( temp_name, mem, oyCACHE_DISK_HEADER + size );
+  }
+
+  if(error <= 0)
+  {
+    error = rename( temp_name, file_name ) != 0;
+    if(error)
+      oyRemoveFile_( temp_name );
+  }
+
+  if(error <= 0 &&
+     oyAtomicAdd_m_( &oy_cache_disk_writes_, 1 ) % oyCACHE_DISK_TRIM_WRITES == 1)
+    oyCacheDiskTrim_( oyCacheDiskGetDir_(), oy_cache_disk_max_bytes_,
+                      oyCACHE_DISK_MAX_AGE );
+
+  oyFree_m_( file_name );
+  if(temp_name)
+    oyFree_m_( temp_name );
+  if(mem)
+    oyDeAllocateFunc_( mem );
+
+  return error;
+}
+
+typedef struct {
+  char * name;
+  time_t mtime;
+  size_t size;
+} oyCacheDiskFile_s;
+
+/* "md5-of-hash-text.type" as of oyCacheDiskFileName_() or a left over
+ * "md5-of-hash-text.type.pid-count.tmp" from oyGetTempSiblingName_() */
+static int oyCacheDiskIsOwnName_     ( const char        * name )
+{
+  int i;
+
+  for(i = 0; i < 32; ++i)
+    if(!isxdigit( (unsigned char)name[i] ) || isupper( (unsigned char)name[i] ))
+      return 0;
+  if(name[i++] != '.')
+    return 0;
+
+  /* oyCMMapi4_s::context_type */
+  if(!isalnum( (unsigned char)name[i] ))
+    return 0;
+  while(isalnum( (unsigned char)name[i] ) && i < 32 + 1 + 7)
+    ++i;
+  if(!name[i])
+    return 1;
+
+  if(name[i++] != '.' || !isdigit( (unsigned char)name[i] ))
+    return 0;
+  while(isdigit( (unsigned char)name[i] ))
+    ++i;
+  if(name[i++] != '-' || !isdigit( (unsigned char)name[i] ))
+    return 0;
+  while(isdigit( (unsigned char)name[i] ))
+    ++i;
+
+  return strcmp( &name[i], ".tmp" ) == 0;
+}
+
+static int oyCacheDiskFileCompare_   ( const void        * a,
+                                       const void        * b )
+{
+  const oyCacheDiskFile_s * fa = (const oyCacheDiskFile_s*) a,
+                          * fb = (const oyCacheDiskFile_s*) b;
+  return (fa->mtime > fb->mtime) - (fa->mtime < fb->mtime);
+}
+
+/** @internal
+ *  @brief expire files from the persistent device link cache
+ *
+ *  Files older than max_age are removed. If the remaining files exceed
+ *  max_bytes, the oldest ones are removed until 3/4 of max_bytes is reached.
+ *  The directory can be shared with other applications. Only files directly
+ *  inside of dir and named by oyCacheDiskWrite_() are considered.
+ *
+ *  @param[in]     dir                 the cache directory
+ *  @param[in]     max_bytes           byte budget; 0 - unlimited
+ *  @param[in]     max_age             seconds since last use; 0 - unlimited
+ *  @return                            number of removed files
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+int      oyCacheDiskTrim_            ( const char        * dir,
+                                       size_t              max_bytes,
+                                       long                max_age )
+{
+  int i, count = 0, removed = 0, reserved = 0;
+  oyCacheDiskFile_s * files = NULL;
+  size_t total = 0;
+  time_t now = time(NULL);
+  DIR * d;
+  struct dirent * entry;
+
+  if(!dir || !oyIsDir_( dir ))
+    return 0;
+
+  d = opendir( dir );
+  if(!d)
+    return 0;
+
+  while((entry = readdir( d )) != NULL)
+  {
+    struct stat st;
+    char * name = NULL;
+
+    if(!oyCacheDiskIsOwnName_( entry->d_name ))
+      continue;
+
+    oyStringAddPrintf_( &name, oyAllocateFunc_, oyDeAllocateFunc_,
+                        "%s%s%s", dir, OY_SLASH, entry->d_name );
+    if(!name)
+      continue;
+
+    if(stat( name, &st ) != 0 || !S_ISREG( st.st_mode ))
+    {
+      oyFree_m_( name );
+      continue;
+    }
+
+    if(max_age && now - st.st_mtime > max_age)
+    {
+      if(oyRemoveFile_( name ) == 0)
+        ++removed;
+      oyFree_m_( name );
+      continue;
+    }
+
+    if(count >= reserved)
+    {
+      oyCacheDiskFile_s * tmp;
+      reserved = reserved ? reserved * 2 : 64;
+      tmp = (oyCacheDiskFile_s*) oyAllocateFunc_( sizeof(oyCacheDiskFile_s) *
+                                                  reserved );
+      if(!tmp)
+      {
+        oyFree_m_( name );
+        break;
+      }
+      if(count)
+        memcpy( tmp, files, sizeof(oyCacheDiskFile_s) * count );
+      if(files)
+        oyDeAllocateFunc_( files );
+      files = tmp;
+    }
+
+    files[count].name = name;
+    files[count].mtime = st.st_mtime;
+    files[count].size = st.st_size;
+    total += st.st_size;
+    ++count;
+  }
+  closedir( d );
+
+  if(max_bytes && total > max_bytes)
+  {
+    size_t goal = max_bytes / 4 * 3;
+
+    qsort( files, count, sizeof(oyCacheDiskFile_s), oyCacheDiskFileCompare_ );
+    for(i = 0; i < count && total > goal; ++i)
+      if(oyRemoveFile_( files[i].name ) == 0)
+      {
+        total -= files[i].size;
+        ++removed;
+      }
+  }
+
+  if(removed)
+    DBG_NUM2_S( "disk cache: removed %d files from %s", removed, dir );
+
+  for(i = 0; i < count; ++i)
+    oyDeAllocateFunc_( files[i].name );
+  if(files)
+    oyDeAllocateFunc_( files );
+
+  return removed;
+}
@@ -40,6 +40,7 @@
 #include "oyranos_image.h"
 #include "oyranos_object_internal.h"
 #include "oyranos_string.h"
+#include "oyranos_threads.h"
 
 #ifdef _OPENMP
 #define USE_OPENMP 1
@@ -72,6 +73,15 @@ void  oyDeAllocateFunc_         (void *        data);
 #include <math.h>
 #include <string.h>                    /* memcpy */
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define l2cmsUSE_X86 1
+#include <cpuid.h>
+#include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define l2cmsUSE_NEON 1
+#include <arm_neon.h>
+#endif
+
 
 /* --- internal definitions --- */
 
@@ -86,6 +96,14 @@ void  oyDeAllocateFunc_         (void *        data);
  *  marking, but at the prise of lost speed and increased memory consumption.
  *  53 is the grid size used internally in l2cms' gamut marking code. */
 #define l2cmsPROOF_LUT_GRID_RASTER 53
+/** The matrix-shaper fast path encodes linear light from 2^-48 to 1.0
+ *  with 64 linear interpolated points per octave. This keeps even steep
+ *  gamma curves near black below one 16-bit code value of error. */
+#define l2cmsMS_OCTAVES 48
+#define l2cmsMS_STEP_BITS 6
+#define l2cmsMS_SHIFT (23 - l2cmsMS_STEP_BITS)
+#define l2cmsMS_OUT_N (l2cmsMS_OCTAVES << l2cmsMS_STEP_BITS)
+#define l2cmsMS_MIN_BITS ((int32_t)(127 - l2cmsMS_OCTAVES) << 23)
 /*#define ENABLE_MPE 1*/
 
 #define CMM_VERSION {0,1,1}
@@ -115,11 +133,13 @@ typedef struct l2cmsProfileWrap_s_ {
   oyProfile_s *dbg_profile;            /**< only for debugging */
 } l2cmsProfileWrap_s;
 
+typedef struct l2cmsMatrixShaper_s_ l2cmsMatrixShaper_s;
+
 /** @struct  l2cmsTransformWrap_s
  *  @brief   l2cms wrapper for transform data struct
  *
- *  @version Oyranos: 0.1.8
- *  @date    2007/12/20
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
  *  @since   2007/12/20 (Oyranos: 0.1.8)
  */
 typedef struct l2cmsTransformWrap_s_ {
@@ -129,6 +149,7 @@ typedef struct l2cmsTransformWrap_s_ {
   icColorSpaceSignature sig_out;       /**< ICC profile signature */
   oyPixel_t    oy_pixel_layout_in;
   oyPixel_t    oy_pixel_layout_out;
+  l2cmsMatrixShaper_s * ms;            /**< fast path replacing l2cms or NULL */
 } l2cmsTransformWrap_s;
 
 
@@ -216,6 +237,8 @@ static cmsUInt32Number (*l2cmsGetProfileInfoASCII)(cmsHPROFILE hProfile, cmsInfo
 static int (*l2_cmsLCMScolorSpace)(cmsColorSpaceSignature ProfileSpace) = NULL;
 static cmsUInt32Number (*l2cmsChannelsOf)(cmsColorSpaceSignature ColorSpace) = NULL;
 static cmsBool         (*l2cmsIsTag)(cmsHPROFILE hProfile, cmsTagSignature sig) = NULL;
+static cmsBool         (*l2cmsIsMatrixShaper)(cmsHPROFILE hProfile) = NULL;
+static cmsBool         (*l2cmsIsCLUT)(cmsHPROFILE hProfile, cmsUInt32Number Intent, cmsUInt32Number UsedDirection) = NULL;
 static cmsHTRANSFORM (*l2cmsCreateTransform)(cmsHPROFILE Input,
                                                cmsUInt32Number InputFormat,
                                                cmsHPROFILE Output,
@@ -294,6 +317,8 @@ static void              (*l2cmsPipelineFree)               (cmsPipeline* lut) =
 static cmsStage*         (*l2cmsPipelineGetPtrToFirstStage) (const cmsPipeline* lut ) = NULL;
 static cmsStageSignature (*l2cmsStageType) (const cmsStage* stage) = NULL;
 static cmsStage*         (*l2cmsStageNext) (const cmsStage* next ) = NULL;
+static cmsStage*         (*l2cmsStageDup) (cmsStage* mpe ) = NULL;
+static void              (*l2cmsPipelineEvalFloat) (const cmsFloat32Number In[], cmsFloat32Number Out[], const cmsPipeline* lut) = NULL;
 static cmsUInt32Number   (*l2cmsStageInputChannels)         (const cmsStage* stage) = NULL;
 static cmsUInt32Number   (*l2cmsStageOutputChannels)        (const cmsStage* stage) = NULL;
 static cmsStage*(*l2cmsStageAllocCLut16bit)(cmsContext ContextID, cmsUInt32Number nGridPoints, cmsUInt32Number inputChan, cmsUInt32Number outputChan, const cmsUInt16Number* Table) = NULL;
@@ -421,6 +446,8 @@ int                l2cmsCMMInit       ( oyStruct_s        * filter OY_UNUSED )
       LOAD_FUNC( _cmsLCMScolorSpace, NULL );
       LOAD_FUNC( cmsChannelsOf, NULL );
       LOAD_FUNC( cmsIsTag, NULL );
+      LOAD_FUNC( cmsIsMatrixShaper, NULL );
+      LOAD_FUNC( cmsIsCLUT, NULL );
       LOAD_FUNC( cmsCreateTransform, NULL );
       LOAD_FUNC( cmsCreateTransformTHR, NULL );
       LOAD_FUNC( cmsCreateProofingTransform, NULL );
@@ -458,6 +485,8 @@ int                l2cmsCMMInit       ( oyStruct_s        * filter OY_UNUSED )
       LOAD_FUNC( cmsPipelineGetPtrToFirstStage, NULL );
       LOAD_FUNC( cmsStageType, NULL );
       LOAD_FUNC( cmsStageNext, NULL );
+      LOAD_FUNC( cmsStageDup, NULL );
+      LOAD_FUNC( cmsPipelineEvalFloat, NULL );
       LOAD_FUNC( cmsStageInputChannels, NULL );
       LOAD_FUNC( cmsStageOutputChannels, NULL );
       LOAD_FUNC( cmsStageAllocCLut16bit, NULL );
@@ -539,6 +568,8 @@ int                l2cmsCMMInit       ( oyStruct_s        * filter OY_UNUSED )
 #define _cmsLCMScolorSpace l2_cmsLCMScolorSpace
 #define cmsChannelsOf l2cmsChannelsOf
 #define cmsIsTag l2cmsIsTag
+#define cmsIsMatrixShaper l2cmsIsMatrixShaper
+#define cmsIsCLUT l2cmsIsCLUT
 #define cmsCreateTransform l2cmsCreateTransform
 #define cmsCreateTransformTHR l2cmsCreateTransformTHR
 #define cmsCreateProofingTransform l2cmsCreateProofingTransform
@@ -574,6 +605,8 @@ int                l2cmsCMMInit       ( oyStruct_s        * filter OY_UNUSED )
 #define cmsPipelineGetPtrToFirstStage l2cmsPipelineGetPtrToFirstStage
 #define cmsStageType l2cmsStageType
 #define cmsStageNext l2cmsStageNext
+#define cmsStageDup l2cmsStageDup
+#define cmsPipelineEvalFloat l2cmsPipelineEvalFloat
 #define cmsStageInputChannels l2cmsStageInputChannels
 #define cmsStageOutputChannels l2cmsStageOutputChannels
 #define cmsStageAllocCLut16bit l2cmsStageAllocCLut16bit
@@ -853,9 +886,11 @@ int        oyPixelToLcm2PixelLayout_ ( oyPixel_t           pixel_layout,
     cmm_pixel |= SWAPFIRST_SH(1);
   if(data_type == oyUINT8)
     cmm_pixel |= BYTES_SH(1);
-  else if(data_type == oyUINT16 || data_type == oyHALF)
+  else if(data_type == oyUINT16 ||
+          (data_type == oyHALF && oyToByteswap_m(pixel_layout)))
     cmm_pixel |= BYTES_SH(2);
-  else if(data_type == oyFLOAT)
+  else if(data_type == oyFLOAT || data_type == oyHALF)
+    /* native oyHALF lines are widened in l2cmsFilterPlug_CmmIccRun() */
     cmm_pixel |= BYTES_SH(4);
   else if(data_type == oyDOUBLE)
     cmm_pixel |= BYTES_SH(0);
@@ -877,6 +912,629 @@ int        oyPixelToLcm2PixelLayout_ ( oyPixel_t           pixel_layout,
   return cmm_pixel;
 }
 
+typedef void (*l2cmsMatrixShaperRun_f)(const l2cmsMatrixShaper_s * ms,
+                                       const uint8_t     * in,
+                                       uint8_t           * out,
+                                       int                 n );
+
+/** @struct  l2cmsMatrixShaper_s
+ *  @brief   precalculated curves-matrix-curves transform
+ *
+ *  RGB to RGB device links of two matrix-shaper profiles consist of
+ *  per channel curves, an affine matrix and again per channel curves.
+ *  The curves are tabulated for the input code values and for log2 spaced
+ *  linear light. This avoids the 16-bit pipeline of l2cms.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+struct l2cmsMatrixShaper_s_ {
+  int          in_bytes;               /**< 1 - oyUINT8, 2 - oyUINT16 */
+  int          in_channels;            /**< 3 or 4; alpha is ignored */
+  int          out_bytes;              /**< 1 - oyUINT8, 2 - oyUINT16 */
+  int          out_channels;           /**< 3 or 4; alpha is not touched */
+  float      * in_lut[3];              /**< linearisation per input code */
+  float        m[9];                   /**< row major matrix */
+  float        offset[3];              /**< matrix offset */
+  float      * out_lut[3];             /**< output code + 0.5; l2cmsMS_OUT_N+2 */
+  const char * kernel;                 /**< name of the selected run function */
+  l2cmsMatrixShaperRun_f run;          /**< convert n pixels */
+};
+
+/* write up to 8 pixels from planar results */
+static void l2cmsMatrixShaperStore_  ( const l2cmsMatrixShaper_s * ms,
+                                       int32_t             res[3][8],
+                                       int                 w,
+                                       uint8_t           * out )
+{
+  int i, c;
+  if(ms->out_bytes == 1)
+    for(i = 0; i < w; ++i)
+      for(c = 0; c < 3; ++c)
+        out[i * ms->out_channels + c] = (uint8_t) res[c][i];
+  else
+    for(i = 0; i < w; ++i)
+      for(c = 0; c < 3; ++c)
+        ((uint16_t*)out)[i * ms->out_channels + c] = (uint16_t) res[c][i];
+}
+
+/* the portable reference; the vector variants compute the same */
+static void l2cmsMatrixShaperRunC_   ( const l2cmsMatrixShaper_s * ms,
+                                       const uint8_t     * in,
+                                       uint8_t           * out,
+                                       int                 n )
+{
+  int i, c;
+  const int ib = ms->in_bytes * ms->in_channels,
+            ob = ms->out_bytes * ms->out_channels;
+
+  for(i = 0; i < n; ++i)
+  {
+    const uint8_t * p = in + i * ib;
+    float l[3];
+    int32_t res[3][8];
+
+    if(ms->in_bytes == 1)
+      for(c = 0; c < 3; ++c)
+        l[c] = ms->in_lut[c][p[c]];
+    else
+      for(c = 0; c < 3; ++c)
+        l[c] = ms->in_lut[c][((const uint16_t*)p)[c]];
+
+    for(c = 0; c < 3; ++c)
+    {
+      const float * lut = ms->out_lut[c];
+      union { float f; int32_t i; } y;
+      int32_t t, idx;
+      float f;
+
+      y.f = ms->m[3*c+0] * l[0] + ms->m[3*c+1] * l[1] + ms->m[3*c+2] * l[2] +
+            ms->offset[c];
+      if(!(y.f > 0.0f)) /* includes NaN */
+        y.f = 0.0f;
+      /* the float bits are linear inside each octave */
+      t = y.i - l2cmsMS_MIN_BITS;
+      if(t < 0) t = 0;
+      if(t > l2cmsMS_OCTAVES << 23) t = l2cmsMS_OCTAVES << 23;
+      idx = t >> l2cmsMS_SHIFT;
+      f = (float)(t & ((1 << l2cmsMS_SHIFT) - 1)) * (1.0f / (1 << l2cmsMS_SHIFT));
+      res[c][0] = (int32_t)(lut[idx] + f * (lut[idx+1] - lut[idx]));
+    }
+    l2cmsMatrixShaperStore_( ms, res, 1, out + i * ob );
+  }
+}
+
+#if defined(l2cmsUSE_X86)
+/* 8 pixels per step with hardware gathers */
+__attribute__((target("avx2")))
+static void l2cmsMatrixShaperRunAVX2_( const l2cmsMatrixShaper_s * ms,
+                                       const uint8_t     * in,
+                                       uint8_t           * out,
+                                       int                 n )
+{
+  int i = 0, c;
+  const int ib = ms->in_bytes * ms->in_channels,
+            ob = ms->out_bytes * ms->out_channels;
+  const __m256i offs = _mm256_mullo_epi32( _mm256_setr_epi32(0,1,2,3,4,5,6,7),
+                                           _mm256_set1_epi32( ib ) ),
+                code_mask = _mm256_set1_epi32( ms->in_bytes == 1 ? 0xff : 0xffff ),
+                min_bits = _mm256_set1_epi32( l2cmsMS_MIN_BITS ),
+                max_t = _mm256_set1_epi32( l2cmsMS_OCTAVES << 23 ),
+                frac_mask = _mm256_set1_epi32( (1 << l2cmsMS_SHIFT) - 1 ),
+                izero = _mm256_setzero_si256();
+  const __m256 frac_scale = _mm256_set1_ps( 1.0f / (1 << l2cmsMS_SHIFT) ),
+               zero = _mm256_setzero_ps();
+  __m256 m[9], o[3];
+  int32_t res[3][8];
+
+  for(c = 0; c < 9; ++c)
+    m[c] = _mm256_set1_ps( ms->m[c] );
+  for(c = 0; c < 3; ++c)
+    o[c] = _mm256_set1_ps( ms->offset[c] );
+
+  /* the 32-bit code gathers read up to three bytes past the last code;
+   * keep the last pixel for the scalar code */
+  for( ; i + 8 < n; i += 8)
+  {
+    const uint8_t * p = in + i * ib;
+    __m256 l[3];
+
+    for(c = 0; c < 3; ++c)
+    {
+      __m256i code = _mm256_and_si256( _mm256_i32gather_epi32(
+                          (const int*)(p + c * ms->in_bytes), offs, 1 ),
+                                       code_mask );
+      l[c] = _mm256_i32gather_ps( ms->in_lut[c], code, 4 );
+    }
+
+    for(c = 0; c < 3; ++c)
+    {
+      __m256 y = _mm256_add_ps( _mm256_add_ps(
+                                  _mm256_mul_ps( m[3*c+0], l[0] ),
+                                  _mm256_mul_ps( m[3*c+1], l[1] ) ),
+                                _mm256_add_ps(
+                                  _mm256_mul_ps( m[3*c+2], l[2] ), o[c] ) ),
+             f, v0, v1;
+      __m256i t, idx;
+
+      y = _mm256_max_ps( y, zero ); /* NaN and -0 give the second operand */
+      t = _mm256_sub_epi32( _mm256_castps_si256( y ), min_bits );
+      t = _mm256_min_epi32( _mm256_max_epi32( t, izero ), max_t );
+      idx = _mm256_srli_epi32( t, l2cmsMS_SHIFT );
+      f = _mm256_mul_ps( _mm256_cvtepi32_ps( _mm256_and_si256( t, frac_mask ) ),
+                         frac_scale );
+      v0 = _mm256_i32gather_ps( ms->out_lut[c], idx, 4 );
+      v1 = _mm256_i32gather_ps( ms->out_lut[c] + 1, idx, 4 );
+      y = _mm256_add_ps( v0, _mm256_mul_ps( f, _mm256_sub_ps( v1, v0 ) ) );
+      _mm256_storeu_si256( (__m256i*)res[c], _mm256_cvttps_epi32( y ) );
+    }
+    l2cmsMatrixShaperStore_( ms, res, 8, out + i * ob );
+  }
+
+  l2cmsMatrixShaperRunC_( ms, in + i * ib, out + i * ob, n - i );
+}
+
+/* 4 pixels per step; table look ups stay scalar */
+__attribute__((target("sse4.1")))
+static void l2cmsMatrixShaperRunSSE4_( const l2cmsMatrixShaper_s * ms,
+                                       const uint8_t     * in,
+                                       uint8_t           * out,
+                                       int                 n )
+{
+  int i = 0, c, k;
+  const int ib = ms->in_bytes * ms->in_channels,
+            ob = ms->out_bytes * ms->out_channels;
+  const __m128i min_bits = _mm_set1_epi32( l2cmsMS_MIN_BITS ),
+                max_t = _mm_set1_epi32( l2cmsMS_OCTAVES << 23 ),
+                frac_mask = _mm_set1_epi32( (1 << l2cmsMS_SHIFT) - 1 ),
+                izero = _mm_setzero_si128();
+  const __m128 frac_scale = _mm_set1_ps( 1.0f / (1 << l2cmsMS_SHIFT) ),
+               zero = _mm_setzero_ps();
+  __m128 m[9], o[3];
+  int32_t res[3][8], ix[4];
+  float l[3][4], v0[4], v1[4];
+
+  for(c = 0; c < 9; ++c)
+    m[c] = _mm_set1_ps( ms->m[c] );
+  for(c = 0; c < 3; ++c)
+    o[c] = _mm_set1_ps( ms->offset[c] );
+
+  for( ; i + 4 <= n; i += 4)
+  {
+    const uint8_t * p = in + i * ib;
+
+    if(ms->in_bytes == 1)
+      for(k = 0; k < 4; ++k)
+        for(c = 0; c < 3; ++c)
+          l[c][k] = ms->in_lut[c][p[k * ib + c]];
+    else
+      for(k = 0; k < 4; ++k)
+        for(c = 0; c < 3; ++c)
+          l[c][k] = ms->in_lut[c][((const uint16_t*)(p + k * ib))[c]];
+
+    for(c = 0; c < 3; ++c)
+    {
+      const float * lut = ms->out_lut[c];
+      __m128 y = _mm_add_ps( _mm_add_ps(
+                               _mm_mul_ps( m[3*c+0], _mm_loadu_ps( l[0] ) ),
+                               _mm_mul_ps( m[3*c+1], _mm_loadu_ps( l[1] ) ) ),
+                             _mm_add_ps(
+                               _mm_mul_ps( m[3*c+2], _mm_loadu_ps( l[2] ) ),
+                               o[c] ) ),
+             f;
+      __m128i t;
+
+      y = _mm_max_ps( y, zero );
+      t = _mm_sub_epi32( _mm_castps_si128( y ), min_bits );
+      t = _mm_min_epi32( _mm_max_epi32( t, izero ), max_t );
+      _mm_storeu_si128( (__m128i*)ix, _mm_srli_epi32( t, l2cmsMS_SHIFT ) );
+      f = _mm_mul_ps( _mm_cvtepi32_ps( _mm_and_si128( t, frac_mask ) ),
+                      frac_scale );
+      for(k = 0; k < 4; ++k)
+      {
+        v0[k] = lut[ix[k]];
+        v1[k] = lut[ix[k] + 1];
+      }
+      y = _mm_add_ps( _mm_loadu_ps( v0 ),
+                      _mm_mul_ps( f, _mm_sub_ps( _mm_loadu_ps( v1 ),
+                                                 _mm_loadu_ps( v0 ) ) ) );
+      _mm_storeu_si128( (__m128i*)res[c], _mm_cvttps_epi32( y ) );
+    }
+    l2cmsMatrixShaperStore_( ms, res, 4, out + i * ob );
+  }
+
+  l2cmsMatrixShaperRunC_( ms, in + i * ib, out + i * ob, n - i );
+}
+#endif /* l2cmsUSE_X86 */
+
+#if defined(l2cmsUSE_NEON)
+/* 4 pixels per step; table look ups stay scalar */
+static void l2cmsMatrixShaperRunNEON_( const l2cmsMatrixShaper_s * ms,
+                                       const uint8_t     * in,
+                                       uint8_t           * out,
+                                       int                 n )
+{
+  int i = 0, c, k;
+  const int ib = ms->in_bytes * ms->in_channels,
+            ob = ms->out_bytes * ms->out_channels;
+  const int32x4_t min_bits = vdupq_n_s32( l2cmsMS_MIN_BITS ),
+                  max_t = vdupq_n_s32( l2cmsMS_OCTAVES << 23 ),
+                  frac_mask = vdupq_n_s32( (1 << l2cmsMS_SHIFT) - 1 ),
+                  izero = vdupq_n_s32( 0 );
+  const float32x4_t zero = vdupq_n_f32( 0.0f );
+  int32_t res[3][8], ix[4];
+  float l[3][4], v0[4], v1[4];
+
+  for( ; i + 4 <= n; i += 4)
+  {
+    const uint8_t * p = in + i * ib;
+
+    if(ms->in_bytes == 1)
+      for(k = 0; k < 4; ++k)
+        for(c = 0; c < 3; ++c)
+          l[c][k] = ms->in_lut[c][p[k * ib + c]];
+    else
+      for(k = 0; k < 4; ++k)
+        for(c = 0; c < 3; ++c)
+          l[c][k] = ms->in_lut[c][((const uint16_t*)(p + k * ib))[c]];
+
+    for(c = 0; c < 3; ++c)
+    {
+      const float * lut = ms->out_lut[c];
+      float32x4_t y = vdupq_n_f32( ms->offset[c] ), f, a, b;
+      int32x4_t t;
+
+      y = vmlaq_n_f32( y, vld1q_f32( l[0] ), ms->m[3*c+0] );
+      y = vmlaq_n_f32( y, vld1q_f32( l[1] ), ms->m[3*c+1] );
+      y = vmlaq_n_f32( y, vld1q_f32( l[2] ), ms->m[3*c+2] );
+      /* false for NaN */
+      y = vbslq_f32( vcgtq_f32( y, zero ), y, zero );
+      t = vsubq_s32( vreinterpretq_s32_f32( y ), min_bits );
+      t = vminq_s32( vmaxq_s32( t, izero ), max_t );
+      vst1q_s32( ix, vshrq_n_s32( t, l2cmsMS_SHIFT ) );
+      f = vmulq_n_f32( vcvtq_f32_s32( vandq_s32( t, frac_mask ) ),
+                       1.0f / (1 << l2cmsMS_SHIFT) );
+      for(k = 0; k < 4; ++k)
+      {
+        v0[k] = lut[ix[k]];
+        v1[k] = lut[ix[k] + 1];
+      }
+      a = vld1q_f32( v0 );
+      b = vld1q_f32( v1 );
+      y = vmlaq_f32( a, f, vsubq_f32( b, a ) );
+      vst1q_s32( res[c], vcvtq_s32_f32( y ) );
+    }
+    l2cmsMatrixShaperStore_( ms, res, 4, out + i * ob );
+  }
+
+  l2cmsMatrixShaperRunC_( ms, in + i * ib, out + i * ob, n - i );
+}
+#endif /* l2cmsUSE_NEON */
+
+/* pick the widest kernel the running CPU supports */
+static void l2cmsMatrixShaperSelect_ ( l2cmsMatrixShaper_s * ms )
+{
+  ms->kernel = "C";
+  ms->run = l2cmsMatrixShaperRunC_;
+#if defined(l2cmsUSE_X86)
+  __builtin_cpu_init();
+  if(__builtin_cpu_supports( "avx2" ))
+  {
+    ms->kernel = "AVX2";
+    ms->run = l2cmsMatrixShaperRunAVX2_;
+  } else
+  if(__builtin_cpu_supports( "sse4.1" ))
+  {
+    ms->kernel = "SSE4.1";
+    ms->run = l2cmsMatrixShaperRunSSE4_;
+  }
+#elif defined(l2cmsUSE_NEON)
+  ms->kernel = "NEON";
+  ms->run = l2cmsMatrixShaperRunNEON_;
+#endif
+}
+
+/* IEEE 754 half <-> float for lines of samples; the scalar versions round
+ * to nearest even and keep denormals, infinities and NaN like F16C does */
+static void l2cmsHalfToFloatC_       ( const uint16_t    * h,
+                                       float             * f,
+                                       int                 n )
+{
+  int i;
+  for(i = 0; i < n; ++i)
+  {
+    union { float f; uint32_t u; } v;
+    uint32_t s = (uint32_t)(h[i] & 0x8000) << 16,
+             e = (h[i] >> 10) & 0x1f,
+             m = h[i] & 0x3ff;
+    if(e == 0x1f)
+      v.u = s | 0x7f800000 | (m << 13);
+    else if(e)
+      v.u = s | ((e + 112) << 23) | (m << 13);
+    else
+    {
+      v.f = (float)m * (1.0f / 16777216.0f); /* 2^-24 */
+      v.u |= s;
+    }
+    f[i] = v.f;
+  }
+}
+
+static void l2cmsFloatToHalfC_       ( const float       * f,
+                                       uint16_t          * h,
+                                       int                 n )
+{
+  int i;
+  for(i = 0; i < n; ++i)
+  {
+    union { float f; uint32_t u; } v;
+    uint32_t s, a;
+    v.f = f[i];
+    s = (v.u >> 16) & 0x8000;
+    a = v.u & 0x7fffffff;
+    if(a >= 0x7f800000)      /* Inf and quiet NaN */
+      h[i] = s | 0x7c00 | (a > 0x7f800000 ? 0x200 : 0);
+    else if(a >= 0x477ff000) /* 65520 rounds to Inf */
+      h[i] = s | 0x7c00;
+    else if(a < 0x38800000)  /* denormal; let the FPU round at 2^-24 */
+    {
+      v.u = a;
+      v.f += 0.5f;
+      h[i] = s | (v.u - 0x3f000000);
+    } else
+      h[i] = s | ((a - 0x38000000 + 0xfff + ((a >> 13) & 1)) >> 13);
+  }
+}
+
+#if defined(l2cmsUSE_X86)
+__attribute__((target("avx,f16c")))
+static void l2cmsHalfToFloatF16C_    ( const uint16_t    * h,
+                                       float             * f,
+                                       int                 n )
+{
+  int i = 0;
+  for( ; i + 8 <= n; i += 8)
+    _mm256_storeu_ps( f + i,
+                      _mm256_cvtph_ps( _mm_loadu_si128( (const __m128i*)(h + i) ) ) );
+  l2cmsHalfToFloatC_( h + i, f + i, n - i );
+}
+__attribute__((target("avx,f16c")))
+static void l2cmsFloatToHalfF16C_    ( const float       * f,
+                                       uint16_t          * h,
+                                       int                 n )
+{
+  int i = 0;
+  for( ; i + 8 <= n; i += 8)
+    _mm_storeu_si128( (__m128i*)(h + i),
+                      _mm256_cvtps_ph( _mm256_loadu_ps( f + i ),
+                                       _MM_FROUND_TO_NEAREST_INT ) );
+  l2cmsFloatToHalfC_( f + i, h + i, n - i );
+}
+#elif defined(l2cmsUSE_NEON) && defined(__aarch64__)
+static void l2cmsHalfToFloatNEON_    ( const uint16_t    * h,
+                                       float             * f,
+                                       int                 n )
+{
+  int i = 0;
+  for( ; i + 4 <= n; i += 4)
+    vst1q_f32( f + i, vcvt_f32_f16( vreinterpret_f16_u16( vld1_u16( h + i ) ) ) );
+  l2cmsHalfToFloatC_( h + i, f + i, n - i );
+}
+static void l2cmsFloatToHalfNEON_    ( const float       * f,
+                                       uint16_t          * h,
+                                       int                 n )
+{
+  int i = 0;
+  for( ; i + 4 <= n; i += 4)
+    vst1_u16( h + i, vreinterpret_u16_f16( vcvt_f16_f32( vld1q_f32( f + i ) ) ) );
+  l2cmsFloatToHalfC_( f + i, h + i, n - i );
+}
+#endif
+
+static void (*l2cmsHalfToFloat_)     ( const uint16_t    * h,
+                                       float             * f,
+                                       int                 n ) = l2cmsHalfToFloatC_;
+static void (*l2cmsFloatToHalf_)     ( const float       * f,
+                                       uint16_t          * h,
+                                       int                 n ) = l2cmsFloatToHalfC_;
+
+static int l2cms_half_claimed_ = 0;
+static int l2cms_half_selected_ = 0;
+
+/* pick the half conversion the running CPU supports; the first caller
+ * sets the pointers, concurrent callers wait until they are published */
+static void l2cmsHalfSelect_         ( void )
+{
+  if(oyAtomicGet_m_( &l2cms_half_selected_ ))
+    return;
+  if(oyAtomicAdd_m_( &l2cms_half_claimed_, 1 ) != 1)
+  {
+    while(!oyAtomicGet_m_( &l2cms_half_selected_ ))
+      ;
+    return;
+  }
+#if defined(l2cmsUSE_X86)
+  {
+    unsigned int a = 0, b = 0, c = 0, d = 0;
+    __builtin_cpu_init();
+    /* CPUID.1:ECX bit 29 is F16C; it needs the AVX register state */
+    if(__get_cpuid( 1, &a, &b, &c, &d ) && (c & (1u << 29)) &&
+       __builtin_cpu_supports( "avx" ))
+    {
+      l2cmsHalfToFloat_ = l2cmsHalfToFloatF16C_;
+      l2cmsFloatToHalf_ = l2cmsFloatToHalfF16C_;
+    }
+  }
+#elif defined(l2cmsUSE_NEON) && defined(__aarch64__)
+  l2cmsHalfToFloat_ = l2cmsHalfToFloatNEON_;
+  l2cmsFloatToHalf_ = l2cmsFloatToHalfNEON_;
+#endif
+  oyAtomicAdd_m_( &l2cms_half_selected_, 1 );
+}
+
+/* interleaved 8/16-bit RGB or RGBA without swapping */
+static int l2cmsMatrixShaperLayout_  ( oyPixel_t           pixel_layout )
+{
+  oyDATATYPE_e data_type = oyToDataType_m( pixel_layout );
+  int chan_n = oyToChannels_m( pixel_layout );
+
+  return (data_type == oyUINT8 || data_type == oyUINT16) &&
+         (chan_n == 3 || chan_n == 4) &&
+         oyToColorOffset_m( pixel_layout ) == 0 &&
+         !oyToPlanar_m( pixel_layout ) &&
+         !oyToSwapColorChannels_m( pixel_layout ) &&
+         !oyToByteswap_m( pixel_layout ) &&
+         !oyToFlavor_m( pixel_layout );
+}
+
+/** Function l2cmsMatrixShaperCreate_
+ *  @brief   tabulate a curves-matrix-curves device link
+ *
+ *  The A2B0 pipeline of the device link is split into input curves,
+ *  matrices and output curves. Each part is sampled through l2cms itself.
+ *  Any other stage type disables the fast path.
+ *
+ *  @return                            the table set or NULL
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+static l2cmsMatrixShaper_s * l2cmsMatrixShaperCreate_ (
+                                       cmsHPROFILE         dl,
+                                       oyPixel_t           oy_pixel_layout_in,
+                                       oyPixel_t           oy_pixel_layout_out )
+{
+  l2cmsMatrixShaper_s * ms = NULL;
+  cmsPipeline * lut, * part[3] = {NULL,NULL,NULL};
+  cmsStage * stage;
+  cmsContext tc;
+  int error = 0, pos = 0, i, c, in_n = 0;
+  float v[3], r[3], o[3];
+  double out_max;
+
+  if(!dl ||
+     !l2cmsMatrixShaperLayout_( oy_pixel_layout_in ) ||
+     !l2cmsMatrixShaperLayout_( oy_pixel_layout_out ) ||
+     l2cmsGetDeviceClass( dl ) != cmsSigLinkClass ||
+     l2cmsGetColorSpace( dl ) != cmsSigRgbData ||
+     l2cmsGetPCS( dl ) != cmsSigRgbData)
+    return NULL;
+
+  lut = (cmsPipeline*) l2cmsReadTag( dl, cmsSigAToB0Tag );
+  if(!lut)
+    return NULL;
+
+  tc = l2cmsGetProfileContextID( dl );
+  for(i = 0; i < 3; ++i)
+  {
+    part[i] = l2cmsPipelineAlloc( tc, 3, 3 );
+    if(!part[i]) error = 1;
+  }
+
+  /* pos: 0 - before input curves, 1 - matrices, 2 - after output curves */
+  for(stage = l2cmsPipelineGetPtrToFirstStage( lut );
+      stage && !error;
+      stage = l2cmsStageNext( stage ))
+  {
+    cmsStageSignature type = l2cmsStageType( stage );
+    int p = -1;
+
+    if(l2cmsStageInputChannels( stage ) != 3 ||
+       l2cmsStageOutputChannels( stage ) != 3)
+      error = 1;
+    else if(type == cmsSigIdentityElemType)
+      continue;
+    else if(type == cmsSigCurveSetElemType && pos == 0)
+      p = 0;
+    else if(type == cmsSigCurveSetElemType && pos == 1)
+      p = 2;
+    else if(type == cmsSigMatrixElemType && pos <= 1)
+      p = 1;
+    else
+      error = 1;
+
+    if(!error)
+    {
+      cmsStage * dup = l2cmsStageDup( stage );
+      if(!dup || !l2cmsPipelineInsertStage( part[p], cmsAT_END, dup ))
+        error = 1;
+      pos = p == 2 ? 2 : 1;
+    }
+  }
+
+  if(!error)
+  {
+    in_n = oyToDataType_m( oy_pixel_layout_in ) == oyUINT8 ? 256 : 65536;
+    ms = calloc( sizeof(l2cmsMatrixShaper_s) +
+                 sizeof(float) * 3 * (in_n + l2cmsMS_OUT_N + 2), 1 );
+    if(!ms)
+      error = 1;
+  }
+
+  if(!error)
+  {
+    float * tables = (float*)(ms + 1);
+
+    ms->in_bytes = oyToDataType_m( oy_pixel_layout_in ) == oyUINT8 ? 1 : 2;
+    ms->in_channels = oyToChannels_m( oy_pixel_layout_in );
+    ms->out_bytes = oyToDataType_m( oy_pixel_layout_out ) == oyUINT8 ? 1 : 2;
+    ms->out_channels = oyToChannels_m( oy_pixel_layout_out );
+    for(c = 0; c < 3; ++c)
+    {
+      ms->in_lut[c] = tables + c * in_n;
+      ms->out_lut[c] = tables + 3 * in_n + c * (l2cmsMS_OUT_N + 2);
+    }
+
+    for(i = 0; i < in_n; ++i)
+    {
+      v[0] = v[1] = v[2] = (float)i / (in_n - 1);
+      l2cmsPipelineEvalFloat( v, r, part[0] );
+      for(c = 0; c < 3; ++c)
+        ms->in_lut[c][i] = r[c];
+    }
+
+    v[0] = v[1] = v[2] = 0.0f;
+    l2cmsPipelineEvalFloat( v, o, part[1] );
+    for(i = 0; i < 3; ++i)
+    {
+      v[0] = v[1] = v[2] = 0.0f;
+      v[i] = 1.0f;
+      l2cmsPipelineEvalFloat( v, r, part[1] );
+      for(c = 0; c < 3; ++c)
+        ms->m[3*c+i] = r[c] - o[c];
+    }
+    for(c = 0; c < 3; ++c)
+      ms->offset[c] = o[c];
+
+    out_max = ms->out_bytes == 1 ? 255.0 : 65535.0;
+    for(i = 0; i <= l2cmsMS_OUT_N; ++i)
+    {
+      union { float f; int32_t i; } y;
+      y.i = l2cmsMS_MIN_BITS + (i << l2cmsMS_SHIFT);
+      v[0] = v[1] = v[2] = y.f;
+      l2cmsPipelineEvalFloat( v, r, part[2] );
+      for(c = 0; c < 3; ++c)
+      {
+        double d = r[c] > 1.0f ? 1.0 : r[c] > 0.0f ? r[c] : 0.0;
+        ms->out_lut[c][i] = (float)(d * out_max + 0.5);
+      }
+    }
+    /* the interpolation at 1.0 reads one point further */
+    for(c = 0; c < 3; ++c)
+      ms->out_lut[c][l2cmsMS_OUT_N + 1] = ms->out_lut[c][l2cmsMS_OUT_N];
+
+    l2cmsMatrixShaperSelect_( ms );
+  }
+
+  for(i = 0; i < 3; ++i)
+    if(part[i])
+      l2cmsPipelineFree( part[i] );
+
+  return ms;
+}
+
 /** Function l2cmsCMMDeleteTransformWrap
  *  @brief
  *
@@ -894,6 +1552,10 @@ int l2cmsCMMDeleteTransformWrap(oyPointer * wrap)
     l2cmsDeleteTransform (s->l2cms);
     s->l2cms = 0;
 
+    if(s->ms)
+      free(s->ms);
+    s->ms = 0;
+
     free(s);
 
     *wrap = 0;
@@ -1144,6 +1806,20 @@ cmsHTRANSFORM  l2cmsCMMConversionContextCreate_ (
     }
     else if(profiles_n == 2 && (!proof_n || (!proof && !gamut_warning)))
     {
+      /* Keep the curves and matrices of two matrix-shaper profiles visible
+       * in the pipeline. l2cms optimises 16-bit into a CLUT otherwise and
+       * the device link would lose the l2cmsMatrixShaper_s fast path. */
+      if(!(flags & (cmsFLAGS_NOOPTIMIZE | cmsFLAGS_HIGHRESPRECALC |
+                    cmsFLAGS_LOWRESPRECALC)) &&
+         intent <= 3 &&
+         l2cmsMatrixShaperLayout_( oy_pixel_layout_in ) &&
+         l2cmsMatrixShaperLayout_( oy_pixel_layout_out ) &&
+         color_in == icSigRgbData && color_out == icSigRgbData &&
+         l2cmsIsMatrixShaper( lps[0] ) && l2cmsIsMatrixShaper( lps[1] ) &&
+         !l2cmsIsCLUT( lps[0], intent, LCMS_USED_AS_INPUT ) &&
+         !l2cmsIsCLUT( lps[1], intent, LCMS_USED_AS_OUTPUT ))
+        flags |= cmsFLAGS_NOOPTIMIZE;
+
       oyAllocHelper_m_( intents, cmsUInt32Number, 2,0, goto end);
       oyAllocHelper_m_( bpc, cmsBool, 2,0, goto end);
       oyAllocHelper_m_( adaption_states, cmsFloat64Number, 2,0, goto end);
@@ -1282,6 +1958,19 @@ cmsHTRANSFORM  l2cmsCMMConversionContextCreate_ (
     *ltw= l2cmsTransformWrap_Set_( xform, color_in, color_out,
                                   oy_pixel_layout_in, oy_pixel_layout_out, oy );
 
+  /* precalculation asks for l2cms own processing */
+  if(!error && ltw && *ltw && profiles_n == 1 &&
+     !(flags & (cmsFLAGS_NOOPTIMIZE | cmsFLAGS_HIGHRESPRECALC |
+                cmsFLAGS_LOWRESPRECALC)))
+  {
+    (*ltw)->ms = l2cmsMatrixShaperCreate_( lps[0], oy_pixel_layout_in,
+                                           oy_pixel_layout_out );
+    if((*ltw)->ms && oy_debug)
+      l2cms_msg( oyMSG_DBG, (oyStruct_s*)node, OY_DBG_FORMAT_
+                 "matrix-shaper fast path: %s", OY_DBG_ARGS_,
+                 (*ltw)->ms->kernel );
+  }
+
   end:
   return xform;
 }
@@ -1826,16 +2515,6 @@ oyPointer l2cmsFilterNode_CmmIccContextToMem (
              OY_DBG_FORMAT_" missed output image %d", OY_DBG_ARGS_, image_output?image_output->type_:0 );
   }
 
-  /*oyDATATYPE_e data_type = 0;
-  data_type = oyToDataType_m( oyImage_GetPixelLayout( image_input, oyLAYOUT ) );
-
-  if(data_type == oyHALF)
-  {
-    oyFilterSocket_Callback( plug, oyCONNECTOR_EVENT_INCOMPATIBLE_DATA );
-    l2cms_msg( oyMSG_WARN, (oyStruct_s*)node,
-             OY_DBG_FORMAT_" can not handle oyHALF", OY_DBG_ARGS_ );
-  }*/
-
   len = sizeof(cmsHPROFILE) * (15 + 2 + 1);
   lps = oyAllocateFunc_( len );
   if(!lps)
@@ -2459,6 +3138,116 @@ int  l2cmsModuleData_Convert          ( oyPointer_s       * data_in,
 
 char * oyCMMCacheListPrint_();
 
+/* Convert one line. Native oyHALF is widened into the float lines of tmp
+ * and floating point XYZ is scaled to and from the l2cms range. */
+static void l2cmsTransformLine_      ( l2cmsTransformWrap_s * ltw,
+                                       const uint8_t     * in,
+                                       uint8_t           * out,
+                                       int                 n,
+                                       oyDATATYPE_e        data_type_in,
+                                       oyDATATYPE_e        data_type_out,
+                                       int                 channels_in,
+                                       int                 channels_out,
+                                       int                 out_extra,
+                                       uint8_t           * tmp,
+                                       int                 tmp_in_size,
+                                       int                 tmp_out_size )
+{
+  const double xyz_factor = 1.0 + 32767.0/32768.0;
+  const uint8_t * src = in;
+  uint8_t * dst = out;
+  int j, in_n = n * channels_in, out_n = n * channels_out;
+
+  if(tmp_in_size)
+  {
+    if(data_type_in == oyHALF)
+      l2cmsHalfToFloat_( (const uint16_t*)in, (float*)tmp, in_n );
+    else
+      memcpy( tmp, in, tmp_in_size );
+    src = tmp;
+
+    if(ltw->sig_in == icSigXYZData)
+    {
+      if(data_type_in == oyDOUBLE)
+        for(j = 0; j < in_n; ++j)
+          ((double*)tmp)[j] /= xyz_factor;
+      else
+        for(j = 0; j < in_n; ++j)
+          ((float*)tmp)[j] /= xyz_factor;
+    }
+  }
+
+  if(tmp_out_size)
+  {
+    dst = tmp + tmp_in_size;
+    /* l2cms does not touch extra channels; keep them across the float line */
+    if(out_extra)
+      l2cmsHalfToFloat_( (const uint16_t*)out, (float*)dst, out_n );
+  }
+
+  if(ltw->ms)
+    ltw->ms->run( ltw->ms, src, dst, n );
+  else
+    l2cmsDoTransform( ltw->l2cms, src, dst, n );
+
+  if(ltw->sig_out == icSigXYZData)
+  {
+    if(data_type_out == oyDOUBLE)
+      for(j = 0; j < out_n; ++j)
+        ((double*)dst)[j] *= xyz_factor;
+    else if(data_type_out == oyFLOAT || tmp_out_size)
+      for(j = 0; j < out_n; ++j)
+        ((float*)dst)[j] *= xyz_factor;
+  }
+
+  if(tmp_out_size)
+    l2cmsFloatToHalf_( (const float*)dst, (uint16_t*)out, out_n );
+}
+
+/* lines of l2cmsFilterPlug_CmmIccRun() for oyParallelFor() */
+typedef struct {
+  l2cmsTransformWrap_s * ltw;
+  uint8_t ** array_in_data;
+  uint8_t ** array_out_data;
+  int n;
+  oyDATATYPE_e data_type_in;
+  oyDATATYPE_e data_type_out;
+  int channels_in;
+  int channels_out;
+  int out_extra;
+  int tmp_in_size;
+  int tmp_out_size;
+  int error;
+} l2cmsLines_s;
+/* each chunk owns its float lines, as chunks run on any thread */
+static void l2cmsTransformLines_     ( int                 start,
+                                       int                 end,
+                                       void              * data )
+{
+  l2cmsLines_s * l = (l2cmsLines_s*) data;
+  uint8_t * tmp = 0;
+  int k;
+
+  if(l->tmp_in_size + l->tmp_out_size)
+  {
+    tmp = oyAllocateFunc_( l->tmp_in_size + l->tmp_out_size );
+    if(!tmp)
+    {
+      oyAtomicAdd_m_( &l->error, 1 );
+      return;
+    }
+  }
+
+  for( k = start; k < end; ++k)
+    l2cmsTransformLine_( l->ltw, l->array_in_data[k], l->array_out_data[k],
+                         l->n, l->data_type_in, l->data_type_out,
+                         l->channels_in, l->channels_out, l->out_extra,
+                         tmp, l->tmp_in_size, l->tmp_out_size );
+
+  if(tmp)
+    oyDeAllocateFunc_( tmp );
+}
+
 /** Function l2cmsFilterPlug_CmmIccRun
  *  @brief   implement oyCMMFilterPlug_GetNext_f()
  *
@@ -2469,7 +3258,7 @@ char * oyCMMCacheListPrint_();
 int      l2cmsFilterPlug_CmmIccRun   ( oyFilterPlug_s    * requestor_plug,
                                        oyPixelAccess_s   * ticket )
 {
-  int j, k, n;
+  int n;
   int error = 0;
   oyDATATYPE_e data_type_in = 0,
                data_type_out = 0;
@@ -2523,7 +3312,8 @@ int      l2cmsFilterPlug_CmmIccRun   ( oyFilterPlug_s    * requestor_plug,
       /* Use original pixel size for being save and do not fiddle with ROI's */
       int w = oyArray2d_GetDataGeo1( old_a, 2 ) / channels_out;
       int h = oyArray2d_GetDataGeo1( old_a, 3 );
-      a = oyArray2d_Create( NULL, w * channels_in,h, oyToDataType_m( pixel_layout_in ), ticket->oy_ );
+      /* recycle the array of a previous run with the same ticket */
+      a = oyPixelAccess_TakeArray( ticket, w * channels_in,h, oyToDataType_m( pixel_layout_in ) );
       if(oy_debug)
       {
         l2cms_msg( oy_debug?oyMSG_WARN:oyMSG_DBG, (oyStruct_s*)ticket, OY_DBG_FORMAT_"layout_out(%d) != layout_in(%d) created %s",
@@ -2569,13 +3359,6 @@ int      l2cmsFilterPlug_CmmIccRun   ( oyFilterPlug_s    * requestor_plug,
   data_type_in = oyToDataType_m( oyImage_GetPixelLayout( image_input, oyLAYOUT ) );
   bps_in = oyDataTypeGetSize( data_type_in );
 
-  /*if(data_type_in == oyHALF)
-  {
-    oyFilterSocket_Callback( requestor_plug, oyCONNECTOR_EVENT_INCOMPATIBLE_DATA );
-    l2cms_msg(oyMSG_WARN,(oyStruct_s*)ticket, OY_DBG_FORMAT_" can not handle oyHALF",OY_DBG_ARGS_);
-    error = 1;
-  }*/
-
   if(!image_output)
   {
     l2cms_msg( oyMSG_WARN,(oyStruct_s*)ticket, OY_DBG_FORMAT_ " no ticket->output_image",
@@ -2662,33 +3445,22 @@ int      l2cmsFilterPlug_CmmIccRun   ( oyFilterPlug_s    * requestor_plug,
   /* now do some position blind manipulations */
   if(ltw && error <= 0)
   {
-    uint8_t * array_in_tmp = 0,
-            * array_out_tmp = 0;
-    float * array_in_tmp_flt = 0,
-          * array_out_tmp_flt = 0;
-    double * array_in_tmp_dbl = 0,
-           * array_out_tmp_dbl = 0;
     uint8_t ** array_in_data = oyArray2d_GetData( array_in ),
             ** array_out_data = oyArray2d_GetData( array_out );
-    int threads_n = 
-#if defined(_OPENMP) && defined(USE_OPENMP)
-                    omp_get_max_threads();
-#else
-                    1;
-#endif
     int w_in =  (int)(oyArray2d_GetWidth(array_in)+0.5),
         w_out = (int)(oyArray2d_GetWidth(array_out)+0.5);
-    int stride_in = w_in * bps_in;
+    int tmp_in_size = 0,
+        tmp_out_size = 0,
+        out_extra = 0;
 
     n = OY_MIN(w_in/channels_in, w_out/channels_out);
 
     if(oy_debug)
       l2cms_msg( oyMSG_DBG,(oyStruct_s*)ticket, OY_DBG_FORMAT_
-             " %s[%d]=\"%s\" threads_n: %d %s "OY_PRINT_POINTER
+             " %s[%d]=\"%s\" %s "OY_PRINT_POINTER
              " -> %s "OY_PRINT_POINTER" convert pixel: %d",
              OY_DBG_ARGS_,
              _("Node"),oyStruct_GetId((oyStruct_s*)node),oyStruct_GetInfo((oyStruct_s*)node,0,0),
-             threads_n,
              oyArray2d_Show(array_in,channels_in),array_in_data,
              oyArray2d_Show(array_out,channels_out),array_out_data,n );
 
@@ -2701,131 +3473,43 @@ int      l2cmsFilterPlug_CmmIccRun   ( oyFilterPlug_s    * requestor_plug,
       oyFilterSocket_Callback( requestor_plug, oyCONNECTOR_EVENT_INCOMPATIBLE_DATA );
       error = 1;
     }
-    
-    if(ltw->sig_in  == icSigXYZData &&
-       (data_type_in == oyFLOAT ||
-        data_type_in == oyDOUBLE))
-    {
-      array_in_tmp = oyAllocateFunc_( stride_in * threads_n );
-      if(data_type_in == oyFLOAT)
-        array_in_tmp_flt = (float*) array_in_tmp;
-      else if(data_type_in == oyDOUBLE)
-        array_in_tmp_dbl = (double*) array_in_tmp;
-    }
-    if(ltw->sig_out  == icSigXYZData &&
-       (data_type_out == oyFLOAT ||
-        data_type_out == oyDOUBLE))
+
+    /* per chunk float lines, see oyPixelToLcm2PixelLayout_() */
+    if(data_type_in == oyHALF && !oyToByteswap_m( pixel_layout_in ))
+      tmp_in_size = n * channels_in * sizeof(float);
+    else if(ltw->sig_in  == icSigXYZData &&
+            (data_type_in == oyFLOAT ||
+             data_type_in == oyDOUBLE))
+      tmp_in_size = n * channels_in * bps_in;
+    if(data_type_out == oyHALF && !oyToByteswap_m( layout_out ))
     {
-      array_out_tmp = array_out_data[0];
+      tmp_out_size = n * channels_out * sizeof(float);
+      out_extra = channels_out >
+                  (int)l2cmsChannelsOf( (cmsColorSpaceSignature)ltw->sig_out );
     }
-    
+    if(tmp_in_size + tmp_out_size)
+      l2cmsHalfSelect_();
 
     /*  - - - - - conversion - - - - - */
     /*l2cms_msg(oyMSG_WARN,(oyStruct_s*)ticket, "%s: %d Start lines: %d",
             __FILE__,__LINE__, array_out->height);*/
     if(!error)
     {
-      const double xyz_factor = 1.0 + 32767.0/32768.0;
-      const int use_xyz_scale = 1;
-      int index = 0;
       int array_in_height = oyArray2d_GetHeight(array_in),
           array_out_height = oyArray2d_GetHeight(array_out),
           lines = OY_MIN(array_in_height, array_out_height);
-      if(lines > threads_n * 10)
-      {
-#if defined(USE_OPENMP)
-#pragma omp parallel for private(index,j,array_in_tmp_flt,array_in_tmp_dbl,array_out_tmp_flt,array_out_tmp_dbl)
-#endif
-        for( k = 0; k < lines; ++k)
-        {
-          if(array_in_tmp && use_xyz_scale)
-          {
-#if defined(_OPENMP) && defined(USE_OPENMP)
-            index = omp_get_thread_num();
-#endif
-            memcpy( &array_in_tmp[stride_in*index], array_in_data[k],
-                    w_in * bps_in );
-            if(data_type_in == oyFLOAT)
-            {
-              array_in_tmp_flt = (float*) &array_in_tmp[stride_in*index];
-              for(j = 0; j < w_in; ++j)
-              {
-                array_in_tmp_flt[j] /= xyz_factor;
-              }
-            } else
-            if(data_type_in == oyDOUBLE)
-            {
-              array_in_tmp_dbl = (double*) &array_in_tmp[stride_in*index];
-              for(j = 0; j < w_in; ++j)
-              {
-                array_in_tmp_dbl[j] /= xyz_factor;
-              }
-            }
-            l2cmsDoTransform( ltw->l2cms, &array_in_tmp[stride_in*index],
-                                       array_out_data[k], n );
-          } else
-            l2cmsDoTransform( ltw->l2cms, array_in_data[k],
-                                       array_out_data[k], n );
-          if(array_out_tmp && use_xyz_scale)
-          {
-            if(data_type_out == oyFLOAT)
-            {
-              array_out_tmp_flt = (float*) array_out_data[k];
-              for(j = 0; j < w_out; ++j)
-                array_out_tmp_flt[j] *= xyz_factor;
-            } else
-            if(data_type_out == oyDOUBLE)
-            {
-              array_out_tmp_dbl = (double*) array_out_data[k];
-              for(j = 0; j < w_out; ++j)
-                array_out_tmp_dbl[j] *= xyz_factor;
-            }
-          }
-        }
-      } else
-        for( k = 0; k < lines; ++k)
-        {
-          if(array_in_tmp && use_xyz_scale)
-          {
-            memcpy( array_in_tmp, array_in_data[k], w_in * bps_in );
-            if(data_type_in == oyFLOAT)
-            for(j = 0; j < w_in; ++j)
-            {
-              array_in_tmp_flt[j] /= xyz_factor;
-            }
-            if(data_type_in == oyDOUBLE)
-            for(j = 0; j < w_in; ++j)
-            {
-              array_in_tmp_dbl[j] /= xyz_factor;
-            }
-            l2cmsDoTransform( ltw->l2cms, array_in_tmp,
-                                       array_out_data[k], n );
-          } else
-            l2cmsDoTransform( ltw->l2cms, array_in_data[k],
-                                       array_out_data[k], n );
-          if(array_out_tmp && use_xyz_scale)
-          {
-            if(data_type_out == oyFLOAT)
-            {
-              array_out_tmp_flt = (float*) array_out_data[k];
-              for(j = 0; j < w_out; ++j)
-                array_out_tmp_flt[j] *= xyz_factor;
-            } else
-            if(data_type_out == oyDOUBLE)
-            {
-              array_out_tmp_dbl = (double*) array_out_data[k];
-              for(j = 0; j < w_out; ++j)
-                array_out_tmp_dbl[j] *= xyz_factor;
-            }
-          }
-        }
+      l2cmsLines_s l = { ltw, array_in_data, array_out_data, n,
+                         data_type_in, data_type_out,
+                         channels_in, channels_out, out_extra,
+                         tmp_in_size, tmp_out_size, 0 };
+
+      oyParallelFor( lines, l2cmsTransformLines_, &l, 1 );
+      if(l.error)
+        error = 1;
     /*l2cms_msg(oyMSG_WARN,(oyStruct_s*)ticket, "%s: %d End width: %d",
             __FILE__,__LINE__, n);*/
     }
 
-    if(array_in_tmp)
-      oyDeAllocateFunc_( array_in_tmp );
-
     if(getenv("OY_DEBUG_WRITE"))
     {
       char * t = 0; oyStringAddPrintf( &t, 0,0,
@@ -2877,7 +3561,11 @@ int      l2cmsFilterPlug_CmmIccRun   ( oyFilterPlug_s    * requestor_plug,
 
   if(oyImage_GetPixelLayout( image_input, oyLAYOUT ) != 
      oyImage_GetPixelLayout( image_output, oyLAYOUT ))
+  {
     oyPixelAccess_Release( &new_ticket );
+    /* keep the intermediate array for the next frame */
+    oyPixelAccess_GiveArray( ticket, &array_in );
+  }
 
   oyFilterPlug_Release( &plug );
   oyFilterSocket_Release( &socket );
@@ -0,0 +1,1095 @@
+/** @file oyranos_cmm_clut.c
+ *
+ *  Oyranos is an open source Color Management System
+ *
+ *  @par Copyright:
+ *            2026 (C) Kai-Uwe Behrmann
+ *
+ *  @brief    3D look up table CMM renderer for Oyranos
+ *  @internal
+ *  @author   Kai-Uwe Behrmann <ku.b@gmx.de>
+ *  @par License:
+ *            new BSD <http://www.opensource.org/licenses/BSD-3-Clause>
+ *  @since    2026/10/18
+ */
+
+/**
+ *
+ *  The module renders RGB pixels through a sampled 3D table. It has no
+ *  own ICC context. The device link comes from the context CMM, which
+ *  covers proofing, effect and display chains alike. The device link is
+ *  converted once into a table and cached with the node like any other
+ *  renderer context. Select the module with the "////renderer" = "clut"
+ *  option.
+ *
+ *  The node options "grid_points" (default 33) and "interpolation"
+ *  ("tetrahedral" or "trilinear") control the table.
+ */
+
+#include "oyArray2d_s.h"
+#include "oyCMM_s.h"
+#include "oyCMMapi6_s_.h"
+#include "oyCMMapi7_s_.h"
+#include "oyConnectorImaging_s_.h"
+#include "oyConversion_s.h"
+#include "oyImage_s.h"
+#include "oyPixelAccess_s.h"
+
+#include "oyranos_cmm.h"         /* the API's this CMM implements */
+#include "oyranos_generic.h"     /* oy_connector_imaging_static_object */
+#include "oyranos_helper.h"      /* OY_MIN and other local helpers */
+#include "oyranos_i18n.h"
+#include "oyranos_icc.h"
+#include "oyranos_image.h"
+#include "oyranos_module_internal.h"
+#include "oyranos_string.h"
+#include "oyranos_threads.h"
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define clutUSE_X86 1
+#include <immintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define clutUSE_NEON 1
+#include <arm_neon.h>
+#endif
+
+/*
+oyCMM_s         clut_cmm_module;
+oyCMMapi6_s     clut_api6_cmm;
+oyCMMapi7_s     clut_api7_cmm;
+*/
+
+
+/* --- internal definitions --- */
+
+#define CMM_NICK "clut"
+#define CMM_VERSION {0,1,0}
+#define clutTABLE "cl3D"
+/** 33 points keep 8-bit results within one code value for smooth links
+ *  and need 575 kB of table. */
+#define clutGRID_DEFAULT 33
+#define clutGRID_MAX 129
+/** samples along the neutral axis for placing the grid points */
+#define clutRAMP_N 1024
+/** share of arc length in the grid point placement; the rest is linear */
+#define clutARC_WEIGHT 0.75
+/** pixels per interpolation step; keeps the float buffers on the stack */
+#define clutCHUNK 256
+
+oyMessage_f clut_msg = oyMessageFunc;
+
+int            clutCMMMessageFuncSet ( oyMessage_f         clut_msg_func );
+int                clutCMMInit       ( oyStruct_s        * filter );
+
+typedef struct clutTable_s_ clutTable_s;
+typedef void (*clutKernel_f)         ( const clutTable_s * t,
+                                       const float       * xyz,
+                                       float             * res,
+                                       int                 n );
+/** The table holds four floats per grid point. So one grid point fills a
+ *  128-bit vector and the kernels interpolate all channels at once. */
+struct clutTable_s_ {
+  int          grid;                   /**< grid points per input channel */
+  int          channels;               /**< color channels of the output */
+  int          trilinear;              /**< 0 - tetrahedral, 1 - trilinear */
+  float      * nodes;                  /**< grid^3 * 4 values in 0...1 */
+  float      * in_lut;                 /**< 16-bit code to grid position */
+  const char * kernel;                 /**< name of the selected kernel */
+  clutKernel_f run;
+};
+
+/** Function clutRelease
+ *  @brief   release a clutTable_s
+ *
+ *  Implements oyPointer_release_f.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+int                clutRelease       ( oyPointer         * table )
+{
+  clutTable_s * t;
+
+  if(!table || !*table)
+    return 1;
+
+  t = (clutTable_s*) *table;
+  if(t->nodes)
+    oyDeAllocateFunc_( t->nodes );
+  if(t->in_lut)
+    oyDeAllocateFunc_( t->in_lut );
+  oyDeAllocateFunc_( t );
+  *table = 0;
+
+  return 0;
+}
+
+/* --- interpolation --- */
+
+/* the cell around a grid position and the offsets inside it */
+static const float * clutCell_       ( const clutTable_s * t,
+                                       const float       * x,
+                                       float             * f )
+{
+  int g = t->grid, i[3], c;
+
+  for(c = 0; c < 3; ++c)
+  {
+    i[c] = (int) x[c];
+    if(i[c] > g - 2)
+      i[c] = g - 2;
+    f[c] = x[c] - i[c];
+  }
+
+  return t->nodes + ((i[0] * g + i[1]) * g + i[2]) * 4;
+}
+
+/* axes by falling offset, indexed by the three offset comparisons;
+ * the indexes 1 and 6 can not occur */
+static const unsigned char clut_tetra_axes[8][3] = {
+  {2,1,0}, {0,1,2}, {1,2,0}, {1,0,2}, {2,0,1}, {0,2,1}, {0,1,2}, {0,1,2} };
+
+/* sort the offsets into the tetrahedron containing them; a table instead
+ * of branches, as neighbour pixels often fall into different ones */
+static void    clutTetra_            ( const clutTable_s * t,
+                                       const float       * f,
+                                       int               * o1,
+                                       int               * o2,
+                                       float             * w )
+{
+  int step[3] = { 4 * t->grid * t->grid, 4 * t->grid, 4 };
+  const unsigned char * a = clut_tetra_axes[ (f[0] >= f[1]) << 2 |
+                                             (f[1] >= f[2]) << 1 |
+                                             (f[0] >= f[2]) ];
+
+  *o1 = step[a[0]];
+  *o2 = *o1 + step[a[1]];
+  w[0] = f[a[0]];
+  w[1] = f[a[1]];
+  w[2] = f[a[2]];
+}
+
+/* the portable reference; the vector variants compute the same */
+static void    clutTetraC_           ( const clutTable_s * t,
+                                       const float       * xyz,
+                                       float             * res,
+                                       int                 n )
+{
+  int o3 = 4 * (t->grid * t->grid + t->grid + 1), i, c;
+
+  for(i = 0; i < n; ++i)
+  {
+    float f[3], w[3];
+    int o1, o2;
+    const float * p = clutCell_( t, xyz + 3*i, f );
+
+    clutTetra_( t, f, &o1, &o2, w );
+    for(c = 0; c < 4; ++c)
+      res[4*i + c] = p[c] + w[0] * (p[o1+c] - p[c])
+                          + w[1] * (p[o2+c] - p[o1+c])
+                          + w[2] * (p[o3+c] - p[o2+c]);
+  }
+}
+
+static void    clutTrilinearC_       ( const clutTable_s * t,
+                                       const float       * xyz,
+                                       float             * res,
+                                       int                 n )
+{
+  int dz = 4, dy = 4 * t->grid, dx = dy * t->grid, i, c;
+
+  for(i = 0; i < n; ++i)
+  {
+    float f[3];
+    const float * p = clutCell_( t, xyz + 3*i, f );
+
+    for(c = 0; c < 4; ++c)
+    {
+      const float * q = p + c;
+      float c00 = q[0]     + f[2] * (q[dz]       - q[0]),
+            c01 = q[dy]    + f[2] * (q[dy+dz]    - q[dy]),
+            c10 = q[dx]    + f[2] * (q[dx+dz]    - q[dx]),
+            c11 = q[dx+dy] + f[2] * (q[dx+dy+dz] - q[dx+dy]),
+            c0 = c00 + f[1] * (c01 - c00),
+            c1 = c10 + f[1] * (c11 - c10);
+      res[4*i + c] = c0 + f[0] * (c1 - c0);
+    }
+  }
+}
+
+#if defined(clutUSE_X86)
+__attribute__((target("sse2")))
+static void    clutTetraSSE2_        ( const clutTable_s * t,
+                                       const float       * xyz,
+                                       float             * res,
+                                       int                 n )
+{
+  int o3 = 4 * (t->grid * t->grid + t->grid + 1), i;
+
+  for(i = 0; i < n; ++i)
+  {
+    float f[3], w[3];
+    int o1, o2;
+    const float * p = clutCell_( t, xyz + 3*i, f );
+    __m128 c0, c1, c2, c3, r;
+
+    clutTetra_( t, f, &o1, &o2, w );
+    c0 = _mm_loadu_ps( p );
+    c1 = _mm_loadu_ps( p + o1 );
+    c2 = _mm_loadu_ps( p + o2 );
+    c3 = _mm_loadu_ps( p + o3 );
+    r = _mm_add_ps( c0, _mm_mul_ps( _mm_set1_ps( w[0] ), _mm_sub_ps( c1, c0 ) ) );
+    r = _mm_add_ps( r,  _mm_mul_ps( _mm_set1_ps( w[1] ), _mm_sub_ps( c2, c1 ) ) );
+    r = _mm_add_ps( r,  _mm_mul_ps( _mm_set1_ps( w[2] ), _mm_sub_ps( c3, c2 ) ) );
+    _mm_storeu_ps( res + 4*i, r );
+  }
+}
+
+__attribute__((target("sse2")))
+static void    clutTrilinearSSE2_    ( const clutTable_s * t,
+                                       const float       * xyz,
+                                       float             * res,
+                                       int                 n )
+{
+  int dz = 4, dy = 4 * t->grid, dx = dy * t->grid, i;
+
+  for(i = 0; i < n; ++i)
+  {
+    float f[3];
+    const float * p = clutCell_( t, xyz + 3*i, f );
+    __m128 fx = _mm_set1_ps( f[0] ), fy = _mm_set1_ps( f[1] ),
+           fz = _mm_set1_ps( f[2] ),
+           q000 = _mm_loadu_ps( p ),       q001 = _mm_loadu_ps( p + dz ),
+           q010 = _mm_loadu_ps( p + dy ),  q011 = _mm_loadu_ps( p + dy+dz ),
+           q100 = _mm_loadu_ps( p + dx ),  q101 = _mm_loadu_ps( p + dx+dz ),
+           q110 = _mm_loadu_ps( p + dx+dy ), q111 = _mm_loadu_ps( p + dx+dy+dz ),
+           c00 = _mm_add_ps( q000, _mm_mul_ps( fz, _mm_sub_ps( q001, q000 ) ) ),
+           c01 = _mm_add_ps( q010, _mm_mul_ps( fz, _mm_sub_ps( q011, q010 ) ) ),
+           c10 = _mm_add_ps( q100, _mm_mul_ps( fz, _mm_sub_ps( q101, q100 ) ) ),
+           c11 = _mm_add_ps( q110, _mm_mul_ps( fz, _mm_sub_ps( q111, q110 ) ) ),
+           c0 = _mm_add_ps( c00, _mm_mul_ps( fy, _mm_sub_ps( c01, c00 ) ) ),
+           c1 = _mm_add_ps( c10, _mm_mul_ps( fy, _mm_sub_ps( c11, c10 ) ) );
+    _mm_storeu_ps( res + 4*i, _mm_add_ps( c0, _mm_mul_ps( fx, _mm_sub_ps( c1, c0 ) ) ) );
+  }
+}
+#endif /* clutUSE_X86 */
+
+#if defined(clutUSE_NEON)
+static void    clutTetraNEON_        ( const clutTable_s * t,
+                                       const float       * xyz,
+                                       float             * res,
+                                       int                 n )
+{
+  int o3 = 4 * (t->grid * t->grid + t->grid + 1), i;
+
+  for(i = 0; i < n; ++i)
+  {
+    float f[3], w[3];
+    int o1, o2;
+    const float * p = clutCell_( t, xyz + 3*i, f );
+    float32x4_t c0, c1, c2, c3, r;
+
+    clutTetra_( t, f, &o1, &o2, w );
+    c0 = vld1q_f32( p );
+    c1 = vld1q_f32( p + o1 );
+    c2 = vld1q_f32( p + o2 );
+    c3 = vld1q_f32( p + o3 );
+    r = vaddq_f32( c0, vmulq_n_f32( vsubq_f32( c1, c0 ), w[0] ) );
+    r = vaddq_f32( r,  vmulq_n_f32( vsubq_f32( c2, c1 ), w[1] ) );
+    r = vaddq_f32( r,  vmulq_n_f32( vsubq_f32( c3, c2 ), w[2] ) );
+    vst1q_f32( res + 4*i, r );
+  }
+}
+
+static void    clutTrilinearNEON_    ( const clutTable_s * t,
+                                       const float       * xyz,
+                                       float             * res,
+                                       int                 n )
+{
+  int dz = 4, dy = 4 * t->grid, dx = dy * t->grid, i;
+
+  for(i = 0; i < n; ++i)
+  {
+    float f[3];
+    const float * p = clutCell_( t, xyz + 3*i, f );
+    float32x4_t q000 = vld1q_f32( p ),       q001 = vld1q_f32( p + dz ),
+                q010 = vld1q_f32( p + dy ),  q011 = vld1q_f32( p + dy+dz ),
+                q100 = vld1q_f32( p + dx ),  q101 = vld1q_f32( p + dx+dz ),
+                q110 = vld1q_f32( p + dx+dy ), q111 = vld1q_f32( p + dx+dy+dz ),
+                c00 = vaddq_f32( q000, vmulq_n_f32( vsubq_f32( q001, q000 ), f[2] ) ),
+                c01 = vaddq_f32( q010, vmulq_n_f32( vsubq_f32( q011, q010 ), f[2] ) ),
+                c10 = vaddq_f32( q100, vmulq_n_f32( vsubq_f32( q101, q100 ), f[2] ) ),
+                c11 = vaddq_f32( q110, vmulq_n_f32( vsubq_f32( q111, q110 ), f[2] ) ),
+                c0 = vaddq_f32( c00, vmulq_n_f32( vsubq_f32( c01, c00 ), f[1] ) ),
+                c1 = vaddq_f32( c10, vmulq_n_f32( vsubq_f32( c11, c10 ), f[1] ) );
+    vst1q_f32( res + 4*i, vaddq_f32( c0, vmulq_n_f32( vsubq_f32( c1, c0 ), f[0] ) ) );
+  }
+}
+#endif /* clutUSE_NEON */
+
+/* pick the kernel once per table; wider vectors than one grid point would
+ * need gathers and do not pay off for four channels */
+static void    clutSelect_           ( clutTable_s       * t )
+{
+  t->kernel = t->trilinear ? "trilinear C" : "tetrahedral C";
+  t->run = t->trilinear ? clutTrilinearC_ : clutTetraC_;
+#if defined(clutUSE_X86)
+  __builtin_cpu_init();
+  if(__builtin_cpu_supports( "sse2" ))
+  {
+    t->kernel = t->trilinear ? "trilinear SSE2" : "tetrahedral SSE2";
+    t->run = t->trilinear ? clutTrilinearSSE2_ : clutTetraSSE2_;
+  }
+#elif defined(clutUSE_NEON)
+  t->kernel = t->trilinear ? "trilinear NEON" : "tetrahedral NEON";
+  t->run = t->trilinear ? clutTrilinearNEON_ : clutTetraNEON_;
+#endif
+}
+
+/* input pixels to grid positions */
+static void    clutShape_            ( const clutTable_s * t,
+                                       const uint8_t     * in,
+                                       oyDATATYPE_e        type,
+                                       int                 channels,
+                                       int                 n,
+                                       float             * xyz )
+{
+  const float * lut = t->in_lut;
+  int i, c;
+
+  for(i = 0; i < n; ++i)
+    for(c = 0; c < 3; ++c)
+    {
+      int j = i * channels + c;
+      if(type == oyUINT8)
+        xyz[3*i + c] = lut[in[j] * 257];
+      else if(type == oyUINT16)
+        xyz[3*i + c] = lut[((const uint16_t*)in)[j]];
+      else
+      {
+        float v = ((const float*)in)[j];
+        int k;
+        if(!(v > 0.0f)) v = 0.0f;
+        if(v > 1.0f) v = 1.0f;
+        v *= 65535.0f;
+        k = (int) v;
+        /* in_lut has one extra entry for k = 65535 */
+        xyz[3*i + c] = lut[k] + (v - k) * (lut[k+1] - lut[k]);
+      }
+    }
+}
+
+static float   clutGet_              ( const uint8_t     * p,
+                                       oyDATATYPE_e        type,
+                                       int                 j )
+{
+  if(type == oyUINT8)
+    return p[j] / 255.0f;
+  else if(type == oyUINT16)
+    return ((const uint16_t*)p)[j] / 65535.0f;
+  return ((const float*)p)[j];
+}
+
+static void    clutSet_              ( uint8_t           * p,
+                                       oyDATATYPE_e        type,
+                                       int                 j,
+                                       float               v )
+{
+  if(type == oyFLOAT)
+  {
+    ((float*)p)[j] = v;
+    return;
+  }
+  if(!(v > 0.0f)) v = 0.0f;
+  if(v > 1.0f) v = 1.0f;
+  if(type == oyUINT8)
+    p[j] = (uint8_t)(v * 255.0f + 0.5f);
+  else
+    ((uint16_t*)p)[j] = (uint16_t)(v * 65535.0f + 0.5f);
+}
+
+/* lines of clutFilterPlug_Run() for oyParallelFor() */
+typedef struct {
+  const clutTable_s * t;
+  uint8_t ** array_in_data;
+  uint8_t ** array_out_data;
+  int n;
+  oyDATATYPE_e data_type_in;
+  oyDATATYPE_e data_type_out;
+  int channels_in;
+  int channels_out;
+} clutLines_s;
+static void    clutLines_            ( int                 start,
+                                       int                 end,
+                                       void              * data )
+{
+  clutLines_s * l = (clutLines_s*) data;
+  const clutTable_s * t = l->t;
+  int bps_in = oyDataTypeGetSize( l->data_type_in ),
+      bps_out = oyDataTypeGetSize( l->data_type_out ),
+      extra = OY_MIN( l->channels_in - 3, l->channels_out - t->channels ),
+      k, i, j, c;
+  float xyz[clutCHUNK * 3], res[clutCHUNK * 4];
+
+  for(k = start; k < end; ++k)
+    for(i = 0; i < l->n; i += clutCHUNK)
+    {
+      int m = OY_MIN( clutCHUNK, l->n - i );
+      const uint8_t * in = l->array_in_data[k] + i * l->channels_in * bps_in;
+      uint8_t * out = l->array_out_data[k] + i * l->channels_out * bps_out;
+
+      clutShape_( t, in, l->data_type_in, l->channels_in, m, xyz );
+      t->run( t, xyz, res, m );
+
+      for(j = 0; j < m; ++j)
+      {
+        int p_in = j * l->channels_in,
+            p_out = j * l->channels_out;
+        for(c = 0; c < t->channels; ++c)
+          clutSet_( out, l->data_type_out, p_out + c, res[4*j + c] );
+        /* alpha and other extra channels pass through */
+        for(c = 0; c < extra; ++c)
+          clutSet_( out, l->data_type_out, p_out + t->channels + c,
+                    clutGet_( in, l->data_type_in, p_in + 3 + c ) );
+        for(c = t->channels + OY_MAX( extra, 0 ); c < l->channels_out; ++c)
+          clutSet_( out, l->data_type_out, p_out + c, 1.0f );
+      }
+    }
+}
+
+/* --- table creation --- */
+
+/* run pixels through the device link with the module, which created it */
+static int     clutSample_           ( oyProfile_s       * link,
+                                       oyProfile_s       * out,
+                                       const char        * nick,
+                                       uint16_t          * in,
+                                       uint16_t          * result,
+                                       int                 n,
+                                       int                 channels )
+{
+  oyImage_s * input = oyImage_Create( n, 1, in,
+                                     oyChannels_m(3) | oyDataType_m(oyUINT16),
+                                      link, 0 ),
+            * output = oyImage_Create( n, 1, result,
+                              oyChannels_m(channels) | oyDataType_m(oyUINT16),
+                                       out, 0 );
+  oyOptions_s * opts = NULL;
+  oyConversion_s * cc;
+  int error;
+
+  oyOptions_SetFromString( &opts, "////context", nick, OY_CREATE_NEW );
+  oyOptions_SetFromString( &opts, "////renderer", nick, OY_CREATE_NEW );
+  cc = oyConversion_CreateBasicPixels( input, output, opts, 0 );
+  error = !cc || oyConversion_RunPixels( cc, NULL );
+
+  oyConversion_Release( &cc );
+  oyOptions_Release( &opts );
+  oyImage_Release( &input );
+  oyImage_Release( &output );
+
+  return error;
+}
+
+/* Place the grid points along the input axis by the arc length of the
+ * neutral axis in output space. Steep curves get more points, which
+ * keeps interpolation errors even. in_lut maps each 16-bit code to its
+ * grid position. */
+static int     clutShaper_           ( clutTable_s       * t,
+                                       oyProfile_s       * link,
+                                       oyProfile_s       * out,
+                                       const char        * nick,
+                                       int               * q )
+{
+  int g = t->grid, i, j, c, k = 0, error;
+  uint16_t * ramp = oyAllocateFunc_( clutRAMP_N * 3 * sizeof(uint16_t) ),
+           * ramp_out = oyAllocateFunc_( clutRAMP_N * t->channels *
+                                         sizeof(uint16_t) );
+  double * s = oyAllocateFunc_( clutRAMP_N * sizeof(double) );
+
+  error = !ramp || !ramp_out || !s;
+  for(i = 0; i < clutRAMP_N && !error; ++i)
+    ramp[3*i] = ramp[3*i+1] = ramp[3*i+2] =
+      (uint16_t)(i * 65535.0 / (clutRAMP_N - 1) + 0.5);
+
+  if(!error)
+    error = clutSample_( link, out, nick, ramp, ramp_out, clutRAMP_N,
+                         t->channels );
+
+  if(!error)
+  {
+    s[0] = 0.0;
+    for(i = 1; i < clutRAMP_N; ++i)
+    {
+      double d = 0.0;
+      for(c = 0; c < t->channels; ++c)
+      {
+        double v = (ramp_out[i*t->channels + c] -
+                    ramp_out[(i-1)*t->channels + c]) / 65535.0;
+        d += v * v;
+      }
+      s[i] = s[i-1] + sqrt( d );
+    }
+    for(i = 0; i < clutRAMP_N; ++i)
+      s[i] = clutARC_WEIGHT * (s[clutRAMP_N-1] > 0.0 ? s[i] / s[clutRAMP_N-1] :
+                                 i / (double)(clutRAMP_N - 1)) +
+             (1.0 - clutARC_WEIGHT) * i / (double)(clutRAMP_N - 1);
+
+    /* invert the monotonic weight curve at even steps */
+    for(j = 0; j < g; ++j)
+    {
+      double target = j / (double)(g - 1), x;
+      while(k < clutRAMP_N - 2 && s[k+1] < target)
+        ++k;
+      x = s[k+1] > s[k] ? (target - s[k]) / (s[k+1] - s[k]) : 0.0;
+      if(x > 1.0) x = 1.0;
+      q[j] = (int)((k + x) * 65535.0 / (clutRAMP_N - 1) + 0.5);
+    }
+    /* strictly increasing codes from 0 to 65535 */
+    q[0] = 0;
+    for(j = 1; j < g; ++j)
+      if(q[j] <= q[j-1])
+        q[j] = q[j-1] + 1;
+    q[g-1] = 65535;
+    for(j = g - 2; j > 0; --j)
+      if(q[j] >= q[j+1])
+        q[j] = q[j+1] - 1;
+
+    for(j = 0; j < g - 1; ++j)
+      for(i = q[j]; i < q[j+1]; ++i)
+        t->in_lut[i] = j + (i - q[j]) / (float)(q[j+1] - q[j]);
+    t->in_lut[65535] = t->in_lut[65536] = (float)(g - 1);
+  }
+
+  if(ramp) oyDeAllocateFunc_( ramp );
+  if(ramp_out) oyDeAllocateFunc_( ramp_out );
+  if(s) oyDeAllocateFunc_( s );
+
+  return error;
+}
+
+/* sample the device link at the grid points */
+static int     clutNodes_            ( clutTable_s       * t,
+                                       oyProfile_s       * link,
+                                       oyProfile_s       * out,
+                                       const char        * nick,
+                                       const int         * q )
+{
+  int g = t->grid, n = g * g * g, r, i, j, c, error;
+  uint16_t * in = oyAllocateFunc_( n * 3 * sizeof(uint16_t) ),
+           * result = oyAllocateFunc_( n * t->channels * sizeof(uint16_t) );
+
+  error = !in || !result;
+  for(r = 0; r < g && !error; ++r)
+    for(i = 0; i < g; ++i)
+      for(j = 0; j < g; ++j)
+      {
+        int pos = (r * g + i) * g + j;
+        in[3*pos] = (uint16_t) q[r];
+        in[3*pos + 1] = (uint16_t) q[i];
+        in[3*pos + 2] = (uint16_t) q[j];
+      }
+
+  if(!error)
+    error = clutSample_( link, out, nick, in, result, n, t->channels );
+
+  for(i = 0; i < n && !error; ++i)
+    for(c = 0; c < 4; ++c)
+      t->nodes[4*i + c] = c < t->channels ?
+                          result[i * t->channels + c] / 65535.0f : 0.0f;
+
+  if(in) oyDeAllocateFunc_( in );
+  if(result) oyDeAllocateFunc_( result );
+
+  return error;
+}
+
+/** Function clutModuleData_Convert
+ *  @brief   Convert a ICC device link to a sampled 3D table
+ *  @ingroup cmm_handling
+ *
+ *  The device link is rendered by the module, which created it. So the
+ *  table contains the same transform, just sampled. Only RGB input and
+ *  RGB, CMYK or Gray output are supported.
+ *  Implements oyModuleData_Convert_f
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+int  clutModuleData_Convert          ( oyPointer_s       * data_in,
+                                       oyPointer_s       * data_out,
+                                       oyFilterNode_s    * node )
+{
+  int error = !data_in || !data_out;
+  oyOptions_s * node_options = oyFilterNode_GetOptions( node, 0 );
+  oyProfile_s * link = 0, * out = 0;
+  clutTable_s * t = 0;
+  char * nick = 0;
+  const char * interpolation;
+  int32_t grid = clutGRID_DEFAULT;
+  int q[clutGRID_MAX];
+
+  if(!error &&
+     ( strcmp( oyPointer_GetResourceName(data_in), oyCOLOR_ICC_DEVICE_LINK ) != 0 ||
+       strcmp( oyPointer_GetResourceName(data_out), clutTABLE ) != 0 ))
+    error = 1;
+
+  if(!error)
+  {
+    icColorSpaceSignature sig_in, sig_out;
+
+    link = oyProfile_FromMem( oyPointer_GetSize( data_in ),
+                              oyPointer_GetPointer( data_in ), 0, 0 );
+    nick = oyCMMnameFromLibName_( oyPointer_GetLibName( data_in ) );
+    sig_in = (icColorSpaceSignature)
+             oyProfile_GetSignature( link, oySIGNATURE_COLOR_SPACE );
+    sig_out = (icColorSpaceSignature)
+              oyProfile_GetSignature( link, oySIGNATURE_PCS );
+    if(sig_out == icSigRgbData)
+      out = oyProfile_FromStd( oyASSUMED_RGB, 0, 0 );
+    else if(sig_out == icSigCmykData)
+      out = oyProfile_FromStd( oyASSUMED_CMYK, 0, 0 );
+    else if(sig_out == icSigGrayData)
+      out = oyProfile_FromStd( oyASSUMED_GRAY, 0, 0 );
+
+    if(!link || !nick || !out || sig_in != icSigRgbData)
+    {
+      clut_msg( oyMSG_WARN, (oyStruct_s*)node, OY_DBG_FORMAT_
+                "unsupported device link: %s -> %s from %s", OY_DBG_ARGS_,
+                oyICCColorSpaceGetName( sig_in ),
+                oyICCColorSpaceGetName( sig_out ),
+                oyNoEmptyString_m_(nick) );
+      error = 1;
+    }
+  }
+
+  if(!error)
+  {
+    oyOptions_FindInt( node_options, "grid_points", 0, &grid );
+    if(grid < 2) grid = 2;
+    if(grid > clutGRID_MAX) grid = clutGRID_MAX;
+    interpolation = oyOptions_FindString( node_options, "interpolation", 0 );
+
+    t = oyAllocateFunc_( sizeof(clutTable_s) );
+    error = !t;
+  }
+
+  if(!error)
+  {
+    memset( t, 0, sizeof(clutTable_s) );
+    t->grid = grid;
+    t->channels = oyProfile_GetChannelsCount( out );
+    t->trilinear = interpolation && strcmp( interpolation, "trilinear" ) == 0;
+    t->nodes = oyAllocateFunc_( grid * grid * grid * 4 * sizeof(float) );
+    t->in_lut = oyAllocateFunc_( 65537 * sizeof(float) );
+    error = !t->nodes || !t->in_lut;
+  }
+
+  if(!error)
+    error = clutShaper_( t, link, out, nick, q );
+  if(!error)
+    error = clutNodes_( t, link, out, nick, q );
+
+  if(!error)
+  {
+    clutSelect_( t );
+    error = oyPointer_Set( data_out, 0, 0, t, "clutRelease", clutRelease );
+    if(oy_debug)
+      clut_msg( oyMSG_DBG, (oyStruct_s*)node, OY_DBG_FORMAT_
+                "%d^3 table from %s with %s", OY_DBG_ARGS_,
+                t->grid, nick, t->kernel );
+  } else
+    clutRelease( (oyPointer*)&t );
+
+  if(nick)
+    oyFree_m_( nick );
+  oyProfile_Release( &link );
+  oyProfile_Release( &out );
+  oyOptions_Release( &node_options );
+
+  return error;
+}
+
+/** Function clutFilterPlug_Run
+ *  @brief   implement oyCMMFilterPlug_GetNext_f()
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+int      clutFilterPlug_Run          ( oyFilterPlug_s    * requestor_plug,
+                                       oyPixelAccess_s   * ticket )
+{
+  int error = 0;
+  oyDATATYPE_e data_type_in = 0,
+               data_type_out = 0;
+  int channels_out, channels_in;
+  oyPixel_t pixel_layout_in,
+            layout_out;
+
+  oyFilterSocket_s * socket = oyFilterPlug_GetSocket( requestor_plug );
+  oyFilterPlug_s * plug = 0;
+  oyFilterNode_s * input_node,
+                 * node = oyFilterSocket_GetNode( socket );
+  oyImage_s * image_input = 0, * image_output = 0;
+  oyArray2d_s * array_in = 0, * array_out = 0;
+  oyPointer_s * backend_data = 0;
+  clutTable_s * t = 0;
+  oyPixelAccess_s * new_ticket = ticket;
+
+  plug = oyFilterNode_GetPlug( node, 0 );
+  input_node = oyFilterNode_GetPlugNode( node, 0 );
+
+  image_input = oyFilterPlug_ResolveImage( plug, socket, ticket );
+  pixel_layout_in = oyImage_GetPixelLayout( image_input, oyLAYOUT );
+  channels_in = oyToChannels_m( pixel_layout_in );
+
+  image_output = oyPixelAccess_GetOutputImage( ticket );
+  layout_out = oyImage_GetPixelLayout( image_output, oyLAYOUT );
+  channels_out = oyToChannels_m( layout_out );
+
+  if(pixel_layout_in != layout_out)
+  {
+    /* create a new ticket to avoid pixel layout conflicts */
+    /* keep old ticket array dimensions */
+    oyArray2d_s * a,
+                * old_a = oyPixelAccess_GetArray( new_ticket );
+    new_ticket = oyPixelAccess_Copy( ticket, ticket->oy_ );
+    oyPixelAccess_SetOutputImage( new_ticket, image_input );
+
+    /* remove old array as it's layout does not fit */
+    oyPixelAccess_SetArray( new_ticket, 0, 0 );
+    a = oyPixelAccess_GetArray( new_ticket );
+    if(!a && channels_out)
+    {
+      int w = oyArray2d_GetDataGeo1( old_a, 2 ) / channels_out;
+      int h = oyArray2d_GetDataGeo1( old_a, 3 );
+      /* recycle the array of a previous run with the same ticket */
+      a = oyPixelAccess_TakeArray( ticket, w * channels_in, h,
+                                   oyToDataType_m( pixel_layout_in ) );
+    }
+    oyArray2d_Release( &old_a );
+    oyPixelAccess_SetArray( new_ticket, a, 0 );
+    oyArray2d_Release( &a );
+
+    oyPixelAccess_SynchroniseROI( new_ticket, ticket );
+  }
+
+  /* We let the input filter do its processing first. */
+  error = oyFilterNode_Run( input_node, plug, new_ticket );
+  if(error != 0)
+  {
+    clut_msg( oyMSG_ERROR, (oyStruct_s*)input_node, OY_DBG_FORMAT_"%s %d err:%d",
+              OY_DBG_ARGS_, _("running new ticket failed"),
+              oyStruct_GetId( (oyStruct_s*)new_ticket ), error );
+    goto clean;
+  }
+
+  array_in = oyPixelAccess_GetArray( new_ticket );
+  array_out = oyPixelAccess_GetArray( ticket );
+
+  data_type_in = oyToDataType_m( pixel_layout_in );
+  data_type_out = oyToDataType_m( layout_out );
+
+  backend_data = oyFilterNode_GetContext( node );
+  if(backend_data &&
+     strcmp( oyPointer_GetResourceName( backend_data ), clutTABLE ) == 0)
+    t = (clutTable_s*) oyPointer_GetPointer( backend_data );
+
+  if(!t || !array_in || !array_out || channels_in < 3 ||
+     channels_out < t->channels)
+  {
+    oyFilterGraph_s * ticket_graph = oyPixelAccess_GetGraph( ticket );
+    oyOptions_s * ticket_graph_opts = oyFilterGraph_GetOptions( ticket_graph );
+
+    oyFilterSocket_Callback( requestor_plug,
+                             oyCONNECTOR_EVENT_INCOMPATIBLE_CONTEXT );
+    oyOptions_SetFromString( &ticket_graph_opts,
+                     "//" OY_TYPE_STD "/profile/dirty", "true", OY_CREATE_NEW );
+    oyFilterGraph_Release( &ticket_graph );
+    oyOptions_Release( &ticket_graph_opts );
+    error = 1;
+  } else if(!(data_type_in == oyUINT8 || data_type_in == oyUINT16 ||
+              data_type_in == oyFLOAT) ||
+            !(data_type_out == oyUINT8 || data_type_out == oyUINT16 ||
+              data_type_out == oyFLOAT))
+  {
+    oyFilterSocket_Callback( requestor_plug, oyCONNECTOR_EVENT_INCOMPATIBLE_DATA );
+    error = 1;
+  } else
+  {
+    int w_in =  (int)(oyArray2d_GetWidth(array_in)+0.5),
+        w_out = (int)(oyArray2d_GetWidth(array_out)+0.5),
+        lines = OY_MIN( oyArray2d_GetHeight(array_in),
+                        oyArray2d_GetHeight(array_out) );
+    clutLines_s l = { t, oyArray2d_GetData( array_in ),
+                      oyArray2d_GetData( array_out ),
+                      OY_MIN(w_in/channels_in, w_out/channels_out),
+                      data_type_in, data_type_out,
+                      channels_in, channels_out };
+
+    oyParallelFor( lines, clutLines_, &l, 1 );
+  }
+
+  clean:
+  if(new_ticket != ticket)
+  {
+    oyPixelAccess_Release( &new_ticket );
+    /* keep the intermediate array for the next frame */
+    oyPixelAccess_GiveArray( ticket, &array_in );
+  }
+
+  oyPointer_Release( &backend_data );
+  oyFilterPlug_Release( &plug );
+  oyFilterSocket_Release( &socket );
+  oyFilterNode_Release( &input_node );
+  oyFilterNode_Release( &node );
+  oyImage_Release( &image_input );
+  oyImage_Release( &image_output );
+  oyArray2d_Release( &array_in );
+  oyArray2d_Release( &array_out );
+
+  return error;
+}
+
+
+/** Function clutCMMInit
+ *  @brief   API requirement
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+int                clutCMMInit       ( oyStruct_s        * filter OY_UNUSED )
+{
+  int error = 0;
+  return error;
+}
+
+/** Function clutCMMMessageFuncSet
+ *  @brief
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+int            clutCMMMessageFuncSet ( oyMessage_f         message_func )
+{
+  clut_msg = message_func;
+  return 0;
+}
+
+
+oyDATATYPE_e clut_data_types[4] = {oyUINT8, oyUINT16, oyFLOAT, 0};
+
+oyConnectorImaging_s_ clut_socket_connector = {
+  oyOBJECT_CONNECTOR_IMAGING_S,0,0,
+                               (oyObject_s)&oy_connector_imaging_static_object,
+  oyCMMgetImageConnectorSocketText, /* getText */
+  oy_image_connector_texts, /* texts */
+  "//" OY_TYPE_STD "/manipulator.data", /* connector_type */
+  oyFilterSocket_MatchImagingPlug, /* filterSocket_MatchPlug */
+  0, /* is_plug == oyFilterPlug_s */
+  clut_data_types, /* data_types */
+  3, /* data_types_n; elements in data_types array */
+  0, /* max_color_offset */
+  1, /* min_channels_count; */
+  16, /* max_channels_count; */
+  1, /* min_color_count; */
+  4, /* max_color_count; */
+  0, /* can_planar; can read separated channels */
+  1, /* can_interwoven; can read continuous channels */
+  0, /* can_swap; can swap color channels (BGR)*/
+  0, /* can_swap_bytes; non host byte order */
+  0, /* can_revert; revert 1 -> 0 and 0 -> 1 */
+  0, /* can_premultiplied_alpha; */
+  1, /* can_nonpremultiplied_alpha; */
+  0, /* can_subpixel; understand subpixel order */
+  0, /* oyCHANNELTYPE_e    * channel_types; */
+  0, /* channel_types_n */
+  1, /* id; relative to oyFilterCore_s, e.g. 1 */
+  0  /* is_mandatory; mandatory flag */
+};
+oyConnectorImaging_s_* clut_socket_connectors[2]={&clut_socket_connector,0};
+
+oyConnectorImaging_s_ clut_plug_connector = {
+  oyOBJECT_CONNECTOR_IMAGING_S,0,0,
+                               (oyObject_s)&oy_connector_imaging_static_object,
+  oyCMMgetImageConnectorPlugText, /* getText */
+  oy_image_connector_texts, /* texts */
+  "//" OY_TYPE_STD "/manipulator.data", /* connector_type */
+  oyFilterSocket_MatchImagingPlug, /* filterSocket_MatchPlug */
+  1, /* is_plug == oyFilterPlug_s */
+  clut_data_types, /* data_types */
+  3, /* data_types_n; elements in data_types array */
+  0, /* max_color_offset */
+  3, /* min_channels_count; */
+  16, /* max_channels_count; */
+  3, /* min_color_count; */
+  3, /* max_color_count; */
+  0, /* can_planar; can read separated channels */
+  1, /* can_interwoven; can read continuous channels */
+  0, /* can_swap; can swap color channels (BGR)*/
+  0, /* can_swap_bytes; non host byte order */
+  0, /* can_revert; revert 1 -> 0 and 0 -> 1 */
+  0, /* can_premultiplied_alpha; */
+  1, /* can_nonpremultiplied_alpha; */
+  0, /* can_subpixel; understand subpixel order */
+  0, /* oyCHANNELTYPE_e    * channel_types; */
+  0, /* channel_types_n */
+  1, /* id; relative to oyFilterCore_s, e.g. 1 */
+  0  /* is_mandatory; mandatory flag */
+};
+oyConnectorImaging_s_* clut_plug_connectors[2]={&clut_plug_connector,0};
+
+#define OY_CLUT_DATA_CONVERT_REGISTRATION  OY_TOP_SHARED OY_SLASH OY_DOMAIN_INTERNAL OY_SLASH OY_TYPE_STD OY_SLASH \
+  "icc_color._" CMM_NICK "._CPU." oyCOLOR_ICC_DEVICE_LINK "_" clutTABLE
+
+/** @instance clut_api6_cmm
+ *  @brief    Node for converting a device link into a 3D table
+ *
+ *  This Node type uses internally clutModuleData_Convert().
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+oyCMMapi6_s_ clut_api6_cmm = {
+
+  oyOBJECT_CMM_API6_S,
+  0,0,0,
+  (oyCMMapi_s*) NULL,
+
+  clutCMMInit,
+  clutCMMMessageFuncSet,
+
+  OY_CLUT_DATA_CONVERT_REGISTRATION,
+
+  CMM_VERSION,
+  CMM_API_VERSION,                  /**< int32_t module_api[3] */
+  0,   /* id_; keep empty */
+  0,   /* api5_; keep empty */
+  0,   /* runtime_context */
+
+  oyCOLOR_ICC_DEVICE_LINK,  /* data_type_in, "oyDL" */
+  clutTABLE,                /* data_type_out, clutTABLE */
+  clutModuleData_Convert    /* oyModuleData_Convert_f oyModuleData_Convert */
+};
+
+/** @instance clut_api7_cmm
+ *  @brief    3D table pixel processor node
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+oyCMMapi7_s_ clut_api7_cmm = {
+
+  oyOBJECT_CMM_API7_S,
+  0,0,0,
+  (oyCMMapi_s*) & clut_api6_cmm,
+
+  clutCMMInit,
+  clutCMMMessageFuncSet,
+
+  OY_TOP_SHARED OY_SLASH OY_DOMAIN_INTERNAL OY_SLASH OY_TYPE_STD OY_SLASH
+  "icc_color._" CMM_NICK "._CPU",
+
+  CMM_VERSION,
+  CMM_API_VERSION,                  /**< int32_t module_api[3] */
+  0,   /* id_; keep empty */
+  0,   /* api5_; keep empty */
+  0,   /* runtime_context */
+
+  clutFilterPlug_Run,        /* oyCMMFilterPlug_Run_f */
+  clutTABLE,                 /* data_type, clutTABLE */
+
+  (oyConnector_s**) clut_plug_connectors,   /* plugs */
+  1,                         /* plugs_n */
+  0,                         /* plugs_last_add */
+  (oyConnector_s**) clut_socket_connectors, /* sockets */
+  1,                         /* sockets_n */
+  0,                         /* sockets_last_add */
+  NULL                       /* properties */
+};
+
+
+/**
+ *  This function implements oyCMMinfoGetText_f.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+const char * clutInfoGetText         ( const char        * select,
+                                       oyNAME_e            type,
+                                       oyStruct_s        * context OY_UNUSED )
+{
+         if(strcmp(select, "name")==0)
+  {
+         if(type == oyNAME_NICK)
+      return CMM_NICK;
+    else if(type == oyNAME_NAME)
+      return _("Oyranos 3D Table");
+    else
+      return _("Oyranos 3D Table Renderer");
+  } else if(strcmp(select, "manufacturer")==0)
+  {
+         if(type == oyNAME_NICK)
+      return "Kai-Uwe";
+    else if(type == oyNAME_NAME)
+      return "Kai-Uwe Behrmann";
+    else
+      return _("Oyranos project; www: http://www.oyranos.com; support/email: ku.b@gmx.de; sources: http://www.oyranos.com/wiki/index.php?title=Oyranos/Download");
+  } else if(strcmp(select, "copyright")==0)
+  {
+         if(type == oyNAME_NICK)
+      return "BSD-3-Clause";
+    else if(type == oyNAME_NAME)
+      return _("Copyright (c) 2026 Kai-Uwe Behrmann; new BSD");
+    else
+      return _("new BSD license: http://www.opensource.org/licenses/BSD-3-Clause");
+  } else if(strcmp(select, "help")==0)
+  {
+         if(type == oyNAME_NICK)
+      return "help";
+    else if(type == oyNAME_NAME)
+      return _("The filter renders RGB pixels through a sampled device link.");
+    else
+      return _("The filter samples the device link of the context CMM into a 3D table and renders RGB pixels by tetrahedral or trilinear interpolation. The \"grid_points\" option sets the table size.");
+  }
+  return 0;
+}
+const char *clut_texts[5] = {"name","copyright","manufacturer","help",0};
+oyIcon_s clut_icon = {oyOBJECT_ICON_S, 0,0,0, 0,0,0, "oyranos_logo.png"};
+
+/** @instance clut_cmm_module
+ *  @brief    clut module infos
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+oyCMM_s clut_cmm_module = {
+
+  oyOBJECT_CMM_INFO_S,                 /**< type, struct type */
+  0,0,0,                               /**< ,dynamic object functions */
+  CMM_NICK,                            /**< cmm, ICC signature */
+  "0.6",                               /**< backend_version */
+  clutInfoGetText,                     /**< getText */
+  (char**)clut_texts,                  /**<texts; list of arguments to getText*/
+  OYRANOS_VERSION,                     /**< oy_compatibility */
+
+  (oyCMMapi_s*) & clut_api7_cmm,       /**< api */
+
+  &clut_icon, /**< icon */
+  clutCMMInit                          /**< oyCMMinfoInit_f */
+};
+
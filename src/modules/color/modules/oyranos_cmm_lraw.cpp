@@ -36,6 +36,7 @@
 #include "oyranos_definitions.h"
 #include "oyranos_string.h"
 #include "oyranos_texts.h"
+#include "oyranos_threads.h"
 
 #include <cmath>
 #include <cstdarg>
@@ -316,6 +317,91 @@ extern "C" {
 int              oyArray2d_ToPPM_    ( oyArray2d_s       * array,
                                        const char        * file_name ); }
 
+/* lines of lrawFilterPlug_ImageInputRAWRun() for oyParallelFor() */
+typedef struct {
+  uint8_t * buf;
+  const uint8_t * src;
+  double maxval;
+  int type, width, spp, byteps, byte_swap;
+} lrawLines_s;
+static void lrawLines_               ( int                 start,
+                                       int                 end,
+                                       void              * data )
+{
+  lrawLines_s * l = (lrawLines_s*)data;
+  uint8_t * buf = l->buf;
+  const uint8_t * src = l->src;
+  double maxval = l->maxval;
+  int type = l->type,
+      width = l->width,
+      spp = l->spp,
+      byteps = l->byteps;
+  int h, p,
+      n_samples = 1 * width * spp,
+      n_bytes = n_samples * byteps;
+
+  for(h = start; h < end; ++h)
+  {
+    /* adapt the copied line and not the source */
+    unsigned char *d_8 = &buf[ h * width * spp * byteps ];
+    uint16_t *d_16 = (uint16_t*)d_8;
+    float  *d_f = (float*)d_8;
+
+    /*  TODO 1 bit raw and ascii */
+    if (type == 1 || type == 4) {
+
+    /*  TODO ascii  */
+    } else if (type == 2 || type == 3) {
+
+
+    /*  raw and floats */
+    } else if (type == 5 || type == 6 ||
+               type == -5 || type == -6 ||
+               type == 7 )
+    {
+      memcpy (d_8,
+              &src[ h * width * spp * byteps ],
+              1 * width * spp * byteps);
+    }
+
+    /* normalise and byteswap */
+    if( l->byte_swap )
+    {
+      unsigned char *c_buf = d_8;
+      char  tmp;
+      if (byteps == 2) {         /* 16 bit */
+        for (p = 0; p < n_bytes; p += 2)
+        {
+          tmp = c_buf[p];
+          c_buf[p] = c_buf[p+1];
+          c_buf[p+1] = tmp;
+        }
+      } else if (byteps == 4) {  /* float */
+        for (p = 0; p < n_bytes; p += 4)
+        {
+          tmp = c_buf[p];
+          c_buf[p] = c_buf[p+3];
+          c_buf[p+3] = tmp;
+          tmp = c_buf[p+1];
+          c_buf[p+1] = c_buf[p+2];
+          c_buf[p+2] = tmp;
+        }
+      }
+    }
+
+    if (byteps == 1 && maxval < 255) {         /*  8 bit */
+      for (p = 0; p < n_samples; ++p)
+        d_8[p] = (d_8[p] * 255) / maxval;
+    } else if (byteps == 2 && maxval < 65535) {/* 16 bit */
+      for (p = 0; p < n_samples; ++p)
+        d_16 [p] = (d_16[p] * 65535) / maxval;
+    } else if (byteps == 4 && maxval != 1.0) {  /* float */
+      for (p = 0; p < n_samples; ++p)
+        d_f[p] = d_f[p] * maxval;
+    }
+  }
+}
+
 /** Function lrawFilterPlug_ImageInputRAWRun
  *  @brief   implement oyCMMFilter_GetNext_f()
  *
@@ -499,84 +585,9 @@ int      lrawFilterPlug_ImageInputRAWRun (
   /* ... and then copied from the input_ppm Oyranos filter */
   if(info_good)
   {
-    int h, j_h = 0, p, n_samples, n_bytes;
-    int byte_swap = 0; /*!oyBigEndian();*/
-    unsigned char *d_8 = 0;
-    unsigned char *src = image_rgb->data;
-
-    uint16_t *d_16;
-    float  *d_f;
-
-#pragma omp parallel for
-    for(h = 0; h < height; ++h)
-    {
-        n_samples = 1 * width * spp;
-        n_bytes = n_samples * byteps;
-
-        d_8  = buf;
-        d_16 = (uint16_t*)buf;
-        d_f  = (float*)buf;
-
-        /*  TODO 1 bit raw and ascii */
-        if (type == 1 || type == 4) {
-
-        /*  TODO ascii  */
-        } else if (type == 2 || type == 3) {
-
-
-        /*  raw and floats */
-        } else if (type == 5 || type == 6 ||
-                   type == -5 || type == -6 ||
-                   type == 7 )
-        {
-          if(byteps == 1) {
-            d_8 = &src[ h * width * spp * byteps ];
-          } else if(byteps == 2) {
-            d_16 = (uint16_t*)& src[ h * width * spp * byteps ];
-          } else if(byteps == 4) {
-            d_f = (float*)&src[ h * width * spp * byteps ];
-          }
-          memcpy (&buf[ h * width * spp * byteps ],
-                  &src[ (j_h + h) * width * spp * byteps ],
-                  1 * width * spp * byteps);
-        }
-
-        /* normalise and byteswap */
-        if( byte_swap )
-        {
-          unsigned char *c_buf = &buf[ h * width * spp * byteps ];
-          char  tmp;
-          if (byteps == 2) {         /* 16 bit */
-            for (p = 0; p < n_bytes; p += 2)
-            {
-              tmp = c_buf[p];
-              c_buf[p] = c_buf[p+1];
-              c_buf[p+1] = tmp;
-            }
-          } else if (byteps == 4) {  /* float */
-            for (p = 0; p < n_bytes; p += 4)
-            {
-              tmp = c_buf[p];
-              c_buf[p] = c_buf[p+3];
-              c_buf[p+3] = tmp;
-              tmp = c_buf[p+1];
-              c_buf[p+1] = c_buf[p+2];
-              c_buf[p+2] = tmp;
-            }
-          }
-        }
-
-        if (byteps == 1 && maxval < 255) {         /*  8 bit */
-          for (p = 0; p < n_samples; ++p)
-            d_8[p] = (d_8[p] * 255) / maxval;
-        } else if (byteps == 2 && maxval < 65535) {/* 16 bit */
-          for (p = 0; p < n_samples; ++p)
-            d_16 [p] = (d_16[p] * 65535) / maxval;
-        } else if (byteps == 4 && maxval != 1.0) {  /* float */
-          for (p = 0; p < n_samples; ++p)
-            d_f[p] = d_f[p] * maxval;
-        }
-    }
+    lrawLines_s lines = { buf, image_rgb->data, maxval, type, width, spp,
+                          byteps, 0 /*!oyBigEndian()*/ };
+    oyParallelFor( height, lrawLines_, &lines, 1 );
   }
 
   pixel_type = oyChannels_m(spp) | oyDataType_m(data_type);
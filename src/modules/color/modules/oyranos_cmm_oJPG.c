@@ -25,6 +25,7 @@
 #include "oyranos_config.h"
 #include "oyranos_definitions.h"
 #include "oyranos_helper.h"
+#include "oyranos_threads.h"
 
 #include <math.h>
 #include <stdarg.h>
@@ -453,6 +454,24 @@ oJPG_error_exit (j_common_ptr cinfo)
   longjmp (myerr->setjmp_buffer, 1);
 }
 
+/* lines for oyParallelFor() */
+typedef struct {
+  uint8_t * buf;
+  int       stride;
+} ojpgLines_s;
+/* Adobe CMYK JPEGs are stored inverted */
+static void ojpgInvertLines_         ( int                 start,
+                                       int                 end,
+                                       void              * data )
+{
+  ojpgLines_s * l = (ojpgLines_s*)data;
+  uint8_t * d = l->buf + (size_t)start * l->stride;
+  int i, n = (end - start) * l->stride;
+
+  for(i = 0; i < n; ++i)
+    d[i] = 255 - d[i];
+}
+
 
 /** Function ojpgFilter_CmmRun
  *  @brief   implement oyCMMFilter_GetNext_f()
@@ -645,14 +664,10 @@ int      ojpgFilter_CmmRun           ( oyFilterPlug_s    * requestor_plug,
     icColorSpaceSignature csp = (icColorSpaceSignature) oyProfile_GetSignature(prof,oySIGNATURE_COLOR_SPACE);
     if(csp == icSigCmykData)
     {
-      int n = width * height * 4;
       if(data_type == oyUINT8)
       {
-        uint8_t * d = (uint8_t*)buf;
-        int i;
-#pragma omp parallel for private(i)
-        for(i = 0; i < n; ++i)
-          d[i] = 255 - d[i];
+        ojpgLines_s lines = { (uint8_t*)buf, width * 4 };
+        oyParallelFor( height, ojpgInvertLines_, &lines, 1 );
       }
     }
  
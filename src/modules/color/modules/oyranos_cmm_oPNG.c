@@ -198,15 +198,18 @@ int png_jumpbuf_set ( png_structp png_ptr )
   return 0;
 }
 
-/* the more heavily commented parts are from libpng/example.c */
-int  oyImage_WritePNG                ( oyImage_s         * image,
+/* Open file_name and write the PNG header from image. The returned
+ * structures are ready for png_write_rows(). */
+static int  oPNGWriteHeader_         ( oyImage_s         * image,
                                        const char        * file_name,
-                                       oyOptions_s       * options )
+                                       oyOptions_s       * options,
+                                       FILE             ** fp_,
+                                       png_structp       * png_ptr_,
+                                       png_infop         * info_ptr_ )
 {
   FILE *fp;
   png_structp png_ptr;
   png_infop info_ptr;
-  int y;
 
   int width = oyImage_GetWidth( image );
   int height = oyImage_GetHeight( image );
@@ -371,6 +374,27 @@ int  oyImage_WritePNG                ( oyImage_s         * image,
    if(byteps > 1 && !oyBigEndian())
      png_set_swap( png_ptr );
 
+  *fp_ = fp;
+  *png_ptr_ = png_ptr;
+  *info_ptr_ = info_ptr;
+
+  return 0;
+}
+
+/* the more heavily commented parts are from libpng/example.c */
+int  oyImage_WritePNG                ( oyImage_s         * image,
+                                       const char        * file_name,
+                                       oyOptions_s       * options )
+{
+  FILE *fp;
+  png_structp png_ptr;
+  png_infop info_ptr;
+  int y;
+  int height = oyImage_GetHeight( image );
+
+  if(oPNGWriteHeader_( image, file_name, options, &fp, &png_ptr, &info_ptr ))
+    return (1);
+
    /* One of the following output methods is REQUIRED */
 
       /* If you are only writing one row at a time, this works */
@@ -409,6 +433,113 @@ int  oyImage_WritePNG                ( oyImage_s         * image,
    return 0;
 }
 
+/* a PNG file, which is written in bands from top to bottom */
+typedef struct {
+  FILE * fp;
+  png_structp png_ptr;
+  png_infop info_ptr;
+  int next_y;
+  int height;
+} oPNGBands_s;
+
+#define OPNG_BANDS_KEY "//" OY_TYPE_STD "/file_write/png_bands"
+
+static int  oPNGBandsRelease_        ( oyPointer         * ptr )
+{
+  oPNGBands_s * b = (oPNGBands_s*) *ptr;
+
+  if(!b)
+    return 0;
+
+  if(b->png_ptr)
+    png_destroy_write_struct( &b->png_ptr, &b->info_ptr );
+  if(b->fp)
+    fclose( b->fp );
+  oyDeAllocateFunc_( b );
+  *ptr = NULL;
+
+  return 0;
+}
+
+/* Write the lines of a ticket band. The first band opens the file. The
+ * state lives in the node tags until the last band closes the file. */
+static int  oPNGWriteBand_           ( oyFilterNode_s    * node,
+                                       oyImage_s         * image,
+                                       const char        * file_name,
+                                       oyOptions_s       * options,
+                                       oyArray2d_s       * lines,
+                                       int                 y )
+{
+  oyOptions_s * tags = oyFilterNode_GetTags( node );
+  oyPointer_s * ptr = NULL;
+  oPNGBands_s * b = NULL;
+  int error = 0, i, n;
+  png_bytep * rows = (png_bytep*) oyArray2d_GetData( lines );
+
+  if(y == 0)
+  {
+    oyPointer p;
+
+    b = (oPNGBands_s*) oyAllocateFunc_( sizeof(oPNGBands_s) );
+    error = !b;
+    if(!error)
+    {
+      memset( b, 0, sizeof(oPNGBands_s) );
+      b->height = oyImage_GetHeight( image );
+      error = oPNGWriteHeader_( image, file_name, options, &b->fp,
+                                &b->png_ptr, &b->info_ptr );
+      if(error)
+      {
+        p = b;
+        oPNGBandsRelease_( &p );
+        b = NULL;
+      }
+    }
+    if(!error)
+    {
+      ptr = oyPointer_New( 0 );
+      oyPointer_Set( ptr, CMM_NICK, "oPNGBands_s", b, "oPNGBandsRelease_",
+                     oPNGBandsRelease_ );
+      oyOptions_MoveInStruct( &tags, OPNG_BANDS_KEY, (oyStruct_s**)&ptr,
+                              OY_CREATE_NEW );
+    }
+  } else
+  {
+    ptr = (oyPointer_s*) oyOptions_GetType( tags, -1, OPNG_BANDS_KEY,
+                                            oyOBJECT_POINTER_S );
+    b = (oPNGBands_s*) oyPointer_GetPointer( ptr );
+    oyPointer_Release( &ptr );
+  }
+
+  if(!b || !b->png_ptr || b->next_y != y)
+  {
+    oPNG_msg( oyMSG_WARN, (oyStruct_s*)node,
+             OY_DBG_FORMAT_ "band at line %d out of order: %s",
+             OY_DBG_ARGS_, y, oyNoEmptyString_m_( file_name ) );
+    error = 1;
+  }
+
+  if(!error)
+  {
+    n = OY_MIN( oyArray2d_GetHeight( lines ), b->height - y );
+    for(i = 0; i < n; ++i)
+      png_write_rows( b->png_ptr, &rows[i], 1 );
+    b->next_y = y + n;
+
+    /* close the file with the last band */
+    if(b->next_y >= b->height)
+    {
+      png_write_end( b->png_ptr, b->info_ptr );
+      png_destroy_write_struct( &b->png_ptr, &b->info_ptr );
+      fclose( b->fp ); b->fp = NULL;
+    }
+  }
+
+  oyOptions_Release( &tags );
+
+  return error;
+}
+
 /** @func    oPNGFilterPlug_ImageOutputPNGWrite
  *  @brief   implement oyCMMFilter_GetNext_f()
  *
@@ -446,7 +577,45 @@ int      oPNGFilterPlug_ImageOutputPNGWrite (
   }
 
   if(filename)
-    fp = fopen( filename, "wb" );
+  {
+    oyImage_s *image = (oyImage_s*)oyFilterSocket_GetData( socket );
+    oyOptions_s * queue = oyPixelAccess_GetRequestQueue( ticket );
+    int32_t streamed = 0;
+    int y;
+
+    /* a band from oyConversion_RunPixelsStreamed() is taken from the
+     * ticket array, as the image has not necessarily seen the pixels;
+     * other partial tickets, e.g. tiles, write the whole image */
+    oyOptions_FindInt( queue, "streamed", 0, &streamed );
+    oyOptions_Release( &queue );
+    y = OY_ROUND( oyPixelAccess_GetStart( ticket, 1 ) *
+                  oyImage_GetWidth( image ) );
+
+    if(streamed)
+    {
+      oyArray2d_s * a;
+
+      oyPixelAccess_SetArrayFocus( ticket, 0 );
+      a = oyPixelAccess_GetArray( ticket );
+      result = oPNGWriteBand_( node, image, filename, opts, a, y );
+      oyArray2d_Release( &a );
+    } else
+    {
+      fp = fopen( filename, "wb" );
+
+      if(fp)
+      {
+        fclose (fp); fp = 0;
+
+        result = oyImage_WritePNG( image, filename, opts );
+      }
+      else
+        oPNG_msg( oyMSG_WARN, node,
+                 OY_DBG_FORMAT_ "could not open: %s",
+                 OY_DBG_ARGS_, oyNoEmptyString_m_( filename ) );
+    }
+    oyImage_Release( &image );
+  }
   else
   {
     oPNG_msg( oyMSG_WARN, node,
@@ -456,20 +625,6 @@ int      oPNGFilterPlug_ImageOutputPNGWrite (
       result = 1;
   }
 
-  if(fp)
-  {
-    oyImage_s *image = (oyImage_s*)oyFilterSocket_GetData( socket );
-
-    fclose (fp); fp = 0;
-
-    result = oyImage_WritePNG( image, filename, opts );
-    oyImage_Release( &image );
-  }
-  else
-    oPNG_msg( oyMSG_WARN, node,
-             OY_DBG_FORMAT_ "could not open: %s",
-             OY_DBG_ARGS_, oyNoEmptyString_m_( filename ) );
-
   oyOptions_Release( &opts );
   oyFilterSocket_Release( &socket );
   oyFilterNode_Release( &node );
@@ -26,6 +26,7 @@
 #include "oyranos_helper.h"
 #include "oyranos_i18n.h"
 #include "oyranos_string.h"
+#include "oyranos_threads.h"
 
 
 #include <math.h>
@@ -45,6 +46,103 @@
 /* OY_IMAGE_CHANNEL_REGISTRATION ----------------------------------------------*/
 
 
+/* lines of oyraFilter_ImageChannelRun() for oyParallelFor() */
+typedef struct {
+  uint8_t ** array_out_data;
+  oyDATATYPE_e data_type_out;
+  double * channel;
+  int * channel_pos;
+  int count, max_value, bps_out, channels_dst, start_x, start_y, w;
+} oyraChannelLines_s;
+static void oyraChannelLines_        ( int                 start,
+                                       int                 end,
+                                       void              * data )
+{
+  oyraChannelLines_s * l = (oyraChannelLines_s*)data;
+  uint8_t ** array_out_data = l->array_out_data;
+  oyDATATYPE_e data_type_out = l->data_type_out;
+  double * channel = l->channel;
+  int * channel_pos = l->channel_pos;
+  const int max_channels = 'z'-'a'+1;
+  int count = l->count,
+      max_value = l->max_value,
+      bps_out = l->bps_out,
+      channels_dst = l->channels_dst,
+      start_x = l->start_x,
+      w = l->w;
+  int x, y, i;
+
+  for(y = l->start_y + start; y < l->start_y + end; ++y)
+  {
+    for(x = start_x; x < w; ++x)
+    {
+      union u8421 { uint32_t u4; uint16_t u2; uint8_t u1; float f; double d; };
+      union u8421 cache[max_channels];
+      float flt;
+      uint32_t u4;
+
+      /* fill the intermediate pixel cache;
+       * It is not known which channels are needed and in which order.
+       * Thus all channels are stored outside the main buffer.
+       */
+      for(i = 0; i < count; ++i)
+      {
+        int pos = (channel_pos[i] == -1) ? i : channel_pos[i];
+        switch(data_type_out)
+        {
+        case oyUINT8:
+          cache[i].u1 = (channel_pos[i] == -1) ? OY_ROUND(channel[i] * max_value) : array_out_data[y][x*channels_dst*bps_out + pos*bps_out];
+          break;
+        case oyUINT16:
+          cache[i].u2 = (channel_pos[i] == -1) ? OY_ROUND(channel[i] * max_value) : *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + pos*bps_out]);
+          break;
+        case oyUINT32:
+          cache[i].u4 = (channel_pos[i] == -1) ? OY_ROUND(channel[i] * max_value) : *((uint32_t*)&array_out_data[y][x*channels_dst*bps_out + pos*bps_out]);
+          break;
+        case oyHALF:
+          flt = channel[i] * max_value;
+          memcpy( &u4, &flt, 4 );
+          cache[i].u2 = (channel_pos[i] == -1) ? OY_FLOAT2HALF(u4) : *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + pos*bps_out]);
+          break;
+        case oyFLOAT:
+          cache[i].f = (channel_pos[i] == -1) ? channel[i] * max_value : *((float*)&array_out_data[y][x*channels_dst*bps_out + pos*bps_out]);
+          break;
+        case oyDOUBLE:
+          cache[i].d = (channel_pos[i] == -1) ? channel[i] * max_value : *((double*)&array_out_data[y][x*channels_dst*bps_out + pos*bps_out]);
+          break;
+        }
+      }
+
+      /* read back all scattered channels */
+      for(i = 0; i < count; ++i)
+      {
+        int pos = i;
+        switch(data_type_out)
+        {
+        case oyUINT8:
+          array_out_data[y][x*channels_dst*bps_out + i*bps_out] = cache[pos].u1;
+          break;
+        case oyUINT16:
+          *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = cache[pos].u2;
+          break;
+        case oyUINT32:
+          *((uint32_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = cache[pos].u4;
+          break;
+        case oyHALF:
+           *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = cache[pos].u2;
+          break;
+        case oyFLOAT:
+          *((float*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = cache[pos].f;
+          break;
+        case oyDOUBLE:
+          *((double*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = cache[pos].d;
+          break;
+        }
+      }
+    }
+  }
+}
+
 /** @func    oyraFilter_ImageChannelRun
  *  @brief   implement oyCMMFilter_GetNext_f()
  *
@@ -83,7 +181,7 @@ int      oyraFilter_ImageChannelRun  ( oyFilterPlug_s    * requestor_plug,
   oyFilterPlug_s * plug = NULL;
   oyImage_s * image;
 
-  int dirty = 0;
+  int dirty = 0, fused = 0;
 
   socket = oyFilterPlug_GetSocket( requestor_plug );
   node = oyFilterSocket_GetNode( socket );
@@ -119,6 +217,14 @@ int      oyraFilter_ImageChannelRun  ( oyFilterPlug_s    * requestor_plug,
     /* select node */
     input_node = oyFilterNode_GetPlugNode( node, 0 );
 
+    /* a chain of point filters runs in one pass over cache sized tiles */
+    fused = oyFilterNode_RunFused( node, requestor_plug, ticket, &result );
+    if(fused == 2)
+    {
+      oyOptions_Release( &node_opts );
+      goto oyraFilter_ImageChannelRun_clean2;
+    }
+
     /* find filters own channel factor */
     channels_json = oyOptions_FindString( node_opts,
                                   "//" OY_TYPE_STD "/channel/channel",
@@ -211,7 +317,7 @@ int      oyraFilter_ImageChannelRun  ( oyFilterPlug_s    * requestor_plug,
 
       if(!error)
       {
-        int w,h,x,y, start_x,start_y, max_value = -1;
+        int w,h, start_x,start_y, max_value = -1;
         oyRectangle_s * ticket_roi = oyPixelAccess_GetArrayROI( ticket );
         oyRectangle_s_  roi_= {oyOBJECT_RECTANGLE_S,0,0,0, 0,0,0,0};
         oyRectangle_s * roi = (oyRectangle_s*)&roi_;
@@ -222,7 +328,8 @@ int      oyraFilter_ImageChannelRun  ( oyFilterPlug_s    * requestor_plug,
         int bps_out = oyDataTypeGetSize( data_type_out );
 
         /* get the source pixels */
-        result = oyFilterNode_Run( input_node, plug, ticket );
+        if(!fused)
+          result = oyFilterNode_Run( input_node, plug, ticket );
 
         /* get the channel buffers */
         array_out = oyPixelAccess_GetArray( ticket );
@@ -253,83 +360,18 @@ int      oyraFilter_ImageChannelRun  ( oyFilterPlug_s    * requestor_plug,
         start_y = OY_ROUND(roi_.y);
 
         /* copy the channels */
-#if defined(USE_OPENMP)
-#pragma omp parallel for private(x,y,i)
-#endif
-        for(y = start_y; y < h; ++y)
         {
-          for(x = start_x; x < w; ++x)
-          {
-            union u8421 { uint32_t u4; uint16_t u2; uint8_t u1; float f; double d; };
-            union u8421 cache[max_channels];
-            float flt;
-            uint32_t u4;
-            
-            /* fill the intermediate pixel cache;
-             * It is not known which channels are needed and in which order.
-             * Thus all channels are stored outside the main buffer.
-             */
-            for(i = 0; i < count; ++i)
-            {
-              int pos = (channel_pos[i] == -1) ? i : channel_pos[i];
-              switch(data_type_out)
-              {
-              case oyUINT8:
-                cache[i].u1 = (channel_pos[i] == -1) ? OY_ROUND(channel[i] * max_value) : array_out_data[y][x*channels_dst*bps_out + pos*bps_out];
-                break;
-              case oyUINT16:
-                cache[i].u2 = (channel_pos[i] == -1) ? OY_ROUND(channel[i] * max_value) : *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + pos*bps_out]);
-                break;
-              case oyUINT32:
-                cache[i].u4 = (channel_pos[i] == -1) ? OY_ROUND(channel[i] * max_value) : *((uint32_t*)&array_out_data[y][x*channels_dst*bps_out + pos*bps_out]);
-                break;
-              case oyHALF:
-                flt = channel[i] * max_value;
-                memcpy( &u4, &flt, 4 );
-                cache[i].u2 = (channel_pos[i] == -1) ? OY_FLOAT2HALF(u4) : *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + pos*bps_out]);
-                break;
-              case oyFLOAT:
-                cache[i].f = (channel_pos[i] == -1) ? channel[i] * max_value : *((float*)&array_out_data[y][x*channels_dst*bps_out + pos*bps_out]);
-                break;
-              case oyDOUBLE:
-                cache[i].d = (channel_pos[i] == -1) ? channel[i] * max_value : *((double*)&array_out_data[y][x*channels_dst*bps_out + pos*bps_out]);
-                break;
-              }
-            }
-
-            /* read back all scattered channels */
-            for(i = 0; i < count; ++i)
-            {
-              int pos = i;
-              switch(data_type_out)
-              {
-              case oyUINT8:
-                array_out_data[y][x*channels_dst*bps_out + i*bps_out] = cache[pos].u1;
-                break;
-              case oyUINT16:
-                *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = cache[pos].u2;
-                break;
-              case oyUINT32:
-                *((uint32_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = cache[pos].u4;
-                break;
-              case oyHALF:
-                 *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = cache[pos].u2;
-                break;
-              case oyFLOAT:
-                *((float*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = cache[pos].f;
-                break;
-              case oyDOUBLE:
-                *((double*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = cache[pos].d;
-                break;
-              }
-            }
-          }
+          oyraChannelLines_s lines = { array_out_data, data_type_out,
+                                       channel, channel_pos, count,
+                                       max_value, bps_out, channels_dst,
+                                       start_x, start_y, w };
+          oyParallelFor( h - start_y, oyraChannelLines_, &lines, 1 );
         }
 
         oyArray2d_Release( &array_out );
       }
       oyImage_Release( &output_image );
-    } else /* nothing to do */
+    } else if(!fused) /* nothing to do */
       result = oyFilterNode_Run( input_node, plug, ticket );
 
     oyraFilter_ImageChannelRun_clean2:
@@ -347,6 +389,12 @@ int      oyraFilter_ImageChannelRun  ( oyFilterPlug_s    * requestor_plug,
 
 #define OY_IMAGE_CHANNEL_REGISTRATION OY_TOP_SHARED OY_SLASH OY_DOMAIN_INTERNAL OY_SLASH OY_TYPE_STD OY_SLASH "channel"
 
+const char * oyra_api7_image_channel_properties[] =
+{
+  "pixel=point",  /* changes each pixel in place; see oyFilterNode_RunFused() */
+  0
+};
+
 /** @instance oyra_api7
  *  @brief    oyra oyCMMapi7_s implementation
  *
@@ -410,7 +458,7 @@ oyCMMapi_s * oyraApi7ImageChannelCreate(void)
                                        oyraFilter_ImageChannelRun,
                                        (oyConnector_s**)plugs, 1, 0,
                                        (oyConnector_s**)sockets, 1, 0,
-                                       0, 0 );
+                                       oyra_api7_image_channel_properties, 0 );
   return (oyCMMapi_s*) channel7;
 }
 
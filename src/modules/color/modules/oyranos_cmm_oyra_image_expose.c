@@ -25,6 +25,7 @@
 #include "oyranos_helper.h"
 #include "oyranos_i18n.h"
 #include "oyranos_string.h"
+#include "oyranos_threads.h"
 
 #include <math.h>
 #include <stdarg.h>
@@ -83,6 +84,148 @@ void     oySensibleClip ( double * c, icColorSpaceSignature sig, int range_max,
   }
 }
 
+/* lines of oyraFilter_ImageExposeRun() for oyParallelFor() */
+typedef struct {
+  uint8_t ** array_out_data;
+  oyDATATYPE_e data_type_out;
+  icColorSpaceSignature sig;
+  double expose;
+  unsigned int max;
+  int bps_out, channels_dst, byte_swap, start_x, start_y, w;
+} oyraExposeLines_s;
+static void oyraExposeLines_         ( int                 start,
+                                       int                 end,
+                                       void              * data )
+{
+  oyraExposeLines_s * l = (oyraExposeLines_s*)data;
+  uint8_t ** array_out_data = l->array_out_data;
+  oyDATATYPE_e data_type_out = l->data_type_out;
+  icColorSpaceSignature sig = l->sig;
+  double expose = l->expose;
+  unsigned int max = l->max;
+  int bps_out = l->bps_out,
+      channels_dst = l->channels_dst,
+      byte_swap = l->byte_swap,
+      start_x = l->start_x,
+      w = l->w;
+  int x, y, i;
+
+  for(y = l->start_y + start; y < l->start_y + end; ++y)
+  {
+    for(x = start_x; x < w; ++x)
+    {
+      if( (sig == icSigRgbData ||
+           sig == icSigXYZData ||
+           sig == icSigLabData ||
+           sig == icSigYCbCrData)
+          && channels_dst >= 3)
+      {
+        double rgb[3], v;
+
+        for(i = 0; i < 3; ++i)
+        {
+          switch(data_type_out)
+          {
+          case oyUINT8:
+            rgb[i] = array_out_data[y][x*channels_dst*bps_out + i*bps_out];
+            break;
+          case oyUINT16:
+            {
+            uint16_t v = *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]);
+            if(byte_swap) v = oyByteSwapUInt16(v);
+            rgb[i] = v;
+            }
+            break;
+          case oyUINT32:
+            {
+            uint32_t v = *((uint32_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]);
+            if(byte_swap) v = oyByteSwapUInt32(v);
+            rgb[i] = v;
+            }
+            break;
+          case oyHALF:
+            v = *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]);
+            rgb[i] = v;
+            break;
+          case oyFLOAT:
+            v = *((float*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]);
+            rgb[i] = v;
+            break;
+          case oyDOUBLE:
+            v = *((double*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]);
+            rgb[i] = v;
+            break;
+          }
+        }
+
+        oySensibleClip ( rgb, sig, max, expose );
+
+        for(i = 0; i < 3; ++i)
+        {
+          v = rgb[i];
+          switch(data_type_out)
+          {
+          case oyUINT8:
+            array_out_data[y][x*channels_dst*bps_out + i*bps_out] = v;
+            break;
+          case oyUINT16:
+            { uint16_t u16 = v;
+            *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = byte_swap ? oyByteSwapUInt16(u16) : u16;
+            }
+            break;
+          case oyUINT32:
+            { uint32_t u32 = v;
+            *((uint32_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = byte_swap ? oyByteSwapUInt16(u32) : u32;
+            }
+            break;
+          case oyHALF:
+            *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = v;
+            break;
+          case oyFLOAT:
+            *((float*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = v;
+            break;
+          case oyDOUBLE:
+            *((double*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = v;
+            break;
+          }
+        }
+      }
+      else
+      for(i = 0; i < channels_dst; ++i)
+      {
+        int v;
+        switch(data_type_out)
+        {
+        case oyUINT8:
+          v = array_out_data[y][x*channels_dst*bps_out + i*bps_out] * expose;
+          if(v > 255) v = 255;
+          array_out_data[y][x*channels_dst*bps_out + i*bps_out] = v;
+          break;
+        case oyUINT16:
+          v = *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]);
+          if(byte_swap) v = oyByteSwapUInt16(v);
+          v *= expose;
+          if(v > 65535) v = 65535;
+          *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = byte_swap ? oyByteSwapUInt16(v) : v;
+          break;
+        case oyUINT32:
+          *((uint32_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) *= expose;
+          break;
+        case oyHALF:
+           *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) *= expose;
+          break;
+        case oyFLOAT:
+          *((float*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) *= expose;
+          break;
+        case oyDOUBLE:
+          *((double*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) *= expose;
+          break;
+        }
+      }
+    }
+  }
+}
+
 /** @func    oyraFilter_ImageExposeRun
  *  @brief   implement oyCMMFilter_GetNext_f()
  *
@@ -100,7 +243,7 @@ int      oyraFilter_ImageExposeRun   ( oyFilterPlug_s    * requestor_plug,
   oyFilterPlug_s * plug = 0;
   oyImage_s * image = 0;
 
-  int dirty = 0;
+  int dirty = 0, fused = 0;
 
   socket = oyFilterPlug_GetSocket( requestor_plug );
   node = oyFilterSocket_GetNode( socket );
@@ -135,6 +278,11 @@ int      oyraFilter_ImageExposeRun   ( oyFilterPlug_s    * requestor_plug,
     /* select node */
     input_node = oyFilterNode_GetPlugNode( node, 0 );
 
+    /* a chain of point filters runs in one pass over cache sized tiles */
+    fused = oyFilterNode_RunFused( node, requestor_plug, ticket, &result );
+    if(fused == 2)
+      goto clean_expose2;
+
     /* find filters own expose factor */
     error = oyOptions_FindDouble( node_opts,
                                   "//" OY_TYPE_STD "/expose/expose",
@@ -163,7 +311,7 @@ int      oyraFilter_ImageExposeRun   ( oyFilterPlug_s    * requestor_plug,
       ticket_array_pix_width = oyArray2d_GetWidth( array_out ) / channels_dst;
 
       {
-        int w,h,x,y, i, start_x,start_y;
+        int w,h, start_x,start_y;
         unsigned int max = 1;
         oyRectangle_s * ticket_roi = oyPixelAccess_GetArrayROI( ticket );
         oyRectangle_s_  roi_= {oyOBJECT_RECTANGLE_S,0,0,0, 0,0,0,0};
@@ -174,7 +322,8 @@ int      oyraFilter_ImageExposeRun   ( oyFilterPlug_s    * requestor_plug,
         int bps_out = oyDataTypeGetSize( data_type_out );
 
         /* get the source pixels */
-        result = oyFilterNode_Run( input_node, plug, ticket );
+        if(!fused)
+          result = oyFilterNode_Run( input_node, plug, ticket );
 
         /* get the channel buffers */
         array_out_data = oyArray2d_GetData( array_out );
@@ -195,122 +344,11 @@ int      oyraFilter_ImageExposeRun   ( oyFilterPlug_s    * requestor_plug,
         }
 
         /* expose the samples */
-#if defined(USE_OPENMP)
-#pragma omp parallel for private(x,y,i)
-#endif
-        for(y = start_y; y < h; ++y)
         {
-          for(x = start_x; x < w; ++x)
-          {
-            if( (sig == icSigRgbData ||
-                 sig == icSigXYZData ||
-                 sig == icSigLabData ||
-                 sig == icSigYCbCrData)
-                && channels_dst >= 3)
-            {
-              double rgb[3], v;
-
-              for(i = 0; i < 3; ++i)
-              {
-                switch(data_type_out)
-                {
-                case oyUINT8:
-                  rgb[i] = array_out_data[y][x*channels_dst*bps_out + i*bps_out];
-                  break;
-                case oyUINT16:
-                  {
-                  uint16_t v = *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]);
-                  if(byte_swap) v = oyByteSwapUInt16(v);
-                  rgb[i] = v;
-                  }
-                  break;
-                case oyUINT32:
-                  {
-                  uint32_t v = *((uint32_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]);
-                  if(byte_swap) v = oyByteSwapUInt32(v);
-                  rgb[i] = v;
-                  }
-                  break;
-                case oyHALF:
-                  v = *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]);
-                  rgb[i] = v;
-                  break;
-                case oyFLOAT:
-                  v = *((float*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]);
-                  rgb[i] = v;
-                  break;
-                case oyDOUBLE:
-                  v = *((double*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]);
-                  rgb[i] = v;
-                  break;
-                }
-              }
-
-              oySensibleClip ( rgb, sig, max, expose );
-
-              for(i = 0; i < 3; ++i)
-              {
-                v = rgb[i];
-                switch(data_type_out)
-                {
-                case oyUINT8:
-                  array_out_data[y][x*channels_dst*bps_out + i*bps_out] = v;
-                  break;
-                case oyUINT16:
-                  { uint16_t u16 = v;
-                  *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = byte_swap ? oyByteSwapUInt16(u16) : u16;
-                  }
-                  break;
-                case oyUINT32:
-                  { uint32_t u32 = v;
-                  *((uint32_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = byte_swap ? oyByteSwapUInt16(u32) : u32;
-                  }
-                  break;
-                case oyHALF:
-                  *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = v;
-                  break;
-                case oyFLOAT:
-                  *((float*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = v;
-                  break;
-                case oyDOUBLE:
-                  *((double*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = v;
-                  break;
-                }
-              }
-            }
-            else
-            for(i = 0; i < channels_dst; ++i)
-            {
-              int v;
-              switch(data_type_out)
-              {
-              case oyUINT8:
-                v = array_out_data[y][x*channels_dst*bps_out + i*bps_out] * expose;
-                if(v > 255) v = 255;
-                array_out_data[y][x*channels_dst*bps_out + i*bps_out] = v;
-                break;
-              case oyUINT16:
-                v = *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]);
-                if(byte_swap) v = oyByteSwapUInt16(v);
-                v *= expose;
-                if(v > 65535) v = 65535;
-                *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) = byte_swap ? oyByteSwapUInt16(v) : v;
-                break;
-              case oyUINT32:
-                *((uint32_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) *= expose;
-                break;
-              case oyHALF:
-                 *((uint16_t*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) *= expose;
-                break;
-              case oyFLOAT:
-                *((float*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) *= expose;
-                break;
-              case oyDOUBLE:
-                *((double*)&array_out_data[y][x*channels_dst*bps_out + i*bps_out]) *= expose;
-                break;
-              }
-            }
-          }
+          oyraExposeLines_s lines = { array_out_data, data_type_out, sig,
+                                      expose, max, bps_out, channels_dst,
+                                      byte_swap, start_x, start_y, w };
+          oyParallelFor( h - start_y, oyraExposeLines_, &lines, 1 );
         }
 
       }
@@ -319,7 +357,7 @@ int      oyraFilter_ImageExposeRun   ( oyFilterPlug_s    * requestor_plug,
 
       oyImage_Release( &output_image );
       oyProfile_Release( &p );
-    } else /* expose == 1.0 */
+    } else if(!fused) /* expose == 1.0 */
     {
       result = oyFilterNode_Run( input_node, plug, ticket );
     }
@@ -343,6 +381,12 @@ int      oyraFilter_ImageExposeRun   ( oyFilterPlug_s    * requestor_plug,
 
 #define OY_IMAGE_EXPOSE_REGISTRATION OY_TOP_SHARED OY_SLASH OY_DOMAIN_INTERNAL OY_SLASH OY_TYPE_STD OY_SLASH "expose"
 
+const char * oyra_api7_image_expose_properties[] =
+{
+  "pixel=point",  /* changes each pixel in place; see oyFilterNode_RunFused() */
+  0
+};
+
 /** @instance oyra_api7
  *  @brief    oyra oyCMMapi7_s implementation
  *
@@ -406,7 +450,7 @@ oyCMMapi_s * oyraApi7ImageExposeCreate(void)
                                        oyraFilter_ImageExposeRun,
                                        (oyConnector_s**)plugs, 1, 0,
                                        (oyConnector_s**)sockets, 1, 0,
-                                       0, 0 );
+                                       oyra_api7_image_expose_properties, 0 );
   return (oyCMMapi_s*) expose7;
 }
 
@@ -32,6 +32,7 @@
 #include "oyranos_io.h"
 #include "oyranos_definitions.h"
 #include "oyranos_string.h"
+#include "oyranos_threads.h"
 #include "oyranos_texts.h"
 
 #include <math.h>
@@ -40,6 +41,14 @@
 #include <stdio.h>
 #include <string.h>
 
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define OYRA_PPM_MMAP 1
+#endif
+
 typedef uint16_t half;
 
 int wread ( unsigned char   *data,    /* read a word */
@@ -130,20 +139,52 @@ int      oyraFilterPlug_ImageOutputPPMWrite (
     filename = oyOptions_FindString( node_opts, "filename", 0 );
 
   if(filename)
-    fp = fopen( filename, "wb" );
-
-  if(fp)
   {
     oyImage_s *image_output = (oyImage_s*)oyFilterSocket_GetData( socket );
     const char * comment = oyOptions_FindString( node_opts, "comment", NULL );
+    oyOptions_s * queue = oyPixelAccess_GetRequestQueue( ticket );
+    int32_t streamed = 0;
+    int y;
+
+    /* a band from oyConversion_RunPixelsStreamed() is appended from the
+     * ticket array, as the image has not necessarily seen the pixels;
+     * other partial tickets, e.g. tiles, write the whole image */
+    oyOptions_FindInt( queue, "streamed", 0, &streamed );
+    oyOptions_Release( &queue );
+    y = OY_ROUND( oyPixelAccess_GetStart( ticket, 1 ) *
+                  oyImage_GetWidth( image_output ) );
+
+    if(streamed)
+    {
+      oyArray2d_s * a;
+
+      oyPixelAccess_SetArrayFocus( ticket, 0 );
+      a = oyPixelAccess_GetArray( ticket );
+      result = oyImage_WritePPMLines( image_output, filename,
+                                      comment ? comment :
+                                      oyFilterNode_GetRelatives( node ),
+                                      a, y );
+      oyArray2d_Release( &a );
+    } else
+    {
+      fp = fopen( filename, "wb" );
 
-    fclose (fp); fp = 0;
+      if(fp)
+      {
+        fclose (fp); fp = 0;
 
-    result = oyImage_WritePPM( image_output, filename,
-                               comment ? comment :
-                               oyFilterNode_GetRelatives( node ) );
+        result = oyImage_WritePPM( image_output, filename,
+                                   comment ? comment :
+                                   oyFilterNode_GetRelatives( node ) );
+      }
+    }
+    oyImage_Release( &image_output );
   }
 
+  oyOptions_Release( &node_opts );
+  oyFilterNode_Release( &node );
+  oyFilterSocket_Release( &socket );
+
   return result;
 }
 
@@ -448,6 +489,264 @@ int wread ( unsigned char* data, size_t pos, size_t max, size_t *start, size_t *
   return end_found;
 }
 
+#if defined(OYRA_PPM_MMAP)
+/* pixel source for memory mapped binary PNM/PAM/PFM files */
+typedef struct {
+  uint8_t      * map;                  /**< the private file mapping */
+  size_t         map_size;             /**< bytes in map */
+  uint8_t      * pixels;               /**< first sample after the header */
+  size_t         stride;               /**< bytes per line */
+  int            byteps;               /**< bytes per sample */
+  int            height;               /**< lines */
+  int          * swapped;              /**< line is in host byte order, atomic; 0 - no swap needed */
+} oyraPPMMap_s;
+
+static int oyraPPMMapRelease_        ( oyPointer         * ptr )
+{
+  oyraPPMMap_s * m;
+
+  if(!ptr || !*ptr)
+    return 1;
+
+  m = (oyraPPMMap_s*) *ptr;
+  munmap( m->map, m->map_size );
+  if(m->swapped)
+    oyDeAllocateFunc_( m->swapped );
+  oyDeAllocateFunc_( m );
+  *ptr = NULL;
+
+  return 0;
+}
+
+/* the mapping is private, so byte swapping in place does not touch the file;
+ * swap each line only once on first request */
+static uint8_t * oyraPPMMapLine_     ( oyImage_s         * image,
+                                       int                 y )
+{
+  oyPointer_s * ptr = (oyPointer_s*) oyImage_GetPixelData( image );
+  oyraPPMMap_s * m = (oyraPPMMap_s*) oyPointer_GetPointer( ptr );
+  uint8_t * line;
+
+  oyPointer_Release( &ptr );
+  if(!m || y < 0 || y >= m->height)
+    return NULL;
+
+  line = &m->pixels[ m->stride * y ];
+
+  if(m->swapped && !oyAtomicGet_m_( &m->swapped[y] ))
+  {
+    oyObject_Lock( image->oy_, __FILE__, __LINE__ );
+    if(!m->swapped[y])
+    {
+      size_t p;
+      uint8_t tmp;
+
+      if(m->byteps == 2)
+        for(p = 0; p < m->stride; p += 2)
+        {
+          tmp = line[p]; line[p] = line[p+1]; line[p+1] = tmp;
+        }
+      else if(m->byteps == 4)
+        for(p = 0; p < m->stride; p += 4)
+        {
+          tmp = line[p]; line[p] = line[p+3]; line[p+3] = tmp;
+          tmp = line[p+1]; line[p+1] = line[p+2]; line[p+2] = tmp;
+        }
+      /* publish the swapped line to the unlocked check above */
+      oyAtomicAdd_m_( &m->swapped[y], 1 );
+    }
+    oyObject_UnLock( image->oy_, __FILE__, __LINE__ );
+  }
+
+  return line;
+}
+
+static oyPointer oyraPPMGetLine_     ( oyImage_s         * image,
+                                       int                 point_y,
+                                       int               * height,
+                                       int                 channel OY_UNUSED,
+                                       int               * is_allocated )
+{
+  if(height) *height = 1;
+  if(is_allocated) *is_allocated = 0;
+  return oyraPPMMapLine_( image, point_y );
+}
+
+static oyPointer oyraPPMGetPoint_    ( oyImage_s         * image,
+                                       int                 point_x,
+                                       int                 point_y,
+                                       int                 channel,
+                                       int               * is_allocated )
+{
+  uint8_t * line = oyraPPMMapLine_( image, point_y );
+  int byteps = oyDataTypeGetSize( oyToDataType_m(
+                             oyImage_GetPixelLayout( image, oyLAYOUT ) ) ),
+      channels = oyImage_GetPixelLayout( image, oyCHANS );
+
+  if(is_allocated) *is_allocated = 0;
+  if(!line)
+    return NULL;
+  if(channel < 0)
+    channel = 0;
+  return &line[ (point_x * channels + channel) * byteps ];
+}
+
+static int oyraPPMSetLine_           ( oyImage_s         * image,
+                                       int                 point_x,
+                                       int                 point_y,
+                                       int                 pixel_n,
+                                       int                 channel,
+                                       oyPointer           data )
+{
+  uint8_t * line = oyraPPMMapLine_( image, point_y );
+  int byteps = oyDataTypeGetSize( oyToDataType_m(
+                             oyImage_GetPixelLayout( image, oyLAYOUT ) ) ),
+      channels = 1,
+      offset = point_x;
+
+  if(!line)
+    return 1;
+  if(pixel_n < 0)
+    pixel_n = oyImage_GetWidth( image ) - point_x;
+  if(channel < 0)
+  {
+    channels = oyImage_GetPixelLayout( image, oyCHANS );
+    offset *= channels;
+  }
+  if(&line[ offset * byteps ] != data)
+    memcpy( &line[ offset * byteps ], data, pixel_n * byteps * channels );
+
+  return 0;
+}
+
+static int oyraPPMSetPoint_          ( oyImage_s         * image,
+                                       int                 point_x,
+                                       int                 point_y,
+                                       int                 channel,
+                                       oyPointer           data )
+{
+  int byteps = oyDataTypeGetSize( oyToDataType_m(
+                             oyImage_GetPixelLayout( image, oyLAYOUT ) ) ),
+      channels = oyImage_GetPixelLayout( image, oyCHANS );
+  uint8_t * pixel = oyraPPMGetPoint_( image, point_x, point_y,
+                                      channel < 0 ? 0 : channel, NULL );
+
+  if(!pixel)
+    return 1;
+  memcpy( pixel, data, byteps * (channel < 0 ? channels : 1) );
+
+  return 0;
+}
+#endif /* OYRA_PPM_MMAP */
+
+/* release the file content from either mmap() or fread() */
+static void oyraPPMDataRelease_      ( uint8_t          ** data,
+                                       size_t            * map_size )
+{
+#if defined(OYRA_PPM_MMAP)
+  if(*map_size)
+  {
+    munmap( *data, *map_size );
+    *data = NULL;
+    *map_size = 0;
+    return;
+  }
+#endif
+  oyFree_m_( *data )
+}
+
+/* lines of oyraFilterPlug_ImageInputPPMRun() for oyParallelFor() */
+typedef struct {
+  uint8_t * buf;
+  const uint8_t * src;
+  double maxval;
+  int type, width, spp, byteps, byte_swap;
+} oyraPPMLines_s;
+static void oyraPPMLines_            ( int                 start,
+                                       int                 end,
+                                       void              * data )
+{
+  oyraPPMLines_s * l = (oyraPPMLines_s*)data;
+  uint8_t * buf = l->buf;
+  const uint8_t * src = l->src;
+  double maxval = l->maxval;
+  int type = l->type,
+      width = l->width,
+      spp = l->spp,
+      byteps = l->byteps;
+  int h, p,
+      n_samples = 1 * width * spp,
+      n_bytes = n_samples * byteps;
+
+  for(h = start; h < end; ++h)
+  {
+    /* adapt the copied line and not the source */
+    unsigned char *d_8 = &buf[ h * width * spp * byteps ];
+    uint16_t *d_16 = (uint16_t*)d_8;
+    half   *d_f16 = (half*)d_8;
+    float  *d_f = (float*)d_8;
+
+    /*  TODO 1 bit raw and ascii */
+    if (type == 1 || type == 4) {
+
+    /*  TODO ascii  */
+    } else if (type == 2 || type == 3) {
+
+
+    /*  raw and floats */
+    } else if (type == 5 || type == 6 ||
+               type == -5 || type == -6 ||
+               type == -8 || type == -9 ||
+               type == 7 )
+    {
+      memcpy (d_8,
+              &src[ h * width * spp * byteps ],
+              1 * width * spp * byteps);
+    }
+
+    /* normalise and byteswap */
+    if( l->byte_swap )
+    {
+      unsigned char *c_buf = d_8;
+      char  tmp;
+      if (byteps == 2) {         /* 16 bit */
+        for (p = 0; p < n_bytes; p += 2)
+        {
+          tmp = c_buf[p];
+          c_buf[p] = c_buf[p+1];
+          c_buf[p+1] = tmp;
+        }
+      } else if (byteps == 4) {  /* float */
+        for (p = 0; p < n_bytes; p += 4)
+        {
+          tmp = c_buf[p];
+          c_buf[p] = c_buf[p+3];
+          c_buf[p+3] = tmp;
+          tmp = c_buf[p+1];
+          c_buf[p+1] = c_buf[p+2];
+          c_buf[p+2] = tmp;
+        }
+      }
+    }
+
+    if (byteps == 1 && maxval < 255) {         /*  8 bit */
+      for (p = 0; p < n_samples; ++p)
+        d_8[p] = (d_8[p] * 255) / maxval;
+    } else if (byteps == 2 && maxval != 1.0 &&
+               (type == -8 || type == -9)) {  /* half float */
+      for (p = 0; p < n_samples; ++p)
+        d_f16[p] = d_f16[p] * maxval;
+    } else if (byteps == 2 && maxval < 65535 &&
+               type != -8 && type != -9) {/* 16 bit */
+      for (p = 0; p < n_samples; ++p)
+        d_16 [p] = (d_16[p] * 65535) / maxval;
+    } else if (byteps == 4 && maxval != 1.0) {  /* float */
+      for (p = 0; p < n_samples; ++p)
+        d_f[p] = d_f[p] * maxval;
+    }
+  }
+}
+
 /** @func    oyraFilterPlug_ImageInputPPMRun
  *  @brief   implement oyCMMFilter_GetNext_f()
  *
@@ -476,6 +775,9 @@ int      oyraFilterPlug_ImageInputPPMRun (
   size_t  fpos = 0;
   uint8_t * data = 0, * buf = 0;
   size_t  mem_n = 0;   /* needed memory in bytes */
+  size_t  map_size = 0;/* data is mapped from the file */
+  int     byte_swap = 0;
+  int     bigendian = 1;  /* PAM sample order; BIGENDIAN 0 is host order */
     
   int info_good = 1;
   int32_t icc_profile_flags = 0;
@@ -523,37 +825,64 @@ int      oyraFilterPlug_ImageInputPPMRun (
     oyOptions_Release( &opts );
   }
 
+#if defined(OYRA_PPM_MMAP)
+  /* map the file instead of reading it */
   if(filename)
-    fp = fopen( filename, "rm" );
-
-  if(!fp)
   {
-    oyra_msg( oyMSG_WARN, (oyStruct_s*)node,
-             OY_DBG_FORMAT_ " could not open: %s",
-             OY_DBG_ARGS_, oyNoEmptyString_m_( filename ) );
-    return 1;
+    struct stat st;
+    int fd = open( filename, O_RDONLY );
+
+    if(fd >= 0 && fstat( fd, &st ) == 0 && st.st_size > 0)
+    {
+      data = mmap( NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+                   fd, 0 );
+      if(data == MAP_FAILED)
+        data = NULL;
+      else
+      {
+        map_size = st.st_size;
+        fsize = st.st_size;
+      }
+    }
+    if(fd >= 0)
+      close( fd );
   }
+#endif
+
+  if(!data)
+  {
+    if(filename)
+      fp = fopen( filename, "rm" );
 
-  fseek(fp,0L,SEEK_END);
-  fsize = ftell(fp);
-  rewind(fp);
+    if(!fp)
+    {
+      oyra_msg( oyMSG_WARN, (oyStruct_s*)node,
+               OY_DBG_FORMAT_ " could not open: %s",
+               OY_DBG_ARGS_, oyNoEmptyString_m_( filename ) );
+      return 1;
+    }
 
-  oyAllocHelper_m_( data, uint8_t, fsize, 0, fclose(fp); return 1);
+    fseek(fp,0L,SEEK_END);
+    fsize = ftell(fp);
+    rewind(fp);
 
-  fpos = fread( data, sizeof(uint8_t), fsize, fp );
-  if( fpos < (size_t)fsize ) {
-    oyra_msg( oyMSG_WARN, (oyStruct_s*)node,
-             OY_DBG_FORMAT_ " could not read: %s %d %d",
-             OY_DBG_ARGS_, oyNoEmptyString_m_( filename ), fsize, (int)fpos );
-    oyFree_m_( data )
+    oyAllocHelper_m_( data, uint8_t, fsize, 0, fclose(fp); return 1);
+
+    fpos = fread( data, sizeof(uint8_t), fsize, fp );
+    if( fpos < (size_t)fsize ) {
+      oyra_msg( oyMSG_WARN, (oyStruct_s*)node,
+               OY_DBG_FORMAT_ " could not read: %s %d %d",
+               OY_DBG_ARGS_, oyNoEmptyString_m_( filename ), fsize, (int)fpos );
+      oyFree_m_( data )
+      fclose (fp);
+      return FALSE;
+    }
+
+    fpos = 0;
     fclose (fp);
-    return FALSE;
+    fp = NULL;
   }
 
-  fpos = 0;
-  fclose (fp);
-  fp = NULL;
-
 
   /* parse Infos */
   if(data[fpos] == 'P')
@@ -697,6 +1026,8 @@ int      oyraFilterPlug_ImageInputPPMRun (
               tupl = 1;
               tupltype = oyStringCopy(var_s, oyAllocateFunc_);
             }
+            if(bigendian == -1)
+              bigendian = (int)var;
 
             if(strcmp(var_s, "HEIGHT") == 0)
               height = -1; /* expecting the next token is the val */
@@ -708,6 +1039,11 @@ int      oyraFilterPlug_ImageInputPPMRun (
               maxval = -0.5;
             if(strcmp(var_s, "TUPLTYPE") == 0)
               tupl = -1;
+            if(strcmp(var_s, "BIGENDIAN") == 0)
+            {
+              bigendian = -1;
+              v_need += 2; /* keep reading up to ENDHDR */
+            }
             if(strcmp(var_s, "ENDHDR") == 0)
               v_need = v_read;
           }
@@ -875,7 +1211,7 @@ int      oyraFilterPlug_ImageInputPPMRun (
     oyra_msg( oyMSG_WARN, (oyStruct_s*)node,
              OY_DBG_FORMAT_ "failed to get info of %s",
              OY_DBG_ARGS_, oyNoEmptyString_m_( filename ));
-    oyFree_m_( data )
+    oyraPPMDataRelease_( &data, &map_size );
     return FALSE;
   }
 
@@ -889,7 +1225,7 @@ int      oyraFilterPlug_ImageInputPPMRun (
              OY_DBG_FORMAT_ "\n  storage size of %s is too small: %d",
              OY_DBG_ARGS_, oyNoEmptyString_m_( filename ),
              (int)mem_n-fsize-fpos );
-      oyFree_m_( data )
+      oyraPPMDataRelease_( &data, &map_size );
       return FALSE;
     }
 
@@ -904,126 +1240,125 @@ int      oyraFilterPlug_ImageInputPPMRun (
              OY_DBG_FORMAT_ "\n  %s contains bitmap data, which are not handled by this pnm reader",
              OY_DBG_ARGS_, oyNoEmptyString_m_( filename ) );
     }
-    oyFree_m_( data )
+    oyraPPMDataRelease_( &data, &map_size );
     return FALSE;
   }
 
-  oyAllocHelper_m_( buf, uint8_t, mem_n, 0, oyFree_m_( data ); return 1);
-  DBG_NUM2_S("allocate image data: 0x%x size: %d ", (int)(intptr_t)
-              buf, mem_n );
+  if(type == 7)
+  {
+    if( (byteps == 2 || byteps == 4) &&
+        oyBigEndian() != (bigendian != 0) )
+      byte_swap = 1;
+  } else
+  if(oyBigEndian())
+  {
+    if( maxval < 0 &&
+        (byteps == 2 || byteps == 4) )
+      byte_swap = 1;
+  } else
+  {
+    if( maxval > 0 && 
+        (byteps == 2 || byteps == 4) )
+      byte_swap = 1;
+  }
 
-  /* the following code is almost completely taken from ku.b's ppm CP plug-in */
+  pixel_type = oyChannels_m(spp) | oyDataType_m(data_type); 
+  if(!prof)
+    prof = oyProfile_FromStd( profile_type, icc_profile_flags, 0 );
+
+#if defined(OYRA_PPM_MMAP)
+  /* Samples without intensity adaption are used in place from the mapping.
+   * Byte swapping happens per line on first access. */
+  if(map_size &&
+     ((data_type == oyUINT8 && fabs(maxval) == 255.0) ||
+      (data_type == oyUINT16 && fabs(maxval) == 65535.0) ||
+      ((data_type == oyHALF || data_type == oyFLOAT) && fabs(maxval) == 1.0)))
   {
-    int h, j_h = 0, p, n_samples = 0, n_bytes = 0;
-    int byte_swap = 0;
-    unsigned char *d_8 = 0;
-    unsigned char *src = &data[fpos];
-
-    uint16_t *d_16;
-    half   *d_f16;
-    float  *d_f;
-    int adapt = 0;
+    oyraPPMMap_s * m = NULL;
+    oyPointer_s * ptr = NULL;
+
+    oyAllocHelper_m_( m, oyraPPMMap_s, 1, 0,
+                      oyraPPMDataRelease_( &data, &map_size ); return 1 );
+    memset( m, 0, sizeof(oyraPPMMap_s) );
+    m->map = data;
+    m->map_size = map_size;
+    m->pixels = &data[fpos];
+    m->stride = (size_t)width * spp * byteps;
+    m->byteps = byteps;
+    m->height = height;
+    /* the mapping belongs now to m */
+    data = NULL;
+    map_size = 0;
+
+    if(byte_swap)
+    {
+      m->swapped = oyAllocateFunc_( height * sizeof(int) );
+      if(m->swapped)
+        memset( m->swapped, 0, height * sizeof(int) );
+      else
+        error = 1;
+    }
 
-    if(oyBigEndian())
+    if(!error)
+      image_in = oyImage_Create( width, height, m->pixels, pixel_type, prof,
+                                 0 );
+    if(image_in)
+      ptr = oyPointer_New( 0 );
+    if(ptr)
     {
-      if( maxval < 0 &&
-          (byteps == 2 || byteps == 4) )
-        byte_swap = 1;
+      oyPointer_Set( ptr, CMM_NICK, "oyraPPMMap_s", m, "oyraPPMMapRelease_",
+                     oyraPPMMapRelease_ );
+      oyImage_SetData( image_in, (oyStruct_s**)&ptr,
+                       oyraPPMGetPoint_, oyraPPMGetLine_, 0,
+                       oyraPPMSetPoint_, oyraPPMSetLine_, 0 );
     } else
     {
-      if( maxval > 0 && 
-          (byteps == 2 || byteps == 4) )
-        byte_swap = 1;
+      oyImage_Release( &image_in );
+      oyraPPMMapRelease_( (oyPointer*)&m );
     }
 
-    maxval = fabs(maxval);
-
-    for(h = 0; h < height; ++h)
+    if(oy_debug)
+      oyra_msg( oyMSG_DBG, (oyStruct_s*)node, OY_DBG_FORMAT_
+                "mapped %s %dx%d%s", OY_DBG_ARGS_, filename, width, height,
+                byte_swap ? " lazy byte swap" : "" );
+  } else
+#endif
+  {
+    /* the image owns its pixel storage */
+    image_in = oyImage_Create( width, height, NULL, pixel_type, prof, 0 );
+    if(image_in)
     {
-        n_samples = 1 * width * spp;
-        n_bytes = n_samples * byteps;
-
-        d_8  = buf;
-        d_16 = (uint16_t*)buf;
-        d_f16= (half*)buf;
-        d_f  = (float*)buf;
-
-        /*  TODO 1 bit raw and ascii */
-        if (type == 1 || type == 4) {
-
-        /*  TODO ascii  */
-        } else if (type == 2 || type == 3) {
+      oyArray2d_s * a = (oyArray2d_s*) oyImage_GetPixelData( image_in );
+      uint8_t ** rows = (uint8_t**) oyArray2d_GetData( a );
+      if(rows)
+        buf = rows[0];
+      oyArray2d_Release( &a );
+    }
+    if(!buf)
+      oyImage_Release( &image_in );
+  }
 
+  /* the following code is almost completely taken from ku.b's ppm CP plug-in */
+  if(buf)
+  {
+    int n_samples = 1 * width * spp,
+        n_bytes = n_samples * byteps;
+    int adapt = 0;
 
-        /*  raw and floats */
-        } else if (type == 5 || type == 6 ||
-                   type == -5 || type == -6 ||
-                   type == -8 || type == -9 ||
-                   type == 7 )
-        {
-          if(byteps == 1) {
-            d_8 = &src[ h * width * spp * byteps ];
-          } else if(byteps == 2) {
-            d_f16 = d_16 = (uint16_t*)& src[ h * width * spp * byteps ];
-          } else if(byteps == 4) {
-            d_f = (float*)&src[ h * width * spp * byteps ];
-          }
-          memcpy (&buf[ h * width * spp * byteps ],
-                  &src[ (j_h + h) * width * spp * byteps ],
-                  1 * width * spp * byteps);
-        }
+    maxval = fabs(maxval);
 
-        /* normalise and byteswap */
-        if( byte_swap )
-        {
-          unsigned char *c_buf = &buf[ h * width * spp * byteps ];
-          char  tmp;
-          adapt |= 1;
-          if (byteps == 2) {         /* 16 bit */
-#pragma omp parallel for private(tmp)
-            for (p = 0; p < n_bytes; p += 2)
-            {
-              tmp = c_buf[p];
-              c_buf[p] = c_buf[p+1];
-              c_buf[p+1] = tmp;
-            }
-          } else if (byteps == 4) {  /* float */
-#pragma omp parallel for private(tmp)
-            for (p = 0; p < n_bytes; p += 4)
-            {
-              tmp = c_buf[p];
-              c_buf[p] = c_buf[p+3];
-              c_buf[p+3] = tmp;
-              tmp = c_buf[p+1];
-              c_buf[p+1] = c_buf[p+2];
-              c_buf[p+2] = tmp;
-            }
-          }
-        }
+    if( byte_swap )
+      adapt |= 1;
+    if ((byteps == 1 && maxval < 255) ||
+        (byteps == 2 && maxval != 1.0 && (type == -8 || type == -9)) ||
+        (byteps == 2 && maxval < 65535 && type != -8 && type != -9) ||
+        (byteps == 4 && maxval != 1.0))
+      adapt |= 2;
 
-        if (byteps == 1 && maxval < 255) {         /*  8 bit */
-          adapt |= 2;
-#pragma omp parallel for
-          for (p = 0; p < n_samples; ++p)
-            d_8[p] = (d_8[p] * 255) / maxval;
-        } else if (byteps == 2 && maxval != 1.0 &&
-                   (type == -8 || type == -9)) {  /* half float */
-          adapt |= 2;
-#pragma omp parallel for
-          for (p = 0; p < n_samples; ++p)
-            d_f16[p] = d_f16[p] * maxval;
-        } else if (byteps == 2 && maxval < 65535 &&
-                   type != -8 && type != -9) {/* 16 bit */
-          adapt |= 2;
-#pragma omp parallel for
-          for (p = 0; p < n_samples; ++p)
-            d_16 [p] = (d_16[p] * 65535) / maxval;
-        } else if (byteps == 4 && maxval != 1.0) {  /* float */
-          adapt |= 2;
-#pragma omp parallel for
-          for (p = 0; p < n_samples; ++p)
-            d_f[p] = d_f[p] * maxval;
-        }
+    {
+      oyraPPMLines_s lines = { buf, &data[fpos], maxval, type, width, spp,
+                               byteps, byte_swap };
+      oyParallelFor( height, oyraPPMLines_, &lines, 1 );
     }
     if((adapt & 1) && oy_debug)
       oyra_msg( oyMSG_DBG, (oyStruct_s*)node, OY_DBG_FORMAT_ 
@@ -1033,18 +1368,15 @@ int      oyraFilterPlug_ImageInputPPMRun (
         OY_DBG_FORMAT_ "going to adapt intensity %g %d", OY_DBG_ARGS_, maxval, n_samples );
   }
 
-  pixel_type = oyChannels_m(spp) | oyDataType_m(data_type); 
-  if(!prof)
-    prof = oyProfile_FromStd( profile_type, icc_profile_flags, 0 );
-
-  image_in = oyImage_Create( width, height, buf, pixel_type, prof, 0 );
+  oyProfile_Release( &prof );
+  if(data)
+    oyraPPMDataRelease_( &data, &map_size );
 
   if (!image_in)
   {
       oyra_msg( oyMSG_WARN, (oyStruct_s*)node,
              OY_DBG_FORMAT_ "PNM can't create a new image\n%dx%d %d",
              OY_DBG_ARGS_,  width, height, pixel_type );
-      oyFree_m_ (data)
     return FALSE;
   }
 
@@ -1079,7 +1411,6 @@ int      oyraFilterPlug_ImageInputPPMRun (
   oyImage_Release( &output_image );
   oyFilterNode_Release( &node );
   oyFilterSocket_Release( &socket );
-  oyFree_m_ (data)
 
   /* return an error to cause the graph to retry */
   return 1;
@@ -25,6 +25,7 @@
 #include "oyranos_helper.h"
 #include "oyranos_i18n.h"
 #include "oyranos_string.h"
+#include "oyranos_threads.h"
 
 #include <math.h>
 #include <stdarg.h>
@@ -42,6 +43,70 @@
 /* OY_IMAGE_SCALE_REGISTRATION ----------------------------------------------*/
 
 
+/* lines of oyraFilter_ImageScaleRun() for oyParallelFor() */
+typedef struct {
+  uint8_t ** array_in_data,
+          ** array_out_data;
+  oyPixelAccess_s * ticket;
+  double scale;
+  int bps_in, bps_out, channels_src, channels_dst, nw, nh, w, h;
+} oyraScaleLines_s;
+static void oyraScaleLines_          ( int                 start,
+                                       int                 end,
+                                       void              * data )
+{
+  oyraScaleLines_s * l = (oyraScaleLines_s*)data;
+  uint8_t ** array_in_data = l->array_in_data,
+          ** array_out_data = l->array_out_data;
+  oyPixelAccess_s * ticket = l->ticket;
+  double scale = l->scale;
+  int bps_in = l->bps_in,
+      bps_out = l->bps_out,
+      channels_src = l->channels_src,
+      channels_dst = l->channels_dst,
+      nw = l->nw,
+      nh = l->nh,
+      w = l->w,
+      h = l->h;
+  int x, y, xs, ys;
+
+  for(y = start; y < end; ++y)
+  {
+    ys = y/scale;
+    if(OY_ROUNDp(ys) >= nh)
+    {
+      if(oy_debug || (OY_ROUNDp(ys) >= (nh + 1)))
+        oyra_msg( oy_debug?oyMSG_DBG:oyMSG_ERROR, (oyStruct_s*)ticket,
+                OY_DBG_FORMAT_"scale:%g y:%d h:%d ys:%d/%g nh:%d\n",
+                OY_DBG_ARGS_, scale, y,h,ys,y/scale,nh);
+    } else
+    for(x = 0; x < w; ++x)
+    {
+      xs = x/scale;
+      if(OY_ROUNDp(xs) < nw)
+      {
+#if 0
+        /* optimisations which have not much benefit */
+        int chars = channels_src*bps_in, b;
+        uint32_t ** array_out_4 = (uint32_t**)array_out_data;
+        uint32_t ** array_in_4  = (uint32_t**)array_in_data;
+        if(bps_in == 4)
+        for( b = 0; b < channels_src; ++b )
+          array_out_4[y] [x  *channels_dst+b] =
+          array_in_4 [ys][xs *channels_src+b];
+        else
+        for( b = 0; b < chars; ++b )
+          array_out_data[y] [x  *channels_dst*bps_out+b] =
+          array_in_data [ys][xs *channels_src*bps_in +b];
+#else
+        memmove( &array_out_data[y] [x  *channels_dst*bps_out],
+                 &array_in_data [ys][xs *channels_src*bps_in], channels_src*bps_in );
+#endif
+      }
+    }
+  }
+}
+
 /** @func    oyraFilter_ImageScaleRun
  *  @brief   implement oyCMMFilter_GetNext_f()
  *
@@ -160,6 +225,11 @@ int      oyraFilter_ImageScaleRun    ( oyFilterPlug_s    * requestor_plug,
         /* scale */
       oyRectangle_Scale( new_ticket_array_roi_pix, 1.0/scale );
       oyRectangle_Round( new_ticket_array_roi_pix );
+        /* the source array is private to new_ticket; place the roi at its
+         * origin, the image offset goes with start_x/y_dst_pixel */
+      oyRectangle_SetGeo( new_ticket_array_roi_pix, 0, 0,
+                          oyRectangle_GetGeo1( new_ticket_array_roi_pix, 2 ),
+                          oyRectangle_GetGeo1( new_ticket_array_roi_pix, 3 ) );
         /* convert to new_ticket relative dimensions */
       oyPixelAccess_PixelsToRoi( new_ticket, new_ticket_array_roi_pix,
                                  &new_ticket_array_roi );
@@ -172,6 +242,20 @@ int      oyraFilter_ImageScaleRun    ( oyFilterPlug_s    * requestor_plug,
                                      start_y_dst_pixel / image_width,
                                      new_ticket_array_roi );
 
+      /* recycle the source array of a previous run with the same ticket;
+       * oyPixelAccess_SetArray() adapts the new_ticket roi to the array */
+      {
+        int aw = OY_ROUND( oyRectangle_GetGeo1( new_ticket_array_roi_pix, 2 ) ),
+            ah = OY_ROUND( oyRectangle_GetGeo1( new_ticket_array_roi_pix, 3 ) );
+        if(aw > 0 && ah > 0)
+        {
+          oyArray2d_s * a = oyPixelAccess_TakeArray( ticket, aw * channels_src,
+                                         ah, oyToDataType_m( layout_src ) );
+          oyPixelAccess_SetArray( new_ticket, a, 0 );
+          oyArray2d_Release( &a );
+        }
+      }
+
       if(oy_debug)
         oyMessageFunc_p( oy_debug?oyMSG_DBG:oyMSG_WARN, (oyStruct_s*)ticket, OY_DBG_FORMAT_
               "ticket: %s image[%d](%d) -> [%d](%d) scale %f\n",OY_DBG_ARGS_,
@@ -199,7 +283,7 @@ int      oyraFilter_ImageScaleRun    ( oyFilterPlug_s    * requestor_plug,
 
       if(oyRectangle_CountPoints(  new_ticket_array_roi ) > 0)
       {
-        int nw,nh,w,h,x,y,xs,ys;
+        int nw,nh,w,h;
         oyArray2d_s * array_in,
                     * array_out;
         uint8_t ** array_in_data,
@@ -261,47 +345,16 @@ int      oyraFilter_ImageScaleRun    ( oyFilterPlug_s    * requestor_plug,
         }
 
         /* do the scaling while copying the channels */
-#if defined(USE_OPENMP)
-#pragma omp parallel for private(x,xs,ys)
-#endif
-        for(y = 0; y < h; ++y)
         {
-          ys = y/scale;
-          if(OY_ROUNDp(ys) >= nh)
-          {
-            if(oy_debug || (OY_ROUNDp(ys) >= (nh + 1)))
-              oyra_msg( oy_debug?oyMSG_DBG:oyMSG_ERROR, (oyStruct_s*)ticket,
-                      OY_DBG_FORMAT_"scale:%g y:%d h:%d ys:%d/%g nh:%d\n",
-                      OY_DBG_ARGS_, scale, y,h,ys,y/scale,nh);
-          } else
-          for(x = 0; x < w; ++x)
-          {
-            xs = x/scale;
-            if(OY_ROUNDp(xs) < nw)
-            {
-#if 0
-              /* optimisations which have not much benefit */
-              int chars = channels_src*bps_in, b;
-              uint32_t ** array_out_4 = (uint32_t**)array_out_data;
-              uint32_t ** array_in_4  = (uint32_t**)array_in_data;
-              if(bps_in == 4)
-              for( b = 0; b < channels_src; ++b )
-                array_out_4[y] [x  *channels_dst+b] =
-                array_in_4 [ys][xs *channels_src+b];
-              else
-              for( b = 0; b < chars; ++b )
-                array_out_data[y] [x  *channels_dst*bps_out+b] =
-                array_in_data [ys][xs *channels_src*bps_in +b];
-#else
-              memmove( &array_out_data[y] [x  *channels_dst*bps_out],
-                       &array_in_data [ys][xs *channels_src*bps_in], channels_src*bps_in );
-#endif
-            }
-          }
+          oyraScaleLines_s lines = { array_in_data, array_out_data, ticket,
+                                     scale, bps_in, bps_out, channels_src,
+                                     channels_dst, nw, nh, w, h };
+          oyParallelFor( h, oyraScaleLines_, &lines, 1 );
         }
 
         oyPixelAccess_Release( &new_ticket );
-        oyArray2d_Release( &array_in );
+        /* keep the source array for the next frame */
+        oyPixelAccess_GiveArray( ticket, &array_in );
         oyArray2d_Release( &array_out );
       }
 
@@ -23,6 +23,10 @@
 
 //      * move some of the Why questions above to the doxygen docu.
 
+#if defined(__linux__) && !defined(_GNU_SOURCE)
+# define _GNU_SOURCE                   /* pthread_setaffinity_np() */
+#endif
+
 #include "oyCMM_s.h"
 #include "oyCMMapi10_s_.h"
 
@@ -48,11 +52,18 @@ oyCMMapi10_s    trds_api10_cmm;
 typedef unsigned long oyThread_t;
 # define oyThreadSelf  GetCurrentThreadId
 # define oyThreadEqual(a,b) ((a) == (b))
-typedef CRITICAL_SECTION oyMutex_t;
-# define oyMutexInit_m(m,a) InitializeCriticalSection(m)
-# define oyMutexLock_m(m) EnterCriticalSection(m)
-# define oyMutexUnLock_m(m) LeaveCriticalSection(m)
-# define oyMutexDestroy_m(m) DeleteCriticalSection(m)
+typedef struct {
+  CRITICAL_SECTION mutex;
+  CONDITION_VARIABLE cond;
+} oyMutex_t;
+# define oyMutexInit_m(m,a) { InitializeCriticalSection(m.mutex); InitializeConditionVariable(m.cond); }
+# define oyMutexLock_m(m) EnterCriticalSection(m.mutex)
+# define oyMutexUnLock_m(m) LeaveCriticalSection(m.mutex)
+# define oyMutexDestroy_m(m) DeleteCriticalSection(m.mutex)
+/* return zero on wake up and non zero on timeout; msec < 0 waits forever */
+# define oyCondWait_m(m,msec) (!SleepConditionVariableCS(m.cond, m.mutex, (msec) < 0 ? INFINITE : (DWORD)(msec)))
+# define oyCondSignal_m(m) WakeConditionVariable(m.cond)
+# define oyCondBroadcast_m(m) WakeAllConditionVariable(m.cond)
 #else
 # include <pthread.h>
 typedef pthread_t oyThread_t;
@@ -66,6 +77,9 @@ typedef struct {
 # define oyMutexLock_m(m) pthread_mutex_lock(m.mutex)
 # define oyMutexUnLock_m(m) pthread_mutex_unlock(m.mutex)
 # define oyMutexDestroy_m(m) { pthread_mutex_destroy(m.mutex); pthread_cond_destroy(m.cond); }
+# define oyCondWait_m(m,msec) oyCondWait_(m.cond, m.mutex, msec)
+# define oyCondSignal_m(m) pthread_cond_signal(m.cond)
+# define oyCondBroadcast_m(m) pthread_cond_broadcast(m.cond)
 #endif 
 
 int oyThreadCreate                   ( void             *(*func) (void * data),
@@ -83,6 +97,18 @@ int                oyMsg_Add_        ( oyJob_s           * job,
                                        double              progress_zero_till_one,
                                        char             ** status_text );
 void               oyJobResult_      ( void );
+int                oyJobResultWait_  ( double              seconds );
+int                oyJob_Cancel_     ( int                 job_id,
+                                       int                 group );
+int                oyJobGroupWait_   ( int                 group,
+                                       double              seconds );
+int                oyJobPool_        ( int                 workers,
+                                       const char        * cpus,
+                                       int                 flags );
+int                oyParallelFor_    ( int                 n,
+                                       oyParallelBody_f    body,
+                                       void              * data,
+                                       int                 grain );
 
 oyMessage_f trds_msg = oyMessageFunc;
 
@@ -91,10 +117,15 @@ int                trdsCMMInit       ( );
 
 
 #include <unistd.h> /* usleep() */
+#include <time.h>   /* clock_gettime() */
 #ifdef _OPENMP
 #define USE_OPENMP 1
 #include <omp.h> /* omp_get_num_procs() */
 #endif
+#include <stdlib.h> /* getenv() strtol() */
+#if defined(__linux__)
+#include <sched.h>  /* sched_getaffinity() */
+#endif
 
 
 #ifdef __cplusplus
@@ -135,6 +166,29 @@ int oyThreadCreate                   ( void             *(*func) (void * ptr),
   return error;
 }
 
+#if !defined(_WIN32) || defined(__GNU__)
+/* return zero on wake up and non zero on timeout; msec < 0 waits forever */
+static int oyCondWait_               ( pthread_cond_t    * cond,
+                                       pthread_mutex_t   * mutex,
+                                       int                 msec )
+{
+  struct timespec ts;
+
+  if(msec < 0)
+    return pthread_cond_wait( cond, mutex );
+
+  clock_gettime( CLOCK_REALTIME, &ts );
+  ts.tv_sec += msec / 1000;
+  ts.tv_nsec += (long)(msec % 1000) * 1000000L;
+  if(ts.tv_nsec >= 1000000000L)
+  {
+    ++ts.tv_sec;
+    ts.tv_nsec -= 1000000000L;
+  }
+  return pthread_cond_timedwait( cond, mutex, &ts );
+}
+#endif
+
 typedef struct {
   oyMutex_t m;
   oyThread_t t;
@@ -227,40 +281,769 @@ void       oyUnLock_                   ( oyPointer         lock,
 }
 
 
-/* forward declaration from src/API_generated/oyStruct_s.c */
-void oyThreadAdd()
+/* FIFO of oyJob_s pointers; a ring buffer guarded by its own mutex, with
+ * the condition variable signalled on each push */
+typedef struct {
+  oyJob_s   ** jobs;
+  int          size;
+  int          first;
+  int          n;
+  int          wake_ups;               /* non job events, e.g. messages */
+  oyMutex_t    m;
+} oyJobQueue_s;
+
+static oyJobQueue_s * oyJobQueue_New_( void )
 {
-  oyThread_t background_thread;
-  int error;
-  oyOption_s * o = oyOption_FromRegistration( "///id", NULL );
-  int count = oyStructList_Count( oy_threads_ );
-  oyBlob_s * blob;
+  oyJobQueue_s * q = (oyJobQueue_s*) calloc( sizeof(oyJobQueue_s), 1 );
+  if(!q) return NULL;
+  q->size = 64;
+  q->jobs = (oyJob_s**) calloc( sizeof(oyJob_s*), q->size );
+  oyMutexInit_m( &q->m, NULL );
+  return q;
+}
 
-  oyOption_SetFromInt( o, count, 0, 0 );
+static int   oyJobQueue_Push_        ( oyJobQueue_s      * q,
+                                       oyJob_s           * job )
+{
+  int error = 0;
 
-  oyThreadCreate( oyJobWorker, (oyPointer)o, &background_thread );
-  if(oy_debug)
-    trds_msg( oyMSG_DBG, 0, "thread created [%ld]\n", background_thread);
+  oyMutexLock_m( &q->m );
+  if(q->n == q->size)
+  {
+    /* grow and unwrap the ring */
+    oyJob_s ** jobs = (oyJob_s**) calloc( sizeof(oyJob_s*), q->size * 2 );
+    int i;
+    if(jobs)
+    {
+      for(i = 0; i < q->n; ++i)
+        jobs[i] = q->jobs[(q->first + i) % q->size];
+      free( q->jobs );
+      q->jobs = jobs;
+      q->first = 0;
+      q->size *= 2;
+    } else
+      error = 1;
+  }
+  if(!error)
+  {
+    q->jobs[(q->first + q->n) % q->size] = job;
+    ++q->n;
+    oyCondSignal_m( &q->m );
+  }
+  oyMutexUnLock_m( &q->m );
+
+  return error;
+}
+
+/* wake up waiters without adding a job */
+static void  oyJobQueue_Wake_        ( oyJobQueue_s      * q )
+{
+  oyMutexLock_m( &q->m );
+  ++q->wake_ups;
+  oyCondBroadcast_m( &q->m );
+  oyMutexUnLock_m( &q->m );
+}
+
+/* Take the oldest job. Block until a job arrives for msec < 0, block at
+ * most msec milliseconds otherwise. A wake up from oyJobQueue_Wake_()
+ * returns early without a job. */
+static oyJob_s * oyJobQueue_Pop_     ( oyJobQueue_s      * q,
+                                       int                 msec )
+{
+  oyJob_s * job = NULL;
+  int timeout = 0;
+
+  oyMutexLock_m( &q->m );
+  while(q->n == 0 && q->wake_ups == 0 && msec != 0 && !timeout)
+    timeout = oyCondWait_m( &q->m, msec ) != 0;
+  if(q->n)
+  {
+    job = q->jobs[q->first];
+    q->jobs[q->first] = NULL;
+    q->first = (q->first + 1) % q->size;
+    --q->n;
+  }
+  q->wake_ups = 0;
+  oyMutexUnLock_m( &q->m );
+
+  return job;
+}
+
+/* growable array of oyJob_s pointers */
+typedef struct {
+  oyJob_s   ** jobs;
+  int          n;
+  int          size;
+} oyJobArray_s;
+
+static int   oyJobArray_Add_         ( oyJobArray_s      * a,
+                                       oyJob_s           * job )
+{
+  if(a->n == a->size)
+  {
+    int size = a->size ? a->size * 2 : 64;
+    oyJob_s ** jobs = (oyJob_s**) realloc( a->jobs, sizeof(oyJob_s*) * size );
+    if(!jobs) return 1;
+    a->jobs = jobs;
+    a->size = size;
+  }
+  a->jobs[a->n++] = job;
+  return 0;
+}
+
+/* unordered removal */
+static oyJob_s * oyJobArray_TakeAt_  ( oyJobArray_s      * a,
+                                       int                 i )
+{
+  oyJob_s * job = a->jobs[i];
+  a->jobs[i] = a->jobs[--a->n];
+  return job;
+}
+
+/* The ready jobs form a binary heap. Higher priority goes first and
+ * lower ID, that is earlier added, on equal priority. */
+#define oyJobBefore_m(a,b) ((a)->priority > (b)->priority || \
+                            ((a)->priority == (b)->priority && (a)->id_ < (b)->id_))
+static void  oyJobHeap_Up_           ( oyJobArray_s      * a,
+                                       int                 i )
+{
+  while(i > 0)
+  {
+    int parent = (i - 1) / 2;
+    oyJob_s * job = a->jobs[i];
+    if(!oyJobBefore_m( job, a->jobs[parent] ))
+      break;
+    a->jobs[i] = a->jobs[parent];
+    a->jobs[parent] = job;
+    i = parent;
+  }
+}
+static void  oyJobHeap_Down_         ( oyJobArray_s      * a,
+                                       int                 i )
+{
+  while(1)
+  {
+    int l = 2 * i + 1, r = l + 1, first = i;
+    oyJob_s * job;
+    if(l < a->n && oyJobBefore_m( a->jobs[l], a->jobs[first] ))
+      first = l;
+    if(r < a->n && oyJobBefore_m( a->jobs[r], a->jobs[first] ))
+      first = r;
+    if(first == i)
+      break;
+    job = a->jobs[i];
+    a->jobs[i] = a->jobs[first];
+    a->jobs[first] = job;
+    i = first;
+  }
+}
+static int   oyJobHeap_Push_         ( oyJobArray_s      * a,
+                                       oyJob_s           * job )
+{
+  if(oyJobArray_Add_( a, job ))
+    return 1;
+  oyJobHeap_Up_( a, a->n - 1 );
+  return 0;
+}
+static oyJob_s * oyJobHeap_TakeAt_   ( oyJobArray_s      * a,
+                                       int                 i )
+{
+  oyJob_s * job = a->jobs[i];
+  if(i < --a->n)
+  {
+    a->jobs[i] = a->jobs[a->n];
+    oyJobHeap_Up_( a, i );
+    oyJobHeap_Down_( a, i );
+  }
+  return job;
+}
+
+typedef struct {
+  int          group;
+  int          n;                      /* added and not yet finish()ed */
+} oyJobGroup_s;
+
+/* iterations of a oyParallelFor_() loop; the owner takes from the front,
+ * other threads steal from the back */
+typedef struct {
+  oyMutex_t    m;
+  int          begin;
+  int          end;
+} oyLoopRange_s;
+
+/* a running oyParallelFor_() loop */
+typedef struct {
+  oyParallelBody_f body;
+  void       * data;
+  int          grain;
+  oyLoopRange_s * ranges;              /* one per thread */
+  int          ranges_n;
+  int          joined;                 /* ranges in use */
+  int          left;                   /* iterations not yet done */
+  int          ref;
+  oyMutex_t    m;                      /* signals left == 0 */
+} oyLoop_s;
+
+static void  oyLoop_Release_         ( oyLoop_s         ** loop )
+{
+  oyLoop_s * l = *loop;
+  int i;
+
+  *loop = NULL;
+  if(oyAtomicAdd_m_( &l->ref, -1 ) != 0)
+    return;
+
+  for(i = 0; i < l->ranges_n; ++i)
+    oyMutexDestroy_m( &l->ranges[i].m );
+  oyMutexDestroy_m( &l->m );
+  free( l->ranges );
+  free( l );
+}
+
+/* take the next iterations for range i; steal if it is empty */
+static int   oyLoop_Next_            ( oyLoop_s          * l,
+                                       int                 i,
+                                       int               * begin,
+                                       int               * end )
+{
+  oyLoopRange_s * r = &l->ranges[i];
+  int n = 0;
+
+  while(1)
+  {
+    int j, victim = -1, most = 0;
+
+    /* adaptive chunks: large at the start, down to grain at the end */
+    oyMutexLock_m( &r->m );
+    n = r->end - r->begin;
+    if(n > 0)
+    {
+      int chunk = n / (2 * l->ranges_n);
+      if(chunk < l->grain)
+        chunk = OY_MIN( n, l->grain );
+      *begin = r->begin;
+      *end = r->begin += chunk;
+    }
+    oyMutexUnLock_m( &r->m );
+    if(n > 0)
+      return 1;
+
+    /* steal the back half of the largest range */
+    for(j = 0; j < l->ranges_n; ++j)
+    {
+      oyLoopRange_s * v = &l->ranges[j];
+      if(j == i) continue;
+      oyMutexLock_m( &v->m );
+      n = v->end - v->begin;
+      oyMutexUnLock_m( &v->m );
+      if(n > most)
+      {
+        most = n;
+        victim = j;
+      }
+    }
+    if(victim < 0)
+      return 0;
+
+    {
+      oyLoopRange_s * v = &l->ranges[victim];
+      int b, e;
+      oyMutexLock_m( &v->m );
+      n = v->end - v->begin;
+      e = v->end;
+      b = n >= 2 * l->grain ? e - n / 2 : v->begin;
+      v->end = b;
+      oyMutexUnLock_m( &v->m );
+      if(e > b)
+      {
+        oyMutexLock_m( &r->m );
+        r->begin = b;
+        r->end = e;
+        oyMutexUnLock_m( &r->m );
+      }
+    }
+  }
+}
+
+/* work on loop l with range i until no iterations are left to take */
+static void  oyLoop_Run_             ( oyLoop_s          * l,
+                                       int                 i )
+{
+  int begin, end;
+
+  while(oyLoop_Next_( l, i, &begin, &end ))
+  {
+    l->body( begin, end, l->data );
+    if(oyAtomicAdd_m_( &l->left, begin - end ) == 0)
+    {
+      oyMutexLock_m( &l->m );
+      oyCondBroadcast_m( &l->m );
+      oyMutexUnLock_m( &l->m );
+    }
+  }
+}
+
+/* a thread running oyJobWorker() */
+typedef struct {
+  oyThread_t   thread;
+  int          id;
+  int          stop;                   /* leave after the current job */
+  int          persistent;             /* runs a oyJOB_ADD_PERSISTENT_JOB */
+  int          done;                   /* oyJobWorker() returned */
+} oyWorker_s;
+
+/* pending and running jobs */
+typedef struct {
+  oyJobArray_s ready;                  /* binary heap */
+  oyJobArray_s blocked;                /* waiting for dependencies */
+  oyJobArray_s running;
+  oyJobGroup_s * groups;
+  int          groups_n;
+  int          groups_size;
+  oyWorker_s ** workers;
+  int          workers_n;
+  int          workers_size;
+  int          pool_started;
+  char       * cpus;                   /* affinity of workers; NULL for all */
+  oyLoop_s  ** loops;                  /* loops with free ranges */
+  int          loops_n;
+  int          loops_size;
+  oyMutex_t    m;                      /* signals new ready jobs and loops */
+} oyJobSchedule_s;
+
+static oyJobSchedule_s * oyJobSchedule_New_( void )
+{
+  oyJobSchedule_s * s = (oyJobSchedule_s*) calloc( sizeof(oyJobSchedule_s), 1 );
+  if(!s) return NULL;
+  oyMutexInit_m( &s->m, NULL );
+  return s;
+}
+
+/* is the job still pending or running; call locked */
+static int   oyJobSchedule_Has_      ( oyJobSchedule_s   * s,
+                                       int                 job_id )
+{
+  oyJobArray_s * lists[3] = { &s->ready, &s->blocked, &s->running };
+  int i, j;
+  for(j = 0; j < 3; ++j)
+    for(i = 0; i < lists[j]->n; ++i)
+      if(lists[j]->jobs[i]->id_ == job_id)
+        return 1;
+  return 0;
+}
+
+/* change the count of not yet finish()ed jobs in group; call locked */
+static int   oyJobSchedule_GroupAdd_ ( oyJobSchedule_s   * s,
+                                       int                 group,
+                                       int                 n )
+{
+  int i;
+  for(i = 0; i < s->groups_n; ++i)
+    if(s->groups[i].group == group)
+      break;
+  if(i == s->groups_n)
+  {
+    if(n <= 0)
+      return 0;
+    if(s->groups_n == s->groups_size)
+    {
+      int size = s->groups_size ? s->groups_size * 2 : 8;
+      oyJobGroup_s * groups = (oyJobGroup_s*) realloc( s->groups,
+                                                 sizeof(oyJobGroup_s) * size );
+      if(!groups) return 0;
+      s->groups = groups;
+      s->groups_size = size;
+    }
+    s->groups[i].group = group;
+    s->groups[i].n = 0;
+    ++s->groups_n;
+  }
+  s->groups[i].n += n;
+  n = s->groups[i].n;
+  if(n <= 0)
+    s->groups[i] = s->groups[--s->groups_n];
+  return n;
+}
+
+/* queue a new job; it waits in blocked as long as depends_ are pending */
+static int   oyJobSchedule_Add_      ( oyJobSchedule_s   * s,
+                                       oyJob_s           * job )
+{
+  int error, i;
+
+  oyMutexLock_m( &s->m );
+  /* keep only the pending dependencies */
+  for(i = 0; i < job->depends_n_; )
+    if(oyJobSchedule_Has_( s, job->depends_[i] ))
+      ++i;
+    else
+      job->depends_[i] = job->depends_[--job->depends_n_];
+
+  if(job->depends_n_)
+    error = oyJobArray_Add_( &s->blocked, job );
+  else
+  {
+    error = oyJobHeap_Push_( &s->ready, job );
+    if(!error)
+      oyCondSignal_m( &s->m );
+  }
+  if(!error && job->group)
+    oyJobSchedule_GroupAdd_( s, job->group, 1 );
+  oyMutexUnLock_m( &s->m );
+
+  return error;
+}
+
+/* remove loop l from the loops to help with; call locked */
+static void  oyJobSchedule_LoopDone_ ( oyJobSchedule_s   * s,
+                                       oyLoop_s          * l )
+{
+  int i;
+  for(i = 0; i < s->loops_n; ++i)
+    if(s->loops[i] == l)
+    {
+      s->loops[i] = s->loops[--s->loops_n];
+      break;
+    }
+}
+
+/* take the next ready job; sleeps until one is available or until the
+ * worker w is stopped; the worker helps with parallel loops meanwhile */
+static oyJob_s * oyJobSchedule_Take_ ( oyJobSchedule_s   * s,
+                                       oyWorker_s        * w )
+{
+  oyJob_s * job = NULL;
+
+  oyMutexLock_m( &s->m );
+  while(s->ready.n == 0 && !(w && w->stop))
+  {
+    if(w && s->loops_n)
+    {
+      oyLoop_s * l = s->loops[s->loops_n - 1];
+      int i = l->joined++;
+      if(l->joined == l->ranges_n)
+        oyJobSchedule_LoopDone_( s, l );
+      oyAtomicAdd_m_( &l->ref, 1 );
+      oyMutexUnLock_m( &s->m );
+      oyLoop_Run_( l, i );
+      oyLoop_Release_( &l );
+      oyMutexLock_m( &s->m );
+    } else
+      oyCondWait_m( &s->m, -1 );
+  }
+  if(!(w && w->stop))
+  {
+    job = oyJobHeap_TakeAt_( &s->ready, 0 );
+    if(oyJobArray_Add_( &s->running, job ))
+      WARNc1_S("job[%d] not tracked", job->id_);
+    /* keep the worker out of pool resizing */
+    if(w && job->flags_ & oyJOB_ADD_PERSISTENT_JOB)
+      w->persistent = 1;
+  }
+  oyMutexUnLock_m( &s->m );
+
+  return job;
+}
+
+/* the work of job is done; release the jobs depending on it */
+static void  oyJobSchedule_Done_     ( oyJobSchedule_s   * s,
+                                       oyJob_s           * job )
+{
+  int i, j, ready = 0,
+      cancelled = oyJob_IsCancelled( job );
+
+  oyMutexLock_m( &s->m );
+  for(i = 0; i < s->running.n; ++i)
+    if(s->running.jobs[i] == job)
+    {
+      oyJobArray_TakeAt_( &s->running, i );
+      break;
+    }
+
+  for(i = 0; i < s->blocked.n; )
+  {
+    oyJob_s * b = s->blocked.jobs[i];
+    for(j = 0; j < b->depends_n_; ++j)
+      if(b->depends_[j] == job->id_)
+      {
+        b->depends_[j] = b->depends_[--b->depends_n_];
+        /* a cancelled job cancels its dependents */
+        if(cancelled && !oyJob_IsCancelled( b ))
+          oyAtomicAdd_m_( &b->status_cancel_, 1 );
+        break;
+      }
+    if(b->depends_n_ == 0 && !oyJobHeap_Push_( &s->ready, b ))
+    {
+      oyJobArray_TakeAt_( &s->blocked, i );
+      ++ready;
+    } else
+      ++i;
+  }
+  if(ready)
+    oyCondBroadcast_m( &s->m );
+  oyMutexUnLock_m( &s->m );
+}
+
+/* pending jobs, taken by the oyJobWorker() threads */
+static oyJobSchedule_s * oy_job_schedule_ = NULL;
+/* finished jobs, taken by oyJobResult() in the managing thread */
+static oyJobQueue_s * oy_job_finished_ = NULL;
+oyStructList_s * oy_job_message_list_ = NULL;
+
+#if defined(__linux__)
+static cpu_set_t oy_process_cpus_;
+/* parse a CPU list like "0-7,16" */
+static int oyCPUSetFromList_         ( const char        * list,
+                                       cpu_set_t         * set )
+{
+  CPU_ZERO( set );
+  while(*list)
+  {
+    char * end;
+    long first = strtol( list, &end, 10 ), last;
+    if(end == list || first < 0)
+      return 1;
+    last = first;
+    if(*end == '-')
+    {
+      list = end + 1;
+      last = strtol( list, &end, 10 );
+      if(end == list || last < first)
+        return 1;
+    }
+    for( ; first <= last && first < CPU_SETSIZE; ++first)
+      CPU_SET( first, set );
+    list = end;
+    if(*list == ',')
+      ++list;
+    else if(*list)
+      return 1;
+  }
+  return CPU_COUNT( set ) == 0;
+}
+
+/* CPUs of a cgroup v2 or v1 CPU quota; 0 without quota */
+static int oyCgroupCPUs_             ( void )
+{
+  long long quota = -1, period = 0;
+  FILE * fp = fopen( "/sys/fs/cgroup/cpu.max", "r" );
+  if(fp)
+  {
+    char q[32];
+    if(fscanf( fp, "%31s %lld", q, &period ) == 2 && strcmp( q, "max" ) != 0)
+      quota = atoll( q );
+    fclose( fp );
+  } else if((fp = fopen( "/sys/fs/cgroup/cpu/cpu.cfs_quota_us", "r" )) != NULL)
+  {
+    if(fscanf( fp, "%lld", &quota ) != 1)
+      quota = -1;
+    fclose( fp );
+    if((fp = fopen( "/sys/fs/cgroup/cpu/cpu.cfs_period_us", "r" )) != NULL)
+    {
+      if(fscanf( fp, "%lld", &period ) != 1)
+        period = 0;
+      fclose( fp );
+    }
+  }
+  if(quota > 0 && period > 0)
+    return (int)((quota + period - 1) / period);
+  return 0;
+}
+#endif
+
+/* check a CPU list; non zero for invalid or unsupported */
+static int oyCPUListCheck_           ( const char        * list )
+{
+#if defined(__linux__)
+  cpu_set_t set;
+  return oyCPUSetFromList_( list, &set );
+#else
+  return list && list[0];
+#endif
+}
+
+/* pin a worker to the CPU list or to all CPUs of the process for NULL */
+static int oyWorkerPin_              ( oyWorker_s        * w,
+                                       const char        * list )
+{
+#if defined(__linux__)
+  cpu_set_t set = oy_process_cpus_;
+  if(list && oyCPUSetFromList_( list, &set ))
+    return 1;
+  return pthread_setaffinity_np( w->thread, sizeof(set), &set );
+#else
+  return list != NULL;
+#endif
+}
+
+/* CPUs available to the process; 0 if unknown */
+static int oyCPUsAvailable_          ( const char        * list )
+{
+  int n = 0;
+#if defined(__linux__)
+  cpu_set_t set = oy_process_cpus_;
+  int quota = oyCgroupCPUs_();
+  if(list)
+    oyCPUSetFromList_( list, &set );
+  n = CPU_COUNT( &set );
+  if(quota > 0 && quota < n)
+    n = quota;
+#elif defined(_OPENMP) && defined(USE_OPENMP)
+  n = omp_get_num_procs();
+#endif
+  return n;
+}
+
+/* ::OY_THREADS or one less than the available CPUs */
+static int oyJobPool_Count_          ( oyJobSchedule_s   * s )
+{
+  const char * v = getenv( OY_THREADS );
+  int n = v ? atoi( v ) : 0;
+  if(n > 0)
+    return n;
+
+  n = oyCPUsAvailable_( s->cpus ) - 1;
+  return n >= 1 ? n : 2;
+}
+
+/* start a new worker; call locked */
+static int oyJobPool_AddWorker_      ( oyJobSchedule_s   * s )
+{
+  oyWorker_s * w;
+  oyBlob_s * blob;
+  int error;
+
+  if(s->workers_n == s->workers_size)
+  {
+    int size = s->workers_size ? s->workers_size * 2 : 16;
+    oyWorker_s ** workers = (oyWorker_s**) realloc( s->workers,
+                                                   sizeof(oyWorker_s*) * size );
+    if(!workers) return 1;
+    s->workers = workers;
+    s->workers_size = size;
+  }
+  w = (oyWorker_s*) calloc( sizeof(oyWorker_s), 1 );
+  if(!w) return 1;
 
-  blob = oyBlob_New(0);
-  oyBlob_SetFromStatic( blob, (oyPointer)background_thread, 0, "oyThread_t" );
   oyObject_Lock( oy_threads_->oy_, __FILE__, __LINE__ );
+  w->id = oyStructList_Count( oy_threads_ );
+  error = oyThreadCreate( oyJobWorker, w, &w->thread );
+  if(error)
+  {
+    oyObject_UnLock( oy_threads_->oy_, __FILE__, __LINE__ );
+    WARNc1_S("error=%d", error);
+    free( w );
+    return 1;
+  }
+  blob = oyBlob_New(0);
+  oyBlob_SetFromStatic( blob, (oyPointer)w->thread, 0, "oyThread_t" );
   error = oyStructList_MoveIn( oy_threads_, (oyStruct_s**) &blob, -1, 0 );
   oyObject_UnLock( oy_threads_->oy_, __FILE__, __LINE__ );
   if(error)
     WARNc1_S("error=%d", error);
+
+  if(s->cpus && oyWorkerPin_( w, s->cpus ))
+    trds_msg( oyMSG_WARN, 0, "can not pin thread[%d] to CPUs %s", w->id, s->cpus );
+  s->workers[s->workers_n++] = w;
+  if(oy_debug)
+    trds_msg( oyMSG_DBG, 0, "thread created [%ld]\n", w->thread);
+
+  return 0;
 }
 
-//oyStructList_s * oy_thread_cache_ = NULL;
-oyStructList_s * oy_job_list_ = NULL;
-oyStructList_s * oy_job_message_list_ = NULL;
-void oyThreadsInit_( int flags )
+/* wait for a stopped worker to return */
+static void oyWorkerJoin_            ( oyWorker_s        * w )
 {
-  int i, count, error;
+#if defined(_WIN32) && !defined(__GNU__)
+  while(!oyAtomicGet_m_( &w->done ))
+    Sleep( 1 );
+#else
+  pthread_join( w->thread, NULL );
+#endif
+}
+
+/* change the number of workers; stopped workers are joined after their
+ * current job; return the new count */
+static int oyJobPool_Resize_         ( oyJobSchedule_s   * s,
+                                       int                 count )
+{
+  oyWorker_s ** stopped = NULL;
+  int i, n = 0, stopped_n = 0;
+
+  oyMutexLock_m( &s->m );
+  for(i = 0; i < s->workers_n; ++i)
+    if(!s->workers[i]->persistent)
+      ++n;
+  while(n < count && !oyJobPool_AddWorker_( s ))
+    ++n;
+  if(n > count)
+    stopped = (oyWorker_s**) calloc( sizeof(oyWorker_s*), n - count );
+  for(i = s->workers_n - 1; i >= 0 && n > count && stopped; --i)
+    if(!s->workers[i]->persistent)
+    {
+      oyWorker_s * w = s->workers[i];
+      w->stop = 1;
+      stopped[stopped_n++] = w;
+      s->workers[i] = s->workers[--s->workers_n];
+      --n;
+    }
+  if(stopped_n)
+    oyCondBroadcast_m( &s->m );
+  s->pool_started = count > 0;
+  oyMutexUnLock_m( &s->m );
+
+  for(i = 0; i < stopped_n; ++i)
+  {
+    oyWorkerJoin_( stopped[i] );
+    free( stopped[i] );
+  }
+  free( stopped );
+
+  return n;
+}
+
+/* start the workers with the first job */
+static void oyJobPool_Start_         ( oyJobSchedule_s   * s )
+{
+  int count;
+
+  oyMutexLock_m( &s->m );
+  count = s->pool_started ? 0 : oyJobPool_Count_( s );
+  oyMutexUnLock_m( &s->m );
+
+  if(count)
+    oyJobPool_Resize_( s, count );
+}
+
+/* a worker with a persistent job leaves the pool on its own */
+static void oyJobPool_Leave_         ( oyJobSchedule_s   * s,
+                                       oyWorker_s        * w )
+{
+  int i;
+
+  oyMutexLock_m( &s->m );
+  for(i = 0; i < s->workers_n; ++i)
+    if(s->workers[i] == w)
+    {
+      s->workers[i] = s->workers[--s->workers_n];
+      break;
+    }
+  oyMutexUnLock_m( &s->m );
+
+#if !defined(_WIN32) || defined(__GNU__)
+  pthread_detach( w->thread );
+#endif
+  free( w );
+}
+
+void oyThreadsInit_( void )
+{
+  int error;
 
   /* initialise threadsafe job and message queues */
-  if(!oy_job_list_)
+  if(!oy_job_schedule_)
   {
+    const char * cpus = getenv( OY_THREADS_AFFINITY );
     oyBlob_s * blob;
     /* check threading */
     if(!oyThreadLockingReady())
@@ -268,23 +1051,24 @@ void oyThreadsInit_( int flags )
       oyThreadLockingSet( oyStruct_LockCreate_, oyLockRelease_,
                           oyLock_, oyUnLock_ );
 
-    oy_job_list_ = oyStructList_Create( oyOBJECT_NONE, "oy_job_list_", NULL );
+#if defined(__linux__)
+    if(sched_getaffinity( 0, sizeof(oy_process_cpus_), &oy_process_cpus_ ))
+    {
+      int i;
+      CPU_ZERO( &oy_process_cpus_ );
+      for(i = 0; i < CPU_SETSIZE; ++i)
+        CPU_SET( i, &oy_process_cpus_ );
+    }
+#endif
+
+    oy_job_finished_ = oyJobQueue_New_();
     oy_job_message_list_ = oyStructList_Create( oyOBJECT_NONE,
                                                 "oy_job_message_list_", NULL );
 
     /* setup mutexes */
-    oyObject_Lock( oy_job_list_->oy_, __func__, __LINE__ );
-    oyObject_UnLock( oy_job_list_->oy_, __func__, __LINE__ );
     oyObject_Lock( oy_job_message_list_->oy_, __func__, __LINE__ );
     oyObject_UnLock( oy_job_message_list_->oy_, __func__, __LINE__ );
 
-#if defined(_OPENMP) && defined(USE_OPENMP)
-    if((omp_get_num_procs() - 1) >= 1)
-      count = omp_get_num_procs() - 1;
-    else
-#endif
-      count = 2;
-
     oy_threads_ = oyStructList_Create( oyOBJECT_NONE, "oy_threads_", NULL );
 
     blob = oyBlob_New(0);
@@ -295,45 +1079,41 @@ void oyThreadsInit_( int flags )
     if(error)
        WARNc1_S("error=%d", error);
 
-    for(i = 0; i < count; ++i)
+    oy_job_schedule_ = oyJobSchedule_New_();
+    if(cpus && cpus[0])
     {
-      oyThread_t background_thread;
-      int error;
-      oyOption_s * o = oyOption_FromRegistration( "///id", NULL );
-      oyOption_SetFromInt( o, i+1, 0, 0 );
-
-      oyThreadCreate( oyJobWorker, (oyPointer)o, &background_thread );
-      if(oy_debug)
-        trds_msg( oyMSG_DBG, 0, "thread created [%ld]\n", background_thread);
-
-      blob = oyBlob_New(0);
-      oyBlob_SetFromStatic( blob, (oyPointer)background_thread, 0, "oyThread_t" );
-      oyObject_Lock( oy_threads_->oy_, __FILE__, __LINE__ );
-      error = oyStructList_MoveIn( oy_threads_, (oyStruct_s**) &blob, -1, 0 );
-      oyObject_UnLock( oy_threads_->oy_, __FILE__, __LINE__ );
-      if(error)
-         WARNc1_S("error=%d", error);
+      if(oyCPUListCheck_( cpus ))
+        trds_msg( oyMSG_WARN, 0, "ignoring %s=%s", OY_THREADS_AFFINITY, cpus );
+      else
+        oy_job_schedule_->cpus = strdup( cpus );
     }
   }
+}
 
-  if(flags & oyJOB_ADD_PERSISTENT_JOB)
-  {
-    oyThreadAdd();
-  }
+/* forward declaration from src/API_generated/oyStruct_s.c */
+void oyThreadAdd()
+{
+  oyThreadsInit_();
+  oyMutexLock_m( &oy_job_schedule_->m );
+  oyJobPool_AddWorker_( oy_job_schedule_ );
+  oyMutexUnLock_m( &oy_job_schedule_->m );
 }
 
 /**
  *  @brief   Add and run a job
  *
+ *  Pending jobs are started by oyJob_s::priority and then in FIFO order,
+ *  as soon as their oyJob_s::depends_ are done. Finished jobs go into a
+ *  FIFO queue. Adding a job wakes up one thread sleeping on the queue.
+ *
  *  @version Oyranos: 0.9.7
- *  @date    2017/09/22
+ *  @date    2026/10/18
  *  @since   2014/01/27 (Oyranos: 0.9.5)
  */
 int                oyJob_Add_        ( oyJob_s          ** job_,
                                        int                 finished,
                                        int                 flags )
 {
-  oyBlob_s * blob;
   static int job_count = 0;
   int job_id = 0;
   int error = 0;
@@ -341,7 +1121,14 @@ int                oyJob_Add_        ( oyJob_s          ** job_,
 
   *job_ = NULL;
 
-  oyThreadsInit_( flags );
+  oyThreadsInit_();
+  if(!finished)
+  {
+    oyJobPool_Start_( oy_job_schedule_ );
+    /* a extra thread, as the job might never return */
+    if(flags & oyJOB_ADD_PERSISTENT_JOB)
+      oyThreadAdd();
+  }
 
   /* set status */
   if(finished)
@@ -355,75 +1142,38 @@ int                oyJob_Add_        ( oyJob_s          ** job_,
 
   job_id = job->id_;
 
-  /* setup container */
-  blob = oyBlob_New(NULL);
-  oyBlob_SetFromStatic( blob, job, 0, "oyJob_s" );
-
-  /* add container to queue threadsafe */
-  error = oyStructList_MoveIn( oy_job_list_, (oyStruct_s**) &blob, -1, 0 );
-  if(error)
-    WARNc2_S("error=%d %d", error, finished);
-
-#if defined(_WIN32) && !defined(__GNU__)
-#else
-  if(finished == 0)
+  /* add to queue threadsafe */
+  if(finished)
   {
-    oyMutex_t * m = (oyMutex_t*) oy_job_list_->oy_->lock_;
-    oyObject_Lock( oy_job_list_->oy_, __func__, __LINE__ );
-    pthread_cond_signal( &m->cond );
-    oyObject_UnLock( oy_job_list_->oy_, __func__, __LINE__ );
+    oyJobSchedule_Done_( oy_job_schedule_, job );
+    error = oyJobQueue_Push_( oy_job_finished_, job );
   }
-#endif
+  else
+    error = oyJobSchedule_Add_( oy_job_schedule_, job );
+  if(error)
+    WARNc2_S("error=%d %d", error, finished);
 
   return job_id;
 }
+/**
+ *  @brief   Get a job
+ *
+ *  A pending job is waited for, a finished job is not.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2014/01/27 (Oyranos: 0.9.5)
+ */
 int                oyJob_Get_        ( oyJob_s          ** job,
                                        int                 finished )
 {
-  /* FIFO */
   *job = 0;
-  if(!oy_job_list_) return -1;
-
-  /* queue manipulation needs mutex */
-  if(oy_debug >= 2)
-  {
-    char * t = NULL;
-    oyStringAddPrintf_(&t, oyAllocateFunc_, oyDeAllocateFunc_, "%s() finished:%d", __func__, finished);
-    oyObject_Lock( oy_job_list_->oy_, t, __LINE__ );
-    oyFree_m_(t);
-  } else
-    oyObject_Lock( oy_job_list_->oy_, __func__, __LINE__ );
+  if(!oy_job_schedule_) return -1;
 
-  int n = oyStructList_Count( oy_job_list_ );
-  if(n)
-  {
-    oyBlob_s * blob = (oyBlob_s*) oyStructList_GetRefType( oy_job_list_, n-1, oyOBJECT_BLOB_S );
-    oyJob_s * j = (oyJob_s*) oyBlob_GetPointer( blob );
-    if((j->status_done_ > 0 && finished > 0) ||
-       (j->status_done_ == 0 && finished == 0))
-    {
-      oyStructList_ReleaseAt( oy_job_list_, n-1 );
-      *job = j;
-    }
-    oyBlob_Release( &blob );
-  }
-#if defined(_WIN32) && !defined(__GNU__)
-#else
-  else if(finished == 0)
-  {
-    oyMutex_t * m = (oyMutex_t*) oy_job_list_->oy_->lock_;
-    pthread_cond_wait( &m->cond, &m->mutex );
-  }
-#endif
-
-  if(oy_debug >= 2)
-  {
-    char * t = NULL;
-    oyStringAddPrintf_(&t, oyAllocateFunc_, oyDeAllocateFunc_, "%s() finished:%d", __func__, finished);
-    oyObject_UnLock( oy_job_list_->oy_, t, __LINE__ );
-    oyFree_m_(t);
-  } else
-    oyObject_UnLock( oy_job_list_->oy_, __func__, __LINE__ );
+  if(finished)
+    *job = oyJobQueue_Pop_( oy_job_finished_, 0 );
+  else
+    *job = oyJobSchedule_Take_( oy_job_schedule_, NULL );
 
   return 0;
 }
@@ -462,7 +1212,12 @@ int                oyMsg_Add_        ( oyJob_s           * job,
   if(error)
     WARNc2_S("error=%d %g", error, progress_zero_till_one);
 
-  return 0;
+  /* let oyJobResultWait_() deliver the message */
+  if(oy_job_finished_)
+    oyJobQueue_Wake_( oy_job_finished_ );
+
+  /* tell the work function to stop */
+  return oyJob_IsCancelled( job );
 }
 int                oyMsg_Get         ( oyMsg_s          ** msg )
 {
@@ -490,45 +1245,73 @@ void               oySleep           ( double              seconds )
 
 void *             oyJobWorker       ( void              * data )
 {
-  oyOption_s * o = (oyOption_s*)data;
-  int thread_id = oyOption_GetValueInt(o,0);
-  oyOption_Release( &o );
+  oyWorker_s * w = (oyWorker_s*)data;
+  int thread_id = w->id;
 
   while(1)
   {
     int flags = 0;
-    oyJob_s * job = NULL;
-    oyJob_Get_( &job, 0 );
-    if(job)
+    /* sleeps until a job arrives or the worker is stopped */
+    oyJob_s * job = oyJobSchedule_Take_( oy_job_schedule_, w );
+    if(!job)
+      break;
+    else
     {
       int finished = 1;
       char * t;
       job->thread_id_ = thread_id;
-      if(job->cb_progress)
-      {
-        t = strdup("start");
-        oyMsg_Add_(job, 0.0, &t);
-      }
-      job->status_work_return = job->work(job);
-      if(job->cb_progress)
+      if(oyJob_IsCancelled( job ))
+        job->status_work_return = -1;
+      else
       {
-        t = strdup("done");
-        oyMsg_Add_(job, 1.0, &t);
+        if(job->cb_progress)
+        {
+          t = strdup("start");
+          oyMsg_Add_(job, 0.0, &t);
+        }
+        job->status_work_return = job->work(job);
+        if(job->cb_progress)
+        {
+          t = strdup("done");
+          oyMsg_Add_(job, 1.0, &t);
+        }
       }
       flags = job->flags_;
       oyJob_Add_( &job, finished, 0 );
     }
-    oySleep(0.02);
 
     if(flags & oyJOB_ADD_PERSISTENT_JOB)
-      break;
+    {
+      oyJobPool_Leave_( oy_job_schedule_, w );
+      return NULL;
+    }
   }
+  /* let oyWorkerJoin_() return */
+  oyAtomicAdd_m_( &w->done, 1 );
   return NULL;
 }
-void               oyJobResult_      ( void )
+/* call finish() in the managing thread and count down the group */
+static void        oyJobFinish_      ( oyJob_s          ** job )
+{
+  int group = (*job)->group;
+
+  if((*job)->finish)
+    (*job)->finish(*job);
+  oyJob_Release( job );
+
+  if(group)
+  {
+    oyMutexLock_m( &oy_job_schedule_->m );
+    oyJobSchedule_GroupAdd_( oy_job_schedule_, group, -1 );
+    oyMutexUnLock_m( &oy_job_schedule_->m );
+  }
+}
+/* deliver all messages and finished jobs; return their count */
+static int         oyJobResultRun_   ( void )
 { 
   oyMsg_s * msg = NULL;
   oyJob_s * job = NULL;
+  int n = 0;
   while(!oyMsg_Get( &msg ) && msg != NULL)
   {
     if(msg->cb_progress)
@@ -541,15 +1324,260 @@ void               oyJobResult_      ( void )
     if(msg->status_text)
     { free(msg->status_text); msg->status_text = NULL; }
     free(msg); msg = NULL;
+    ++n;
+  }
+
+  while(!oyJob_Get_( &job, 1 ) && job != NULL)
+  {
+    oyJobFinish_( &job );
+    ++n;
+  }
+
+  return n;
+}
+void               oyJobResult_      ( void )
+{
+  oyJobResultRun_();
+}
+/* sleep on the finished queue; oyJob_Add_() and oyMsg_Add_() wake it up */
+int                oyJobResultWait_  ( double              seconds )
+{
+  int n = oyJobResultRun_();
+  if(n || !oy_job_finished_ || seconds == 0.0)
+    return n;
+
+  {
+    int msec = seconds < 0.0 ? -1 : (int)(seconds * 1000.0 + 0.5);
+    oyJob_s * job = oyJobQueue_Pop_( oy_job_finished_, msec ? msec : 1 );
+    if(job)
+    {
+      oyJobFinish_( &job );
+      ++n;
+    }
+  }
+
+  return n + oyJobResultRun_();
+}
+/* take not yet started jobs out and flag the running ones; all jobs for
+ * job_id < 0 and group == 0 */
+static int         oyJobCancel_      ( int                 job_id,
+                                       int                 group )
+{
+  oyJobSchedule_s * s = oy_job_schedule_;
+  oyJobArray_s taken = { NULL, 0, 0 };
+  int i, n = 0;
+
+  if(!s || (job_id == 0 && !group))
+    return 0;
+
+#define oyJobMatch_m(j) ((job_id > 0 && (j)->id_ == job_id) || \
+                         (job_id <= 0 && (group ? (j)->group == group : 1)))
+  oyMutexLock_m( &s->m );
+  for(i = s->ready.n - 1; i >= 0; --i)
+    if(oyJobMatch_m( s->ready.jobs[i] ) &&
+       !oyJobArray_Add_( &taken, s->ready.jobs[i] ))
+      oyJobHeap_TakeAt_( &s->ready, i );
+  for(i = s->blocked.n - 1; i >= 0; --i)
+    if(oyJobMatch_m( s->blocked.jobs[i] ) &&
+       !oyJobArray_Add_( &taken, s->blocked.jobs[i] ))
+      oyJobArray_TakeAt_( &s->blocked, i );
+  for(i = 0; i < s->running.n; ++i)
+    if(oyJobMatch_m( s->running.jobs[i] ) &&
+       !oyJob_IsCancelled( s->running.jobs[i] ))
+    {
+      oyAtomicAdd_m_( &s->running.jobs[i]->status_cancel_, 1 );
+      ++n;
+    }
+  oyMutexUnLock_m( &s->m );
+#undef oyJobMatch_m
+
+  /* hand the never started jobs over to oyJobResult() */
+  for(i = 0; i < taken.n; ++i)
+  {
+    oyJob_s * job = taken.jobs[i];
+    oyAtomicAdd_m_( &job->status_cancel_, 1 );
+    job->status_work_return = -1;
+    oyJob_Add_( &job, 1, 0 );
+    ++n;
+  }
+  free( taken.jobs );
+
+  return n;
+}
+int                oyJob_Cancel_     ( int                 job_id,
+                                       int                 group )
+{
+  if(job_id <= 0 && !group)
+    return 0;
+  return oyJobCancel_( job_id, group );
+}
+/* handle results until all jobs of group passed finish() */
+int                oyJobGroupWait_   ( int                 group,
+                                       double              seconds )
+{
+  double start = oySeconds();
+  int n;
+
+  if(!group || !oy_job_schedule_)
+    return -1;
+
+  while(1)
+  {
+    double left = -1.0;
+
+    oyMutexLock_m( &oy_job_schedule_->m );
+    n = oyJobSchedule_GroupAdd_( oy_job_schedule_, group, 0 );
+    oyMutexUnLock_m( &oy_job_schedule_->m );
+    if(n <= 0)
+      break;
+
+    if(seconds >= 0.0)
+    {
+      left = seconds - (oySeconds() - start);
+      if(left <= 0.0)
+        break;
+    }
+    oyJobResultWait_( left );
+  }
+
+  return n;
+}
+/* split the loop among the caller and idle workers */
+int                oyParallelFor_    ( int                 n,
+                                       oyParallelBody_f    body,
+                                       void              * data,
+                                       int                 grain )
+{
+  oyJobSchedule_s * s;
+  oyLoop_s * l;
+  int i, threads = 0;
+
+  if(n <= 0 || !body)
+    return 0;
+  if(grain < 1)
+    grain = 1;
+
+  oyThreadsInit_();
+  s = oy_job_schedule_;
+  oyJobPool_Start_( s );
+
+  oyMutexLock_m( &s->m );
+  for(i = 0; i < s->workers_n; ++i)
+    if(!s->workers[i]->persistent)
+      ++threads;
+  oyMutexUnLock_m( &s->m );
+  threads = OY_MIN( threads + 1, (n + grain - 1) / grain );
+  if(threads <= 1)
+  {
+    body( 0, n, data );
+    return 1;
+  }
+
+  l = (oyLoop_s*) calloc( sizeof(oyLoop_s), 1 );
+  if(l)
+    l->ranges = (oyLoopRange_s*) calloc( sizeof(oyLoopRange_s), threads );
+  if(!l || !l->ranges)
+  {
+    if(l) free( l );
+    body( 0, n, data );
+    return 1;
+  }
+  l->body = body;
+  l->data = data;
+  l->grain = grain;
+  l->ranges_n = threads;
+  for(i = 0; i < threads; ++i)
+    oyMutexInit_m( &l->ranges[i].m, NULL );
+  oyMutexInit_m( &l->m, NULL );
+  /* all iterations start in the callers range */
+  l->ranges[0].end = n;
+  l->joined = 1;
+  l->left = n;
+  l->ref = 1;
+
+  oyMutexLock_m( &s->m );
+  if(s->loops_n == s->loops_size)
+  {
+    int size = s->loops_size ? s->loops_size * 2 : 8;
+    oyLoop_s ** loops = (oyLoop_s**) realloc( s->loops, sizeof(oyLoop_s*) * size );
+    if(loops)
+    {
+      s->loops = loops;
+      s->loops_size = size;
+    }
+  }
+  if(s->loops_n < s->loops_size)
+  {
+    s->loops[s->loops_n++] = l;
+    oyCondBroadcast_m( &s->m );
+  }
+  oyMutexUnLock_m( &s->m );
+
+  oyLoop_Run_( l, 0 );
+
+  /* wait for iterations taken by helpers */
+  oyMutexLock_m( &l->m );
+  while(oyAtomicGet_m_( &l->left ) > 0)
+    oyCondWait_m( &l->m, -1 );
+  oyMutexUnLock_m( &l->m );
+
+  oyMutexLock_m( &s->m );
+  oyJobSchedule_LoopDone_( s, l );
+  threads = l->joined;
+  oyMutexUnLock_m( &s->m );
+  oyLoop_Release_( &l );
+
+  return threads;
+}
+/* cancel everything, join the workers and finish() the remaining jobs */
+static int         oyJobPool_Shutdown_(oyJobSchedule_s   * s )
+{
+  oyJobCancel_( -1, 0 );
+  oyJobPool_Resize_( s, 0 );
+  oyJobResultRun_();
+  return 0;
+}
+int                oyJobPool_        ( int                 workers,
+                                       const char        * cpus,
+                                       int                 flags )
+{
+  oyJobSchedule_s * s;
+  int i, n = 0;
+
+  oyThreadsInit_();
+  s = oy_job_schedule_;
+
+  if(flags & oyJOB_POOL_SHUTDOWN)
+    return oyJobPool_Shutdown_( s );
+
+  if(cpus && cpus[0] && oyCPUListCheck_( cpus ))
+  {
+    trds_msg( oyMSG_WARN, 0, "can not pin threads to CPUs %s", cpus );
+    return -1;
   }
 
-  oyJob_Get_( &job, 1 );
-  if(job)
+  oyMutexLock_m( &s->m );
+  if(cpus)
   {
-    if(job->finish)
-      job->finish(job);
-    oyJob_Release( &job );
+    if(s->cpus) free( s->cpus );
+    s->cpus = cpus[0] ? strdup( cpus ) : NULL;
+    for(i = 0; i < s->workers_n; ++i)
+      if(oyWorkerPin_( s->workers[i], s->cpus ))
+        trds_msg( oyMSG_WARN, 0, "can not pin thread[%d] to CPUs %s",
+                  s->workers[i]->id, s->cpus );
   }
+  if(workers == 0)
+    workers = oyJobPool_Count_( s );
+  if(workers < 0)
+    for(i = 0; i < s->workers_n; ++i)
+      if(!s->workers[i]->persistent)
+        ++n;
+  oyMutexUnLock_m( &s->m );
+
+  if(workers > 0)
+    n = oyJobPool_Resize_( s, workers );
+
+  return n;
 }
 
 #ifdef __cplusplus
@@ -611,6 +1639,10 @@ int          trdsMOptions_Handle     ( oyOptions_s       * options OY_UNUSED,
                       oyMsg_Add_,
                       oyJobResult_,
                       CMM_NICK );
+    oyJobResultWaitSet( oyJobResultWait_ );
+    oyJobSchedulingSet( oyJob_Cancel_, oyJobGroupWait_ );
+    oyJobPoolSet( oyJobPool_ );
+    oyParallelForSet( oyParallelFor_ );
     trds_msg( oyMSG_DBG, 0, "called %s()::threads_handler", __func__ );
   }
 
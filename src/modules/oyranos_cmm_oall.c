@@ -24,6 +24,7 @@
 #include "oyranos_debug.h"
 #include "oyranos_config_internal.h"
 
+extern oyCMM_s clut_cmm_module;
 extern oyCMM_s CUPS_cmm_module;
 extern oyCMM_s elDB_cmm_module;
 extern oyCMM_s lcm2_cmm_module;
@@ -50,6 +51,7 @@ typedef struct {
 
 static oyStaticCMMs_s cmms[] = {
   { "oyIM_cmm_module-inbuild", &oyIM_cmm_module, 0 },
+  { "clut_cmm_module-inbuild", &clut_cmm_module, 0 },
 #ifdef HAVE_CUPS
   { "CUPS_cmm_module-inbuild", &CUPS_cmm_module, 0 },
 #endif
@@ -9,6 +9,11 @@
                                             - 0 not owned by the object
                                             - 1 one own monolithic memory block
                                                 starting in array2d[0]
-                                            - 2 several owned memory blocks */
+                                            - 2 several owned memory blocks
+                                            - 3 one own block in slab_ with
+                                                OY_ARRAY2D_ROW_ALIGN aligned rows */
+  oyPointer            slab_;          /**< row memory for own_lines == 3;
+                                            kept over oyArray2d_Reset() */
+  size_t               slab_size_;     /**< allocated bytes in slab_ */
   oyStructList_s     * refs_;          /**< references of other arrays to this*/
   oyArray2d_s        * refered_;       /**< array this one refers to */
@@ -0,0 +1,3 @@
+/** @internal
+ *  alignment of rows in bytes for oyArray2d_SetSlab_(), fits SIMD registers */
+#define OY_ARRAY2D_ROW_ALIGN 64
@@ -26,13 +26,15 @@ void oyArray2d_Release__Members( oyArray2d_s_ * array2d )
 
   if(array2d->oy_->deallocateFunc_)
   {
-#if 0
     oyDeAlloc_f deallocateFunc = array2d->oy_->deallocateFunc_;
-#endif
 
     /* Deallocate members of basic type here
      * E.g.: deallocateFunc( array2d->member );
      */
+    if(array2d->slab_)
+      deallocateFunc( array2d->slab_ );
+    array2d->slab_ = NULL;
+    array2d->slab_size_ = 0;
   }
 }
 
@@ -90,14 +92,10 @@ int oyArray2d_Copy__Members( oyArray2d_s_ * dst, oyArray2d_s_ * src)
 
   /* Copy each value of src to dst here */
 
-  dst->own_lines = 2;
-  for(i = 0; i < dst->height; ++i)
-  {
-    size = dst->width * oyDataTypeGetSize( dst->t );
-    oyStruct_AllocHelper_m_( dst->array2d[i], unsigned char, size,
-                             dst, error = 1; break );
+  size = dst->width * oyDataTypeGetSize( dst->t );
+  error = oyArray2d_SetSlab_( dst, dst->width, dst->height );
+  for(i = 0; !error && i < dst->height; ++i)
     error = !memcpy( dst->array2d[i], src->array2d[i], size );
-  }
 
   return error;
 }
@@ -9,5 +9,8 @@ oyArray2d_s_ *
                                        oyObject_s          object );
 int
              oyArray2d_ReleaseArray_ ( oyArray2d_s       * obj );
+int              oyArray2d_SetSlab_  ( oyArray2d_s_      * s,
+                                       int                 width,
+                                       int                 height );
 int              oyArray2d_ToPPM_    ( oyArray2d_s_      * array,
                                        const char        * file_name );
@@ -91,6 +91,7 @@ int          oyArray2d_ReleaseArray_ ( oyArray2d_s       * obj )
                        oyArray2d_Show( (oyArray2d_s*)s, channels) );
     }
 
+    /* rows in slab_ stay allocated for reuse */
     for( y = s->data_area.y; y < y_max; ++y )
     {
       if((s->own_lines == 1 && y == s->data_area.y) ||
@@ -104,6 +105,65 @@ int          oyArray2d_ReleaseArray_ ( oyArray2d_s       * obj )
 
   return error;
 }
+
+/** Function  oyArray2d_SetSlab_
+ *  @memberof oyArray2d_s
+ *  @brief    Place all rows into one owned memory block
+ *  @internal
+ *
+ *  The rows start at OY_ARRAY2D_ROW_ALIGN byte boundaries with a fixed
+ *  stride. This avoids one allocation per row and keeps the rows close
+ *  in memory. A block from a previous call is reused, if it is large enough.
+ *  The array2d row pointers must already exist, e.g. from oyArray2d_Init_().
+ *
+ *  @param[in,out] s                   the array
+ *  @param[in]     width               samples per row
+ *  @param[in]     height              number of rows
+ *  @return                            error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+int              oyArray2d_SetSlab_  ( oyArray2d_s_      * s,
+                                       int                 width,
+                                       int                 height )
+{
+  size_t stride = (size_t)width * oyDataTypeGetSize( s->t ),
+         size;
+  uintptr_t start;
+  int y;
+
+  if(!s->array2d || width <= 0 || height <= 0)
+    return 1;
+
+  stride = (stride + OY_ARRAY2D_ROW_ALIGN - 1) &
+           ~(size_t)(OY_ARRAY2D_ROW_ALIGN - 1);
+  size = stride * height + OY_ARRAY2D_ROW_ALIGN - 1;
+
+  if(s->slab_ && s->slab_size_ < size)
+  {
+    s->oy_->deallocateFunc_( s->slab_ );
+    s->slab_ = NULL;
+    s->slab_size_ = 0;
+  }
+
+  if(!s->slab_)
+  {
+    s->slab_ = s->oy_->allocateFunc_( size );
+    if(!s->slab_)
+      return 1;
+    s->slab_size_ = size;
+  }
+
+  start = ((uintptr_t)s->slab_ + OY_ARRAY2D_ROW_ALIGN - 1) &
+          ~(uintptr_t)(OY_ARRAY2D_ROW_ALIGN - 1);
+  for(y = 0; y < height; ++y)
+    s->array2d[y] = (unsigned char*)(start + stride * y);
+  s->own_lines = 3;
+
+  return 0;
+}
  
 /** Function  oyArray2d_ToPPM_
  *  @memberof oyArray2d_s
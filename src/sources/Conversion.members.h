@@ -1,2 +1,3 @@
   oyFilterNode_s_    * input;          /**< the input image filter; Most users will start logically with this pice and chain their filters to get the final result. */
   oyFilterNode_s_    * out_;           /**< @private the Oyranos output image. Oyranos will stream the filters starting from the end. This element will be asked on its first plug. */
+  oyStructList_s     * tickets_;       /**< @private kept job tickets of oyConversion_RunPixels() */
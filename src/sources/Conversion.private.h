@@ -0,0 +1,3 @@
+/** @internal
+ *  the number of job tickets oyConversion_RunPixels() keeps for reuse */
+#define OY_CONVERSION_TICKETS_MAX 4
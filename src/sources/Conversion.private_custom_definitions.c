@@ -22,6 +22,7 @@ void oyConversion_Release__Members( oyConversion_s_ * conversion )
    */
   oyFilterNode_Release( (oyFilterNode_s**)&conversion->input );
   oyFilterNode_Release( (oyFilterNode_s**)&conversion->out_ );
+  oyStructList_Release( &conversion->tickets_ );
 
   if(conversion->oy_->deallocateFunc_)
   {
@@ -1,4 +1,5 @@
 #include "oyranos_conversion_internal.h"
+#include "oyranos_cache.h"
 #include "oyCMMapi9_s_.h"
 
 /** Function  oyFilterNode_AddToAdjacencyLst_
@@ -251,6 +252,7 @@ int          oyFilterNode_SetContext_( oyFilterNode_s_    * node,
           oyPointer ptr = 0;
           oyPointer_s * cmm_ptr4 = 0,
                       * cmm_ptr7 = 0;
+          int from_disk = 0;
 
 
           /*  Cache Search
@@ -375,8 +377,15 @@ int          oyFilterNode_SetContext_( oyFilterNode_s_    * node,
               if(!oyPointer_GetPointer(cmm_ptr4))
               {
                 size = 0;
+                /* 3b.0. look into the persistent device link cache */
+                ptr = oyCacheDiskRead_( hash4, core_->api4_->context_type,
+                                        &size, oyAllocateFunc_ );
+                from_disk = ptr && size;
+
                 /* 3b. ask CMM */
-                ptr = oyFilterNode_ContextToMem_( node, &size, oyAllocateFunc_);
+                if(!from_disk)
+                  ptr = oyFilterNode_ContextToMem_( node, &size,
+                                                    oyAllocateFunc_ );
 
                 if(!ptr || !size)
                 {
@@ -429,6 +438,11 @@ int          oyFilterNode_SetContext_( oyFilterNode_s_    * node,
 
                 if(!error)
                 {
+                  /* 3b.0.1. share with other processes under the request key */
+                  if(!from_disk)
+                    oyCacheDiskWrite_( hash4, core_->api4_->context_type,
+                                       ptr, size );
+
                   /* 3b.1. update the hash as the CMM can change options */
                   hash4 = oyFilterNode_GetHash_( node, 4 );
                   oyPointer_Release( &cmm_ptr4 );
@@ -1 +1,2 @@
   oyStruct_s         * entry;          /**< holds a pointer to something */
+  uint32_t             access_;        /**< @private last cache access stamp */
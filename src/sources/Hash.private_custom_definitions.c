@@ -52,13 +52,13 @@ void oyHash_Release__Members( oyHash_s_ * hash )
  */
 int oyHash_Init__Members( oyHash_s_ * hash )
 {
-  oyStruct_AllocHelper_m_( hash->oy_->hash_ptr_,
-                    unsigned char,
-                    OY_HASH_SIZE*2,
-                    hash,
-                    oyHash_Release_( &hash ));
+  /* the object allocates and releases the hash memory */
+  int error = oyObject_HashSet( hash->oy_, NULL );
 
-  return 0;
+  if(error)
+    WARNc_S( "Can not allocate memory for: hash->oy_->hash_ptr_" );
+
+  return error;
 }
 
 /** @internal
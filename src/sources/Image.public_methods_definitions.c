@@ -554,19 +554,21 @@ static int oyImage_CreateFillArray_  ( oyImage_s         * image,
       error = !a;
       if(!error)
       {
-        /* allocate each single line */
+        /* allocate all lines in one aligned block */
         if(allocate_method == 1 || allocate_method == 2)
         {
-          a->own_lines = 2;
-
-          for(ay = 0; ay < array_height; ++ay)
-            if(!a->array2d[ay])
-              oyStruct_AllocHelper_m_( a->array2d[ay], 
-                              unsigned char,
-                              array_width * data_size,
-                              a, error = 1; break );
+          error = oyArray2d_SetSlab_( a, array_width, array_height );
         } else if(allocate_method == 0)
         {
+          /* rows left in a own block, e.g. from oyArray2d_Reset(), are
+           * replaced by the image lines */
+          if(a->own_lines == 3)
+          {
+            for( i = 0; i < array_height; ++i )
+              a->array2d[i] = NULL;
+            a->own_lines = oyNO;
+          }
+
           for( i = 0; i < array_height; )
           {
             if(!a->array2d[i])
@@ -1016,57 +1018,15 @@ int            oyImage_ReadArray     ( oyImage_s         * image,
   return error;
 }
 
-/**
- *  Function oyImage_WritePPM
- *  @memberof oyImage_s
- *  @brief   write buffer to portable pix map format
- *
- *  @param[in]     image               the image
- *  @param[in]     file_name           a writeable file name, The file can 
- *                                     contain "%d" to include the image ID.
- *  @param[in]     free_text           A text to include as comment.
- *
- *  @version Oyranos: 0.3.1
- *  @date    2011/05/12
- *  @since   2008/10/07 (Oyranos: 0.1.8)
- */
-int          oyImage_WritePPM        ( oyImage_s         * image,
-                                       const char        * file_name,
+/* PPM or PAM header from the image geometry and pixel layout */
+static void  oyImage_WritePPMHeader_ ( oyImage_s_        * s,
+                                       FILE              * fp,
                                        const char        * free_text )
 {
-  int error = !file_name;
-  FILE * fp = 0;
-  char * filename = 0;
-  oyImage_s_ * s = (oyImage_s_*)image;
-
-  oyCheckType__m( oyOBJECT_IMAGE_S, return 1 )
-
-  if(!error)
-    oyAllocHelper_m_( filename, char, strlen(file_name)+80, 0, return 1 );
-
-  if(!error)
-  {
-    if(strstr(file_name, "%d"))
-      sprintf( filename, file_name, oyStruct_GetId( (oyStruct_s*)s ) );
-    else
-      strcpy(filename,file_name);
-  }
-
-  if(filename)
-  {
-    fp = fopen( filename, "wb" );
-    oyFree_m_( filename );
-  }
-  else
-    error = 2;
-
-  if(fp)
-  {
       size_t pt = 0;
       char text[128];
       char * t = 0;
       int  len = 0;
-      int  i,j,k,l, n;
       char bytes[48];
 
       int cchan_n = oyProfile_GetChannelsCount( s->profile_ );
@@ -1078,10 +1038,6 @@ int          oyImage_WritePPM        ( oyImage_s         * image,
       const char * colorspacename = oyProfile_GetText( s->profile_,
                                                         oyNAME_DESCRIPTION );
       char * vs = oyVersionString(1,malloc);
-      uint8_t * out_values = 0;
-      const uint8_t * u8 = NULL;
-      double * dbls;
-      float flt;
 
             fputc( 'P', fp );
       if(alpha ||
@@ -1125,7 +1081,7 @@ int          oyImage_WritePPM        ( oyImage_s         * image,
                 free_text?free_text:"" );
       oyStringAddPrintf_( &t, oyAllocateFunc_, oyDeAllocateFunc_,
                 " oyImage_s: %d\n",
-                oyObject_GetId( image->oy_ ) );
+                oyObject_GetId( s->oy_ ) );
       if(vs) { free(vs); vs = 0; }
       len = strlen( t );
       do { fputc ( t[pt] , fp); if(t[pt] == '\n') fputc( '#', fp ); pt++; } while (--len); pt = 0;
@@ -1165,7 +1121,7 @@ int          oyImage_WritePPM        ( oyImage_s         * image,
       if(byteps == 2)
         snprintf( bytes, 48, "65535" );
       else
-        oyMessageFunc_p( oyMSG_WARN, (oyStruct_s*)image,
+        oyMessageFunc_p( oyMSG_WARN, (oyStruct_s*)s,
              OY_DBG_FORMAT_ " byteps: %d",
              OY_DBG_ARGS_, byteps );
 
@@ -1206,10 +1162,88 @@ int          oyImage_WritePPM        ( oyImage_s         * image,
         len = strlen( text );
         do { fputc ( text[pt++] , fp); } while (--len); pt = 0;
       }
+}
+
+/* one line of samples; doubles are stored as floats */
+static void  oyImage_WritePPMLine_   ( FILE              * fp,
+                                       const uint8_t     * line,
+                                       int                 samples,
+                                       int                 byteps )
+{
+  int i, j;
+
+  if(byteps == 8)
+  {
+    const double * dbls = (const double*)line;
+    float flt;
+    const uint8_t * u8 = (const uint8_t*) &flt;
+
+    for(i = 0; i < samples; ++i)
+    {
+      flt = dbls[i];
+      for(j = 0; j < 4; ++j)
+        fputc ( u8[j], fp);
+    }
+  } else
+    fwrite( line, byteps, samples, fp );
+}
+
+/**
+ *  Function oyImage_WritePPM
+ *  @memberof oyImage_s
+ *  @brief   write buffer to portable pix map format
+ *
+ *  @param[in]     image               the image
+ *  @param[in]     file_name           a writeable file name, The file can 
+ *                                     contain "%d" to include the image ID.
+ *  @param[in]     free_text           A text to include as comment.
+ *
+ *  @version Oyranos: 0.3.1
+ *  @date    2011/05/12
+ *  @since   2008/10/07 (Oyranos: 0.1.8)
+ */
+int          oyImage_WritePPM        ( oyImage_s         * image,
+                                       const char        * file_name,
+                                       const char        * free_text )
+{
+  int error = !file_name;
+  FILE * fp = 0;
+  char * filename = 0;
+  oyImage_s_ * s = (oyImage_s_*)image;
+
+  oyCheckType__m( oyOBJECT_IMAGE_S, return 1 )
+
+  if(!error)
+    oyAllocHelper_m_( filename, char, strlen(file_name)+80, 0, return 1 );
+
+  if(!error)
+  {
+    if(strstr(file_name, "%d"))
+      sprintf( filename, file_name, oyStruct_GetId( (oyStruct_s*)s ) );
+    else
+      strcpy(filename,file_name);
+  }
+
+  if(filename)
+  {
+    fp = fopen( filename, "wb" );
+    oyFree_m_( filename );
+  }
+  else
+    error = 2;
+
+  if(fp)
+  {
+      int  len = 0;
+      int  k,l, n;
+      int channels = oyToChannels_m( s->layout_[oyLAYOUT] );
+      oyDATATYPE_e data_type = oyToDataType_m( s->layout_[oyLAYOUT] );
+      int byteps = oyDataTypeGetSize( data_type );
+      uint8_t * out_values = 0;
+
+      oyImage_WritePPMHeader_( s, fp, free_text );
 
       n = s->width * channels;
-      if(byteps == 8)
-        u8 = (uint8_t*) &flt;
 
       for( k = 0; k < s->height; ++k)
       {
@@ -1220,20 +1254,7 @@ int          oyImage_WritePPM        ( oyImage_s         * image,
         len = n * byteps;
 
         for( l = 0; l < height; ++l )
-        {
-          if(byteps == 8)
-          {
-            dbls = (double*)out_values;
-            for(i = 0; i < n; ++i)
-            {
-              flt = dbls[l * len + i];
-              for(j = 0; j < 4; ++j)
-                fputc ( u8[j], fp);
-            }
-          } else 
-          for(i = 0; i < len; ++i)
-            fputc ( out_values[l * len + i] , fp);
-        }
+          oyImage_WritePPMLine_( fp, &out_values[l * len], n, byteps );
 
         if(is_allocated)
           image->oy_->deallocateFunc_(out_values);
@@ -1247,6 +1268,76 @@ int          oyImage_WritePPM        ( oyImage_s         * image,
 }
 
 
+/** Function oyImage_WritePPMLines
+ *  @memberof oyImage_s
+ *  @brief   write lines to portable pix map format
+ *
+ *  Write a band of lines in the layout of image to a PPM file. The band
+ *  starting at line zero creates the file and writes the header from the
+ *  image geometry. Following bands are appended. Thus a image can be
+ *  written from top to bottom without holding all of its pixels in memory,
+ *  e.g. from oyConversion_RunPixelsStreamed().
+ *
+ *  @param[in]     image               the image providing geometry and layout
+ *  @param[in]     file_name           a writeable file name
+ *  @param[in]     free_text           A text to include as comment.
+ *  @param[in]     lines               the band; oyArray2d_GetHeight() lines
+ *                                     with oyImage_GetWidth() pixels each
+ *  @param[in]     y                   position of the first line in image;
+ *                                     the bands must come in order
+ *  @return                            error
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+int          oyImage_WritePPMLines   ( oyImage_s         * image,
+                                       const char        * file_name,
+                                       const char        * free_text,
+                                       oyArray2d_s       * lines,
+                                       int                 y )
+{
+  int error = !file_name || !lines || y < 0;
+  FILE * fp = 0;
+  oyImage_s_ * s = (oyImage_s_*)image;
+
+  oyCheckType__m( oyOBJECT_IMAGE_S, return 1 )
+
+  if(!error)
+  {
+    int channels = oyToChannels_m( s->layout_[oyLAYOUT] ),
+        byteps = oyDataTypeGetSize( oyToDataType_m( s->layout_[oyLAYOUT] ) ),
+        n = s->width * channels,
+        height = OY_MIN( oyArray2d_GetHeight( lines ), s->height - y ),
+        k;
+    unsigned char ** rows = (unsigned char**) oyArray2d_GetData( lines );
+
+    if(oyArray2d_GetWidth( lines ) < n ||
+       (int)oyDataTypeGetSize( oyArray2d_GetType( lines ) ) != byteps)
+    {
+      WARNcc2_S( image, "lines[%d] do not fit image: %s",
+                 oyStruct_GetId( (oyStruct_s*)lines ), file_name );
+      return 1;
+    }
+
+    fp = fopen( file_name, y == 0 ? "wb" : "ab" );
+    error = !fp;
+
+    if(fp)
+    {
+      if(y == 0)
+        oyImage_WritePPMHeader_( s, fp, free_text );
+
+      for(k = 0; k < height; ++k)
+        oyImage_WritePPMLine_( fp, rows[k], n, byteps );
+
+      fclose( fp );
+    }
+  }
+
+  return error;
+}
+
 /** Function oyImage_SetData
  *  @memberof oyImage_s
  *  @brief   set a custom image data module
@@ -32,14 +32,17 @@ oyObject_s   oyObject_SetAllocators_  ( oyObject_s        object,
  *  @memberof oyObject_s
  *  @brief   increase the ref counter and return the above zero ref value
  *
- *  @version Oyranos: 0.1.8
- *  @date    2011/02/02
+ *  The counter is changed atomically through oyAtomicAdd_m_().
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
  *  @since   2008/02/07 (Oyranos: 0.1.8)
  */
 int          oyObject_Ref            ( oyObject_s          obj )
 {
   oyObject_s s = obj;
   int error = !s;
+  int ref = 0;
 
   if(!s) return 1;
 
@@ -50,12 +53,9 @@ int          oyObject_Ref            ( oyObject_s          obj )
     return 1;
   }
 
-  if(error <= 0)
-    oyObject_Lock( s, __FILE__, __LINE__ );
-
   if(error <= 0)
   {
-    ++s->ref_;
+    ref = oyAtomicAdd_m_( &s->ref_, 1 );
 
     if(oy_debug_objects >= 0)
       /* track object */
@@ -63,7 +63,7 @@ int          oyObject_Ref            ( oyObject_s          obj )
   }
 #   if DEBUG_OBJECT
     WARNc3_S("%s   ID: %d refs: %d",
-             oyStructTypeToText( s->parent_types_[s->parent_types_[0]] ), s->id_, s->ref_)
+             oyStructTypeToText( s->parent_types_[s->parent_types_[0]] ), s->id_, ref)
 #   endif
 
   if(obj->parent_types_[obj->parent_types_[0]] == oyOBJECT_NAMED_COLORS_S)
@@ -73,10 +73,7 @@ int          oyObject_Ref            ( oyObject_s          obj )
     error = e_a;
   }
 
-  if(error <= 0)
-    oyObject_UnLock( s, __FILE__, __LINE__ );
-
-  return s->ref_;
+  return ref;
 }
 
 /** @internal
@@ -120,7 +117,8 @@ int          oyObject_HashSet          ( oyObject_s        s,
 
   if(!error && !s->hash_ptr_)
   {
-    s->hash_ptr_ = s->allocateFunc_(OY_HASH_SIZE*2);
+    s->hash_ptr_ = oySlabAllocateFunc_( OY_HASH_SIZE*2,
+                                        s->allocateFunc_, s->deallocateFunc_ );
     error = !s->hash_ptr_;
   }
 
@@ -159,14 +157,12 @@ int          oyObject_HashEqual        ( oyObject_s        s1,
   return equal;
 }
 
-static oyPointer oy_object_id_mutex_ = NULL;
-
 /** @internal
  *  @memberof oyObject_s
  *  @brief    get a object identification number
  *
- *  @version  Oyranos: 0.9.5
- *  @date     2014/02/04
+ *  @version  Oyranos: 0.9.7
+ *  @date     2026/10/18
  *  @since    2014/02/04 (Oyranos: 0.9.5)
  */
 int oyGetNewObjectID()
@@ -174,12 +170,7 @@ int oyGetNewObjectID()
   /* For the ::OY_DEBUG_OBJECTS variable starting with 2 is much easier. */
   static int oy_object_id_ = 2;
   int val = -1;
-  if(!oy_object_id_mutex_)
-    oy_object_id_mutex_ = oyStruct_LockCreateFunc_(NULL);
-
-  oyLockFunc_(oy_object_id_mutex_,__FILE__,__LINE__);
-  val = oy_object_id_++;
-  oyUnLockFunc_(oy_object_id_mutex_,__FILE__,__LINE__);
+  val = oyAtomicAdd_m_( &oy_object_id_, 1 ) - 1;
   return val;
 }
 
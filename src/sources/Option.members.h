@@ -5,3 +5,4 @@
   oyValue_u          * value;          /**< the actual value */
   oyOPTIONSOURCE_e     source;         /**< the source of this value */
   uint32_t             flags;          /**< | oyOPTIONATTRIBUTE_e */
+  struct oyRegPattern_s * pattern_;    /**< @private compiled registration */
@@ -103,6 +103,7 @@ int oyOption_Copy__Members( oyOption_s_ * dst, oyOption_s_ * src)
    oyStruct_EnableSignalSend( (oyStruct_s*)dst );
 
    dst->registration = oyStringCopy_( src->registration, allocateFunc_ );
+   oyOption_SetPattern_( dst );
    dst->value_type = src->value_type;
    dst->value = allocateFunc_(sizeof(oyValue_u));
    memset(dst->value, 0, sizeof(oyValue_u));
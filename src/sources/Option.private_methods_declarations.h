@@ -13,3 +13,7 @@ int            oyOption_SetFromInt_  ( oyOption_s_       * obj,
                                        uint32_t            flags );
 int            oyOption_MoveInStruct_( oyOption_s_       * option,
                                        oyStruct_s       ** s );
+void           oyOption_SetPattern_  ( oyOption_s_       * option );
+int            oyOption_MatchPattern_( oyOption_s_       * option,
+                                       const struct oyRegPattern_s * pattern,
+                                       const char        * pattern_text );
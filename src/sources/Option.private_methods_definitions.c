@@ -37,6 +37,56 @@ int            oyOption_Match_       ( oyOption_s_        * option_a,
   return erg;
 }
 
+/**
+ *  @internal
+ *  Function oyOption_SetPattern_
+ *  @memberof oyOption_s
+ *  @brief   compile the registration for oyOption_MatchPattern_()
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+void           oyOption_SetPattern_  ( oyOption_s_       * option )
+{
+  oyAlloc_f allocateFunc = option->oy_->allocateFunc_;
+  oyDeAlloc_f deallocateFunc = option->oy_->deallocateFunc_;
+
+  oyRegPatternRelease_( &option->pattern_, allocateFunc, deallocateFunc );
+
+  if(option->registration)
+    option->pattern_ = oyRegPatternNew_( option->registration,
+                                         allocateFunc, deallocateFunc );
+}
+
+/**
+ *  @internal
+ *  Function oyOption_MatchPattern_
+ *  @memberof oyOption_s
+ *  @brief   match the registration against a pattern
+ *
+ *  The same as oyFilterRegistrationMatch() on the registration. With a
+ *  compiled pattern the texts are not scanned again.
+ *
+ *  @param[in]     option              the option
+ *  @param[in]     pattern             the compiled pattern_text or NULL
+ *  @param[in]     pattern_text        the pattern
+ *  @return                            match, useable for ranking
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+int            oyOption_MatchPattern_( oyOption_s_       * option,
+                                       const struct oyRegPattern_s * pattern,
+                                       const char        * pattern_text )
+{
+  if(option->pattern_ && pattern)
+    return oyRegPatternMatch_( option->pattern_, pattern, oyOBJECT_NONE, 0 );
+
+  return oyFilterRegistrationMatch( option->registration, pattern_text, 0 );
+}
+
 /**
  *  @internal
  *  Function oyOption_UpdateFlags_
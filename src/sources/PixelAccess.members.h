@@ -21,3 +21,4 @@
   oyImage_s      * output_image;       /**< the image which issued the request*/
   oyFilterGraph_s_ * graph;            /**< the graph to process */
   oyOptions_s    * request_queue;      /**< messaging; requests to resolve */
+  oyStructList_s * pool_;             /**< @private recycled intermediate arrays; shared with copies */
@@ -0,0 +1,3 @@
+/** @internal
+ *  the number of arrays a oyPixelAccess_s pool keeps for reuse */
+#define OY_PIXEL_ACCESS_POOL_MAX 8
@@ -63,3 +63,11 @@ int                oyPixelAccess_SetOldStart (
                                        int                 vertical,
                                        double              start );
 const char *       oyPixelAccess_Show( oyPixelAccess_s   * pixel_access );
+oyArray2d_s *      oyPixelAccess_TakeArray (
+                                       oyPixelAccess_s   * pixel_access,
+                                       int                 width,
+                                       int                 height,
+                                       oyDATATYPE_e        data_type );
+int                oyPixelAccess_GiveArray (
+                                       oyPixelAccess_s   * pixel_access,
+                                       oyArray2d_s      ** array );
@@ -1,6 +1,9 @@
   char               * file_name_;     /*!< @private file name for loading on request */
   size_t               size_;          /*!< @private ICC profile size */
   void               * block_;         /*!< @private ICC profile data */
+  size_t               lazy_;          /*!< @private bytes in block_, if only header and tag table are loaded */
+  void               * head_;          /*!< @private header block replaced by a later full load */
+  size_t               map_size_;      /*!< @private block_ is a read-only file mapping of this size */
   icColorSpaceSignature sig_;          /*!< @private ICC profile signature */
   oyPROFILE_e          use_default_;   /*!< @private if > 0 : take from settings */
   oyObject_s         * names_chan_;    /*!< @private user visible channel description */
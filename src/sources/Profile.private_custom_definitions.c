@@ -43,8 +43,10 @@ void oyProfile_Release__Members( oyProfile_s_ * profile )
     if(profile->names_chan_)
     { deallocateFunc( profile->names_chan_ ); profile->names_chan_ = 0; }
 
-    if(profile->block_)
-    { deallocateFunc( profile->block_ ); profile->block_ = 0; profile->size_ = 0; }
+    oyProfile_FreeBlock_( profile );
+
+    if(profile->head_)
+    { deallocateFunc( profile->head_ ); profile->head_ = 0; }
 
     if(profile->file_name_)
     { deallocateFunc( profile->file_name_ ); profile->file_name_ = 0; }
@@ -105,13 +107,18 @@ int oyProfile_Copy__Members( oyProfile_s_ * dst, oyProfile_s_ * src)
   /* Copy each value of src to dst here */
   if(src->block_ && src->size_)
   {
-    dst->block_ = allocateFunc_( src->size_ );
+    /* a partly loaded profile stays partial */
+    size_t lazy = src->lazy_,
+           size = lazy ? lazy : src->size_;
+
+    dst->block_ = allocateFunc_( size );
     if(!dst->block_)
       error = 1;
     else
     {
       dst->size_ = src->size_;
-      error = !memcpy( dst->block_, src->block_, src->size_ );
+      dst->lazy_ = lazy;
+      error = !memcpy( dst->block_, src->block_, size );
       if(error) { WARNc_S("Unable to copy CMM name"); }
     }
   }
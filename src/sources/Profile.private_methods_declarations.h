@@ -38,6 +38,12 @@ oyPointer    oyProfile_WriteTagTable_( oyProfile_s_      * profile,
 int oyProfile_HasID_          ( oyProfile_s_      * s );
 int oyProfile_GetHash_        ( oyProfile_s_      * s,
                                        int                 flags );
+int oyProfile_LoadBlock_      ( oyProfile_s_      * s );
+void oyProfile_FreeBlock_     ( oyProfile_s_      * s );
+int oyProfile_UnMap_          ( oyProfile_s_      * s );
+int oyProfile_ReadTag_        ( oyProfile_s_      * s,
+                                       icTagSignature      id,
+                                       oyProfileTag_s   ** tag );
 #if 0
 oyChar *       oyProfile_GetCMMText_ ( oyProfile_s       * profile,
                                        oyNAME_e            type,
@@ -25,4 +25,5 @@
 #define OY_SKIP_NON_DEFAULT_PATH 0x40           /**< ignore profiles outside of default paths */
 #define OY_NO_REPAIR     0x80                   /**< do not try to repair or fix profiles */
 #define OY_NO_LOAD       0x100                  /**< do not load profile, create fragment */
+#define OY_MAP_FILE      0x200                  /**< map the profile file read-only into memory */
 /** @} *//* objects_profile */
@@ -29,6 +29,7 @@ int              oyStructList_MoveIn ( oyStructList_s    * list,
   int error = 0;
   int i;
   int set = 0;
+  oyStruct_s * obj = NULL;
 
   error = !s;
 
@@ -45,14 +46,20 @@ int              oyStructList_MoveIn ( oyStructList_s    * list,
     error = !(ptr && *ptr && (*ptr)->type_);
 
   if(error <= 0)
-    /* search for a empty pointer and set */
-    if(0 > pos || pos >= s->n_)
+    obj = *ptr;
+
+  if(error <= 0)
+    /* search for a empty pointer and set;
+     * indexed cache lists are kept compact by oyStructList_ReleaseAt() and
+     * skip the linear search */
+    if((0 > pos || pos >= s->n_) && !s->hash_index_)
     {
       for(i = 0; i < s->n_; ++i)
         if(s->ptr_[i] == 0)
         {
           s->ptr_[i] = *ptr;
           set = 1;
+          break;
         }
     }
 
@@ -128,6 +135,9 @@ int              oyStructList_MoveIn ( oyStructList_s    * list,
     *ptr = 0;
   }
 
+  if(error <= 0)
+    oyCacheListIndexAdd_( list, obj );
+
   oyObject_UnLock( s->oy_, __FILE__, __LINE__ );
 
   return error;
@@ -210,6 +220,8 @@ int            oyStructList_ReleaseAt( oyStructList_s    * list,
 
   if(0 <= pos && pos < s->n_)
   {
+    oyCacheListIndexRemove_( list, s->ptr_[pos] );
+
     if(s->ptr_[pos] && s->ptr_[pos]->release)
       s->ptr_[pos]->release( (oyStruct_s**)&s->ptr_[pos] );
 
@@ -88,7 +88,7 @@ static const char * oy{{ class.baseName }}_StaticMessageFunc_ (
   {{ class.privName }} * s = 0;
 
   if(s_obj)
-    s = ({{ class.privName }}*)s_obj->allocateFunc_(sizeof({{ class.privName }}));
+    s = {% block allocate %}({{ class.privName }}*)s_obj->allocateFunc_(sizeof({{ class.privName }}));{% endblock allocate %}
   else
   {
     WARNc_S(_("MEM Error."));
@@ -406,14 +406,14 @@ int oy{{ class.baseName }}_Release_( {{ class.privName }} **{{ class.baseName|lo
 
   if(s->oy_->deallocateFunc_)
   {
-    oyDeAlloc_f deallocateFunc = s->oy_->deallocateFunc_;
+    {% block deallocators %}oyDeAlloc_f deallocateFunc = s->oy_->deallocateFunc_;{% endblock deallocators %}
     int id = s->oy_->id_;
 
     oyObject_Release( &s->oy_ );
     if(track_name)
       fprintf( stderr, "%s[%d] untracked\n", track_name, id);
 
-    deallocateFunc( s );
+    {% block deallocate %}deallocateFunc( s );{% endblock deallocate %}
   }
 
   return 0;
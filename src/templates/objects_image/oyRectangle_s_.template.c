@@ -1,5 +1,10 @@
 {% extends "Base_s_.c" %}
 
+{% block allocate %}({{ class.privName }}*)oySlabAllocateFunc_( sizeof({{ class.privName }}), s_obj->allocateFunc_, s_obj->deallocateFunc_ );{% endblock %}
+{% block deallocators %}oyAlloc_f allocateFunc = s->oy_->allocateFunc_;
+    oyDeAlloc_f deallocateFunc = s->oy_->deallocateFunc_;{% endblock %}
+{% block deallocate %}oySlabDeAllocateFunc_( s, sizeof({{ class.privName }}), allocateFunc, deallocateFunc );{% endblock %}
+
 {% block customStaticMessage %}
 {{ block.super }}
   if(type != oyNAME_NICK || (flags & 0x01))
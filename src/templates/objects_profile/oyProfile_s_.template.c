@@ -8,6 +8,14 @@
 #include "oyranos_cache.h"
 #include "oyranos_io.h"
 #include "oyranos_generic_internal.h"
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define OY_PROFILE_MMAP 1
+#endif
 {% endblock %}
 
 {% block GlobalIncludeFiles %}
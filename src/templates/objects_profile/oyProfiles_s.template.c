@@ -6,4 +6,5 @@
 #include "oyProfile_s_.h"
 #include "oyProfiles_s_.h"
 #include "oyConfig_s_.h"
+#include "lookup3.h"
 {% endblock %}
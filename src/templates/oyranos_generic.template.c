@@ -4,15 +4,19 @@
 
 #include "oyranos_helper_macros.h"
 #include "oyranos_helper.h"
+#include "lookup3.h"
 #include "oyranos_generic.h"
+#include "oyranos_generic_internal.h"
 #include "oyranos_object.h"
 #include "oyranos_object_internal.h"
 #include "oyranos_string.h"
 
 #include "oyObject_s.h"
 #include "oyHash_s.h"
+#include "oyHash_s_.h"
 
 #include "oyStructList_s_.h"
+#include "oyranos_cache.h"
 
 
 oyObjectInfoStatic_s oy_connector_imaging_static_object = {
@@ -82,17 +86,488 @@ const char *   oyContextCollectData_ ( oyStruct_s        * s,
 
 /** Private function definitions { */
 
+/** @internal
+ *  @struct  oyCacheIndexSlot_s
+ *  @brief   a single cache index slot
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+typedef struct {
+  uint32_t             key;            /**< oy_hashlittle() of the hash_ptr_ */
+  oyHash_s           * entry;          /**< not referenced list member */
+} oyCacheIndexSlot_s;
+
+/** @internal
+ *  @struct  oyCacheIndex_s
+ *  @brief   open addressing lookup table for a oyStructList_s cache
+ *
+ *  The table maps the OY_HASH_SIZE*2 bytes of a oyHash_s::oy_->hash_ptr_ to
+ *  the oyHash_s member of a cache list. It uses linear probing and backward
+ *  shift deletion. Entries are not referenced, as the list owns them.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+typedef struct {
+  uint32_t             size;           /**< slot count; a power of two */
+  uint32_t             count;          /**< used slots */
+  oyCacheIndexSlot_s * slots;          /**< the table */
+  int                  inserts;        /**< new entries since last trim */
+} oyCacheIndex_s;
+
+#define oyCACHE_INDEX_MIN 64
+
+/* LRU clock for oyHash_s::access_; shared by all cache lists */
+static int oy_cache_access_ = 0;
+
+static uint32_t    oyCacheIndexKey_  ( const unsigned char * hash )
+{
+  return oy_hashlittle( hash, OY_HASH_SIZE*2, 0 );
+}
+
+static oyCacheIndex_s * oyCacheIndexNew_( uint32_t         size )
+{
+  oyCacheIndex_s * index = oyAllocateFunc_( sizeof(oyCacheIndex_s) );
+
+  if(!index) return NULL;
+
+  index->size = size;
+  index->count = 0;
+  index->inserts = 0;
+  index->slots = oyAllocateFunc_( sizeof(oyCacheIndexSlot_s) * size );
+  if(!index->slots)
+  {
+    oyDeAllocateFunc_( index );
+    return NULL;
+  }
+  memset( index->slots, 0, sizeof(oyCacheIndexSlot_s) * size );
+
+  return index;
+}
+
+static void        oyCacheIndexFree_ ( oyCacheIndex_s   ** index )
+{
+  if(!index || !*index) return;
+
+  oyDeAllocateFunc_( (*index)->slots );
+  oyDeAllocateFunc_( *index );
+  *index = NULL;
+}
+
+static void        oyCacheIndexPut_  ( oyCacheIndex_s    * index,
+                                       uint32_t            key,
+                                       oyHash_s          * entry )
+{
+  uint32_t mask = index->size - 1,
+           i = key & mask;
+
+  while(index->slots[i].entry)
+    i = (i + 1) & mask;
+
+  index->slots[i].key = key;
+  index->slots[i].entry = entry;
+  ++index->count;
+}
+
+/* keep the load factor below 1/2 */
+static int         oyCacheIndexGrow_ ( oyCacheIndex_s    * index )
+{
+  oyCacheIndex_s * tmp;
+  uint32_t i;
+
+  if((index->count + 1) * 2 <= index->size)
+    return 0;
+
+  tmp = oyCacheIndexNew_( index->size * 2 );
+  if(!tmp)
+    return 1;
+
+  for(i = 0; i < index->size; ++i)
+    if(index->slots[i].entry)
+      oyCacheIndexPut_( tmp, index->slots[i].key, index->slots[i].entry );
+
+  oyDeAllocateFunc_( index->slots );
+  index->slots = tmp->slots;
+  index->size = tmp->size;
+  tmp->slots = NULL;
+  oyDeAllocateFunc_( tmp );
+
+  return 0;
+}
+
+static oyHash_s *  oyCacheIndexFind_ ( oyCacheIndex_s    * index,
+                                       const char        * hash )
+{
+  uint32_t key = oyCacheIndexKey_( (const unsigned char*)hash ),
+           mask = index->size - 1,
+           i = key & mask;
+
+  while(index->slots[i].entry)
+  {
+    if(index->slots[i].key == key &&
+       memcmp( hash, index->slots[i].entry->oy_->hash_ptr_,
+               OY_HASH_SIZE*2 ) == 0)
+      return index->slots[i].entry;
+    i = (i + 1) & mask;
+  }
+
+  return NULL;
+}
+
+static void        oyCacheIndexRemove_(oyCacheIndex_s    * index,
+                                       oyHash_s          * entry )
+{
+  uint32_t key = oyCacheIndexKey_( entry->oy_->hash_ptr_ ),
+           mask = index->size - 1,
+           i = key & mask, j, home;
+
+  while(index->slots[i].entry && index->slots[i].entry != entry)
+    i = (i + 1) & mask;
+
+  /* the key changed after insertion; search all slots */
+  if(!index->slots[i].entry)
+    for(i = 0; i < index->size; ++i)
+      if(index->slots[i].entry == entry)
+        break;
+
+  if(i >= index->size || !index->slots[i].entry)
+    return;
+
+  /* shift following members of the probe sequence back into the gap */
+  index->slots[i].entry = NULL;
+  --index->count;
+  j = i;
+  while(1)
+  {
+    j = (j + 1) & mask;
+    if(!index->slots[j].entry)
+      break;
+
+    home = index->slots[j].key & mask;
+    if((i <= j) ? (i < home && home <= j) : (i < home || home <= j))
+      continue;
+
+    index->slots[i] = index->slots[j];
+    index->slots[j].entry = NULL;
+    i = j;
+  }
+}
+
+/** @internal
+ *  @brief obtain the lookup table of a cache list
+ *
+ *  The table is build on first access from the current list members.
+ *  Further modifications are tracked by oyStructList_MoveIn() and
+ *  oyStructList_ReleaseAt().
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+static oyCacheIndex_s * oyCacheListIndexGet_ (
+                                       oyStructList_s_   * list )
+{
+  oyCacheIndex_s * index = (oyCacheIndex_s*) list->hash_index_;
+  uint32_t size = oyCACHE_INDEX_MIN;
+  int i;
+
+  if(index)
+    return index;
+
+  while(size < (uint32_t)list->n_ * 2)
+    size *= 2;
+
+  index = oyCacheIndexNew_( size * 2 );
+  if(!index)
+    return NULL;
+
+  for(i = 0; i < list->n_; ++i)
+  {
+    oyHash_s * entry = (oyHash_s*) oyStructList_GetType_( list, i,
+                                                          oyOBJECT_HASH_S );
+    if(entry && entry->oy_ && entry->oy_->hash_ptr_)
+      oyCacheIndexPut_( index, oyCacheIndexKey_( entry->oy_->hash_ptr_ ),
+                        entry );
+  }
+
+  list->hash_index_ = index;
+
+  return index;
+}
+
+/** @internal
+ *  @brief track a new cache list member
+ *
+ *  Does nothing for lists without lookup table or for non oyHash_s members.
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+int          oyCacheListIndexAdd_    ( oyStructList_s    * cache_list,
+                                       oyStruct_s        * entry )
+{
+  oyStructList_s_ * s = (oyStructList_s_*)cache_list;
+  oyCacheIndex_s * index;
+  oyHash_s * hash = (oyHash_s*) entry;
+
+  if(!s || !s->hash_index_ ||
+     !entry || entry->type_ != oyOBJECT_HASH_S ||
+     !entry->oy_ || !entry->oy_->hash_ptr_)
+    return 0;
+
+  index = (oyCacheIndex_s*) s->hash_index_;
+  if(oyCacheIndexGrow_( index ))
+  {
+    /* fall back to a rebuild on next lookup */
+    oyCacheListIndexRelease_( cache_list );
+    return 1;
+  }
+
+  oyCacheIndexPut_( index, oyCacheIndexKey_( hash->oy_->hash_ptr_ ), hash );
+
+  return 0;
+}
+
+/** @internal
+ *  @brief forget a cache list member
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+int          oyCacheListIndexRemove_ ( oyStructList_s    * cache_list,
+                                       oyStruct_s        * entry )
+{
+  oyStructList_s_ * s = (oyStructList_s_*)cache_list;
+
+  if(!s || !s->hash_index_ ||
+     !entry || entry->type_ != oyOBJECT_HASH_S ||
+     !entry->oy_ || !entry->oy_->hash_ptr_)
+    return 0;
+
+  oyCacheIndexRemove_( (oyCacheIndex_s*) s->hash_index_, (oyHash_s*)entry );
+
+  return 0;
+}
+
+/** @internal
+ *  @brief release a cache list lookup table
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+void         oyCacheListIndexRelease_( oyStructList_s    * cache_list )
+{
+  oyStructList_s_ * s = (oyStructList_s_*)cache_list;
+
+  if(s && s->hash_index_)
+    oyCacheIndexFree_( (oyCacheIndex_s**) &s->hash_index_ );
+}
+
+/** @internal
+ *  @brief account the payload bytes of a cache list
+ *
+ *  @param[in]     cache_list          the list to inspect
+ *  @param[out]    unreferenced        optional count of entries held only by
+ *                                     the list
+ *  @return                            bytes as of oyCacheEntryGetSize_()
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+size_t       oyCacheListGetSize_     ( oyStructList_s    * cache_list,
+                                       int               * unreferenced )
+{
+  oyStructList_s_ * s = (oyStructList_s_*)cache_list;
+  size_t bytes = 0;
+  int i, n, free_n = 0;
+
+  if(!s || s->type_ != oyOBJECT_STRUCT_LIST_S)
+    return 0;
+
+  oyObject_Lock( s->oy_, __FILE__, __LINE__ );
+  n = s->n_;
+  for(i = 0; i < n; ++i)
+  {
+    oyHash_s * entry = (oyHash_s*) oyStructList_GetType_( s, i,
+                                                          oyOBJECT_HASH_S );
+    if(!entry)
+      continue;
+
+    bytes += oyCacheEntryGetSize_( entry );
+    if(entry->oy_->ref_ == 1)
+      ++free_n;
+  }
+  oyObject_UnLock( s->oy_, __FILE__, __LINE__ );
+
+  if(unreferenced)
+    *unreferenced = free_n;
+
+  return bytes;
+}
+
+typedef struct {
+  uint32_t             access;
+  size_t               size;
+} oyCacheLRU_s;
+
+static int oyCacheLRUCompare_( const void * a, const void * b )
+{
+  const oyCacheLRU_s * ea = (const oyCacheLRU_s *)a,
+                     * eb = (const oyCacheLRU_s *)b;
+  return (ea->access > eb->access) - (ea->access < eb->access);
+}
+
+/** @internal
+ *  @brief evict least recently used entries from a cache list
+ *
+ *  Only entries, which are held by nothing but the list, are released.
+ *  After exceeding a limit the list is trimmed to 3/4 of that limit. That
+ *  avoids evicting on each new entry.
+ *
+ *  @param[in,out] cache_list          the list to trim
+ *  @param[in]     max_bytes           byte budget; 0 - unlimited
+ *  @param[in]     max_entries         entry cap; 0 - unlimited
+ *  @return                            the number of released entries
+ *
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
+ *  @since   2026/10/18 (Oyranos: 0.9.7)
+ */
+int          oyCacheListTrim_        ( oyStructList_s    * cache_list,
+                                       size_t              max_bytes,
+                                       int                 max_entries )
+{
+  oyStructList_s_ * s = (oyStructList_s_*)cache_list;
+  oyCacheLRU_s * lru = NULL;
+  size_t bytes = 0, need_bytes = 0, freed = 0;
+  int i, j, n, lru_n = 0, need_n = 0, evict_n = 0, released = 0;
+  uint32_t threshold = 0;
+
+  if(!s || s->type_ != oyOBJECT_STRUCT_LIST_S ||
+     (!max_bytes && !max_entries))
+    return 0;
+
+  oyObject_Lock( s->oy_, __FILE__, __LINE__ );
+
+  n = s->n_;
+  if(n)
+    lru = oyAllocateFunc_( sizeof(oyCacheLRU_s) * n );
+  if(!lru)
+  {
+    oyObject_UnLock( s->oy_, __FILE__, __LINE__ );
+    return 0;
+  }
+
+  for(i = 0; i < n; ++i)
+  {
+    oyHash_s_ * entry = (oyHash_s_*) oyStructList_GetType_( s, i,
+                                                            oyOBJECT_HASH_S );
+    size_t size;
+    if(!entry)
+      continue;
+
+    size = oyCacheEntryGetSize_( (oyHash_s*)entry );
+    bytes += size;
+    if(entry->oy_->ref_ == 1)
+    {
+      lru[lru_n].access = entry->access_;
+      lru[lru_n].size = size;
+      ++lru_n;
+    }
+  }
+
+  if(max_bytes && bytes > max_bytes)
+    need_bytes = bytes - max_bytes / 4 * 3;
+  if(max_entries && n > max_entries)
+    need_n = n - max_entries / 4 * 3;
+
+  if((need_bytes || need_n) && lru_n)
+  {
+    qsort( lru, lru_n, sizeof(oyCacheLRU_s), oyCacheLRUCompare_ );
+    while(evict_n < lru_n && (freed < need_bytes || evict_n < need_n))
+      freed += lru[evict_n++].size;
+    threshold = lru[evict_n - 1].access;
+
+    /* release the oldest unreferenced entries and close the gaps */
+    for(i = 0, j = 0; i < n; ++i)
+    {
+      oyStruct_s * st = s->ptr_[i];
+      oyHash_s_ * entry = (st && st->type_ == oyOBJECT_HASH_S) ?
+                          (oyHash_s_*) st : NULL;
+
+      if(entry && released < evict_n &&
+         entry->oy_->ref_ == 1 && entry->access_ <= threshold)
+      {
+        oyCacheListIndexRemove_( cache_list, st );
+        st->release( &st );
+        ++released;
+      } else
+        s->ptr_[j++] = st;
+    }
+    for(i = j; i < n; ++i)
+      s->ptr_[i] = NULL;
+    s->n_ = j;
+
+    if(oy_debug)
+      oyMessageFunc_p( oyMSG_DBG, (oyStruct_s*)s,
+                       OY_DBG_FORMAT_ "%s: released %d of %d entries %lu/%lu bytes",
+                       OY_DBG_ARGS_, oyNoEmptyString_m_(s->list_name),
+                       released, n, (unsigned long)freed,
+                       (unsigned long)bytes );
+  }
+
+  oyObject_UnLock( s->oy_, __FILE__, __LINE__ );
+
+  oyDeAllocateFunc_( lru );
+
+  return released;
+}
+
+/* trim new entries, as byte sizes are known only after oyHash_SetPointer()
+ * the check runs in intervals growing with the list */
+static void  oyCacheListCheck_       ( oyStructList_s    * cache_list,
+                                       oyCacheIndex_s    * index )
+{
+  size_t max_bytes = 0;
+  int max_entries = 0, n, interval;
+
+  oyCacheGetLimits_( &max_bytes, &max_entries );
+  if(!max_bytes && !max_entries)
+    return;
+
+  n = oyStructList_Count( cache_list );
+  interval = n / 8 > 32 ? n / 8 : 32;
+  if(index && ++index->inserts < interval &&
+     !(max_entries && n > max_entries))
+    return;
+
+  if(index)
+    index->inserts = 0;
+  oyCacheListTrim_( cache_list, max_bytes, max_entries );
+}
+
 /** @internal
  *  @brief get always a Oyranos cache entry from a cache list
  *
+ *  The lookup goes through a hash table keyed by the entries hash_ptr_.
+ *  It costs constant time independent of the cache size. New entries
+ *  might trigger oyCacheListTrim_() with the oyCacheGetLimits_() values.
+ *
  *  @param[in]     cache_list          the list to search in
  *  @param[in]     flags               0 - assume text, 1 - assume 16 byte hash
  *  @param[in]     hash_text           the text to search for in the cache_list
  *  @return                            the cache entry may not have a entry
  *
- *  @version Oyranos: 0.1.10
+ *  @version Oyranos: 0.9.7
+ *  @date    2026/10/18
  *  @since   2007/11/24 (Oyranos: 0.1.8)
- *  @date    2009/06/04
  */
 oyHash_s *   oyCacheListGetEntry_    ( oyStructList_s    * cache_list,
                                        uint32_t            flags,
@@ -101,10 +576,10 @@ oyHash_s *   oyCacheListGetEntry_    ( oyStructList_s    * cache_list,
   oyHash_s * entry = 0,
            * search_key = 0;
   int error = !(cache_list && hash_text);
-  int n = 0, i;
   uint32_t search_int[8] = {0,0,0,0,0,0,0,0};
   char hash_text_copy[32];
   const char * search_ptr = (const char*)search_int;
+  oyCacheIndex_s * index = NULL;
 
   if(error <= 0 && cache_list->type_ != oyOBJECT_STRUCT_LIST_S)
     error = 1;
@@ -124,30 +599,46 @@ oyHash_s *   oyCacheListGetEntry_    ( oyStructList_s    * cache_list,
                                   (unsigned char*)search_int );
   }
 
-  if(error <= 0)
-    n = oyStructList_Count(cache_list);
+  if(error > 0)
+    return entry;
 
-  for(i = 0; i < n; ++i)
+  oyObject_Lock( cache_list->oy_, __FILE__, __LINE__ );
+
+  index = oyCacheListIndexGet_( (oyStructList_s_*)cache_list );
+  if(index)
+    entry = oyCacheIndexFind_( index, search_ptr );
+  else
   {
-    oyHash_s * compare = (oyHash_s*) oyStructList_GetType_( (oyStructList_s_*)cache_list, i,
-                                                         oyOBJECT_HASH_S );
+    int n = oyStructList_Count(cache_list), i;
 
-    if(compare )
-    if(memcmp(search_ptr, compare->oy_->hash_ptr_, OY_HASH_SIZE*2) == 0)
+    for(i = 0; i < n; ++i)
     {
-      entry = compare;
-      oyHash_Copy( entry, 0 );
-      return entry;
+      oyHash_s * compare = (oyHash_s*) oyStructList_GetType_( (oyStructList_s_*)cache_list, i,
+                                                           oyOBJECT_HASH_S );
+
+      if(compare )
+      if(memcmp(search_ptr, compare->oy_->hash_ptr_, OY_HASH_SIZE*2) == 0)
+      {
+        entry = compare;
+        break;
+      }
     }
   }
 
-  if(error <= 0 && !entry)
+  if(entry)
+  {
+    ((oyHash_s_*)entry)->access_ = (uint32_t)oyAtomicAdd_m_( &oy_cache_access_, 1 );
+    oyHash_Copy( entry, 0 );
+  } else
   {
     search_key = oyHash_Create(hash_text, 0);
     error = !search_key;
 
     if(error <= 0)
+    {
+      ((oyHash_s_*)search_key)->access_ = (uint32_t)oyAtomicAdd_m_( &oy_cache_access_, 1 );
       entry = oyHash_Copy( search_key, 0 );
+    }
 
     if(error <= 0)
     {
@@ -156,8 +647,13 @@ oyHash_s *   oyCacheListGetEntry_    ( oyStructList_s    * cache_list,
     }
 
     oyHash_Release( &search_key );
+
+    if(error <= 0)
+      oyCacheListCheck_( cache_list, (oyCacheIndex_s*)
+                         ((oyStructList_s_*)cache_list)->hash_index_ );
   }
 
+  oyObject_UnLock( cache_list->oy_, __FILE__, __LINE__ );
 
   return entry;
 }
@@ -13,6 +13,16 @@ extern "C" {
 oyHash_s *   oyCacheListGetEntry_    ( oyStructList_s    * cache_list,
                                        uint32_t            flags,
                                        const char        * hash_text );
+int          oyCacheListIndexAdd_    ( oyStructList_s    * cache_list,
+                                       oyStruct_s        * entry );
+int          oyCacheListIndexRemove_ ( oyStructList_s    * cache_list,
+                                       oyStruct_s        * entry );
+void         oyCacheListIndexRelease_( oyStructList_s    * cache_list );
+size_t       oyCacheListGetSize_     ( oyStructList_s    * cache_list,
+                                       int               * unreferenced );
+int          oyCacheListTrim_        ( oyStructList_s    * cache_list,
+                                       size_t              max_bytes,
+                                       int                 max_entries );
 
 
 #ifdef __cplusplus
@@ -678,12 +678,17 @@ oyStructList_s** oyCMMCacheList_()
 char * oyCMMCacheListPrint_()
 {
   oyStructList_s ** cache_list = oyCMMCacheList_();
-  int n = oyStructList_Count( *cache_list ), i;
+  int n = oyStructList_Count( *cache_list ), i, unreferenced = 0;
   oyChar * text = 0;
+  size_t bytes = oyCacheListGetSize_( *cache_list, &unreferenced ),
+         max_bytes = 0;
+  int max_entries = 0;
 
+  oyCacheGetLimits_( &max_bytes, &max_entries );
   oyStringAddPrintf_( &text, oyAllocateFunc_,oyDeAllocateFunc_,
-                      "Oyranos CMM cache with %d entries:\n", 
-                      n);
+                      "Oyranos CMM cache with %d entries (%d unreferenced) %lu bytes; limits: %d entries %lu bytes:\n", 
+                      n, unreferenced, (unsigned long)bytes,
+                      max_entries, (unsigned long)max_bytes );
 
   for(i = 0; i < n ; ++i)
   {
@@ -696,8 +701,13 @@ char * oyCMMCacheListPrint_()
       oyPointer_s * cmm_ptr = (oyPointer_s*) oyHash_GetPointer( compare,
                                                   oyOBJECT_POINTER_S);
       uint32_t * id = (uint32_t*) ((cmm_ptr && cmm_ptr->oy_ && cmm_ptr->oy_->hash_ptr_) ? cmm_ptr->oy_->hash_ptr_ : compare->oy_->hash_ptr_);
+      uint32_t digest[8] = {0,0,0,0,0,0,0,0};
       oyStringAddPrintf_( &text, oyAllocateFunc_,oyDeAllocateFunc_,
-                      "refs:%d hash: %08x%08x%08x%08x ", compare->oy_->ref_, id[0],id[1],id[2],id[3]);
+                      "refs:%d size:%lu hash: %08x%08x%08x%08x ", compare->oy_->ref_,
+                      (unsigned long)oyCacheEntryGetSize_( compare ),
+                      id[0],id[1],id[2],id[3]);
+      /* do not touch the cache key */
+      id = digest;
       oyMiscBlobGetHash_((void*)hash_text, oyStrlen_(hash_text), 0,
                          (unsigned char*)id);
       oyStringAddPrintf_( &text, oyAllocateFunc_,oyDeAllocateFunc_,
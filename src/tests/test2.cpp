@@ -31,6 +31,18 @@
   TEST_RUN( testProfile, "Profile handling", 1 ); \
   TEST_RUN( testProfiles, "Profiles reading", 1 ); \
   TEST_RUN( testProfileLists, "Profile lists", 1 ); \
+  TEST_RUN( testProfileIndex, "Profile index", 1 ); \
+  TEST_RUN( testProfileFromMD5, "Profile from MD5 and name", 1 ); \
+  TEST_RUN( testProfileIndexOverwrite, "Profile overwritten in place", 1 ); \
+  TEST_RUN( testProfilesCreate, "Profiles duplicate filtering", 1 ); \
+  TEST_RUN( testProfileLazy, "Profile partial loading", 1 ); \
+  TEST_RUN( testProfileMap, "Profile file mapping", 1 ); \
+  TEST_RUN( testProfileRefs, "Profile reference counting", 1 ); \
+  TEST_RUN( testObjectAlloc, "Small object allocation", 1 ); \
+  TEST_RUN( testJobQueue, "Job queue throughput", 1 ); \
+  TEST_RUN( testJobSchedule, "Job priorities, dependencies and cancel", 1 ); \
+  TEST_RUN( testJobPool, "Job worker pool", 1 ); \
+  TEST_RUN( testParallelFor, "Parallel for loop", 1 ); \
   TEST_RUN( testEffects, "Effects", 1 ); \
   TEST_RUN( testDeviceLinkProfile, "CMM deviceLink", 1 ); \
   TEST_RUN( testClut, "CMM clut", 1 ); \
@@ -49,6 +61,16 @@
   TEST_RUN( testCMMsShow, "CMMs show", 1 ); \
   TEST_RUN( testCMMnmRun, "CMM named color run", 1 ); \
   TEST_RUN( testImagePixel, "CMM Image Pixel run", 1 ); \
+  TEST_RUN( testImagePixelTiled, "CMM Image Pixel tiled run", 1 ); \
+  TEST_RUN( testImagePixelStreamed, "CMM Image Pixel streamed run", 1 ); \
+  TEST_RUN( testImagePPMRead, "PPM Image read", 1 ); \
+  TEST_RUN( testImageFileWrite, "Image file write", 1 ); \
+  TEST_RUN( testArray2dSlab, "Array2d row block", 1 ); \
+  TEST_RUN( testPixelAccessPool, "PixelAccess ticket and array pool", 1 ); \
+  TEST_RUN( testMatrixShaper, "CMM matrix-shaper fast path", 1 ); \
+  TEST_RUN( testImageHalf, "CMM half float pixels", 1 ); \
+  TEST_RUN( testCLUT, "CMM 3D table renderer", 1 ); \
+  TEST_RUN( testFusedPoint, "Fused point filters", 1 ); \
   TEST_RUN( testRectangles, "Image Rectangles", 1 ); \
   TEST_RUN( testScreenPixel, "Draw Screen Pixel run", 1 ); \
   TEST_RUN( testFilterNode, "FilterNode Options", 1 ); \
@@ -2490,3267 +2512,5700 @@ oyTESTRESULT_e testProfileLists ()
   return result;
 }
 
-#include "oyProfile_s_.h"           /* oyProfile_ToFile_ */
-#include "oyranos_color.h"
+#include "oyranos_io.h"
+extern "C" {
+int oyProfileListCb_ (oyFileList_s * data, const char* full_name, const char* filename);
+}
 
-oyTESTRESULT_e testEffects ()
+/* the plain directory walk, which the profile index replaces */
+static char ** testProfileListWalk   ( uint32_t          * size )
+{
+  oyFileList_s l = {oyOBJECT_FILE_LIST_S_, 128, NULL, 0, 128, 0, 0};
+  int count = 0;
+  char ** path_names = oyProfilePathsGet_( &count, oyAllocateFunc_ );
+
+  l.names = (char**) oyAllocateFunc_( sizeof(char*) * l.mem_count );
+  oyRecursivePaths_( oyProfileListCb_, &l, (const char**)path_names, count );
+  oyStringListRelease_( &path_names, count, oyDeAllocateFunc_ );
+  *size = l.count_files;
+  return l.names;
+}
+
+/* the walk leaves equal file names from different paths unordered */
+static int testProfileNameCmp        ( const void        * a,
+                                       const void        * b )
+{
+  int r = oyStrcmpWrap( a, b );
+  return r ? r : strcmp( *(const char * const *)a, *(const char * const *)b );
+}
+
+static int testProfileListSame       ( char             ** a,
+                                       uint32_t            a_n,
+                                       char             ** b,
+                                       uint32_t            b_n )
+{
+  uint32_t i;
+  if(a_n != b_n)
+    return 0;
+  qsort( a, a_n, sizeof(char*), testProfileNameCmp );
+  qsort( b, b_n, sizeof(char*), testProfileNameCmp );
+  for(i = 0; i < a_n; ++i)
+    if(strcmp( a[i], b[i] ) != 0)
+      return 0;
+  return 1;
+}
+
+oyTESTRESULT_e testProfileIndex ()
 {
   oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
-  oyOptions_s * opts = oyOptions_New(testobj),
-              * result_opts = 0;
-  const char * text = 0;
-  oyProfile_s * prof = oyProfile_FromStd( oyEDITING_CMYK, 0, testobj ),
-              * abstract;
-  int error;
+  uint32_t ref_n = 0, n = 0;
+  char ** reference, ** names;
+  double clck_walk, clck_index, clck_file;
+  int i, repeat = 20;
 
   fprintf(stdout, "\n" );
 
-  error = oyOptions_MoveInStruct( &opts, "//" OY_TYPE_STD "/icc_profile.proofing_profile",
-                                  (oyStruct_s**) &prof, OY_CREATE_NEW );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_MoveInStruct() error: %d", error )
-  error = oyOptions_Handle( "//" OY_TYPE_STD "/create_profile.proofing_effect",
-                            opts,"create_profile.proofing_effect",
-                            &result_opts );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_Handle() error: %d", error )
-  abstract = (oyProfile_s*)oyOptions_GetType( result_opts, -1, "icc_profile",
-                                              oyOBJECT_PROFILE_S );
-  oyOptions_Release( &result_opts );
-  oyOptions_Release( &opts );
+  oyRemoveFile_( "test2_profile_index" );
+  oyProfileIndexSetFile_( "test2_profile_index" );
 
-  text = oyProfile_GetText( abstract, oyNAME_DESCRIPTION );
+  clck_walk = oyClock();
+  reference = testProfileListWalk( &ref_n );
+  clck_walk = oyClock() - clck_walk;
 
-  if(abstract)
-  {
-    PRINT_SUB( oyTESTRESULT_SUCCESS, 
-    "oyOptions_Handle(\"create_profile\"): %s", text );
-  } else if(error == -1)
-  {
-    PRINT_SUB( oyTESTRESULT_XFAIL,
-    "oyOptions_Handle(\"create_profile\") no" );
+  names = oyProfileListGet_( NULL, 0, &n );
+  if(ref_n && testProfileListSame( reference, ref_n, names, n ))
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyProfileListGet_() == directory walk %u", (unsigned)n );
   } else
-  {
-    PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyOptions_Handle(\"create_profile\") zero" );
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyProfileListGet_() == directory walk %u/%u", (unsigned)n, (unsigned)ref_n );
   }
+  oyStringListRelease_( &names, n, oyDeAllocateFunc_ );
 
-  oyProfile_ToFile_( (oyProfile_s_*)abstract, "test_proof_effect.icc" );
-  oyProfile_Release( &abstract );
-
-
-  double XYZ[3] = {-1, -1, -1};
-  double Lab[3], cie_a, cie_b, dst_cie_a, dst_cie_b;
-  error = oyGetDisplayWhitePoint( 2, XYZ );
-  oyXYZ2Lab( XYZ, Lab );
-  cie_a = Lab[1]/256.0+0.5; cie_b = Lab[2]/256.0+0.5;
-  error = oyGetDisplayWhitePoint( 5, XYZ );
-  oyXYZ2Lab( XYZ, Lab );
-  dst_cie_a = Lab[1]/256.0+0.5; dst_cie_b = Lab[2]/256.0+0.5;
-  error = oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/cie_a",
-                                   dst_cie_a - cie_a, 0, OY_CREATE_NEW );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_SetFromDouble() error: %d", error )
-  error = oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/cie_b",
-                                   dst_cie_b - cie_b, 0, OY_CREATE_NEW );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_SetFromDouble() error: %d", error )
-  fprintf(zout,"source white point cie_ab %g %g -> %g %g\n", cie_a, cie_b, dst_cie_a, dst_cie_b );
-  error = oyOptions_Handle( "//" OY_TYPE_STD "/create_profile.white_point_adjust.lab",
-                            opts,"create_profile.white_point_adjust.lab",
-                            &result_opts );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_Handle() error: %d", error )
-  abstract = (oyProfile_s*)oyOptions_GetType( result_opts, -1, "icc_profile",
-                                              oyOBJECT_PROFILE_S );
-  oyOptions_Release( &result_opts );
-  oyOptions_Release( &opts );
-
-  text = oyProfile_GetText( abstract, oyNAME_DESCRIPTION );
-
-  if(abstract)
-  {
-    PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyOptions_Handle(\"create_profile\"): %s", text );
-  } else if(error == -1)
-  {
-    PRINT_SUB( oyTESTRESULT_XFAIL,
-    "oyOptions_Handle(\"create_profile\") no" );
+  if(oyIsFile_( "test2_profile_index" ))
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "index written: %s", oyProfileIndexGetFile_() );
   } else
-  {
-    PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyOptions_Handle(\"create_profile\") zero" );
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "index written: %s", oyNoEmptyString_m_(oyProfileIndexGetFile_()) );
   }
-  oyProfile_ToFile_( (oyProfile_s_*)abstract, "test_wtpt_effect-lab.icc" );
-  oyProfile_Release( &abstract );
-
-
-  double        src_XYZ[3] = {0.0, 0.0, 0.0}, dst_XYZ[3] = {0.0, 0.0, 0.0};
-  error = oyGetDisplayWhitePoint( 2, src_XYZ );
-  error = oyGetDisplayWhitePoint( 5, dst_XYZ );
-  error = oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/src_iccXYZ", src_XYZ[0], 0, OY_CREATE_NEW );
-  error = oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/src_iccXYZ", src_XYZ[1], 1, OY_CREATE_NEW );
-  error = oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/src_iccXYZ", src_XYZ[2], 2, OY_CREATE_NEW );
-  error = oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/illu_iccXYZ", dst_XYZ[0], 0, OY_CREATE_NEW );
-  error = oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/illu_iccXYZ", dst_XYZ[1], 1, OY_CREATE_NEW );
-  error = oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/illu_iccXYZ", dst_XYZ[2], 2, OY_CREATE_NEW );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_SetFromDouble() error: %d", error )
-  fprintf(zout,"white point XYZ %g %g %g -> %g %g %g\n", src_XYZ[0], src_XYZ[1], src_XYZ[2], dst_XYZ[0], dst_XYZ[1], dst_XYZ[2] );
-  error = oyOptions_Handle( "//" OY_TYPE_STD "/create_profile.white_point_adjust.bradford",
-                            opts,"create_profile.white_point_adjust.bradford",
-                            &result_opts );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_Handle() error: %d", error )
-  abstract = (oyProfile_s*)oyOptions_GetType( result_opts, -1, "icc_profile",
-                                              oyOBJECT_PROFILE_S );
-  oyOptions_Release( &result_opts );
-  oyOptions_Release( &opts );
-
-  text = oyProfile_GetText( abstract, oyNAME_DESCRIPTION );
 
-  if(abstract)
-  {
-    PRINT_SUB( oyTESTRESULT_SUCCESS, 
-    "oyOptions_Handle(\"create_profile\"): %s", text );
-  } else if(error == -1)
+  clck_index = oyClock();
+  for(i = 0; i < repeat; ++i)
   {
-    PRINT_SUB( oyTESTRESULT_XFAIL,
-    "oyOptions_Handle(\"create_profile\") no" );
+    names = oyProfileListGet_( NULL, 0, &n );
+    oyStringListRelease_( &names, n, oyDeAllocateFunc_ );
+  }
+  clck_index = oyClock() - clck_index;
+
+  /* a new process starts from the file */
+  oyProfileIndexRelease_();
+  clck_file = oyClock();
+  names = oyProfileListGet_( NULL, 0, &n );
+  clck_file = oyClock() - clck_file;
+  if(testProfileListSame( reference, ref_n, names, n ))
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "index from file == directory walk %u", (unsigned)n );
   } else
-  {
-    PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyOptions_Handle(\"create_profile\") zero" );
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "index from file == directory walk %u/%u", (unsigned)n, (unsigned)ref_n );
   }
+  oyStringListRelease_( &names, n, oyDeAllocateFunc_ );
 
-  oyProfile_ToFile_( (oyProfile_s_*)abstract, "test_wtpt_effect-bradford.icc" );
-  oyProfile_Release( &abstract );
+  fprintf( zout, "walk: %s\n",
+           oyProfilingToString(1,clck_walk/(double)CLOCKS_PER_SEC, "calls") );
+  fprintf( zout, "index: %s\n",
+           oyProfilingToString(repeat,clck_index/(double)CLOCKS_PER_SEC, "calls") );
+  fprintf( zout, "index from file: %s\n",
+           oyProfilingToString(1,clck_file/(double)CLOCKS_PER_SEC, "calls") );
+
+  oyStringListRelease_( &reference, ref_n, oyDeAllocateFunc_ );
+
+  oyProfileIndexSetFile_( NULL );
+  oyRemoveFile_( "test2_profile_index" );
 
   return result;
 }
 
-#include "oyImage_s.h"
-#include "oyConversion_s.h"
-
-oyTESTRESULT_e testDeviceLinkProfile ()
+oyTESTRESULT_e testProfileFromMD5 ()
 {
   oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
-
-  double buf[24];
-  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
-                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
-  oyProfile_s * prof = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj ), *dl = 0;
-  oyImage_s * in = oyImage_Create( 2, 2, buf, OY_TYPE_123_DBL, prof, testobj );
-  oyImage_s * out = oyImage_CreateForDisplay( 2, 2, buf, OY_TYPE_123_DBL, 0,
-                                              0,0, 12,12,
-                                              icc_profile_flags, testobj );
-  oyOptions_s * options = NULL;
-  oyOptions_SetFromString( &options, OY_CMM_STD"/context", "lcm2", OY_CREATE_NEW );
-  oyConversion_s *cc = oyConversion_CreateBasicPixels( in, out, options, testobj );
-  oyFilterGraph_s * graph = NULL;
-  oyFilterNode_s * node = NULL;
-  oyBlob_s * blob = NULL;
-  int error = 0;
-  const char * fn = NULL,
-             * prof_fn = oyProfile_GetFileName( prof, -1 );
-  int i,n=0, len;
+  uint32_t n = 0, i, md5_found = 0, name_found = 0, checked = 0;
+  char ** names;
+  double clck;
 
   fprintf(stdout, "\n" );
 
-  fprintf(stdout, "creating DL from sRGB to CIE*XYZ\n" );
-
-  memset( buf, 0, sizeof(double)*24);
-
-  /*oyConversion_RunPixels( cc, 0 );*/
+  names = oyProfileListGet_( NULL, 0, &n );
 
-  if(cc)
-    graph = oyConversion_GetGraph( cc );
-  if(graph)
-    n = oyFilterGraph_CountEdges( graph );
-  for(i = 0; i < n; ++i)
-  {
-    node = oyFilterGraph_GetNode( graph, i, NULL, NULL );
-    blob = oyFilterNode_ToBlob( node, NULL );
-    if(blob && oyBlob_GetSize( blob ))
-    {
-      char name[64];
-      sprintf( name, "oy_dl_test_%d_", i );
-      len = strlen(name);
-      memcpy( &name[len], oyBlob_GetType( blob ), 4 );
-      name[len+4] = 0;
-      len = strlen(name);
-      sprintf( &name[len], ".icc" );
-      error = oyWriteMemToFile_( name, oyBlob_GetPointer( blob ),
-                                 oyBlob_GetSize( blob) );
-      if(!error)
-        fprintf(zout,"wrote: %s\n", name );
-      else
-        fprintf(zout,"writing failed: %s\n", name );
-      dl = oyProfile_FromMem( oyBlob_GetSize( blob ),
-                              oyBlob_GetPointer( blob ), 0,0 );
-    }
+  clck = oyClock();
+  for(i = 0; i < n && checked < 20; ++i)
+  {
+    oyProfile_s * p = oyProfile_FromFile( names[i], 0, testobj ), * q;
+    uint32_t md5[4], md5_q[4];
+    const char * t;
+    char * desc;
+
+    if(!p) continue;
+    ++checked;
+
+    oyProfile_GetMD5( p, 0, md5 );
+    q = oyProfile_FromMD5( md5, 0, testobj );
+    if(q && oyProfile_GetMD5( q, 0, md5_q ) == 0 &&
+       memcmp( md5, md5_q, 16 ) == 0)
+      ++md5_found;
+    oyProfile_Release( &q );
+
+    t = oyProfile_GetText( p, oyNAME_DESCRIPTION );
+    desc = oyStringCopy_( t, oyAllocateFunc_ );
+    q = oyProfile_FromName( desc, 0, testobj );
+    t = oyProfile_GetText( q, oyNAME_DESCRIPTION );
+    if(q && t && desc && strcmp( t, desc ) == 0)
+      ++name_found;
+    oyProfile_Release( &q );
+    oyFree_m_( desc );
 
-    oyBlob_Release( &blob );
-    oyFilterNode_Release( &node );
+    oyProfile_Release( &p );
   }
+  clck = oyClock() - clck;
 
-  fn = oyProfile_GetFileName( dl, 0 );
-  if(fn && prof_fn && strcmp(fn,prof_fn) == 0)
-  {
-    PRINT_SUB( oyTESTRESULT_SUCCESS, 
-    "oyProfile_GetFileName(dl, 0): %s", fn );
+  if(checked && md5_found == checked)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyProfile_FromMD5()                    %u/%u", md5_found, checked );
   } else
-  {
-    PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyProfile_GetFileName(dl, 0): %s  %s", oyNoEmptyString_m_(fn), oyNoEmptyString_m_(prof_fn) );
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyProfile_FromMD5()                    %u/%u", md5_found, checked );
   }
 
-  fn = oyProfile_GetFileName( dl, 1 );
-  if(fn)
-  {
-    PRINT_SUB( oyTESTRESULT_SUCCESS, 
-    "oyProfile_GetFileName(dl, 1): %s", fn );
+  if(checked && name_found == checked)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyProfile_FromName(description)        %u/%u", name_found, checked );
   } else
-  {
-    PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyProfile_GetFileName(dl, 1): %s", oyNoEmptyString_m_(fn) );
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyProfile_FromName(description)        %u/%u", name_found, checked );
   }
 
-  error = oyConversion_Release( &cc );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyConversion_Release() error: %d", error )
-  error = oyImage_Release( &in );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyImage_Release() error: %d", error )
-  error = oyImage_Release( &out );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyImage_Release() error: %d", error )
-  error = oyProfile_Release( &prof );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyProfile_Release() error: %d", error )
-  error = oyProfile_Release( &dl );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyProfile_Release() error: %d", error )
-  error = oyOptions_Release( &options );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_Release() error: %d", error )
-  error = oyFilterGraph_Release( &graph );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyFilterGraph_Release() error: %d", error )
+  fprintf( zout, "lookups: %s\n",
+           oyProfilingToString(checked*2,clck/(double)CLOCKS_PER_SEC, "calls") );
 
+  oyStringListRelease_( &names, n, oyDeAllocateFunc_ );
 
   return result;
 }
 
+/* the block of a installed profile */
+static char * testProfileBlockGet    ( size_t            * size )
+{
+  oyProfile_s * p = oyProfile_FromStd( oyASSUMED_WEB, 0, testobj );
+  char * block = NULL;
 
-/* make plain external project code happy */
-#define GLushort uint16_t
-#define GLuint uint32_t
-#define GLfloat float
-#define cicc_free oyFree_m_
-#define cdCreateTexture( ignore_opengl )
+  if(!p)
+  {
+    uint32_t n = 0;
+    char ** names = oyProfileListGet_( NULL, 0, &n );
+    if(n)
+      p = oyProfile_FromFile( names[0], 0, testobj );
+    oyStringListRelease_( &names, n, oyDeAllocateFunc_ );
+  }
+  if(p)
+    block = (char*) oyProfile_GetMem( p, size, 0, oyAllocateFunc_ );
+  oyProfile_Release( &p );
 
-#define CompLogLevelDebug oyMSG_WARN
-#define CompLogLevelWarn oyMSG_WARN
-#define CompLogLevelInfo oyMSG_DBG
-#define DBG_STRING OY_DBG_FORMAT_
-#define DBG_ARGS OY_DBG_ARGS_
-#define oyCompLogMessage(ignore, prog, level, format, ... ) \
-        oyMessageFunc_p( level,0, format, __VA_ARGS__)
-static oyStructList_s * oy_test_cache_ = NULL;
-oyStructList_s *   pluginGetPrivatesCache ( )
-{
-  if(!oy_test_cache_)
-    oy_test_cache_ = oyStructList_Create( oyOBJECT_NONE, "oy_test_cache_ p", 0 );
+  if(block && *size < 132)
+    oyFree_m_( block );
 
-  return oy_test_cache_;
+  return block;
 }
-void         oyTestCacheListClear_     ( )
+
+/* write a variant of block with a valid ICC ID; the reserved header bytes
+ * make the md5 unique */
+static int testProfileWriteVariant   ( const char        * name,
+                                       const char        * block,
+                                       size_t              size,
+                                       uint32_t            variant,
+                                       uint32_t          * md5 )
 {
-  oyStructList_Release( &oy_test_cache_ );
-}
+  char * mem = (char*) oyAllocateFunc_( size );
+  uint32_t v = oyValueUInt32( variant ), id[4];
+  oyProfile_s * p;
+  int i, error;
 
-/* taken from compicc.c f268e681e3b73004376e8d3ea9db4ae3e669fad8 20150227 */
-#define GRIDPOINTS 64
-typedef struct {
-  oyProfile_s * src_profile;         /* the data profile or device link */
-  oyProfile_s * dst_profile;         /* the monitor profile or none */
-  char * output_name;                /* the intented output device */
-  GLushort clut[GRIDPOINTS][GRIDPOINTS][GRIDPOINTS][3]; /* lookup table */
-  GLuint glTexture;                  /* texture reference */
-  GLfloat scale, offset;             /* texture parameters */
-  int ref;                           /* reference counter */
-} PrivColorContext;
+  memcpy( mem, block, size );
+  memset( &mem[84], 0, 16 );
+  memcpy( &mem[100], &v, 4 );
+  p = oyProfile_FromMem( size, mem, OY_NO_REPAIR, testobj );
+  error = !p || oyProfile_GetMD5( p, OY_COMPUTE, md5 ) > 0;
+  oyProfile_Release( &p );
 
-static int     setupColourTable      ( PrivColorContext  * ccontext,
-                                       int                 advanced )
-{
-  int dl_count = 0;
+  for(i = 0; i < 4; ++i)
+    id[i] = oyValueUInt32( md5[i] );
+  memcpy( &mem[84], id, 16 );
+  if(!error)
+    error = oyWriteMemToFile_( name, mem, size );
 
-  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
-                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
-  oyConversion_s * cc;
-  int error = 0;
-  oyProfile_s * dst_profile = ccontext->dst_profile, * web = 0;
+  oyFree_m_( mem );
+  return error;
+}
 
-    if(!ccontext->dst_profile)
-      dst_profile = web = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
+#include <utime.h>
 
+/* stamps from the current second are not trusted by the profile index */
+static void testFileSetTime          ( const char        * name,
+                                       time_t              t )
+{
+  struct utimbuf times;
+  times.actime = times.modtime = t;
+  utime( name, &times );
+}
 
-    {
-      int flags = 0;
-      int ** ptr;
+oyTESTRESULT_e testProfileIndexOverwrite ()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  const char * t = getenv("XDG_DATA_DIRS");
+  char * old_dirs = NULL, * env = NULL, * block, * dir, * path = NULL,
+       * name = NULL;
+  size_t size = 0;
+  uint32_t md5[4], md5_new[4];
+  time_t now = time(NULL);
+  oyProfile_s * p;
+  int error, found;
 
-      oyProfile_s * src_profile = ccontext->src_profile;
-      oyOptions_s * options = 0;
+  fprintf(stdout, "\n" );
 
-      oyPixel_t pixel_layout = OY_TYPE_123_16;
-      oyCompLogMessage(NULL, "compicc", CompLogLevelDebug,
-             DBG_STRING "%s -> %s",
-             DBG_ARGS, oyProfile_GetText( src_profile, oyNAME_DESCRIPTION ),
-                       oyProfile_GetText( dst_profile, oyNAME_DESCRIPTION ) );
+  block = testProfileBlockGet( &size );
+  if(!block)
+  { PRINT_SUB( oyTESTRESULT_XFAIL, "no profile found" );
+    return result;
+  }
 
-      /* skip web to web conversion */
-      if(oyProfile_Equal( src_profile, web ))
-      {
-        oyCompLogMessage(NULL, "compicc", CompLogLevelDebug,
-             DBG_STRING "src_profile == web",
-             DBG_ARGS );
-        goto clean_setupColourTable;
-      }
+  dir = oyGetTempFileName_( NULL, "test2_profiles", 0, oyAllocateFunc_ );
+  oyStringAddPrintf( &path, 0,0, "%s/color/icc/", dir );
+  oyStringAddPrintf( &name, 0,0, "%sp.icc", path );
+  error = !dir || oyMakeDir_( path );
+  if(!error)
+    error = testProfileWriteVariant( name, block, size, 1, md5 );
+  if(error)
+  { PRINT_SUB( oyTESTRESULT_XFAIL, "can not write %s", oyNoEmptyString_m_(name) );
+    oyFree_m_( name ); oyFree_m_( path ); oyFree_m_( dir ); oyFree_m_( block );
+    return result;
+  }
+  testFileSetTime( name, now - 100 );
+  testFileSetTime( path, now - 100 );
+
+  /* putenv() keeps the strings */
+  oyStringAddPrintf( &old_dirs, 0,0, "XDG_DATA_DIRS=%s", t ? t : "" );
+  oyStringAddPrintf( &env, 0,0, "XDG_DATA_DIRS=%s", dir );
+  putenv( env );
+  oyProfileIndexSetFile_( NULL );
+
+  p = oyProfile_FromMD5( md5, 0, testobj );
+  found = p && strcmp( oyNoEmptyString_m_(oyProfile_GetFileName( p, -1 )),
+                       name ) == 0;
+  oyProfile_Release( &p );
+  if(found)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyProfile_FromMD5() indexed            " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyProfile_FromMD5() indexed            " );
+  }
 
-      if(!src_profile)
-        src_profile = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
+  /* a recalibration keeps the file name and the directory mtime */
+  error = testProfileWriteVariant( name, block, size, 2, md5_new );
+  testFileSetTime( name, now - 50 );
+  testFileSetTime( path, now - 100 );
 
-      if(!src_profile)
-        oyCompLogMessage(NULL, "compicc", CompLogLevelWarn,
-             DBG_STRING "Output %s: no oyASSUMED_WEB src_profile",
-             DBG_ARGS, ccontext->output_name );
+  p = oyProfile_FromMD5( md5_new, 0, testobj );
+  found = p && strcmp( oyNoEmptyString_m_(oyProfile_GetFileName( p, -1 )),
+                       name ) == 0;
+  oyProfile_Release( &p );
+  if(!error && found)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyProfile_FromMD5() overwritten file   " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyProfile_FromMD5() overwritten file   " );
+  }
 
-      /* optionally set advanced options from Oyranos */
-      if(advanced)
-        flags = oyOPTIONATTRIBUTE_ADVANCED;
+  p = oyProfile_FromMD5( md5, 0, testobj );
+  if(!p)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyProfile_FromMD5() old md5 is gone    " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyProfile_FromMD5() old md5 is gone    " );
+  }
+  oyProfile_Release( &p );
 
-      oyCompLogMessage( NULL, "compicc", CompLogLevelDebug,
-                      DBG_STRING "oyConversion_Correct(///icc_color,%d,0) %s %s",
-                      DBG_ARGS, flags, ccontext->output_name,
-                      advanced?"advanced":"");
-      oyImage_s * image_in = oyImage_Create( GRIDPOINTS,GRIDPOINTS*GRIDPOINTS,
-                                             ccontext->clut,
-                                             pixel_layout, src_profile, testobj );
-      oyImage_s * image_out= oyImage_Create( GRIDPOINTS,GRIDPOINTS*GRIDPOINTS,
-                                             ccontext->clut,
-                                             pixel_layout, dst_profile, testobj );
+  putenv( old_dirs );
+  oyProfileIndexSetFile_( NULL );
+  oyRemoveFile_( name );
+  oyFree_m_( name );
+  oyStringAddPrintf( &name, 0,0, "%s/color/icc", dir );
+  remove( name );
+  oyFree_m_( name );
+  oyStringAddPrintf( &name, 0,0, "%s/color", dir );
+  remove( name );
+  oyFree_m_( name );
+  remove( dir );
+  oyFree_m_( path );
+  oyFree_m_( dir );
+  oyFree_m_( block );
 
-      oyProfile_Release( &src_profile );
+  return result;
+}
 
-      oyOptions_SetFromString( &options, "org/oyranos/cmm/any/cached", "1", OY_CREATE_NEW );
-      cc = oyConversion_CreateBasicPixels( image_in, image_out, options, testobj );
-      if (cc == NULL)
-      {
-        oyCompLogMessage( NULL, "compicc", CompLogLevelWarn,
-                      DBG_STRING "no conversion created for %s",
-                      DBG_ARGS, ccontext->output_name);
-        goto clean_setupColourTable;
-      }
-      oyOptions_Release( &options );
+/* write n profiles with n/2 different md5 sums below dir/color/icc/ */
+static int testProfilesWriteDir      ( const char        * dir,
+                                       const char        * block,
+                                       size_t              size,
+                                       int                 n )
+{
+  char * path = NULL, * name = NULL, * mem;
+  int i, error;
 
-      oyOptions_SetFromString( &options,
-                                     "//" OY_TYPE_STD "/config/display_mode", "1",
-                                     OY_CREATE_NEW );
-      error = oyConversion_Correct(cc, "//" OY_TYPE_STD "/icc_color", flags, options);
-      if(error > 0)
-      {
-        oyCompLogMessage( NULL, "compicc", CompLogLevelWarn,
-                      DBG_STRING "oyConversion_Correct(///icc_color,%d,0) failed %s, %d",
-                      DBG_ARGS, flags, ccontext->output_name, error);
-        goto clean_setupColourTable;
-      }
-      oyOptions_Release( &options );
+  oyStringAddPrintf( &path, 0,0, "%s/color/icc/", dir );
+  error = oyMakeDir_( path );
+  mem = (char*) oyAllocateFunc_( size );
+  memcpy( mem, block, size );
+  /* no embedded ID; the reserved header bytes make the md5 unique */
+  memset( &mem[84], 0, 16 );
 
-      oyFilterGraph_s * cc_graph = oyConversion_GetGraph( cc );
-      oyFilterNode_s * icc = oyFilterGraph_GetNode( cc_graph, -1, "///icc_color", 0 );
-      oyBlob_s * blob = oyFilterNode_ToBlob( icc, testobj );
+  for(i = 0; i < n && !error; ++i)
+  {
+    uint32_t v = oyValueUInt32( (uint32_t)(i / 2) );
+    memcpy( &mem[100], &v, 4 );
+    oyStringAddPrintf( &name, 0,0, "%sp%d.icc", path, i );
+    error = oyWriteMemToFile_( name, mem, size );
+    oyFree_m_( name );
+  }
 
-      if(!blob)
-      {
-        oyConversion_Release( &cc );
-        oyFilterNode_Release( &icc );
+  oyFree_m_( mem );
+  oyFree_m_( path );
+  return error;
+}
 
-        oyOptions_SetFromString( &options, OY_DEFAULT_CMM_CONTEXT, "lcm2", OY_CREATE_NEW );
-        cc = oyConversion_CreateBasicPixels( image_in, image_out, options, testobj );
-        if (cc == NULL)
-        {
-          oyCompLogMessage( NULL, "compicc", CompLogLevelWarn,
-                      DBG_STRING "no conversion created for %s",
-                      DBG_ARGS, ccontext->output_name);
-          goto clean_setupColourTable;
-        }
-        oyOptions_Release( &options );
-        oyOptions_SetFromString( &options,
-                                     "//" OY_TYPE_STD "/config/display_mode", "1",
-                                     OY_CREATE_NEW );
-        error = oyConversion_Correct(cc, "//" OY_TYPE_STD "/icc_color", flags, options);
-        icc = oyFilterGraph_GetNode( cc_graph, -1, "///icc_color", 0 );
-        blob = oyFilterNode_ToBlob( icc, NULL );
-      }
+static void testProfilesRemoveDir    ( const char        * dir,
+                                       int                 n )
+{
+  char * name = NULL;
+  int i;
 
-      {
-        oyOptions_s * node_opts = oyFilterNode_GetOptions( icc, 0 );
-        oyProfile_s * dl;
-        dl = oyProfile_FromMem( oyBlob_GetSize( blob ),
-                                oyBlob_GetPointer( blob ), 0,testobj );
-        const char * fn;
-        int j = 0;
-        while((fn = oyProfile_GetFileName( dl, j )) != NULL)
-        {
-          fprintf( zout, " -> \"%s\"[%d]", fn, j );
-          ++j;
-        }
-        dl_count = j;
-        fprintf( zout, " %d\n", dl_count );
-        if(oy_debug) fprintf( zout, "%s\n", oyOptions_GetText( node_opts, oyNAME_NAME ) );
-      }
+  for(i = 0; i < n; ++i)
+  {
+    oyStringAddPrintf( &name, 0,0, "%s/color/icc/p%d.icc", dir, i );
+    oyRemoveFile_( name );
+    oyFree_m_( name );
+  }
+  oyStringAddPrintf( &name, 0,0, "%s/color/icc", dir );
+  remove( name );
+  oyFree_m_( name );
+  oyStringAddPrintf( &name, 0,0, "%s/color", dir );
+  remove( name );
+  oyFree_m_( name );
+  remove( dir );
+}
 
-      uint32_t exact_hash_size = 0;
-      char * hash_text = 0;
-      const char * t = 0;
-      {
-        t = oyFilterNode_GetText( icc, oyNAME_NAME );
-        if(t)
-          hash_text = strdup(t);
-        if(oy_debug)
-          fprintf( zout, " hash_text = %s", oyNoEmptyString_m_(t) );
-      }
-      oyHash_s * entry;
-      oyArray2d_s * clut = NULL;
-      oyStructList_s * cache = pluginGetPrivatesCache();
-      entry = oyStructList_GetHash( cache, exact_hash_size, hash_text );
-      clut = (oyArray2d_s*) oyHash_GetPointer( entry, oyOBJECT_ARRAY2D_S);
-      oyFilterNode_Release( &icc );
-      oyFilterGraph_Release( &cc_graph );
+/* count the profiles below dir */
+static int testProfilesCountIn       ( oyProfiles_s      * profiles,
+                                       const char        * dir )
+{
+  int i, n = oyProfiles_Count( profiles ), count = 0;
 
-      if(oy_debug)
-      oyCompLogMessage( NULL, "compicc", CompLogLevelDebug,
-                      DBG_STRING "clut from cache %s %s",
-                      DBG_ARGS, clut?"obtained":"", oyNoEmptyString_m_(hash_text) );
-      if(clut)
-      {
-        ptr = (int**)oyArray2d_GetData(clut);
-        memcpy( ccontext->clut, ptr[0], 
-                sizeof(GLushort) * GRIDPOINTS*GRIDPOINTS*GRIDPOINTS * 3 );
-      } else
-      {
-        uint16_t in[3];
-        for (int r = 0; r < GRIDPOINTS; ++r)
-        {
-          in[0] = floor((double) r / (GRIDPOINTS - 1) * 65535.0 + 0.5);
-          for (int g = 0; g < GRIDPOINTS; ++g) {
-            in[1] = floor((double) g / (GRIDPOINTS - 1) * 65535.0 + 0.5);
-            for (int b = 0; b < GRIDPOINTS; ++b)
-            {
-              in[2] = floor((double) b / (GRIDPOINTS - 1) * 65535.0 + 0.5);
-              for(int j = 0; j < 3; ++j)
-                /* BGR */
-                ccontext->clut[b][g][r][j] = in[j];
-            }
-          }
-        }
+  for(i = 0; i < n; ++i)
+  {
+    oyProfile_s * p = oyProfiles_Get( profiles, i );
+    const char * fn = oyProfile_GetFileName( p, -1 );
+    if(fn && strstr( fn, dir ))
+      ++count;
+    oyProfile_Release( &p );
+  }
 
-        clut = oyArray2d_Create( NULL, GRIDPOINTS*3, GRIDPOINTS*GRIDPOINTS,
-                                 oyUINT16, testobj );
+  return count;
+}
 
-        error = oyConversion_RunPixels( cc, 0 );
+oyTESTRESULT_e testProfilesCreate ()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  /* 10000 profiles only with OY_TEST_LARGE set */
+  int sizes[3] = { 100, 1000, 10000 }, i,
+      sizes_n = getenv("OY_TEST_LARGE") ? 3 : 2;
+  const char * t = getenv("XDG_DATA_DIRS");
+  char * old_dirs = NULL, * env = NULL, * block = NULL;
+  size_t size = 0;
 
-        if(error)
-        {
-          oyCompLogMessage( NULL, "compicc", CompLogLevelWarn,
-                      DBG_STRING "oyConversion_RunPixels() error: %d %s",
-                      DBG_ARGS, error, ccontext->output_name);
-          goto clean_setupColourTable;
-        }
+  fprintf(stdout, "\n" );
 
-        ptr = (int**)oyArray2d_GetData(clut);
-        memcpy( ptr[0], ccontext->clut,
-                sizeof(GLushort) * GRIDPOINTS*GRIDPOINTS*GRIDPOINTS * 3 );
+  block = testProfileBlockGet( &size );
+  if(!block)
+  { PRINT_SUB( oyTESTRESULT_XFAIL, "no profile found" );
+    return result;
+  }
 
-        oyHash_SetPointer( entry, (oyStruct_s*) clut );
-      }
+  /* putenv() keeps the strings */
+  oyStringAddPrintf( &old_dirs, 0,0, "XDG_DATA_DIRS=%s", t ? t : "" );
 
-      if(hash_text)
-      {
-        cicc_free(hash_text); hash_text = 0;
-      }
+  for(i = 0; i < sizes_n; ++i)
+  {
+    int n = sizes[i], count, count_all;
+    char * dir = NULL, * dir_full;
+    oyProfiles_s * profiles;
+    double clck, clck_load;
 
+    dir = oyGetTempFileName_( NULL, "test2_profiles", 0, oyAllocateFunc_ );
+    if(!dir || testProfilesWriteDir( dir, block, size, n ))
+    { PRINT_SUB( oyTESTRESULT_XFAIL, "can not write %s", oyNoEmptyString_m_(dir) );
+      if(dir)
+        testProfilesRemoveDir( dir, n );
+      oyFree_m_( dir );
+      break;
+    }
+    dir_full = oyResolveDirFileName_( dir );
 
-      oyOptions_Release( &options );
-      oyImage_Release( &image_in );
-      oyImage_Release( &image_out );
-      oyConversion_Release( &cc );
+    env = NULL;
+    oyStringAddPrintf( &env, 0,0, "XDG_DATA_DIRS=%s", dir_full );
+    putenv( env );
 
-      cdCreateTexture( ccontext );
+    clck_load = oyClock();
+    profiles = oyProfiles_Create( NULL, OY_NO_REPAIR, testobj );
+    clck_load = oyClock() - clck_load;
+    oyProfiles_Release( &profiles );
 
-    }
+    /* the profiles are cached now; measure the filtering */
+    clck = oyClock();
+    profiles = oyProfiles_Create( NULL, OY_NO_REPAIR, testobj );
+    clck = oyClock() - clck;
+    count = testProfilesCountIn( profiles, dir_full );
+    oyProfiles_Release( &profiles );
 
-    if(!ccontext->dst_profile)
-    {
-      oyCompLogMessage( NULL, "compicc", CompLogLevelInfo,
-                      DBG_STRING "Output \"%s\": no profile",
-                      DBG_ARGS, ccontext->output_name);
-    }
+    profiles = oyProfiles_Create( NULL, OY_NO_REPAIR | OY_ALLOW_DUPLICATES,
+                                  testobj );
+    count_all = testProfilesCountIn( profiles, dir_full );
+    oyProfiles_Release( &profiles );
 
-    clean_setupColourTable:
-    if(web)
-      oyProfile_Release( &web );
-
-  return dl_count;
-}
-
-oyTESTRESULT_e testClut ()
-{
-  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
-
-  fprintf(stdout, "\n" );
-
-  oyTestCacheListClear_();
-
-  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
-                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
-  PrivColorContext pc = {
-    oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, NULL ), /* the data profile or device link */
-    oyProfile_FromFile( "compatibleWithAdobeRGB1998.icc", icc_profile_flags, NULL ), /* the monitor profile or none */
-    oyStringCopy( "*TEST*", oyAllocateFunc_ ), /* the intented output device */
-    {{{0}}},
-    0,
-    0,0,
-    0
-  };
-  double clck = oyClock();
-  int dl_count = setupColourTable( &pc, 0 );
-  int r=12,g=12,b=2;
-  clck = oyClock() - clck;
-  uint16_t c[3] = {pc.clut[r][g][b][0],pc.clut[r][g][b][1],pc.clut[r][g][b][2]};
-  fprintf(zout, "compatibleWithAdobeRGB1998.icc %d,%d,%d\n", pc.clut[r][g][b][0],pc.clut[r][g][b][1],pc.clut[r][g][b][2]);
+    if(count == n / 2 && count_all == n)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyProfiles_Create() %5d -> %5d %s", n, count,
+      oyProfilingToString(n,clck/(double)CLOCKS_PER_SEC, "profiles") );
+      fprintf( zout, "  first call: %s\n",
+           oyProfilingToString(n,clck_load/(double)CLOCKS_PER_SEC, "profiles") );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyProfiles_Create() %5d -> %5d/%d (%d)", n, count, n / 2, count_all );
+    }
 
-  int count = oyStructList_Count( oy_test_cache_ );
-  if( count )
-  { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "clut cached            %d %s", count,
-                   oyProfilingToString(1,clck/(double)CLOCKS_PER_SEC,"Tex"));
-  } else
-  { PRINT_SUB( oyTESTRESULT_FAIL,
-    "clut cache empty                      " );
+    putenv( old_dirs );
+    testProfilesRemoveDir( dir, n );
+    oyFree_m_( dir_full );
+    oyFree_m_( dir );
   }
-  oyProfile_Release( &pc.dst_profile );
-
-
-  // test outside DB change
-  char * old_daemon = oyGetPersistentString(OY_DEFAULT_DISPLAY_WHITE_POINT_DAEMON, 0, oySCOPE_USER_SYS, 0);
-  int old_display_white_point = oyGetBehaviour( oyBEHAVIOUR_DISPLAY_WHITE_POINT );
-  char * value = NULL;
-  oyStringAddPrintf( &value, oyAllocateFunc_, oyDeAllocateFunc_,
-                     "%d", old_display_white_point != 0 ? 0 : 7 );
-  oyDBSetString( OY_DEFAULT_DISPLAY_WHITE_POINT_DAEMON, oySCOPE_USER,
-                 old_daemon ? NULL : "oyranos-monitor-white-point",
-                 "testing");
-  oyDBSetString( OY_DEFAULT_DISPLAY_WHITE_POINT, oySCOPE_USER, value,
-                 "testing");
-  /* clear the DB cache */
-  oyGetPersistentStrings( NULL );
-  int display_white_point = oyGetBehaviour( oyBEHAVIOUR_DISPLAY_WHITE_POINT );
-  fprintf(zout, "old_value: %d -> setting oyBEHAVIOUR_DISPLAY_WHITE_POINT: %s  check %d\n", old_display_white_point, value, display_white_point );
-  oyFree_m_( value );
 
+  oyFree_m_( block );
 
-  pc.dst_profile = oyProfile_FromFile( "LStar-RGB.icc", icc_profile_flags, testobj );
-  int dl_count2 = setupColourTable( &pc, 0 ); 
-  fprintf(zout, "LStar-RGB.icc %d,%d,%d\n", pc.clut[r][g][b][0],pc.clut[r][g][b][1],pc.clut[r][g][b][2]);
-  count = oyStructList_Count( oy_test_cache_ );
-  if( !(c[0] == pc.clut[r][g][b][0] || c[1] == pc.clut[r][g][b][1] || c[2] == pc.clut[r][g][b][2]) &&
-      count > 1 && dl_count != dl_count2)
-  { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "cache difference                %d %d!=%d", count, dl_count, dl_count2 );
-  } else
-  { PRINT_SUB( oyTESTRESULT_XFAIL,
-    "cache difference                %d %d!=%d", count, dl_count, dl_count2 );
-  }
+  return result;
+}
 
+#include "oyProfile_s_.h"           /* oyProfile_ToFile_ */
+#include "oyranos_color.h"
 
-  // reset to old value
-  oySetBehaviour( oyBEHAVIOUR_DISPLAY_WHITE_POINT, oySCOPE_USER, old_display_white_point );
-  if(old_daemon)
+/* insert pad bytes between the tag table and the tag data */
+static char * testProfileLazyPad     ( const char        * block,
+                                       size_t              size,
+                                       size_t              pad,
+                                       size_t            * padded_size )
+{
+  uint32_t count, i, v;
+  size_t table_end;
+  char * mem;
+
+  memcpy( &count, &block[128], 4 );
+  count = oyValueUInt32( count );
+  table_end = 132 + count * 12;
+  if(table_end > size)
+    return NULL;
+
+  *padded_size = size + pad;
+  mem = (char*) oyAllocateFunc_( *padded_size );
+  memset( mem, 0, *padded_size );
+  memcpy( mem, block, table_end );
+  memcpy( &mem[table_end + pad], &block[table_end], size - table_end );
+
+  v = oyValueUInt32( (uint32_t)*padded_size );
+  memcpy( &mem[0], &v, 4 );
+  for(i = 0; i < count; ++i)
   {
-    oySetPersistentString( OY_DEFAULT_DISPLAY_WHITE_POINT_DAEMON, oySCOPE_USER, old_daemon, NULL);
-    oyFree_m_(old_daemon);
+    memcpy( &v, &mem[132 + i*12 + 4], 4 );
+    v = oyValueUInt32( oyValueUInt32( v ) + (uint32_t)pad );
+    memcpy( &mem[132 + i*12 + 4], &v, 4 );
   }
-  return result;
-}
+  /* let oyProfile_GetMem() write a new ID */
+  memset( &mem[84], 0, 16 );
 
+  return mem;
+}
 
-oyTESTRESULT_e testRegistrationMatch ()
+oyTESTRESULT_e testProfileLazy ()
 {
   oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  oyProfile_s * p = oyProfile_FromStd( oyASSUMED_WEB, 0, testobj ), * q;
+  oyProfile_s_ * s;
+  char * block = NULL, * padded = NULL, * data = NULL, * desc = NULL,
+       * full_name = NULL;
+  const char * name = "test2_lazy.icc", * t;
+  size_t size = 0, padded_size = 0, data_size = 0;
+  int i, n = 100, tags_n;
+  double clck;
 
   fprintf(stdout, "\n" );
 
-  if( oyFilterRegistrationMatch(OY_INTERNAL "/icc_color.lcms",
-                                "//" OY_TYPE_STD "/icc_color",
-                                oyOBJECT_CMM_API4_S ))
-  { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "simple CMM selection                  " );
-  } else
-  { PRINT_SUB( oyTESTRESULT_FAIL,
-    "simple CMM selection                  " );
-  }
-
-  if(!oyFilterRegistrationMatch(OY_INTERNAL "/icc_color.lcms",
-                                "//" OY_TYPE_STD "/icc_color.octl",
-                                oyOBJECT_CMM_API4_S ))
-  { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "simple CMM selection no match         " );
-  } else
-  { PRINT_SUB( oyTESTRESULT_FAIL,
-    "simple CMM selection no match         " );
-  }
-
-  if( oyFilterRegistrationMatch(OY_INTERNAL "/icc_color.lcms",
-                                "//" OY_TYPE_STD "/icc_color.4+lcms",
-                                oyOBJECT_CMM_API4_S ))
-  { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "special CMM selection                 " );
-  } else
-  { PRINT_SUB( oyTESTRESULT_FAIL,
-    "special CMM selection                 " );
+  if(p)
+  {
+    block = (char*) oyProfile_GetMem( p, &size, 0, oyAllocateFunc_ );
+    t = oyProfile_GetText( p, oyNAME_DESCRIPTION );
+    desc = oyStringCopy( t, oyAllocateFunc_ );
   }
+  oyProfile_Release( &p );
+  if(block && size >= 132)
+    padded = testProfileLazyPad( block, size, 8192, &padded_size );
+  if(!padded || !desc)
+  { PRINT_SUB( oyTESTRESULT_XFAIL, "no profile found" );
+    oyFree_m_( block );
+    oyFree_m_( desc );
+    return result;
+  }
+
+  p = oyProfile_FromMem( padded_size, padded, 0, testobj );
+  oyFree_m_( padded );
+  padded = (char*) oyProfile_GetMem( p, &padded_size, 0, oyAllocateFunc_ );
+  tags_n = oyProfile_GetTagCount( p );
+  oyProfile_Release( &p );
+  oyWriteMemToFile_( name, padded, padded_size );
+  full_name = oyResolveDirFileName_( name );
 
-  if(!oyFilterRegistrationMatch(OY_INTERNAL "/icc_color.lcms",
-                                "//" OY_TYPE_STD "/icc_color.4-lcms",
-                                oyOBJECT_CMM_API4_S ))
+  p = oyProfile_FromFile( full_name, OY_NO_CACHE_READ | OY_NO_CACHE_WRITE,
+                          testobj );
+  s = (oyProfile_s_*) p;
+  if(s && s->lazy_ && s->lazy_ < padded_size &&
+     oyProfile_GetSize( p, 0 ) == padded_size)
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "special CMM avoiding                  " );
+    "oyProfile_FromFile() header + tag table %d/%d", (int)s->lazy_, (int)padded_size );
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "special CMM avoiding                  " );
+    "oyProfile_FromFile() header + tag table %d/%d", s?(int)s->lazy_:0, (int)padded_size );
   }
 
-  if( oyFilterRegistrationMatch(OY_INTERNAL "/icc_color.lcms",
-                                "//" OY_TYPE_STD "/icc_color.7-lcms",
-                                oyOBJECT_CMM_API4_S ))
+  t = oyProfile_GetText( p, oyNAME_DESCRIPTION );
+  if(s && t && strcmp( t, desc ) == 0 && s->lazy_)
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "special CMM avoiding, other API       " );
+    "oyProfile_GetText() tag from disk       %s", t );
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "special CMM avoiding, other API       " );
+    "oyProfile_GetText() tag from disk       %s", oyNoEmptyString_m_(t) );
   }
 
-  if( oyFilterRegistrationMatch("org/freedesktop/openicc/device/monitor/manufacturer",
-                                "org/freedesktop/openicc/device/monitor/model",
-                                oyOBJECT_NONE ) == 0)
+  data = (char*) oyProfile_GetMem( p, &data_size, 0, oyAllocateFunc_ );
+  if(s && !s->lazy_ && data && data_size == padded_size &&
+     memcmp( data, padded, data_size ) == 0 &&
+     oyProfile_GetTagCount( p ) == tags_n)
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "device key mismatch                   " );
+    "oyProfile_GetMem() full load            %d", (int)data_size );
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "device key mismatch                   " );
+    "oyProfile_GetMem() full load            %d", (int)data_size );
   }
+  oyFree_m_( data );
+  oyProfile_Release( &p );
 
-  if( oyFilterRegistrationMatch("org/freedesktop/openicc/device/monitor/manufacturer",
-                                "org/freedesktop/openicc/device/monitor/manufacturer",
-                                oyOBJECT_NONE ))
-  { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "device key match                      " );
-  } else
-  { PRINT_SUB( oyTESTRESULT_FAIL,
-    "device key match                      " );
+  clck = oyClock();
+  for(i = 0; i < n; ++i)
+  {
+    p = oyProfile_FromFile( full_name, OY_NO_CACHE_READ | OY_NO_CACHE_WRITE,
+                            testobj );
+    oyProfile_GetText( p, oyNAME_DESCRIPTION );
+    oyProfile_Release( &p );
   }
+  clck = oyClock() - clck;
+  fprintf( zout, "open + description: %s\n",
+           oyProfilingToString(n,clck/(double)CLOCKS_PER_SEC, "profiles") );
 
-  if( oyFilterRegistrationMatch("org/freedesktop/openicc/device/monitor/manufacturer/short",
-                                "org/freedesktop/openicc/device/monitor/manufacturer/full",
-                                oyOBJECT_NONE ) == 0)
+  /* the file grows behind the header read */
+  p = oyProfile_FromFile( full_name, OY_NO_CACHE_READ, NULL );
+  data = (char*) oyAllocateFunc_( padded_size + 4 );
+  memcpy( data, padded, padded_size );
+  memset( &data[padded_size], 0, 4 );
+  oyWriteMemToFile_( name, data, padded_size + 4 );
+  oyFree_m_( data );
+  data = (char*) oyProfile_GetMem( p, &data_size, 0, oyAllocateFunc_ );
+  s = (oyProfile_s_*) p;
+  if(s && !data && !s->block_)
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "long device key mismatch              " );
+    "oyProfile_GetMem() changed file fails   " );
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "long device key mismatch              " );
+    "oyProfile_GetMem() changed file fails   %d", (int)data_size );
   }
+  oyFree_m_( data );
 
-  if( oyFilterRegistrationMatch("org/freedesktop/openicc/device/monitor/manufacturer/short",
-                                "org/freedesktop/openicc/device/monitor/manufacturer/short",
-                                oyOBJECT_NONE ))
+  /* the failed profile left the file cache */
+  q = oyProfile_FromFile( full_name, 0, NULL );
+  data = (char*) oyProfile_GetMem( q, &data_size, 0, oyAllocateFunc_ );
+  if(q && q != p && data && data_size >= padded_size)
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "long device key match                 " );
+    "oyProfile_FromFile() after failed load  %d", (int)data_size );
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "long device key match                 " );
+    "oyProfile_FromFile() after failed load  %d", (int)data_size );
   }
+  oyFree_m_( data );
+  oyProfile_Release( &q );
+  oyProfile_Release( &p );
 
-  if( oyFilterStringMatch( "abc-def-ghi",
-                           "+def._ghi.-jkl", oyOBJECT_NONE, '/', '.',
-                           OY_MATCH_SUB_STRING ))
-  { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyFilterStringMatch(sub string match) " );
-  } else
-  { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyFilterStringMatch(sub string match) " );
-  }
+  remove( name );
+  oyFree_m_( full_name );
+  oyFree_m_( padded );
+  oyFree_m_( block );
+  oyFree_m_( desc );
 
   return result;
 }
 
-#include "oyranos_object_internal.h"
-oyTESTRESULT_e test_oyTextIccDictMatch ()
+oyTESTRESULT_e testProfileMap ()
 {
   oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  oyProfile_s * p = oyProfile_FromStd( oyASSUMED_WEB, 0, testobj );
+  oyProfile_s_ * s;
+  char * file_name = NULL, * file_data = NULL, * data = NULL, * desc = NULL;
+  const char * t;
+  size_t file_size = 0, size = 0;
 
   fprintf(stdout, "\n" );
 
-  if( oyTextIccDictMatch("ABC",
-                         "ABC", 0, '/', ','))
-  { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "simple text matching                  " );
-  } else
-  { PRINT_SUB( oyTESTRESULT_FAIL,
-    "simple text matching                  " );
+  if(p)
+  {
+    t = oyProfile_GetFileName( p, -1 );
+    file_name = oyStringCopy( t, oyAllocateFunc_ );
+    t = oyProfile_GetText( p, oyNAME_DESCRIPTION );
+    desc = oyStringCopy( t, oyAllocateFunc_ );
   }
-
-  if(!oyTextIccDictMatch("ABC",
-                         "ABCD", 0, '/', ','))
-  { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "simple text mismatching               " );
-  } else
-  { PRINT_SUB( oyTESTRESULT_FAIL,
-    "simple text mismatching               " );
+  oyProfile_Release( &p );
+  if(file_name)
+    file_data = oyReadFileToMem_( file_name, &file_size, oyAllocateFunc_ );
+  if(!file_data || !desc)
+  { PRINT_SUB( oyTESTRESULT_XFAIL, "no profile found" );
+    oyFree_m_( file_name );
+    oyFree_m_( desc );
+    return result;
   }
 
-  if( oyTextIccDictMatch("abcd,ABC,efgh",
-                         "abcdef,12345,ABC", 0, '/', ','))
+  p = oyProfile_FromFile( file_name, OY_MAP_FILE | OY_NO_CACHE_READ |
+                          OY_NO_CACHE_WRITE, testobj );
+  s = (oyProfile_s_*) p;
+  if(s && s->map_size_ == file_size)
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "multiple text matching                " );
+    "oyProfile_FromFile(OY_MAP_FILE)         %d", (int)s->map_size_ );
   } else
-  { PRINT_SUB( oyTESTRESULT_FAIL,
-    "multiple text matching                " );
+  { PRINT_SUB( oyTESTRESULT_XFAIL,
+    "oyProfile_FromFile(OY_MAP_FILE) no mmap %s", oyNoEmptyString_m_(file_name) );
   }
 
-  if( oyTextIccDictMatch("abcd,ABC,efgh,12345",
-                         "abcdef,12345,ABCD", 0.0005, '/', ','))
+  t = oyProfile_GetText( p, oyNAME_DESCRIPTION );
+  data = (char*) oyProfile_GetMem( p, &size, 0, oyAllocateFunc_ );
+  /* the ICC ID at byte 84 is written by oyProfile_GetMem() */
+  if(t && strcmp( t, desc ) == 0 && data && size == file_size &&
+     size > 100 && memcmp( data, file_data, 84 ) == 0 &&
+     memcmp( &data[100], &file_data[100], size - 100 ) == 0)
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "multiple integer matching             " );
+    "oyProfile_GetMem() from mapping         %d", (int)size );
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "multiple integer matching             " );
+    "oyProfile_GetMem() from mapping         %d", (int)size );
   }
+  oyFree_m_( data );
 
-  if(!oyTextIccDictMatch("abcd,ABC,efgh,12345",
-                         "abcdef,12345ABCD", 0.0005, '/', ','))
+  /* header changes need a private copy */
+  if(oyProfile_SetSignature( p, icSigDisplayClass, oySIGNATURE_CLASS ) == 0 &&
+     s && s->map_size_ == 0 &&
+     oyProfile_GetSignature( p, oySIGNATURE_CLASS ) == icSigDisplayClass)
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "multiple integer mismatching          " );
+    "oyProfile_SetSignature() on mapping      " );
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "multiple integer mismatching          " );
+    "oyProfile_SetSignature() on mapping      " );
   }
+  oyProfile_Release( &p );
 
-  if( oyTextIccDictMatch("abcd,ABC,efgh,123.45001",
-                         "abcdef,123.45,ABCD", 0.0005, '/', ','))
-  { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "multiple float matching               " );
-  } else
-  { PRINT_SUB( oyTESTRESULT_FAIL,
-    "multiple float matching               " );
-  }
+  oyFree_m_( file_data );
+  oyFree_m_( file_name );
+  oyFree_m_( desc );
 
-  if(!oyTextIccDictMatch("abcd,ABC,efgh,123.45",
-                         "abcdef,123", 0.0005, '/', ','))
-  { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "multiple float mismatching            " );
-  } else
-  { PRINT_SUB( oyTESTRESULT_FAIL,
-    "multiple float mismatching            " );
-  }
   return result;
 }
 
-oyTESTRESULT_e testPolicy ()
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+oyTESTRESULT_e testProfileRefs ()
 {
   oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
-  char *data = 0;
+  oyProfile_s * p = oyProfile_FromStd( oyASSUMED_WEB, 0, testobj );
+  int refs, i, n = 1000000, threads, max_threads = 1;
 
   fprintf(stdout, "\n" );
 
-#if 0
-  if(argc > 1)
+  if(!p)
+    p = oyProfile_New( testobj );
+  refs = oyObject_GetRefCount( p->oy_ );
+
+#if defined(_OPENMP)
+  max_threads = omp_get_num_procs();
+  if(max_threads < 4)
+    max_threads = 4;
+#endif
+
+  /* all threads copy and release the same profile */
+  for(threads = 1; threads <= max_threads; threads *= 2)
   {
-    fprintf(zout,"%s\n", argv[1]);
-    std::ifstream f( argv[1], std::ios::binary | std::ios::ate);
-    if(f.good())
+    double clck = oyClock();
+#if defined(_OPENMP)
+#pragma omp parallel for num_threads(threads)
+#endif
+    for(i = 0; i < n; ++i)
     {
-      size_t size = f.tellg();
-      f.seekg(0);
-      if(size) {
-        data = (char*) new char [size+1];
-        f.read ((char*)data, size);
-        f.close();
-        std::cout << "Opened file: " << argv[1] << std::endl;
-      }
+      oyProfile_s * copy = oyProfile_Copy( p, NULL );
+      oyProfile_Release( &copy );
     }
-  }
-#endif
-
-  char *xml = data;
-  if( !xml)
-    xml = oyPolicyToXML( oyGROUP_ALL, 1, myAllocFunc );
+    clck = oyClock() - clck;
 
-  if( xml && xml[0] )
-  { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyPolicyToXML                         " );
-  } else
-  { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyPolicyToXML                         " );
+    if(oyObject_GetRefCount( p->oy_ ) == refs)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyProfile_Copy/Release() %d threads  refs: %d %s", threads, refs,
+      oyProfilingToString(n,clck/(double)CLOCKS_PER_SEC, "calls") );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyProfile_Copy/Release() %d threads  refs: %d/%d", threads,
+      oyObject_GetRefCount( p->oy_ ), refs );
+    }
   }
 
-  if(xml) {
-    oyReadXMLPolicy(oyGROUP_ALL, xml);
-    fprintf(zout,"xml text: \n%s", xml);
+  oyProfile_Release( &p );
 
-    data = oyPolicyToXML( oyGROUP_ALL, 1, myAllocFunc );
+  return result;
+}
 
-    if( strcmp( data, xml ) == 0 )
+#include "oyRectangle_s.h"
+oyTESTRESULT_e testObjectAlloc ()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  size_t allocs = 0, reuses = 0, allocs2 = 0, reuses2 = 0;
+  int i, n = 100000, pass;
+
+  fprintf(stdout, "\n" );
+
+  /* pass 0 uses the default allocators, pass 1 the custom ones of testobj */
+  for(pass = 0; pass < 2; ++pass)
+  {
+    oyObject_s object = pass ? testobj : NULL;
+    double clck;
+
+    oySlabGetCounts_( &allocs, &reuses );
+    clck = oyClock();
+    for(i = 0; i < n; ++i)
+    {
+      oyOption_s * o = oyOption_New( object );
+      oyRectangle_s * r = oyRectangle_NewWith( 0,0, 1,1, object );
+      oyRectangle_Release( &r );
+      oyOption_Release( &o );
+    }
+    clck = oyClock() - clck;
+    oySlabGetCounts_( &allocs2, &reuses2 );
+    allocs2 -= allocs;
+    reuses2 -= reuses;
+
+    if(pass == 0 && reuses2 >= (size_t)n && allocs2 < (size_t)n / 100)
     { PRINT_SUB( oyTESTRESULT_SUCCESS,
-      "Policy rereading                      " );
+      "oyOption/Rectangle_New/Release()  mallocs: %d reuses: %d %s",
+      (int)allocs2, (int)reuses2,
+      oyProfilingToString(n,clck/(double)CLOCKS_PER_SEC, "objects") );
+    } else if(pass == 1 && reuses2 == 0 && allocs2 == 0)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyOption/Rectangle_New/Release()  custom allocators %s",
+      oyProfilingToString(n,clck/(double)CLOCKS_PER_SEC, "objects") );
     } else
     { PRINT_SUB( oyTESTRESULT_FAIL,
-      "Policy rereading                      " );
+      "oyOption/Rectangle_New/Release()  %s  mallocs: %d reuses: %d",
+      pass ? "custom allocators" : "", (int)allocs2, (int)reuses2 );
     }
-
-#ifdef USE_NEW
-    delete [] xml;
-    delete [] data;
-#else
-    free(xml);
-    free(data);
-#endif
   }
 
-
   return result;
 }
 
-#include "oyranos_devices.h"
+#include "oyranos_threads.h"
 
-oyTESTRESULT_e testWidgets ()
+static int test_jobs_done = 0;
+static int test_jobs_msgs = 0;
+static int testJobWork_( oyJob_s * job OY_UNUSED ) { return 0; }
+static int testJobFinish_( oyJob_s * job OY_UNUSED ) { ++test_jobs_done; return 0; }
+static void testJobCallback_ ( double              progress_zero_till_one OY_UNUSED,
+                               char              * status_text OY_UNUSED,
+                               int                 thread_id_ OY_UNUSED,
+                               int                 job_id OY_UNUSED,
+                               oyStruct_s        * cb_progress_context OY_UNUSED )
+{ ++test_jobs_msgs; }
+
+oyTESTRESULT_e testJobQueue ()
 {
   oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  int i, n = 100000, timeouts = 0;
+  double clck;
+  oyJob_s * job;
 
   fprintf(stdout, "\n" );
 
-  const char * name = NULL,
-             * tooltip = NULL;
-  int          flags = 0;
-  const oyGROUP_e * categories = NULL;
+  /* one job with progress messages; measures the round trip */
+  test_jobs_done = test_jobs_msgs = 0;
+  clck = oyClock();
+  job = oyJob_New( testobj );
+  job->work = testJobWork_;
+  job->finish = testJobFinish_;
+  job->cb_progress = testJobCallback_;
+  oyJob_Add( &job, 0, 0 );
+  if(job)
+  {
+    PRINT_SUB( oyTESTRESULT_XFAIL, "no threads handler" );
+    oyJob_Release( &job );
+    return result;
+  }
+  while(test_jobs_done < 1 && timeouts < 5)
+    if(oyJobResultWait( 1.0 ) == 0)
+      ++timeouts;
+  clck = oyClock() - clck;
+  if(test_jobs_done == 1 && test_jobs_msgs == 2)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyJob_Add() + oyJobResultWait() round trip: %.03f ms",
+    clck/(double)CLOCKS_PER_SEC*1000.0 );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyJob_Add() + oyJobResultWait() done: %d messages: %d",
+    test_jobs_done, test_jobs_msgs );
+  }
 
-  oyWIDGET_e option = oyWIDGET_RENDERING_INTENT;
-  oyWIDGET_TYPE_e type = oyWidgetTitleGet( option, 
-                                           &categories, &name, &tooltip,
-                                           &flags );
+  /* many trivial jobs */
+  test_jobs_done = test_jobs_msgs = timeouts = 0;
+  clck = oyClock();
+  for(i = 0; i < n; ++i)
+  {
+    job = oyJob_New( testobj );
+    job->work = testJobWork_;
+    job->finish = testJobFinish_;
+    job->cb_progress = NULL;
+    oyJob_Add( &job, 0, 0 );
+  }
+  while(test_jobs_done < n && timeouts < 5)
+    if(oyJobResultWait( 1.0 ) == 0)
+      ++timeouts;
+  clck = oyClock() - clck;
 
-  if( name && tooltip )
+  if(test_jobs_done == n)
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyWidgetTitleGet \"%s\" %d\n\t%s %d", name, type, tooltip, flags );
+    "oyJob_Add() + oyJobResultWait()   %s",
+    oyProfilingToString(n,clck/(double)CLOCKS_PER_SEC, "jobs") );
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyWidgetTitleGet                      " );
+    "oyJob_Add() + oyJobResultWait()   finished: %d/%d", test_jobs_done, n );
   }
 
-  int choices = 0;
-  const char ** choices_string_list = NULL;
-  int current = -1;
-  int error = oyOptionChoicesGet2( option, 0, oyNAME_NAME,
-                                   &choices, &choices_string_list,
-                                   &current );
+  return result;
+}
 
-  if( !error && choices && choices_string_list && current != -1 )
+/* jobs are identified by a tag in an oyOption_s context */
+#define TEST_JOBS 80
+static int test_job_seq = 0;
+static int test_job_start[TEST_JOBS], test_job_end[TEST_JOBS],
+           test_job_ret[TEST_JOBS], test_job_finished[TEST_JOBS];
+static int test_job_gate = 0, test_job_running = 0;
+static int testJobTag_( oyJob_s * job )
+{ return oyOption_GetValueInt( (oyOption_s*)job->context, 0 ); }
+static int testJobSchedWork_( oyJob_s * job )
+{
+  int tag = testJobTag_( job );
+  double start = oySeconds();
+  test_job_start[tag] = oyAtomicAdd_m_( &test_job_seq, 1 );
+  /* tag 0 holds back its dependents, tag 1 runs until cancelled */
+  if(tag == 0)
+    while(!oyAtomicGet_m_( &test_job_gate ) && oySeconds() - start < 10.0) ;
+  if(tag == 1 && oyAtomicAdd_m_( &test_job_running, 1 ))
+    while(!oyJob_IsCancelled( job ) && oySeconds() - start < 10.0) ;
+  test_job_end[tag] = oyAtomicAdd_m_( &test_job_seq, 1 );
+  return oyJob_IsCancelled( job );
+}
+static int testJobSchedFinish_( oyJob_s * job )
+{
+  int tag = testJobTag_( job );
+  test_job_ret[tag] = job->status_work_return;
+  ++test_job_finished[tag];
+  return 0;
+}
+static int testJobSchedAdd_( int tag, int priority, int group, int dep1, int dep2 )
+{
+  oyJob_s * job = oyJob_New( testobj );
+  oyOption_s * o = oyOption_FromRegistration( "///tag", testobj );
+  oyOption_SetFromInt( o, tag, 0, 0 );
+  job->context = (oyStruct_s*)o;
+  job->work = testJobSchedWork_;
+  job->finish = testJobSchedFinish_;
+  job->cb_progress = NULL;
+  job->priority = priority;
+  job->group = group;
+  if(dep1) oyJob_DependsOn( job, dep1 );
+  if(dep2) oyJob_DependsOn( job, dep2 );
+  int id = oyJob_Add( &job, 0, 0 );
+  if(job)
+  {
+    oyJob_Release( &job );
+    return -1;
+  }
+  return id;
+}
+static void testJobSchedReset_()
+{
+  test_job_seq = 0;
+  test_job_gate = test_job_running = 0;
+  memset( test_job_start, 0, sizeof(test_job_start) );
+  memset( test_job_end, 0, sizeof(test_job_end) );
+  memset( test_job_ret, 0, sizeof(test_job_ret) );
+  memset( test_job_finished, 0, sizeof(test_job_finished) );
+}
+
+oyTESTRESULT_e testJobSchedule ()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  int i, j, n, left, gate, a, b, c, d, r, x, y, high;
+  double start;
+
+  fprintf(stdout, "\n" );
+
+  /* priorities: 64 jobs become ready at once, when the gate opens */
+  testJobSchedReset_();
+  gate = testJobSchedAdd_( 0, 0, 1, 0, 0 );
+  if(gate < 0)
+  {
+    PRINT_SUB( oyTESTRESULT_XFAIL, "no threads handler" );
+    return result;
+  }
+  for(i = 2; i < 66; ++i)
+    testJobSchedAdd_( i, i % 2 ? 10 : 0, 1, gate, 0 );
+  oyAtomicAdd_m_( &test_job_gate, 1 );
+  left = oyJobGroupWait( 1, 20.0 );
+  n = 0;
+  for(i = 2; i < 66; ++i)
+    n += test_job_finished[i];
+  /* count the priority 10 jobs among the first 32 started */
+  high = 0;
+  for(i = 3; i < 66; i += 2)
+  {
+    int rank = 0;
+    for(j = 2; j < 66; ++j)
+      if(test_job_start[j] < test_job_start[i])
+        ++rank;
+    if(rank < 32)
+      ++high;
+  }
+  if(left == 0 && n == 64 && high >= 28)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyJob_s::priority            high priority first: %d/32", high );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyJob_s::priority            high priority first: %d/32 left: %d finished: %d",
+    high, left, n );
+  }
+
+  /* dependencies: a diamond A -> B,C -> D */
+  testJobSchedReset_();
+  a = testJobSchedAdd_( 2, 0, 2, 0, 0 );
+  b = testJobSchedAdd_( 3, 0, 2, a, 0 );
+  c = testJobSchedAdd_( 4, 5, 2, a, 0 );
+  d = testJobSchedAdd_( 5, 9, 2, b, c );
+  left = oyJobGroupWait( 2, 20.0 );
+  if(left == 0 && d > 0 &&
+     test_job_start[3] > test_job_end[2] && test_job_start[4] > test_job_end[2] &&
+     test_job_start[5] > test_job_end[3] && test_job_start[5] > test_job_end[4])
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyJob_DependsOn()            A -> B,C -> D" );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyJob_DependsOn()            A -> B,C -> D  left: %d", left );
+  }
+
+  /* cancel queued, blocked, dependent and running jobs */
+  testJobSchedReset_();
+  gate = testJobSchedAdd_( 0, 0, 3, 0, 0 );
+  r = testJobSchedAdd_( 1, 0, 4, 0, 0 );
+  for(i = 2; i < 10; ++i)
+    testJobSchedAdd_( i, 0, 5, gate, 0 );
+  x = testJobSchedAdd_( 10, 0, 6, gate, 0 );
+  y = testJobSchedAdd_( 11, 0, 6, x, 0 );
+  start = oySeconds();
+  while(!oyAtomicGet_m_( &test_job_running ) && oySeconds() - start < 10.0) ;
+  n  = oyJob_Cancel( 0, 5 );
+  n += oyJob_Cancel( x, 0 );
+  n += oyJob_Cancel( r, 0 );
+  oyAtomicAdd_m_( &test_job_gate, 1 );
+  left  = oyJobGroupWait( 3, 20.0 );
+  left += oyJobGroupWait( 4, 20.0 );
+  left += oyJobGroupWait( 5, 20.0 );
+  left += oyJobGroupWait( 6, 20.0 );
+  j = 0;
+  for(i = 2; i < 12; ++i)
+    if(test_job_start[i] == 0 && test_job_finished[i] == 1 && test_job_ret[i] == -1)
+      ++j;
+  if(n == 10 && left == 0 && j == 10 && y > 0 &&
+     test_job_finished[1] == 1 && test_job_ret[1] == 1 &&
+     test_job_finished[0] == 1 && test_job_ret[0] == 0)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyJob_Cancel()               cancelled: %d skipped: %d", n, j );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyJob_Cancel()               cancelled: %d skipped: %d left: %d running: %d/%d",
+    n, j, left, test_job_finished[1], test_job_ret[1] );
+  }
+
+  return result;
+}
+
+/* returns 0 after all workers of the pool met */
+static int test_job_pool = 0;
+static int testJobPoolWork_( oyJob_s * job OY_UNUSED )
+{
+  double start = oySeconds();
+  oyAtomicAdd_m_( &test_job_running, 1 );
+  while(oyAtomicGet_m_( &test_job_running ) < oyAtomicGet_m_( &test_job_pool ) &&
+        oySeconds() - start < 5.0) ;
+  return oyAtomicGet_m_( &test_job_running ) < oyAtomicGet_m_( &test_job_pool );
+}
+
+oyTESTRESULT_e testJobPool ()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  int i, n, left, r, failed;
+
+  fprintf(stdout, "\n" );
+
+  /* grow and check, that all workers run at the same time */
+  testJobSchedReset_();
+  n = oyJobPool( 3, NULL, 0 );
+  if(n < 0)
+  {
+    PRINT_SUB( oyTESTRESULT_XFAIL, "no configurable pool" );
+    return result;
+  }
+  test_job_pool = 3;
+  for(i = 2; i < 5; ++i)
+  {
+    oyJob_s * job = oyJob_New( testobj );
+    oyOption_s * o = oyOption_FromRegistration( "///tag", testobj );
+    oyOption_SetFromInt( o, i, 0, 0 );
+    job->context = (oyStruct_s*)o;
+    job->work = testJobPoolWork_;
+    job->finish = testJobSchedFinish_;
+    job->cb_progress = NULL;
+    job->group = 7;
+    oyJob_Add( &job, 0, 0 );
+  }
+  left = oyJobGroupWait( 7, 20.0 );
+  failed = test_job_ret[2] + test_job_ret[3] + test_job_ret[4];
+  if(n == 3 && left == 0 && failed == 0)
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyOptionChoicesGet2 %d [%d]: %s", choices, current, choices_string_list[current] );
+    "oyJobPool( 3 )               parallel: %d", oyAtomicGet_m_( &test_job_running ) );
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyOptionChoicesGet2                   " );
+    "oyJobPool( 3 )               workers: %d left: %d failed: %d", n, left, failed );
   }
-  const char * description = NULL;
-  int choice = current;
-  type = oyWidgetDescriptionGet( option, &description, choice );
-  if( type == oyWIDGETTYPE_BEHAVIOUR && description )
+
+  /* shrink; the remaining worker does all jobs */
+  testJobSchedReset_();
+  n = oyJobPool( 1, NULL, 0 );
+  for(i = 2; i < 10; ++i)
+    testJobSchedAdd_( i, 0, 7, 0, 0 );
+  left = oyJobGroupWait( 7, 20.0 );
+  if(n == 1 && left == 0)
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyWidgetDescriptionGet  %s", description );
+    "oyJobPool( 1 )" );
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyWidgetDescriptionGet                " );
+    "oyJobPool( 1 )               workers: %d left: %d", n, left );
   }
 
-  oyOptionChoicesFree( option, &choices_string_list, choices );
-
-  option = oyWIDGET_ASSUMED_WEB;
-  type = oyWidgetTitleGet( option, &categories, &name, &tooltip, &flags );
-  if( name && tooltip && (flags & OY_LAYOUT_NO_CHOICES) &&
-      type == oyWIDGETTYPE_DEFAULT_PROFILE )
+  /* CPU affinity */
+  r = oyJobPool( -1, "zero", 0 );
+  n = oyJobPool( -1, "0", 0 );
+#if defined(__linux__)
+  if(r == -1 && n == 1)
+#else
+  if(r == -1 && n == -1)
+#endif
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyWidgetTitleGet \"%s\"\n\t%s %d", name, tooltip, flags );
+    "oyJobPool( -1, \"0\" )" );
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyWidgetTitleGet                      " );
+    "oyJobPool( -1, \"0\" )         invalid: %d workers: %d", r, n );
   }
+  oyJobPool( -1, "", 0 );
 
-  option = oyWIDGET_DISPLAY_WHITE_POINT;
-  type = oyWidgetTitleGet( option, &categories, &name, &tooltip, &flags );
-  error = oyOptionChoicesGet2( option, 0, oyNAME_NAME,
-                               &choices, &choices_string_list,
-                               &current );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptionChoicesGet2() error: %d", error )
-
-  oyConfigs_s * configs = 0;
-  oyOptions_s * options = NULL;
-  error = oyOptions_SetFromString( &options,
-                                     "//" OY_TYPE_STD "/config/command",
-                                     "list", OY_CREATE_NEW );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_SetFromString() error: %d", error )
-  error = oyDevicesGet( 0, "monitor", options, &configs );
-  if(error && displayFail() == oyTESTRESULT_FAIL) PRINT_SUB( oyTESTRESULT_XFAIL, "oyDevicesGet() error: %d", error )
-  int devices_n = oyConfigs_Count( configs );
-  oyOptions_Release( &options );
-  oyConfigs_Release( &configs );
-  int i,j, duplicate = 0;
-  for(i = 0; i < choices; ++i)
-    for(j = i+1; j < choices; ++j)
-      if(strcmp(choices_string_list[i],choices_string_list[j]) == 0)
-        ++duplicate;
-  if(choices == (7 + devices_n) &&
-     duplicate == 0)
+  /* shut down with a running, a blocked and a queued job */
+  testJobSchedReset_();
+  n = oyJobPool( 2, NULL, 0 );
+  oyAtomicAdd_m_( &test_job_running, 1 );
+  r = testJobSchedAdd_( 1, 0, 8, 0, 0 );
+  while(oyAtomicGet_m_( &test_job_running ) < 2 && test_job_finished[1] == 0)
+    oyJobResultWait( 0.01 );
+  testJobSchedAdd_( 2, 0, 8, r, 0 );
+  n = oyJobPool( 0, NULL, oyJOB_POOL_SHUTDOWN );
+  if(n == 0 && test_job_finished[1] == 1 && test_job_ret[1] == 1 &&
+     test_job_finished[2] == 1 && test_job_ret[2] == -1 && test_job_start[2] == 0)
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyOptionChoicesGet2(%s) %d [%d]: %s", name, choices, current, choices_string_list[current] );
+    "oyJobPool( oyJOB_POOL_SHUTDOWN )" );
   } else
-  { if(duplicate)
-    {
-      PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyOptionChoicesGet2(%s) duplicates detected: %d      ", name, duplicate );
-    } else {
-      PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyOptionChoicesGet2(%s) %d != 7 + %d      ", name, choices, devices_n );
-    }
-    for(i = 0; i < choices; ++i)
-      fprintf(zout,"\t%s %s\n", i==current?"*":" ", choices_string_list[i]);
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyJobPool( oyJOB_POOL_SHUTDOWN ) running: %d/%d blocked: %d/%d",
+    test_job_finished[1], test_job_ret[1], test_job_finished[2], test_job_ret[2] );
   }
 
-  oyOptionChoicesFree( option, &choices_string_list, choices );
-
-  fprintf( zout, "\n");
+  /* the next job restarts the pool */
+  testJobSchedReset_();
+  testJobSchedAdd_( 2, 0, 9, 0, 0 );
+  left = oyJobGroupWait( 9, 20.0 );
+  n = oyJobPool( 0, NULL, 0 );
+  if(left == 0 && test_job_finished[2] == 1 && n >= 1)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyJob_Add() after shutdown   workers: %d", n );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyJob_Add() after shutdown   workers: %d left: %d", n, left );
+  }
 
   return result;
 }
 
+#define TEST_PARALLEL_N 100000
+static int test_parallel_hits[TEST_PARALLEL_N];
+static int test_parallel_calls = 0;
+static void testParallelBody_( int start, int end, void * data OY_UNUSED )
+{
+  int i;
+  oyAtomicAdd_m_( &test_parallel_calls, 1 );
+  for(i = start; i < end; ++i)
+    oyAtomicAdd_m_( &test_parallel_hits[i], 1 );
+}
+/* each chunk runs a inner loop over its own lines */
+static void testParallelNested_( int start, int end, void * data OY_UNUSED )
+{
+  int i;
+  for(i = start; i < end; ++i)
+    oyParallelFor( 100, testParallelBody_, NULL, 7 );
+}
+static int testParallelJob_( oyJob_s * job OY_UNUSED )
+{
+  oyParallelFor( TEST_PARALLEL_N, testParallelBody_, NULL, 64 );
+  return 0;
+}
+static int testParallelCheck_( int times )
+{
+  int i, wrong = 0;
+  for(i = 0; i < TEST_PARALLEL_N; ++i)
+    if(test_parallel_hits[i] != times)
+      ++wrong;
+  memset( test_parallel_hits, 0, sizeof(test_parallel_hits) );
+  return wrong;
+}
 
-
-oyTESTRESULT_e testCMMDevicesListing ()
+oyTESTRESULT_e testParallelFor ()
 {
   oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  int threads, wrong, left;
 
   fprintf(stdout, "\n" );
 
-  int i, j, k, j_n, k_n;
-  uint32_t count = 0,
-         * rank_list = 0;
-  int error = 0;
-  char ** texts = 0,
-        * val = 0;
-
-#ifdef USE_GETTEXT
-  setlocale(LC_ALL,"");
-#endif
-
-  /* get all configuration filters */
-  oyConfigDomainList( "//" OY_TYPE_STD "/device/config.icc_profile",
-                      &texts, &count, &rank_list ,0 );
+  /* each index is visited exactly once */
+  testParallelCheck_( 0 );
+  test_parallel_calls = 0;
+  threads = oyParallelFor( TEST_PARALLEL_N, testParallelBody_, NULL, 16 );
+  wrong = testParallelCheck_( 1 );
+  if(threads >= 1 && wrong == 0 && test_parallel_calls >= 1)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyParallelFor( %d )      threads: %d chunks: %d", TEST_PARALLEL_N, threads, test_parallel_calls );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyParallelFor( %d )      threads: %d wrong: %d", TEST_PARALLEL_N, threads, wrong );
+  }
 
-  if( count )
+  /* empty and tiny loops */
+  test_parallel_calls = 0;
+  threads = oyParallelFor( 0, testParallelBody_, NULL, 0 );
+  oyParallelFor( 1, testParallelBody_, NULL, 0 );
+  wrong = test_parallel_hits[0] != 1;
+  wrong += testParallelCheck_( 0 ) - 1;
+  if(threads == 0 && wrong == 0 && test_parallel_calls == 1)
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyConfigDomainList Found CMM's %d     ", (int)count );
+    "oyParallelFor( 0 / 1 )" );
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyConfigDomainList Found CMM's %d     ", (int)count );
+    "oyParallelFor( 0 / 1 )         threads: %d calls: %d", threads, test_parallel_calls );
   }
-  for( i = 0; texts && i < (int)count; ++i)
+
+  /* nested loops must not wait for each other */
+  oyParallelFor( 1000, testParallelNested_, NULL, 1 );
+  wrong = 0;
   {
-    fprintf( zout, "%d: %s\n", i, texts[i] );
+    int i;
+    for(i = 0; i < TEST_PARALLEL_N; ++i)
+      if(test_parallel_hits[i] != (i < 100 ? 1000 : 0))
+        ++wrong;
+    memset( test_parallel_hits, 0, sizeof(test_parallel_hits) );
   }
-  fprintf(zout, "\n" );
-
-  oyConfigs_s * configs = 0;
-  oyConfig_s * config = 0;
-  oyOptions_s * options_list = 0;
-  oyOption_s * o = 0;
-  oyOption_s_ * oi = 0;
-  oyProfile_s * p = 0;
-
-  /* send a empty query to one module to obtain instructions in a message */
-  if(texts && count)
-  error = oyConfigs_FromDomain( texts[0], 0, &configs, testobj );
-  if( !error )
+  if(wrong == 0)
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyConfigs_FromDomain \"%s\" help text ", texts ? 
-                                              oyNoEmptyString_m_(texts[0]) :"----");
+    "oyParallelFor() nested" );
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyConfigs_FromDomain \"%s\" help text ", texts ? 
-                                              oyNoEmptyString_m_(texts[0]) :"----");
+    "oyParallelFor() nested         wrong: %d", wrong );
   }
-  fprintf( zout, "\n");
-
-
-  /* add list call to module arguments */
-  error = oyOptions_SetFromString( &options_list,
-                                 "//" OY_TYPE_STD "/config/command", "list",
-                                 OY_CREATE_NEW );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_SetFromString() error: %d", error )
-  error = oyOptions_SetFromString( &options_list,
-                                 "//" OY_TYPE_STD "/config/icc_profile",
-                                 "true", OY_CREATE_NEW );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_SetFromString() error: %d", error )
 
-  fprintf( zout, "oyConfigs_FromDomain() \"list\" call:\n" );
-  for( i = 0; texts && i < (int)count; ++i)
+  /* loops inside of jobs; without threads handler the jobs run here */
   {
-    const char * registration_domain = texts[i];
-    fprintf(zout,"%d[rank %u]: %s\n", i, (unsigned int)rank_list[i], registration_domain);
-
-    error = oyConfigs_FromDomain( registration_domain,
-                                  options_list, &configs, testobj );
-    if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyConfigs_FromDomain() error: %d", error )
-    j_n = oyConfigs_Count( configs );
-    for( j = 0; j < j_n; ++j )
+    int i, taken = 0;
+    for(i = 0; i < 4; ++i)
     {
-      oyConfigs_s * dbs = 0,
-                  * heap = 0;
-      int precise_count = 0,
-          serial_count = 0,
-          mnft_count = 0,
-          dev_name_count = 0;
+      oyJob_s * job = oyJob_New( testobj );
+      job->work = testParallelJob_;
+      job->cb_progress = NULL;
+      job->group = 10;
+      oyJob_Add( &job, 0, 0 );
+      if(job)
+      {
+        job->work( job );
+        oyJob_Release( &job );
+      } else
+        ++taken;
+    }
+    left = taken ? oyJobGroupWait( 10, 20.0 ) : 0;
+    wrong = testParallelCheck_( 4 );
+    if(left == 0 && wrong == 0)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyParallelFor() in jobs        queued: %d", taken );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyParallelFor() in jobs        left: %d wrong: %d", left, wrong );
+    }
+  }
 
-      config = oyConfigs_Get( configs, j );
+  return result;
+}
 
-      fprintf(zout, "--------------------------------------------------------------------------------\n\"%s\":\n", oyConfig_FindString( config, "device_name", 0 ) );
-      {
-        oyOptions_s * options = 0;
-        const char * t = 0;
-        oyOptions_SetFromString( &options,
-                   "//" OY_TYPE_STD "/config/icc_profile.x_color_region_target",
-                         "yes", OY_CREATE_NEW );
-        error = oyDeviceGetProfile( config, options, &p );
-        if(error > 0) PRINT_SUB( oyTESTRESULT_FAIL, "oyDeviceGetProfile() error: %d", error )
-        oyOptions_Release( &options );
-        t = oyProfile_GetText( p, oyNAME_DESCRIPTION);
-        fprintf(zout, "oyDeviceGetProfile(): \"%s\"\n", t ? t : "----" );
-        oyProfile_Release( &p );
-      }
-
-      error = oyConfigs_FromDB( oyConfig_GetRegistration( config ), NULL, &heap, testobj );
-      if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyConfigs_FromDB() error: %d", error )
-
-      error = oyDeviceSelectSimiliar( config, heap, 0, &dbs );
-      if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyDeviceSelectSimiliar() error: %d", error )
-      precise_count = oyConfigs_Count( dbs );
-      oyConfigs_Release( &dbs );
+oyTESTRESULT_e testEffects ()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  oyOptions_s * opts = oyOptions_New(testobj),
+              * result_opts = 0;
+  const char * text = 0;
+  oyProfile_s * prof = oyProfile_FromStd( oyEDITING_CMYK, 0, testobj ),
+              * abstract;
+  int error;
 
-      error = oyDeviceSelectSimiliar( config, heap, 1, &dbs );
-      if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyDeviceSelectSimiliar() error: %d", error )
-      serial_count = oyConfigs_Count( dbs );
-      oyConfigs_Release( &dbs );
+  fprintf(stdout, "\n" );
 
-      error = oyDeviceSelectSimiliar( config, heap, 2, &dbs );
-      if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyDeviceSelectSimiliar() error: %d", error )
-      mnft_count = oyConfigs_Count( dbs );
-      oyConfigs_Release( &dbs );
+  error = oyOptions_MoveInStruct( &opts, "//" OY_TYPE_STD "/icc_profile.proofing_profile",
+                                  (oyStruct_s**) &prof, OY_CREATE_NEW );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_MoveInStruct() error: %d", error )
+  error = oyOptions_Handle( "//" OY_TYPE_STD "/create_profile.proofing_effect",
+                            opts,"create_profile.proofing_effect",
+                            &result_opts );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_Handle() error: %d", error )
+  abstract = (oyProfile_s*)oyOptions_GetType( result_opts, -1, "icc_profile",
+                                              oyOBJECT_PROFILE_S );
+  oyOptions_Release( &result_opts );
+  oyOptions_Release( &opts );
 
-      error = oyDeviceSelectSimiliar( config, heap, 4, &dbs );
-      if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyDeviceSelectSimiliar() error: %d", error )
-      dev_name_count = oyConfigs_Count( dbs );
-      oyConfigs_Release( &dbs );
+  text = oyProfile_GetText( abstract, oyNAME_DESCRIPTION );
 
-      oyConfigs_Release( &heap );
+  if(abstract)
+  {
+    PRINT_SUB( oyTESTRESULT_SUCCESS, 
+    "oyOptions_Handle(\"create_profile\"): %s", text );
+  } else if(error == -1)
+  {
+    PRINT_SUB( oyTESTRESULT_XFAIL,
+    "oyOptions_Handle(\"create_profile\") no" );
+  } else
+  {
+    PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyOptions_Handle(\"create_profile\") zero" );
+  }
 
+  oyProfile_ToFile_( (oyProfile_s_*)abstract, "test_proof_effect.icc" );
+  oyProfile_Release( &abstract );
 
-      fprintf(zout, "\"%s\" has %d precise matches,\n"
-              "\t%d manufacturer/model/serial, %d manufacturer/model and\n"
-              "\t%d \"device_name\" entries in DB\n",
-              oyConfig_FindString( config, "device_name", 0 ),
-              precise_count,serial_count,mnft_count,dev_name_count );
 
-      k_n = oyConfig_Count( config );
-      for( k = 0; k < k_n; ++k )
-      {
-        char * r = 0;
-        int mnft = -1, mn, pos;
+  double XYZ[3] = {-1, -1, -1};
+  double Lab[3], cie_a, cie_b, dst_cie_a, dst_cie_b;
+  error = oyGetDisplayWhitePoint( 2, XYZ );
+  oyXYZ2Lab( XYZ, Lab );
+  cie_a = Lab[1]/256.0+0.5; cie_b = Lab[2]/256.0+0.5;
+  error = oyGetDisplayWhitePoint( 5, XYZ );
+  oyXYZ2Lab( XYZ, Lab );
+  dst_cie_a = Lab[1]/256.0+0.5; dst_cie_b = Lab[2]/256.0+0.5;
+  error = oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/cie_a",
+                                   dst_cie_a - cie_a, 0, OY_CREATE_NEW );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_SetFromDouble() error: %d", error )
+  error = oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/cie_b",
+                                   dst_cie_b - cie_b, 0, OY_CREATE_NEW );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_SetFromDouble() error: %d", error )
+  fprintf(zout,"source white point cie_ab %g %g -> %g %g\n", cie_a, cie_b, dst_cie_a, dst_cie_b );
+  error = oyOptions_Handle( "//" OY_TYPE_STD "/create_profile.white_point_adjust.lab",
+                            opts,"create_profile.white_point_adjust.lab",
+                            &result_opts );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_Handle() error: %d", error )
+  abstract = (oyProfile_s*)oyOptions_GetType( result_opts, -1, "icc_profile",
+                                              oyOBJECT_PROFILE_S );
+  oyOptions_Release( &result_opts );
+  oyOptions_Release( &opts );
 
-        o = oyConfig_Get( config, k );
-        oi = (oyOption_s_*) o;
+  text = oyProfile_GetText( abstract, oyNAME_DESCRIPTION );
 
-        r = oyFilterRegistrationToText( oyOption_GetRegistration( o ),
-                                        oyFILTER_REG_OPTION, 0 );
-        if(r && strcmp(r,"supported_devices_info") == 0 &&
-           oi->value_type == oyVAL_STRING_LIST)
-        {
-          /* print first line special */
-          while(oi->value->string_list[++mnft])
-          {
-            mn = 0; pos = -1;
-            while(oi->value->string_list[mnft][++pos])
-            {
-              if(oi->value->string_list[mnft][pos] == '\n')
-              {
-                if(mn && oi->value->string_list[mnft][pos+1])
-                  putc(',', zout);
-                else if(mn == 0)
-                {
-                  putc(':', zout);
-                  putc('\n', zout);
-                  putc(' ', zout);
-                  putc(' ', zout);
-                }
-                ++mn;
+  if(abstract)
+  {
+    PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyOptions_Handle(\"create_profile\"): %s", text );
+  } else if(error == -1)
+  {
+    PRINT_SUB( oyTESTRESULT_XFAIL,
+    "oyOptions_Handle(\"create_profile\") no" );
+  } else
+  {
+    PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyOptions_Handle(\"create_profile\") zero" );
+  }
+  oyProfile_ToFile_( (oyProfile_s_*)abstract, "test_wtpt_effect-lab.icc" );
+  oyProfile_Release( &abstract );
 
-              } else
-                putc(oi->value->string_list[mnft][pos], zout);
-            }
-            putc('\n', zout);
-          }
-        } else
-        {
-          val = oyOption_GetValueText( o, oyAllocateFunc_ );
-          fprintf(zout,"  %d::%d::%d \"%s\": \"%s\"\n", i,j,k,
-                 oyOption_GetRegistration(o), val?val:"(nix)" );
-        }
 
-        if(r) { oyDeAllocateFunc_(r); r = 0; }
-        if(val)
-        { oyDeAllocateFunc_( val ); val = 0; }
-        oyOption_Release( &o ); oi = 0;
-      }
+  double        src_XYZ[3] = {0.0, 0.0, 0.0}, dst_XYZ[3] = {0.0, 0.0, 0.0};
+  error = oyGetDisplayWhitePoint( 2, src_XYZ );
+  error = oyGetDisplayWhitePoint( 5, dst_XYZ );
+  error = oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/src_iccXYZ", src_XYZ[0], 0, OY_CREATE_NEW );
+  error = oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/src_iccXYZ", src_XYZ[1], 1, OY_CREATE_NEW );
+  error = oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/src_iccXYZ", src_XYZ[2], 2, OY_CREATE_NEW );
+  error = oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/illu_iccXYZ", dst_XYZ[0], 0, OY_CREATE_NEW );
+  error = oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/illu_iccXYZ", dst_XYZ[1], 1, OY_CREATE_NEW );
+  error = oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/illu_iccXYZ", dst_XYZ[2], 2, OY_CREATE_NEW );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_SetFromDouble() error: %d", error )
+  fprintf(zout,"white point XYZ %g %g %g -> %g %g %g\n", src_XYZ[0], src_XYZ[1], src_XYZ[2], dst_XYZ[0], dst_XYZ[1], dst_XYZ[2] );
+  error = oyOptions_Handle( "//" OY_TYPE_STD "/create_profile.white_point_adjust.bradford",
+                            opts,"create_profile.white_point_adjust.bradford",
+                            &result_opts );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_Handle() error: %d", error )
+  abstract = (oyProfile_s*)oyOptions_GetType( result_opts, -1, "icc_profile",
+                                              oyOBJECT_PROFILE_S );
+  oyOptions_Release( &result_opts );
+  oyOptions_Release( &opts );
 
-      oyConfig_Release( &config );
-    }
+  text = oyProfile_GetText( abstract, oyNAME_DESCRIPTION );
 
-    oyConfigs_Release( &configs );
+  if(abstract)
+  {
+    PRINT_SUB( oyTESTRESULT_SUCCESS, 
+    "oyOptions_Handle(\"create_profile\"): %s", text );
+  } else if(error == -1)
+  {
+    PRINT_SUB( oyTESTRESULT_XFAIL,
+    "oyOptions_Handle(\"create_profile\") no" );
+  } else
+  {
+    PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyOptions_Handle(\"create_profile\") zero" );
   }
-  fprintf( zout, "\n");
-  oyOptions_Release( &options_list );
 
-  fprintf( zout, "\n");
+  oyProfile_ToFile_( (oyProfile_s_*)abstract, "test_wtpt_effect-bradford.icc" );
+  oyProfile_Release( &abstract );
 
   return result;
 }
 
-oyTESTRESULT_e testCMMDevicesDetails ()
+#include "oyImage_s.h"
+#include "oyConversion_s.h"
+
+oyTESTRESULT_e testDeviceLinkProfile ()
 {
   oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
 
-  fprintf(stdout, "\n" );
-
-  int i, k, l, k_n;
-  uint32_t count = 0,
-         * rank_list = 0;
+  double buf[24];
+  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  oyProfile_s * prof = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj ), *dl = 0;
+  oyImage_s * in = oyImage_Create( 2, 2, buf, OY_TYPE_123_DBL, prof, testobj );
+  oyImage_s * out = oyImage_CreateForDisplay( 2, 2, buf, OY_TYPE_123_DBL, 0,
+                                              0,0, 12,12,
+                                              icc_profile_flags, testobj );
+  oyOptions_s * options = NULL;
+  oyOptions_SetFromString( &options, OY_CMM_STD"/context", "lcm2", OY_CREATE_NEW );
+  oyConversion_s *cc = oyConversion_CreateBasicPixels( in, out, options, testobj );
+  oyFilterGraph_s * graph = NULL;
+  oyFilterNode_s * node = NULL;
+  oyBlob_s * blob = NULL;
   int error = 0;
-  char ** texts = 0,
-        * val = 0;
-
-  oyConfigs_s * configs = 0;
-  oyConfig_s * config = 0;
-  oyOptions_s * options = 0;
-  oyOption_s * o = 0;
-  int devices_n = 0;
+  const char * fn = NULL,
+             * prof_fn = oyProfile_GetFileName( prof, -1 );
+  int i,n=0, len;
 
-#ifdef USE_GETTEXT
-  setlocale(LC_ALL,"");
-#endif
+  fprintf(stdout, "\n" );
 
-  /* get all configuration filters */
-  oyConfigDomainList( "//" OY_TYPE_STD "/device/config.icc_profile",
-                      &texts, &count, &rank_list ,0 );
+  fprintf(stdout, "creating DL from sRGB to CIE*XYZ\n" );
 
-  if( count )
-  { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyConfigDomainList Found CMM's %d     ", (int)count );
-  } else
-  { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyConfigDomainList Found CMM's %d     ", (int)count );
-  }
+  memset( buf, 0, sizeof(double)*24);
 
+  /*oyConversion_RunPixels( cc, 0 );*/
 
-  fprintf( zout, "oyConfigs_FromDomain() \"properties\" call:\n" );
-  for( i = 0; rank_list && i < (int)count; ++i)
-  {
-    const char * registration_domain = texts[i];
-    fprintf(zout,"%d[rank %u]: %s\n", i, (unsigned int)rank_list[i], registration_domain);
-
-    /* set a general request */
-    error = oyOptions_SetFromString( &options,
-                                     "//" OY_TYPE_STD "/config/command",
-                                     "properties", OY_CREATE_NEW );
-    if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_SetFromString() error: %d", error )
-    /* send the query to a module */
-    error = oyConfigs_FromDomain( registration_domain,
-                                  options, &configs, testobj );
-    if(error) fprintf( zout, "oyConfigs_FromDomain(%s) error: %d", registration_domain, error );
-    devices_n = oyConfigs_Count( configs );
-    for( l = 0; l < devices_n; ++l )
+  if(cc)
+    graph = oyConversion_GetGraph( cc );
+  if(graph)
+    n = oyFilterGraph_CountEdges( graph );
+  for(i = 0; i < n; ++i)
+  {
+    node = oyFilterGraph_GetNode( graph, i, NULL, NULL );
+    blob = oyFilterNode_ToBlob( node, NULL );
+    if(blob && oyBlob_GetSize( blob ))
     {
-      /* display results */
-      fprintf(zout, "--------------------------------------------------------------------------------\n%s:\n", registration_domain );
-      config = oyConfigs_Get( configs, l );
-
-      k_n = oyConfig_Count( config );
-      for( k = 0; k < k_n; ++k )
-      {
-        o = oyConfig_Get( config, k );
-
-        val = oyOption_GetValueText( o, oyAllocateFunc_ );
-        fprintf(zout, "  %d::%d %s: \"%s\"\n", l,k, 
-                  oyStrrchr_(oyOption_GetRegistration(o),'/')+1, val );
-
-        if(val) { oyDeAllocateFunc_( val ); val = 0; }
-        oyOption_Release( &o );
-      }
-
-      o = oyConfig_Find( config, "icc_profile" );
-      if(o)
-      {
-        val = oyOption_GetValueText( o, oyAllocateFunc_ );
-        fprintf(zout, "  %d %s: \"%s\"\n", l, 
-                oyStrrchr_(oyOption_GetRegistration(o),'/')+1, val );
-
-        if(val) { oyDeAllocateFunc_( val ); val = 0; }
-        oyOption_Release( &o );
-      }
-
-        //error = oyConfig_SaveToDB( config );
-      oyConfig_Release( &config );
+      char name[64];
+      sprintf( name, "oy_dl_test_%d_", i );
+      len = strlen(name);
+      memcpy( &name[len], oyBlob_GetType( blob ), 4 );
+      name[len+4] = 0;
+      len = strlen(name);
+      sprintf( &name[len], ".icc" );
+      error = oyWriteMemToFile_( name, oyBlob_GetPointer( blob ),
+                                 oyBlob_GetSize( blob) );
+      if(!error)
+        fprintf(zout,"wrote: %s\n", name );
+      else
+        fprintf(zout,"writing failed: %s\n", name );
+      dl = oyProfile_FromMem( oyBlob_GetSize( blob ),
+                              oyBlob_GetPointer( blob ), 0,0 );
     }
 
-    oyConfigs_Release( &configs );
-    oyOptions_Release( &options );
+    oyBlob_Release( &blob );
+    oyFilterNode_Release( &node );
   }
 
-  fprintf( zout, "\n");
-
-
-  if(texts && texts[0])
+  fn = oyProfile_GetFileName( dl, 0 );
+  if(fn && prof_fn && strcmp(fn,prof_fn) == 0)
   {
-    oyConfDomain_s * domain = oyConfDomain_FromReg( texts[0], testobj );
-    const char * device_class = oyConfDomain_GetText( domain, "device_class", oyNAME_NICK );
-    char * class_key = NULL;
-    oyStringAddPrintf( &class_key, oyAllocateFunc_, oyDeAllocateFunc_,
-                       OY_STD"/device/%s", device_class );
-    config = oyConfig_FromRegistration( class_key, 0 );
-    oyFree_m_( class_key );
-    oyConfDomain_Release( &domain );
-  }
-  error = oyConfig_AddDBData( config, "k1", "bla1", OY_CREATE_NEW );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyConfig_AddDBData() error: %d", error )
-  error = oyConfig_AddDBData( config, "k2", "bla2", OY_CREATE_NEW );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyConfig_AddDBData() error: %d", error )
-  error = oyConfig_AddDBData( config, "k3", "bla3", OY_CREATE_NEW );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyConfig_AddDBData() error: %d", error )
-
-  if( !error  && config && oyOptions_Count(*oyConfig_GetOptions( config,"db") ))
-  { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyConfig_AddDBData                    " );
+    PRINT_SUB( oyTESTRESULT_SUCCESS, 
+    "oyProfile_GetFileName(dl, 0): %s", fn );
   } else
-  { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyConfig_AddDBData                    " );
+  {
+    PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyProfile_GetFileName(dl, 0): %s  %s", oyNoEmptyString_m_(fn), oyNoEmptyString_m_(prof_fn) );
   }
 
-  char * registration = 0;
-  if(config)
-    registration = oyStringCopy( oyConfig_GetRegistration( config ),
-                                  oyAllocateFunc_ );
-  error = oyConfig_SaveToDB( config, oySCOPE_USER );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyConfig_SaveToDB() error: %d", error )
-
-  error = oyConfigs_FromDB( registration, NULL, &configs, 0 );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyConfigs_FromDB() error: %d", error )
-  count = oyConfigs_Count( configs );
-  oyConfigs_Release( &configs );
-
-  if( count > 0 )
-  { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyConfigs_FromDB() %d                  ", (int)count );
+  fn = oyProfile_GetFileName( dl, 1 );
+  if(fn)
+  {
+    PRINT_SUB( oyTESTRESULT_SUCCESS, 
+    "oyProfile_GetFileName(dl, 1): %s", fn );
   } else
-  { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyConfigs_FromDB() failed %d           ", (int)count );
+  {
+    PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyProfile_GetFileName(dl, 1): %s", oyNoEmptyString_m_(fn) );
   }
 
+  error = oyConversion_Release( &cc );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyConversion_Release() error: %d", error )
+  error = oyImage_Release( &in );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyImage_Release() error: %d", error )
+  error = oyImage_Release( &out );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyImage_Release() error: %d", error )
+  error = oyProfile_Release( &prof );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyProfile_Release() error: %d", error )
+  error = oyProfile_Release( &dl );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyProfile_Release() error: %d", error )
+  error = oyOptions_Release( &options );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_Release() error: %d", error )
+  error = oyFilterGraph_Release( &graph );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyFilterGraph_Release() error: %d", error )
 
-  int32_t rank = 0;
-  error = oyConfig_GetDB( config, NULL, &rank );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyConfig_GetDB() error: %d", error )
-  const char * key_set_name = oyConfig_FindString( config, "key_set_name", 0 );
-  char * key = 0;
-  STRING_ADD( key, key_set_name );
-  STRING_ADD( key, OY_SLASH );
-  STRING_ADD( key, "k1" );
-  o = oyConfig_Get( config, 0 );
-  oyOption_SetRegistration( o, key );
-  oyOption_Release( &o );
-  if(key)
-  { oyDeAllocateFunc_( key ); key = 0; }
-  error = oyConfig_EraseFromDB( config, oySCOPE_USER );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyConfig_EraseFromDB() error: %d", error )
-  oyConfig_Release( &config );
 
-  error = oyConfigs_FromDB( registration, NULL, &configs, testobj );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyConfigs_FromDB() error: %d", error )
-  i = oyConfigs_Count( configs );
-  oyConfigs_Release( &configs );
+  return result;
+}
 
-  if( count - i == 1 )
-  { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyConfig_EraseFromDB() %d/%d            ", (int)count,i );
-  } else
-  { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyConfig_EraseFromDB() failed %d/%d     ", (int)count,i );
-  }
 
-  if(registration)
-  { oyDeAllocateFunc_( registration ); registration = 0; }
+/* make plain external project code happy */
+#define GLushort uint16_t
+#define GLuint uint32_t
+#define GLfloat float
+#define cicc_free oyFree_m_
+#define cdCreateTexture( ignore_opengl )
 
-  fprintf( zout, "\n");
+#define CompLogLevelDebug oyMSG_WARN
+#define CompLogLevelWarn oyMSG_WARN
+#define CompLogLevelInfo oyMSG_DBG
+#define DBG_STRING OY_DBG_FORMAT_
+#define DBG_ARGS OY_DBG_ARGS_
+#define oyCompLogMessage(ignore, prog, level, format, ... ) \
+        oyMessageFunc_p( level,0, format, __VA_ARGS__)
+static oyStructList_s * oy_test_cache_ = NULL;
+oyStructList_s *   pluginGetPrivatesCache ( )
+{
+  if(!oy_test_cache_)
+    oy_test_cache_ = oyStructList_Create( oyOBJECT_NONE, "oy_test_cache_ p", 0 );
 
-  return result;
+  return oy_test_cache_;
 }
-
-oyTESTRESULT_e testCMMRankMap ()
+void         oyTestCacheListClear_     ( )
 {
-  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  oyStructList_Release( &oy_test_cache_ );
+}
 
-  fprintf(stdout, "\n" );
+/* taken from compicc.c f268e681e3b73004376e8d3ea9db4ae3e669fad8 20150227 */
+#define GRIDPOINTS 64
+typedef struct {
+  oyProfile_s * src_profile;         /* the data profile or device link */
+  oyProfile_s * dst_profile;         /* the monitor profile or none */
+  char * output_name;                /* the intented output device */
+  GLushort clut[GRIDPOINTS][GRIDPOINTS][GRIDPOINTS][3]; /* lookup table */
+  GLuint glTexture;                  /* texture reference */
+  GLfloat scale, offset;             /* texture parameters */
+  int ref;                           /* reference counter */
+} PrivColorContext;
 
-#ifdef USE_GETTEXT
-  setlocale(LC_ALL,"");
-#endif
+static int     setupColourTable      ( PrivColorContext  * ccontext,
+                                       int                 advanced )
+{
+  int dl_count = 0;
 
+  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  oyConversion_s * cc;
   int error = 0;
-  oyConfig_s * device;
-  oyOptions_s * options = 0;
-  oyConfigs_s * devices = 0;
+  oyProfile_s * dst_profile = ccontext->dst_profile, * web = 0;
 
-  oyOptions_SetFromString( &options,
-                   "//" OY_TYPE_STD "/config/icc_profile.x_color_region_target",
-                         "yes", OY_CREATE_NEW );
-  error = oyOptions_SetFromString( &options, "//" OY_TYPE_STD "/config/command",
-                                   "properties", OY_CREATE_NEW );  
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_SetFromString() error: %d", error )
-  error = oyDevicesGet( OY_TYPE_STD, "monitor", options, &devices );
-  if(error && displayFail() == oyTESTRESULT_FAIL) PRINT_SUB( oyTESTRESULT_XFAIL, "oyDevicesGet() error: %d", error )
-  oyOptions_Release( &options );
+    if(!ccontext->dst_profile)
+      dst_profile = web = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
 
-  int count = oyConfigs_Count( devices ),
-      i;
 
-  if( count )
-  { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "monitor(s) found               %d (%d)", (int)count, error );
-  } else if(displayFail() == oyTESTRESULT_FAIL)
-  { PRINT_SUB( displayFail(),
-    "no monitor found               %d (%d)", (int)count, error );
-  }
+    {
+      int flags = 0;
+      int ** ptr;
 
-  for(i = 0; i < count; ++i)
-  {
-    char * json_text = 0;
-    device = oyConfigs_Get( devices, i );
-    oyDeviceToJSON( device, 0, &json_text, malloc );
+      oyProfile_s * src_profile = ccontext->src_profile;
+      oyOptions_s * options = 0;
 
-    if( json_text && json_text[0] )
-    { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "json from device [%d]         %d    ", i, (int)strlen(json_text) );
-    } else
-    { PRINT_SUB( oyTESTRESULT_FAIL,
-    "json from device failed for [%d]      ", i );
-    }
+      oyPixel_t pixel_layout = OY_TYPE_123_16;
+      oyCompLogMessage(NULL, "compicc", CompLogLevelDebug,
+             DBG_STRING "%s -> %s",
+             DBG_ARGS, oyProfile_GetText( src_profile, oyNAME_DESCRIPTION ),
+                       oyProfile_GetText( dst_profile, oyNAME_DESCRIPTION ) );
 
-    const oyRankMap * map = oyConfig_GetRankMap( device );
-    if( map )
-    { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "Map from device  [%d]                 ", i );
-    } else
-    { PRINT_SUB( oyTESTRESULT_FAIL,
-    "Map from device failed for [%d]       ", i );
-    }
+      /* skip web to web conversion */
+      if(oyProfile_Equal( src_profile, web ))
+      {
+        oyCompLogMessage(NULL, "compicc", CompLogLevelDebug,
+             DBG_STRING "src_profile == web",
+             DBG_ARGS );
+        goto clean_setupColourTable;
+      }
 
-    char * rank_map_text = 0;
-    error = oyRankMapToJSON( map, options, &rank_map_text, malloc );
-    if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyRankMapToJSON() error: %d", error )
-    if( rank_map_text )
-    { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "JSON from Map    [%d]          %lu    ", i, (long unsigned int)strlen(rank_map_text) );
-    } else
-    { PRINT_SUB( oyTESTRESULT_FAIL,
-    "JSON from Map failed  [%d]     %d     ", i, error );
-    }
+      if(!src_profile)
+        src_profile = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
 
-    oyRankMap * rank_map2 = 0;
-    error = oyRankMapFromJSON( rank_map_text, options, &rank_map2, malloc );
-    if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyRankMapFromJSON() error: %d", error )
-    if( rank_map2 )
-    { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "Map from JSON    [%d]                 ", i );
-    oyRankMapRelease( &rank_map2, free );
-    } else
-    { PRINT_SUB( oyTESTRESULT_FAIL,
-    "Map from JSON failed [%d]      %d     ", i, error );
-    }
+      if(!src_profile)
+        oyCompLogMessage(NULL, "compicc", CompLogLevelWarn,
+             DBG_STRING "Output %s: no oyASSUMED_WEB src_profile",
+             DBG_ARGS, ccontext->output_name );
 
-    oyFree_m_(rank_map_text);
-    oyConfig_Release( &device );
+      /* optionally set advanced options from Oyranos */
+      if(advanced)
+        flags = oyOPTIONATTRIBUTE_ADVANCED;
 
+      oyCompLogMessage( NULL, "compicc", CompLogLevelDebug,
+                      DBG_STRING "oyConversion_Correct(///icc_color,%d,0) %s %s",
+                      DBG_ARGS, flags, ccontext->output_name,
+                      advanced?"advanced":"");
+      oyImage_s * image_in = oyImage_Create( GRIDPOINTS,GRIDPOINTS*GRIDPOINTS,
+                                             ccontext->clut,
+                                             pixel_layout, src_profile, testobj );
+      oyImage_s * image_out= oyImage_Create( GRIDPOINTS,GRIDPOINTS*GRIDPOINTS,
+                                             ccontext->clut,
+                                             pixel_layout, dst_profile, testobj );
 
-    oyDeviceFromJSON( json_text, 0, &device );
-    if(json_text) { free( json_text ); json_text = 0; }
-    oyDeviceToJSON( device, 0, &json_text, malloc );
+      oyProfile_Release( &src_profile );
 
-    if( json_text && strlen(json_text) )
-    { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "json from device [%d]         %d    ", i, (int)strlen(json_text) );
-    } else
-    { PRINT_SUB( oyTESTRESULT_FAIL,
-    "json from device failed for %d        ", i );
-    }
+      oyOptions_SetFromString( &options, "org/oyranos/cmm/any/cached", "1", OY_CREATE_NEW );
+      cc = oyConversion_CreateBasicPixels( image_in, image_out, options, testobj );
+      if (cc == NULL)
+      {
+        oyCompLogMessage( NULL, "compicc", CompLogLevelWarn,
+                      DBG_STRING "no conversion created for %s",
+                      DBG_ARGS, ccontext->output_name);
+        goto clean_setupColourTable;
+      }
+      oyOptions_Release( &options );
 
-    oyConfig_Release( &device );
-    oyFree_m_(json_text);
-    fprintf( zout, "\n");
-  }
-  oyConfigs_Release( &devices );
+      oyOptions_SetFromString( &options,
+                                     "//" OY_TYPE_STD "/config/display_mode", "1",
+                                     OY_CREATE_NEW );
+      error = oyConversion_Correct(cc, "//" OY_TYPE_STD "/icc_color", flags, options);
+      if(error > 0)
+      {
+        oyCompLogMessage( NULL, "compicc", CompLogLevelWarn,
+                      DBG_STRING "oyConversion_Correct(///icc_color,%d,0) failed %s, %d",
+                      DBG_ARGS, flags, ccontext->output_name, error);
+        goto clean_setupColourTable;
+      }
+      oyOptions_Release( &options );
 
-  char ** list = NULL;
-  error = oyRankMapList( NULL, NULL, &list, oyAllocateFunc_ );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyRankMapList() error: %d", error )
-  count = 0;
-  while( list && list[count]) ++count;
-  if( count >= 3 )
-  { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "found rank maps                 %d    ", count );
-  } else
-  { PRINT_SUB( oyTESTRESULT_FAIL,
-    "found too few rank maps         %d %d ", count, error );
-  }
+      oyFilterGraph_s * cc_graph = oyConversion_GetGraph( cc );
+      oyFilterNode_s * icc = oyFilterGraph_GetNode( cc_graph, -1, "///icc_color", 0 );
+      oyBlob_s * blob = oyFilterNode_ToBlob( icc, testobj );
 
-  for( i = 0; i < count; ++i )
-  {
-    fprintf( zout, "%d: %s\n", i, list[i] );
-  }
+      if(!blob)
+      {
+        oyConversion_Release( &cc );
+        oyFilterNode_Release( &icc );
 
-  oyStringListRelease_( &list, count, oyDeAllocateFunc_ );
+        oyOptions_SetFromString( &options, OY_DEFAULT_CMM_CONTEXT, "lcm2", OY_CREATE_NEW );
+        cc = oyConversion_CreateBasicPixels( image_in, image_out, options, testobj );
+        if (cc == NULL)
+        {
+          oyCompLogMessage( NULL, "compicc", CompLogLevelWarn,
+                      DBG_STRING "no conversion created for %s",
+                      DBG_ARGS, ccontext->output_name);
+          goto clean_setupColourTable;
+        }
+        oyOptions_Release( &options );
+        oyOptions_SetFromString( &options,
+                                     "//" OY_TYPE_STD "/config/display_mode", "1",
+                                     OY_CREATE_NEW );
+        error = oyConversion_Correct(cc, "//" OY_TYPE_STD "/icc_color", flags, options);
+        icc = oyFilterGraph_GetNode( cc_graph, -1, "///icc_color", 0 );
+        blob = oyFilterNode_ToBlob( icc, NULL );
+      }
 
-  error = oyOptions_SetFromString( &options, "//" OY_TYPE_STD "/config/path",
-                                   "1", OY_CREATE_NEW );  
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_SetFromString() error: %d", error )
-  error = oyRankMapList( NULL, options, &list, oyAllocateFunc_ );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyRankMapList() error: %d", error )
-  oyOptions_Release( &options );
-  count = 0;
-  while( list && list[count]) ++count;
-  if( count >= 1 )
-  { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "found rank map paths            %d    ", count );
-  } else
-  { PRINT_SUB( oyTESTRESULT_FAIL,
-    "found too few rank map paths    %d %d ", count, error );
-  }
+      {
+        oyOptions_s * node_opts = oyFilterNode_GetOptions( icc, 0 );
+        oyProfile_s * dl;
+        dl = oyProfile_FromMem( oyBlob_GetSize( blob ),
+                                oyBlob_GetPointer( blob ), 0,testobj );
+        const char * fn;
+        int j = 0;
+        while((fn = oyProfile_GetFileName( dl, j )) != NULL)
+        {
+          fprintf( zout, " -> \"%s\"[%d]", fn, j );
+          ++j;
+        }
+        dl_count = j;
+        fprintf( zout, " %d\n", dl_count );
+        if(oy_debug) fprintf( zout, "%s\n", oyOptions_GetText( node_opts, oyNAME_NAME ) );
+      }
 
-  for( i = 0; i < count; ++i )
-  {
-    fprintf( zout, "%d: %s\n", i, list[i] );
-  }
-  oyStringListRelease_( &list, count, oyDeAllocateFunc_ );
+      uint32_t exact_hash_size = 0;
+      char * hash_text = 0;
+      const char * t = 0;
+      {
+        t = oyFilterNode_GetText( icc, oyNAME_NAME );
+        if(t)
+          hash_text = strdup(t);
+        if(oy_debug)
+          fprintf( zout, " hash_text = %s", oyNoEmptyString_m_(t) );
+      }
+      oyHash_s * entry;
+      oyArray2d_s * clut = NULL;
+      oyStructList_s * cache = pluginGetPrivatesCache();
+      entry = oyStructList_GetHash( cache, exact_hash_size, hash_text );
+      clut = (oyArray2d_s*) oyHash_GetPointer( entry, oyOBJECT_ARRAY2D_S);
+      oyFilterNode_Release( &icc );
+      oyFilterGraph_Release( &cc_graph );
 
-  fprintf( zout, "\n");
+      if(oy_debug)
+      oyCompLogMessage( NULL, "compicc", CompLogLevelDebug,
+                      DBG_STRING "clut from cache %s %s",
+                      DBG_ARGS, clut?"obtained":"", oyNoEmptyString_m_(hash_text) );
+      if(clut)
+      {
+        ptr = (int**)oyArray2d_GetData(clut);
+        memcpy( ccontext->clut, ptr[0], 
+                sizeof(GLushort) * GRIDPOINTS*GRIDPOINTS*GRIDPOINTS * 3 );
+      } else
+      {
+        uint16_t in[3];
+        for (int r = 0; r < GRIDPOINTS; ++r)
+        {
+          in[0] = floor((double) r / (GRIDPOINTS - 1) * 65535.0 + 0.5);
+          for (int g = 0; g < GRIDPOINTS; ++g) {
+            in[1] = floor((double) g / (GRIDPOINTS - 1) * 65535.0 + 0.5);
+            for (int b = 0; b < GRIDPOINTS; ++b)
+            {
+              in[2] = floor((double) b / (GRIDPOINTS - 1) * 65535.0 + 0.5);
+              for(int j = 0; j < 3; ++j)
+                /* BGR */
+                ccontext->clut[b][g][r][j] = in[j];
+            }
+          }
+        }
 
-  return result;
-}
+        clut = oyArray2d_Create( NULL, GRIDPOINTS*3, GRIDPOINTS*GRIDPOINTS,
+                                 oyUINT16, testobj );
 
-oyTESTRESULT_e testCMMMonitorJSON ()
-{
-  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+        error = oyConversion_RunPixels( cc, 0 );
 
-  fprintf(stdout, "\n" );
+        if(error)
+        {
+          oyCompLogMessage( NULL, "compicc", CompLogLevelWarn,
+                      DBG_STRING "oyConversion_RunPixels() error: %d %s",
+                      DBG_ARGS, error, ccontext->output_name);
+          goto clean_setupColourTable;
+        }
 
-  int i;
-  int error = 0;
-  double clck = 0;
+        ptr = (int**)oyArray2d_GetData(clut);
+        memcpy( ptr[0], ccontext->clut,
+                sizeof(GLushort) * GRIDPOINTS*GRIDPOINTS*GRIDPOINTS * 3 );
 
-#ifdef USE_GETTEXT
-  setlocale(LC_ALL,"");
-#endif
+        oyHash_SetPointer( entry, (oyStruct_s*) clut );
+      }
 
-  oyConfigs_s * configs = 0;
-  oyConfig_s * config = 0;
-  int devices_n = 0;
-  oyOptions_s * options = NULL;
-  char * first_json = NULL;
+      if(hash_text)
+      {
+        cicc_free(hash_text); hash_text = 0;
+      }
 
-  clck = oyClock();
-  error = oyOptions_SetFromString( &options,
-                                     "//" OY_TYPE_STD "/config/command",
-                                     "properties", OY_CREATE_NEW );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_SetFromString() error: %d", error )
-  error = oyDevicesGet( 0, "monitor", options, &configs );
-  if( error <= 0 && configs )
-  { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyDevicesGet(\"monitor\")           " );
-  } else if(displayFail() == oyTESTRESULT_FAIL)
-  { PRINT_SUB( displayFail(),
-    "oyDevicesGet(\"monitor\")           " );
-  }
 
-  devices_n = oyConfigs_Count( configs );
-  if( error <= 0 && devices_n > 0 )
-  { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyDevicesGet(\"monitor\") count:   %d", devices_n );
-  } else if(displayFail() == oyTESTRESULT_FAIL)
-  { PRINT_SUB( displayFail(),
-    "oyDevicesGet(\"monitor\") count:   %d", devices_n );
-  }
+      oyOptions_Release( &options );
+      oyImage_Release( &image_in );
+      oyImage_Release( &image_out );
+      oyConversion_Release( &cc );
 
-  clck = oyClock() - clck;
-  for( i = 0; i < devices_n; ++i )
-  {
-    char * json_text = 0;
-    config = oyConfigs_Get( configs, i );
-    error = oyDeviceToJSON( config, 0, &json_text, malloc );
-    fprintf(zout, "  %d oyDeviceToJSON():\n%s\n", i,
-            json_text?json_text:"---" );
+      cdCreateTexture( ccontext );
 
-    oyConfig_Release( &config );
-    if( !error && json_text )
-    { PRINT_SUB( oyTESTRESULT_SUCCESS,
-      "oyDeviceToJSON() \"monitor\"       " );
-      if(i == 0)
-        first_json = strdup(json_text);
-    } else
-    { PRINT_SUB( oyTESTRESULT_FAIL,
-      "oyDeviceToJSON() \"monitor\"      %d", error );
     }
 
-    if(i == 1)
+    if(!ccontext->dst_profile)
     {
-      if(strcmp(json_text,first_json) != 0)
-      { PRINT_SUB( oyTESTRESULT_SUCCESS,
-        "found second unique monitor        " );
-      } else
-      { PRINT_SUB( oyTESTRESULT_FAIL,
-        "first and second monitor are equal " );
-      }
+      oyCompLogMessage( NULL, "compicc", CompLogLevelInfo,
+                      DBG_STRING "Output \"%s\": no profile",
+                      DBG_ARGS, ccontext->output_name);
     }
 
-    error = oyDeviceFromJSON( json_text, 0, &config );
-    if( !error && config )
-    { PRINT_SUB( oyTESTRESULT_SUCCESS,
-      "oyDeviceFromJSON() %d             ", oyConfig_Count(config) );
-    } else
-    { PRINT_SUB( oyTESTRESULT_FAIL,
-      "oyDeviceFromJSON() %d %d           ", oyConfig_Count(config), error );
-    }
+    clean_setupColourTable:
+    if(web)
+      oyProfile_Release( &web );
 
- 
-#   ifdef HAVE_X11
-    if(i == 0)
-    {
-      int r OY_UNUSED;
-      r = system("xprop -remove _ICC_PROFILE -root; xprop -remove _ICC_DEVICE_PROFILE -root");
-    }
-#   endif
-    oyProfile_s * p = NULL;
-    oyOptions_SetFromString( &options,
-                  "//" OY_TYPE_STD "/config/command",
-                           "list", OY_CREATE_NEW );
-    oyOptions_SetFromString( &options,
-                   "//" OY_TYPE_STD "/config/icc_profile.x_color_region_target",
-                          "yes", OY_CREATE_NEW );
-    error = oyDeviceGetProfile( config, options, &p );
-    if(error > 0) PRINT_SUB( oyTESTRESULT_XFAIL, "oyDeviceGetProfile() error: %d", error )
-    if( p )
-    { PRINT_SUB( oyTESTRESULT_SUCCESS,
-      "oyDeviceGetProfile(\"list\") \"%s\"", oyProfile_GetText(p,oyNAME_DESCRIPTION) );
-    } else
-    { PRINT_SUB( oyTESTRESULT_FAIL,
-      "oyDeviceGetProfile(\"list\")  %d", error );
-    }
-    oyProfile_s * list_profile = p; p = NULL;
+  return dl_count;
+}
 
-#   ifdef HAVE_X11
-    if(i == 0)
-    {
-      int r OY_UNUSED;
-      r = system("xprop -root -len 4 | grep _ICC");
-    }
-#   endif
+oyTESTRESULT_e testClut ()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
 
-    oyOptions_SetFromString( &options,
-                   "//" OY_TYPE_STD "/config/icc_profile.fallback",
-                          "yes", OY_CREATE_NEW );
-    error = oyDeviceGetProfile( config, options, &p );
-    if(error == -1)
-      PRINT_SUB( oyTESTRESULT_SUCCESS, "oyDeviceGetProfile(\"fallback\") error:       %d", error )
-    else
-      PRINT_SUB( oyTESTRESULT_XFAIL, "oyDeviceGetProfile(\"fallback\") error:       %d", error )
-    if( p )
-    { PRINT_SUB( oyTESTRESULT_SUCCESS,
-      "oyDeviceGetProfile(\"fallback\") \"%s\"", oyProfile_GetText(p,oyNAME_DESCRIPTION) );
-    } else
-    { PRINT_SUB( oyTESTRESULT_FAIL,
-      "oyDeviceGetProfile(\"fallback\")    " );
-    }
-    oyProfile_Release( &p );
-    oyConfig_Release( &config );
-    oyOptions_Release( &options );
+  fprintf(stdout, "\n" );
 
+  oyTestCacheListClear_();
 
+  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  PrivColorContext pc = {
+    oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, NULL ), /* the data profile or device link */
+    oyProfile_FromFile( "compatibleWithAdobeRGB1998.icc", icc_profile_flags, NULL ), /* the monitor profile or none */
+    oyStringCopy( "*TEST*", oyAllocateFunc_ ), /* the intented output device */
+    {{{0}}},
+    0,
+    0,0,
+    0
+  };
+  double clck = oyClock();
+  int dl_count = setupColourTable( &pc, 0 );
+  int r=12,g=12,b=2;
+  clck = oyClock() - clck;
+  uint16_t c[3] = {pc.clut[r][g][b][0],pc.clut[r][g][b][1],pc.clut[r][g][b][2]};
+  fprintf(zout, "compatibleWithAdobeRGB1998.icc %d,%d,%d\n", pc.clut[r][g][b][0],pc.clut[r][g][b][1],pc.clut[r][g][b][2]);
 
-    error = oyDeviceFromJSON( json_text, 0, &config );
-    if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyDeviceFromJSON() error: %d", error )
-    oyOptions_SetFromString( &options,
-                  "//" OY_TYPE_STD "/config/command",
-                           "properties", OY_CREATE_NEW );
-    oyOptions_SetFromString( &options,
-                   "//" OY_TYPE_STD "/config/icc_profile.x_color_region_target",
-                          "yes", OY_CREATE_NEW );
-    error = oyDeviceGetProfile( config, options, &p );
-    if( !error && p )
-    { PRINT_SUB( oyTESTRESULT_SUCCESS,
-      "oyDeviceGetProfile(\"properties\") \"%s\"", oyProfile_GetText(p,oyNAME_DESCRIPTION) );
-    } else
-    { PRINT_SUB( oyTESTRESULT_FAIL,
-      "oyDeviceGetProfile(\"properties\")  %d", error );
-    }
+  int count = oyStructList_Count( oy_test_cache_ );
+  if( count )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "clut cached            %d %s", count,
+                   oyProfilingToString(1,clck/(double)CLOCKS_PER_SEC,"Tex"));
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "clut cache empty                      " );
+  }
+  oyProfile_Release( &pc.dst_profile );
 
 
-    if(oyProfile_Equal(p,list_profile))
-    { PRINT_SUB( oyTESTRESULT_SUCCESS,
-      "\"list\" == \"properties\" profile" );
-    } else
-    { PRINT_SUB( oyTESTRESULT_FAIL,
-      "\"list\" == \"properties\" profile" );
-    }
-    oyProfile_Release( &p );
-    oyProfile_Release( &list_profile );
+  // test outside DB change
+  char * old_daemon = oyGetPersistentString(OY_DEFAULT_DISPLAY_WHITE_POINT_DAEMON, 0, oySCOPE_USER_SYS, 0);
+  int old_display_white_point = oyGetBehaviour( oyBEHAVIOUR_DISPLAY_WHITE_POINT );
+  char * value = NULL;
+  oyStringAddPrintf( &value, oyAllocateFunc_, oyDeAllocateFunc_,
+                     "%d", old_display_white_point != 0 ? 0 : 7 );
+  oyDBSetString( OY_DEFAULT_DISPLAY_WHITE_POINT_DAEMON, oySCOPE_USER,
+                 old_daemon ? NULL : "oyranos-monitor-white-point",
+                 "testing");
+  oyDBSetString( OY_DEFAULT_DISPLAY_WHITE_POINT, oySCOPE_USER, value,
+                 "testing");
+  /* clear the DB cache */
+  oyGetPersistentStrings( NULL );
+  int display_white_point = oyGetBehaviour( oyBEHAVIOUR_DISPLAY_WHITE_POINT );
+  fprintf(zout, "old_value: %d -> setting oyBEHAVIOUR_DISPLAY_WHITE_POINT: %s  check %d\n", old_display_white_point, value, display_white_point );
+  oyFree_m_( value );
 
 
-    oyOptions_SetFromString( &options,
-                   "//" OY_TYPE_STD "/config/icc_profile.fallback",
-                          "yes", OY_CREATE_NEW );
-    error = oyDeviceGetProfile( config, options, &p );
-    if(error == -1)
-      PRINT_SUB( oyTESTRESULT_SUCCESS, "oyDeviceGetProfile(\"fallback\") error:       %d", error )
-    else
-      PRINT_SUB( oyTESTRESULT_XFAIL, "oyDeviceGetProfile(\"fallback\") error:       %d", error )
-    if( p )
-    { PRINT_SUB( oyTESTRESULT_SUCCESS,
-      "oyDeviceGetProfile(\"fallback\") \"%s\"", oyProfile_GetText(p,oyNAME_DESCRIPTION) );
-    } else
-    { PRINT_SUB( oyTESTRESULT_FAIL,
-      "oyDeviceGetProfile(\"fallback\")    " );
-    }
+  pc.dst_profile = oyProfile_FromFile( "LStar-RGB.icc", icc_profile_flags, testobj );
+  int dl_count2 = setupColourTable( &pc, 0 ); 
+  fprintf(zout, "LStar-RGB.icc %d,%d,%d\n", pc.clut[r][g][b][0],pc.clut[r][g][b][1],pc.clut[r][g][b][2]);
+  count = oyStructList_Count( oy_test_cache_ );
+  if( !(c[0] == pc.clut[r][g][b][0] || c[1] == pc.clut[r][g][b][1] || c[2] == pc.clut[r][g][b][2]) &&
+      count > 1 && dl_count != dl_count2)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "cache difference                %d %d!=%d", count, dl_count, dl_count2 );
+  } else
+  { PRINT_SUB( oyTESTRESULT_XFAIL,
+    "cache difference                %d %d!=%d", count, dl_count, dl_count2 );
+  }
 
 
-    oyProfileTag_s * tag = oyProfile_GetTagById( p, (icTagSignature)icSigMetaDataTag );
-    if( tag )
-    { PRINT_SUB( oyTESTRESULT_SUCCESS,
-      "oyProfile_GetTagById(icSigMetaDataTag)" );
-    } else
-    { PRINT_SUB( oyTESTRESULT_FAIL,
-      "oyProfile_GetTagById(icSigMetaDataTag)" );
-    }
+  // reset to old value
+  oySetBehaviour( oyBEHAVIOUR_DISPLAY_WHITE_POINT, oySCOPE_USER, old_display_white_point );
+  if(old_daemon)
+  {
+    oySetPersistentString( OY_DEFAULT_DISPLAY_WHITE_POINT_DAEMON, oySCOPE_USER, old_daemon, NULL);
+    oyFree_m_(old_daemon);
+  }
+  return result;
+}
 
-    int32_t texts_n = 0, tag_size = 0;
-    char ** texts = oyProfileTag_GetText( tag, &texts_n, NULL, NULL,
-                                          &tag_size, oyAllocateFunc_ );
-    if( texts_n > 2 && tag_size )
-    { PRINT_SUB( oyTESTRESULT_SUCCESS,
-      "oyProfileTag_GetText(meta) texts: %d tag size: %d", texts_n, tag_size );
-    } else
-    { PRINT_SUB( oyTESTRESULT_FAIL,
-      "oyProfileTag_GetText(meta) texts: %d tag size: %d", texts_n, tag_size );
-    }
 
-    int edid_mnft_count = 0;
-    for(int j = 0; j < texts_n; ++j)
-    {
-      //fprintf( zout, "%s\n", texts[j] );
-      if(strstr(texts[j],"EDID_mnft_id") != NULL)
-        ++edid_mnft_count;
-    }
-    // one single key is needed
-    // otherwise the monitor is defect or
-    // there is key duplication
-    if( edid_mnft_count == 1 )
-    { PRINT_SUB( oyTESTRESULT_SUCCESS,
-      "Found EDID_mnft_id keys in meta tag: %d", edid_mnft_count );
-    } else
-    { PRINT_SUB( oyTESTRESULT_FAIL,
-      "Found EDID_mnft_id keys in meta tag: %d", edid_mnft_count );
-    }
-
-    oyConfig_Release( &config );
-    oyOptions_Release( &options );
-    oyFree_m_( json_text );
-  }
-
-  oyConfigs_Release( &configs );
-  fprintf( zout, "\n");
-
-  if(result == oyTESTRESULT_UNKNOWN && displayFail() == oyTESTRESULT_XFAIL)
-    result = oyTESTRESULT_SUCCESS;
-
-  return result;
-}
-
-
-oyTESTRESULT_e testCMMMonitorListing ()
+#include "oyranos_object_internal.h"
+oyTESTRESULT_e testRegistrationMatch ()
 {
   oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
 
   fprintf(stdout, "\n" );
 
-  int i, k, k_n;
-  int error = 0;
-  double clck = 0;
-
-#ifdef USE_GETTEXT
-  setlocale(LC_ALL,"");
-#endif
-
-  oyConfigs_s * configs = 0;
-  oyConfig_s * config = 0;
-  oyOption_s * o = 0;
-  int devices_n = 0;
-  char * device_name = 0;
-  char * text = 0,
-       * val = 0;
-
-  clck = oyClock();
-  error = oyDevicesGet( 0, "monitor", 0, &configs );
-  clck = oyClock() - clck;
-  devices_n = oyConfigs_Count( configs );
-  if( !error )
+  if( oyFilterRegistrationMatch(OY_INTERNAL "/icc_color.lcms",
+                                "//" OY_TYPE_STD "/icc_color",
+                                oyOBJECT_CMM_API4_S ))
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyDevicesGet() \"monitor\": %d                      %s", devices_n,
-                   oyProfilingToString(1,clck/(double)CLOCKS_PER_SEC,"Obj."));
-  } else if(displayFail() == oyTESTRESULT_FAIL)
-  { PRINT_SUB( displayFail(),
-    "oyDevicesGet() \"monitor\": %d     ", devices_n );
+    "simple CMM selection                  " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "simple CMM selection                  " );
   }
-  for( i = 0; i < devices_n; ++i )
-  {
-    config = oyConfigs_Get( configs, i );
-    fprintf(zout, "  %d oyConfig_FindString(..\"device_name\"..): %s\n", i,
-            oyConfig_FindString( config, "device_name",0 ) );
-    if(i==0)
-      device_name = oyStringCopy(oyConfig_FindString( config, "device_name",0),
-                                  oyAllocateFunc_ );
-
-    clck = oyClock();
-    error = oyDeviceProfileFromDB( config, &text, myAllocFunc );
-    if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyDeviceProfileFromDB() error: %d", error )
-    clck = oyClock() - clck;
-    if(text)
-      fprintf( zout, "  %d oyDeviceProfileFromDB(): %s %s\n", i, text,
-                   oyProfilingToString(1,clck/(double)CLOCKS_PER_SEC,"Obj."));
-    else
-      fprintf( zout, "  %d oyDeviceProfileFromDB(): ---\n", i );
-
-    clck = oyClock();
-    error = oyDeviceGetInfo( config, oyNAME_NICK, 0, &text, 0 );
-    if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyDeviceGetInfo() error: %d", error )
-    clck = oyClock() - clck;
-    fprintf( zout, "  %d oyDeviceGetInfo)(..oyNAME_NICK..): \"%s\" %s\n",
-             i, text? text:"???",
-                   oyProfilingToString(1,clck/(double)CLOCKS_PER_SEC,"Obj."));
-    clck = oyClock();
-    error = oyDeviceGetInfo( config, oyNAME_NAME, 0, &text, 0 );
-    if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyDeviceGetInfo() error: %d", error )
-    clck = oyClock() - clck;
-    fprintf( zout, "  %d oyDeviceGetInfo)(..oyNAME_NAME..): \"%s\" %s\n",
-             i, text? text:"???",
-                   oyProfilingToString(1,clck/(double)CLOCKS_PER_SEC,"Obj."));
 
-    oyConfig_Release( &config );
+  if(!oyFilterRegistrationMatch(OY_INTERNAL "/icc_color.lcms",
+                                "//" OY_TYPE_STD "/icc_color.octl",
+                                oyOBJECT_CMM_API4_S ))
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "simple CMM selection no match         " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "simple CMM selection no match         " );
   }
-  oyConfigs_Release( &configs );
-  fprintf( zout, "\n");
 
-  error = oyDeviceGet( 0, "monitor", device_name, 0, &config );
-  k_n = oyConfig_Count( config );
-  if( !error )
+  if( oyFilterRegistrationMatch(OY_INTERNAL "/icc_color.lcms",
+                                "//" OY_TYPE_STD "/icc_color.4+lcms",
+                                oyOBJECT_CMM_API4_S ))
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyDeviceGet(..\"monitor\" \"%s\"..) %d     ", device_name, k_n );
+    "special CMM selection                 " );
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyDeviceGet(..\"monitor\" \"%s\"..) %d     ", device_name, k_n );
+    "special CMM selection                 " );
   }
-    for( k = 0; k < k_n; ++k )
-    {
-      o = oyConfig_Get( config, k );
-      val = oyOption_GetValueText( o, oyAllocateFunc_ );
-
-      fprintf(zout, "  %d %s: \"%s\"\n", k, oyOption_GetRegistration(o), val );
 
-      if(val) { oyDeAllocateFunc_( val ); val = 0; }
-      oyOption_Release( &o );
-    }
-  oyConfig_Release( &config );
-  oyConfigs_Release( &configs );
-  fprintf( zout, "\n");
+  if(!oyFilterRegistrationMatch(OY_INTERNAL "/icc_color.lcms",
+                                "//" OY_TYPE_STD "/icc_color.4-lcms",
+                                oyOBJECT_CMM_API4_S ))
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "special CMM avoiding                  " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "special CMM avoiding                  " );
+  }
 
+  if( oyFilterRegistrationMatch(OY_INTERNAL "/icc_color.lcms",
+                                "//" OY_TYPE_STD "/icc_color.7-lcms",
+                                oyOBJECT_CMM_API4_S ))
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "special CMM avoiding, other API       " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "special CMM avoiding, other API       " );
+  }
 
-  return result;
-}
+  if( oyFilterRegistrationMatch("org/freedesktop/openicc/device/monitor/manufacturer",
+                                "org/freedesktop/openicc/device/monitor/model",
+                                oyOBJECT_NONE ) == 0)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "device key mismatch                   " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "device key mismatch                   " );
+  }
 
-oyTESTRESULT_e testCMMDBListing ()
-{
-  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  if( oyFilterRegistrationMatch("org/freedesktop/openicc/device/monitor/manufacturer",
+                                "org/freedesktop/openicc/device/monitor/manufacturer",
+                                oyOBJECT_NONE ))
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "device key match                      " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "device key match                      " );
+  }
 
-  fprintf(stdout, "\n" );
+  if( oyFilterRegistrationMatch("org/freedesktop/openicc/device/monitor/manufacturer/short",
+                                "org/freedesktop/openicc/device/monitor/manufacturer/full",
+                                oyOBJECT_NONE ) == 0)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "long device key mismatch              " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "long device key mismatch              " );
+  }
 
-  int j, k, j_n, k_n;
-  int error = 0;
-  oyConfigs_s * configs = 0;
-  oyConfig_s * config = 0;
-  oyOption_s * o = 0;
-  char * val = 0;
+  if( oyFilterRegistrationMatch("org/freedesktop/openicc/device/monitor/manufacturer/short",
+                                "org/freedesktop/openicc/device/monitor/manufacturer/short",
+                                oyOBJECT_NONE ))
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "long device key match                 " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "long device key match                 " );
+  }
 
-  error = oyConfigs_FromDB( OY_DEVICE_STD "/monitor", NULL, &configs, testobj );
-  j_n = oyConfigs_Count( configs );
-  if( !error )
+  if( oyFilterStringMatch( "abc-def-ghi",
+                           "+def._ghi.-jkl", oyOBJECT_NONE, '/', '.',
+                           OY_MATCH_SUB_STRING ))
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyConfigs_FromDB( \"" OY_DEVICE_STD "/monitor" "\" ) count: %d     ", j_n );
+    "oyFilterStringMatch(sub string match) " );
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyConfigs_FromDB( \"" OY_DEVICE_STD "/monitor" "\" ) count: %d     ", j_n );
+    "oyFilterStringMatch(sub string match) " );
   }
-  for( j = 0; j < j_n; ++j )
+
   {
-    config = oyConfigs_Get( configs, j );
+    const char * regs[] = {
+      OY_INTERNAL "/icc_color.lcms",
+      "org/freedesktop/openicc/icc_color/display.icc_profile.abstract._effect",
+      "org/freedesktop/openicc/device/monitor/manufacturer/short",
+      "shared/oyranos.org/imaging/scale/x",
+      "org/oyranos/openicc/icc_color._lcm2._CPU._NOACCEL.4_lcm2" };
+    const char * patterns[] = {
+      "//" OY_TYPE_STD "/icc_color",
+      "//" OY_TYPE_STD "/icc_color.4+lcms",
+      "//" OY_TYPE_STD "/icc_color.4-lcms",
+      "//" OY_TYPE_STD "/icc_color.7-lcms",
+      "org/freedesktop/openicc/device/monitor/manufacturer",
+      "display.icc_profile", "x", "_effect", "4+lcm2" };
+    int rn = sizeof(regs)/sizeof(char*), pn = sizeof(patterns)/sizeof(char*),
+        i, j, n = 1000000, fails = 0, m1 = 0, m2 = 0;
+    oyRegPattern_s * rc[5], * pc[9];
+    double clck;
+
+    for(i = 0; i < rn; ++i)
+      rc[i] = oyRegPatternNew_( regs[i], 0, oyDeAllocateFunc_ );
+    for(j = 0; j < pn; ++j)
+      pc[j] = oyRegPatternNew_( patterns[j], 0, oyDeAllocateFunc_ );
+
+    for(i = 0; i < rn; ++i)
+      for(j = 0; j < pn; ++j)
+        if(oyFilterRegistrationMatch( regs[i], patterns[j], oyOBJECT_CMM_API4_S ) !=
+           oyRegPatternMatch_( rc[i], pc[j], oyOBJECT_CMM_API4_S, 0 ))
+          ++fails;
+
+    if(!fails)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyRegPatternMatch_() == oyFilterRegistrationMatch() %d", rn*pn );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyRegPatternMatch_() == oyFilterRegistrationMatch() %d/%d", fails, rn*pn );
+    }
 
-    k_n = oyConfig_Count( config );
-    for( k = 0; k < k_n; ++k )
-    {
-      o = oyConfig_Get( config, k );
+    clck = oyClock();
+    for(i = 0; i < n; ++i)
+      m1 += oyFilterRegistrationMatch( regs[i%rn], patterns[i%pn],
+                                       oyOBJECT_CMM_API4_S );
+    clck = oyClock() - clck;
+    fprintf( zout, "oyFilterRegistrationMatch()      %s\n",
+             oyProfilingToString(n,clck/(double)CLOCKS_PER_SEC, "matches") );
 
-      val = oyOption_GetValueText( o, oyAllocateFunc_ );
-      fprintf(zout, "  %d::%d %s %s\n", j,k, oyOption_GetRegistration(o), val );
+    clck = oyClock();
+    for(i = 0; i < n; ++i)
+      m2 += oyRegPatternMatch_( rc[i%rn], pc[i%pn], oyOBJECT_CMM_API4_S, 0 );
+    clck = oyClock() - clck;
 
-      if(val) { oyDeAllocateFunc_( val ); val = 0; }
-      oyOption_Release( &o );
+    if(m1 == m2)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyRegPatternMatch_() compiled       %s",
+      oyProfilingToString(n,clck/(double)CLOCKS_PER_SEC, "matches") );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyRegPatternMatch_() compiled       %d/%d", m2, m1 );
     }
 
-    oyConfig_Release( &config );
+    for(i = 0; i < rn; ++i)
+      oyRegPatternRelease_( &rc[i], 0, oyDeAllocateFunc_ );
+    for(j = 0; j < pn; ++j)
+      oyRegPatternRelease_( &pc[j], 0, oyDeAllocateFunc_ );
   }
 
   return result;
 }
 
-oyTESTRESULT_e testCMMMonitorModule ()
+oyTESTRESULT_e test_oyTextIccDictMatch ()
 {
   oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
-  oyConfigs_s * devices = 0;
-  oyOptions_s * options = 0;
-  const char * t = ":0.100";
-  int error = 0;
 
   fprintf(stdout, "\n" );
 
-  /* non existing display */
-  error = oyOptions_SetFromString( &options,
-                                 "//" OY_TYPE_STD "/config/device_name",
-                                 t, OY_CREATE_NEW );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_SetFromString() error: %d", error )
-  /* clean up */
-  error = oyOptions_SetFromString( &options,
-                                 "//" OY_TYPE_STD "/config/command",
-                                 "unset", OY_CREATE_NEW );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "(oyOptions_SetFromString) error: %d", error )
-  error = oyDevicesGet( OY_TYPE_STD, "monitor", options, &devices );
-  oyConfigs_Release( &devices );
-
-  if( error == -1
-#ifdef __APPLE__
-      ||  error == 0
-#endif
-    )
+  if( oyTextIccDictMatch("ABC",
+                         "ABC", 0, '/', ','))
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyDevicesGet( \"//" OY_TYPE_STD "\", unset, ... ) = %d", error );
+    "simple text matching                  " );
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyDevicesGet( \"//" OY_TYPE_STD "\", unset, ... ) = %d", error );
+    "simple text matching                  " );
   }
 
-  return result;
-}
-
-oyTESTRESULT_e testCMMmonitorDBmatch ()
-{
-  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  if(!oyTextIccDictMatch("ABC",
+                         "ABCD", 0, '/', ','))
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "simple text mismatching               " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "simple text mismatching               " );
+  }
 
-  fprintf(stdout, "\n" );
+  if( oyTextIccDictMatch("abcd,ABC,efgh",
+                         "abcdef,12345,ABC", 0, '/', ','))
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "multiple text matching                " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "multiple text matching                " );
+  }
 
-  int k, k_n;
-  int32_t rank = 0;
-  int error = 0;
-  oyConfig_s * device = 0;
-  oyOption_s * o = 0;
-  char * val = 0;
-  double clck = 0;
-  char * device_name = NULL;
+  if( oyTextIccDictMatch("abcd,ABC,efgh,12345",
+                         "abcdef,12345,ABCD", 0.0005, '/', ','))
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "multiple integer matching             " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "multiple integer matching             " );
+  }
 
-  /* X11 */
-#if !defined(__APPLE__)
-  if(getenv("DISPLAY"))
-  {
-    device_name = oyStringCopy( getenv("DISPLAY"), oyAllocateFunc_ );
-    if(strchr(device_name, '.') == NULL)
-      oyStringAddPrintf( &device_name, oyAllocateFunc_, oyDeAllocateFunc_,
-                         ".0" );
+  if(!oyTextIccDictMatch("abcd,ABC,efgh,12345",
+                         "abcdef,12345ABCD", 0.0005, '/', ','))
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "multiple integer mismatching          " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "multiple integer mismatching          " );
   }
-#endif
-  if(!device_name)
-    device_name = oyStringCopy( "0", oyAllocateFunc_ );
 
-  fprintf( zout, "load a device ...\n");
-  clck = oyClock();
-  error = oyDeviceGet( 0, "monitor", device_name, 0, &device );
-  clck = oyClock() - clck;
-  k_n = oyConfig_Count( device );
-  if( !error )
+  if( oyTextIccDictMatch("abcd,ABC,efgh,123.45001",
+                         "abcdef,123.45,ABCD", 0.0005, '/', ','))
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyDeviceGet(..\"monitor\" \"%s\".. &device) %d %s", device_name, k_n,
-                   oyProfilingToString(1,clck/(double)CLOCKS_PER_SEC,"Obj."));
-  } else if(displayFail() == oyTESTRESULT_FAIL)
-  { PRINT_SUB( displayFail(),
-    "oyDeviceGet(..\"monitor\" \"%s\".. &device) %d", device_name, k_n );
+    "multiple float matching               " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "multiple float matching               " );
   }
 
-  fprintf( zout, "... and search for the devices DB entry ...\n");
-  clck = oyClock();
-  error = oyConfig_GetDB( device, NULL, &rank );
-  clck = oyClock() - clck;
-  if( !error )
+  if(!oyTextIccDictMatch("abcd,ABC,efgh,123.45",
+                         "abcdef,123", 0.0005, '/', ','))
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyConfig_GetDB( device )                  %d %s", (int)rank,
-                   oyProfilingToString(1,clck/(double)CLOCKS_PER_SEC,"Obj."));
+    "multiple float mismatching            " );
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyConfig_GetDB( device )                    %s",
-                   oyProfilingToString(1,clck/(double)CLOCKS_PER_SEC,"Obj."));
+    "multiple float mismatching            " );
   }
-  if(device && rank > 0)
-  {
-    fprintf(zout,"rank: %d\n", (int)rank);
-    k_n = oyConfig_Count( device );
-    for( k = 0; k < k_n; ++k )
-    {
-      o = oyConfig_Get( device, k );
+  return result;
+}
 
-      val = oyOption_GetValueText( o, oyAllocateFunc_ );
-      fprintf(zout, "  d::%d %s: \"%s\"\n", k,
-      strchr(strchr(strchr(strchr(oyOption_GetRegistration(o),'/')+1,'/')+1,'/')+1,'/')+1,
-              val );
+oyTESTRESULT_e testPolicy ()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  char *data = 0;
 
-      if(val) { oyDeAllocateFunc_( val ); val = 0; }
-      oyOption_Release( &o );
+  fprintf(stdout, "\n" );
+
+#if 0
+  if(argc > 1)
+  {
+    fprintf(zout,"%s\n", argv[1]);
+    std::ifstream f( argv[1], std::ios::binary | std::ios::ate);
+    if(f.good())
+    {
+      size_t size = f.tellg();
+      f.seekg(0);
+      if(size) {
+        data = (char*) new char [size+1];
+        f.read ((char*)data, size);
+        f.close();
+        std::cout << "Opened file: " << argv[1] << std::endl;
+      }
     }
-    //error = oyConfig_EraseFromDB( config );
   }
+#endif
 
-  oySetPersistentString( OY_STD "/device/test/#0/system_port", oySCOPE_USER, "TEST-port", "TESTcomment" );
-  oySetPersistentString( OY_STD "/device/test/#0/model", oySCOPE_USER, "TEST-model", "TESTcomment" );
-  oySetPersistentString( OY_STD "/device/test/#1/system_port", oySCOPE_USER, "TEST-port2", "TESTcomment2" );
-  oySetPersistentString( OY_STD "/device/test/#1/model", oySCOPE_USER, "TEST-model2", "TESTcomment2" );
-  fprintf(zout, "creating DB device class: \"%s\"\n", OY_STD "/device/test/#[0,1]/system_port: TEST-port/1" );
-
-  const char * reg = OY_STD "/device/test";
-  oyConfigs_s * configs = NULL;
-  error = oyConfigs_FromDB( reg, NULL, &configs, testobj );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyConfigs_FromDB() error: %d", error )
-  int count = oyConfigs_Count( configs );
-  oyConfig_Release( &device );
+  char *xml = data;
+  if( !xml)
+    xml = oyPolicyToXML( oyGROUP_ALL, 1, myAllocFunc );
 
-  if(count == 2)
+  if( xml && xml[0] )
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyConfigs_FromDB( %s ) %d", reg, count);
+    "oyPolicyToXML                         " );
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyConfigs_FromDB( %s )  ", reg);
+    "oyPolicyToXML                         " );
   }
 
-  for(k = 0; k < count; ++k)
-  {
-    oyOptions_s * db;
-    device = oyConfigs_Get( configs, k );
-    db = *oyConfig_GetOptions(device,"db");
-    fprintf(zout, "  d::%d %d: \"%s\"\n", k, oyConfig_Count( device ),
-                  oyOptions_GetText( db, oyNAME_NICK ));
-    int k_n = oyOptions_Count(db);
-    if(k_n == 2)
+  if(xml) {
+    oyReadXMLPolicy(oyGROUP_ALL, xml);
+    fprintf(zout,"xml text: \n%s", xml);
+
+    data = oyPolicyToXML( oyGROUP_ALL, 1, myAllocFunc );
+
+    if( strcmp( data, xml ) == 0 )
     { PRINT_SUB( oyTESTRESULT_SUCCESS,
-      "oyConfig_s[%d] = %d                                           ", k, k_n);
+      "Policy rereading                      " );
     } else
     { PRINT_SUB( oyTESTRESULT_FAIL,
-      "oyConfig_s[%d] = %d                                           ", k, k_n);
+      "Policy rereading                      " );
     }
+
+#ifdef USE_NEW
+    delete [] xml;
+    delete [] data;
+#else
+    free(xml);
+    free(data);
+#endif
   }
 
-  error = oyDBEraseKey( reg, oySCOPE_USER );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyDBEraseKey() error: %d", error )
 
   return result;
 }
 
+#include "oyranos_devices.h"
 
-#include "oyranos_forms.h"
-
-#define H(type,value) oyFormsAddHeadline( &t, type, value,\
-                                           oyAllocateFunc_, oyDeAllocateFunc_ );
-#define CHOICE(ref,label,help) oyFormsStartChoice( &t, ref, label, help,\
-                                           oyAllocateFunc_, oyDeAllocateFunc_ );
-#define ITEM(value,label) oyFormsAddItem( &t, value, label,\
-                                           oyAllocateFunc_, oyDeAllocateFunc_ );
-#define CHOICE_END STRING_ADD( t, "      </xf:choices>\n     </xf:select1>\n" );
-
-#include "oyCMMapi4_s_.h"
-#include "oyCMMapi6_s_.h"
-#include "oyCMMapi7_s_.h"
-#include "oyCMMapi8_s_.h"
-#include "oyCMMapi9_s_.h"
-#include "oyCMMapi10_s_.h"
-#include "oyCMMapiFilter_s_.h"
-#include "oyCMMinfo_s_.h"
-
-#include "oyranos_module.h"
-#include "oyranos_module_internal.h"
-
-oyTESTRESULT_e testCMMsShow ()
+oyTESTRESULT_e testWidgets ()
 {
   oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
 
-  int i, j, k, l;
-  uint32_t count = 0;
-  char ** texts = 0,
-        * text = 0,
-        * text_tmp = (char*)oyAllocateFunc_(65535),
-        * t = 0,
-        * rfile = 0;
-  oyCMMinfo_s_ * cmm_info = 0;
-  oyCMMapi4_s_ * cmm_api4 = 0;
-  oyCMMapi6_s_ * cmm_api6 = 0;
-  oyCMMapi7_s_ * cmm_api7 = 0;
-  oyCMMapi8_s_ * cmm_api8 = 0;
-  oyCMMapi9_s_ * cmm_api9 = 0;
-  oyCMMapi10_s_ * cmm_api10 = 0;
-  oyCMMapi_s_ * tmp = 0;
-  oyCMMapiFilter_s_ * cmm_filter = 0;
+  fprintf(stdout, "\n" );
 
+  const char * name = NULL,
+             * tooltip = NULL;
+  int          flags = 0;
+  const oyGROUP_e * categories = NULL;
 
-  fprintf(zout, "\n" );
+  oyWIDGET_e option = oyWIDGET_RENDERING_INTENT;
+  oyWIDGET_TYPE_e type = oyWidgetTitleGet( option, 
+                                           &categories, &name, &tooltip,
+                                           &flags );
 
-  texts = oyCMMsGetLibNames_p( &count );
+  if( name && tooltip )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyWidgetTitleGet \"%s\" %d\n\t%s %d", name, type, tooltip, flags );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyWidgetTitleGet                      " );
+  }
 
-  /* Create a oforms style xhtml to present in a XFORMS viewer like
-   * oyranos-xforms-fltk or FF with XFORMS plug-in.
-   * Pretty large here.
-   */
-  STRING_ADD( t, "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n\
-<html xmlns=\"http://www.w3.org/1999/xhtml\"\n\
-      xmlns:xf=\"http://www.w3.org/2002/xforms\"\n\
-      xmlns:oicc=\"http://www.oyranos.org/2009/oyranos_icc\">\n" );
-  STRING_ADD( t, "<head>\n\
-  <title>Filter options</title>\n\
-  <xf:model>\n\
-    <xf:instance xmlns=\"\">\n\
-     <shared><dummy>0</dummy></shared>\n\
-    </xf:instance>\n\
-  </xf:model>\n");
-  STRING_ADD( t, "  <style type=\"text/css\">\n\
-  @namespace xf url(\"http://www.w3.org/2002/xforms\");\n\
-  xf|label {\n\
-   font-family: Helvetica, Geneva, Lucida, sans-serif;\n\
-   width: 24ex;\n\
-   text-align: right;\n\
-   padding-right: 1em;\n\
-  }\n\
-  xf|select1 { display: table-row; }\n\
-  xf|select1 xf|label, xf|choices xf|label  { display: table-cell; }\n\
-  </style></head>\n\
-<body>\n\
- <xf:group>\n" );
-  H(3,"Oyranos Module Overview")
+  int choices = 0;
+  const char ** choices_string_list = NULL;
+  int current = -1;
+  int error = oyOptionChoicesGet2( option, 0, oyNAME_NAME,
+                                   &choices, &choices_string_list,
+                                   &current );
 
-  for( i = 0; i < (int)count; ++i)
-  {
-    cmm_info = (oyCMMinfo_s_*)oyCMMinfoFromLibName_p( texts[i] );
-    if(cmm_info)
-      tmp = (oyCMMapi_s_*)cmm_info->api;
-    else
-      tmp = 0;
+  if( !error && choices && choices_string_list && current != -1 )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyOptionChoicesGet2 %d [%d]: %s", choices, current, choices_string_list[current] );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyOptionChoicesGet2                   " );
+  }
+  const char * description = NULL;
+  int choice = current;
+  type = oyWidgetDescriptionGet( option, &description, choice );
+  if( type == oyWIDGETTYPE_BEHAVIOUR && description )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyWidgetDescriptionGet  %s", description );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyWidgetDescriptionGet                " );
+  }
 
-    /* short skip for non compatible modules */
-    if(oyCMMapi_Check_((oyCMMapi_s*)tmp) == oyOBJECT_NONE)
+  oyOptionChoicesFree( option, &choices_string_list, choices );
+
+  option = oyWIDGET_ASSUMED_WEB;
+  type = oyWidgetTitleGet( option, &categories, &name, &tooltip, &flags );
+  if( name && tooltip && (flags & OY_LAYOUT_NO_CHOICES) &&
+      type == oyWIDGETTYPE_DEFAULT_PROFILE )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyWidgetTitleGet \"%s\"\n\t%s %d", name, tooltip, flags );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyWidgetTitleGet                      " );
+  }
+
+  option = oyWIDGET_DISPLAY_WHITE_POINT;
+  type = oyWidgetTitleGet( option, &categories, &name, &tooltip, &flags );
+  error = oyOptionChoicesGet2( option, 0, oyNAME_NAME,
+                               &choices, &choices_string_list,
+                               &current );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptionChoicesGet2() error: %d", error )
+
+  oyConfigs_s * configs = 0;
+  oyOptions_s * options = NULL;
+  error = oyOptions_SetFromString( &options,
+                                     "//" OY_TYPE_STD "/config/command",
+                                     "list", OY_CREATE_NEW );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_SetFromString() error: %d", error )
+  error = oyDevicesGet( 0, "monitor", options, &configs );
+  if(error && displayFail() == oyTESTRESULT_FAIL) PRINT_SUB( oyTESTRESULT_XFAIL, "oyDevicesGet() error: %d", error )
+  int devices_n = oyConfigs_Count( configs );
+  oyOptions_Release( &options );
+  oyConfigs_Release( &configs );
+  int i,j, duplicate = 0;
+  for(i = 0; i < choices; ++i)
+    for(j = i+1; j < choices; ++j)
+      if(strcmp(choices_string_list[i],choices_string_list[j]) == 0)
+        ++duplicate;
+  if(choices == (7 + devices_n) &&
+     duplicate == 0)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyOptionChoicesGet2(%s) %d [%d]: %s", name, choices, current, choices_string_list[current] );
+  } else
+  { if(duplicate)
     {
-      text = oyCMMinfoPrint_( (oyCMMinfo_s*)cmm_info, 1 );
-      STRING_ADD( text, "    Not accepted by oyCMMapi_Check_() - Stop\n");
-      fprintf(zout,"%d: \"%s\": %s\n\n", i, texts[i], text );
-      continue;
+      PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyOptionChoicesGet2(%s) duplicates detected: %d      ", name, duplicate );
+    } else {
+      PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyOptionChoicesGet2(%s) %d != 7 + %d      ", name, choices, devices_n );
     }
+    for(i = 0; i < choices; ++i)
+      fprintf(zout,"\t%s %s\n", i==current?"*":" ", choices_string_list[i]);
+  }
 
-    text = oyCMMinfoPrint_( (oyCMMinfo_s*)cmm_info, 0 );
+  oyOptionChoicesFree( option, &choices_string_list, choices );
 
-        while(tmp)
-        {
-          oyOBJECT_e type = oyOBJECT_NONE;
-          char num[48],
-               * api_reg = 0;
-          const char * ctmp;
+  fprintf( zout, "\n");
 
-          /* oforms */
-          CHOICE( "shared/dummy", oyStructTypeToText(tmp->type_), text )
-          ITEM( "0", cmm_info->cmm )
-          CHOICE_END
+  return result;
+}
 
-          type = oyCMMapi_Check_((oyCMMapi_s*)tmp);
 
-          oySprintf_(num,"    %d:", type );
-          STRING_ADD( text, num );
-          ctmp = oyStruct_TypeToText((oyStruct_s*)tmp);
-          STRING_ADD( text, ctmp );
-          STRING_ADD( text, "\n" );
 
-          if(type == oyOBJECT_CMM_API5_S)
-          {
-            cmm_filter = (oyCMMapiFilter_s_*) tmp;
+oyTESTRESULT_e testCMMDevicesListing ()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
 
-            {
-              oyCMMapiFilter_s_ * api = 0;
-              oyCMMapiFilters_s * apis = 0;
-              uint32_t * rank_list = 0;
-              uint32_t apis_n = 0;
-              char * classe = 0;
+  fprintf(stdout, "\n" );
 
-              classe = oyFilterRegistrationToText( cmm_filter->registration,
-                                                   oyFILTER_REG_TYPE, 0 );
-              api_reg = oyStringCopy("//", oyAllocateFunc_ );
-              STRING_ADD( api_reg, classe );
-              if(classe)
-              oyFree_m_( classe );
+  int i, j, k, j_n, k_n;
+  uint32_t count = 0,
+         * rank_list = 0;
+  int error = 0;
+  char ** texts = 0,
+        * val = 0;
 
+#ifdef USE_GETTEXT
+  setlocale(LC_ALL,"");
+#endif
 
-              H( 4, "API(s) load from Meta module" )
-              STRING_ADD( text, "    API(s) load from Meta module:\n" );
+  /* get all configuration filters */
+  oyConfigDomainList( "//" OY_TYPE_STD "/device/config.icc_profile",
+                      &texts, &count, &rank_list ,0 );
 
-              for(j = oyOBJECT_CMM_API4_S; j <= (int)oyOBJECT_CMM_API10_S; j++)
-              {
-                apis = oyCMMsGetFilterApis_( api_reg, (oyOBJECT_e)j,
-                                             oyFILTER_REG_MODE_NONE,
-                                             &rank_list, &apis_n );
+  if( count )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyConfigDomainList Found CMM's %d     ", (int)count );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyConfigDomainList Found CMM's %d     ", (int)count );
+  }
+  for( i = 0; texts && i < (int)count; ++i)
+  {
+    fprintf( zout, "%d: %s\n", i, texts[i] );
+  }
+  fprintf(zout, "\n" );
 
-                apis_n = oyCMMapiFilters_Count( apis );
-                for(k = 0; rank_list && k < (int)apis_n; ++k)
-                {
-                  api = (oyCMMapiFilter_s_*)oyCMMapiFilters_Get( apis, k );
+  oyConfigs_s * configs = 0;
+  oyConfig_s * config = 0;
+  oyOptions_s * options_list = 0;
+  oyOption_s * o = 0;
+  oyOption_s_ * oi = 0;
+  oyProfile_s * p = 0;
 
-                  if(api)
-                  snprintf( text_tmp, 65535,
-                            "      [%s]: \"%s\"  %d\n        %s\n",
-                            oyStructTypeToText(api->type_),
-                            api->registration,
-                            (int)rank_list[k], api->id_ );
-                  else
-                    sprintf(text_tmp,"      no api obtained %d",k);
-                  STRING_ADD( text, text_tmp );
-                  /* oforms */
-                  CHOICE( "shared/dummy", oyStructTypeToText(api->type_), text_tmp )
-                  ITEM( "0", api->registration )
-                  CHOICE_END
+  /* send a empty query to one module to obtain instructions in a message */
+  if(texts && count)
+  error = oyConfigs_FromDomain( texts[0], 0, &configs, testobj );
+  if( !error )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyConfigs_FromDomain \"%s\" help text ", texts ? 
+                                              oyNoEmptyString_m_(texts[0]) :"----");
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyConfigs_FromDomain \"%s\" help text ", texts ? 
+                                              oyNoEmptyString_m_(texts[0]) :"----");
+  }
+  fprintf( zout, "\n");
 
-                  if(api->type_ == oyOBJECT_CMM_API4_S)
-                  {
-                    cmm_api4 = (oyCMMapi4_s_*) api;
-                    oyStringAdd_( &text, "        category: ",
-                                  oyAllocateFunc_, oyDeAllocateFunc_ );
-                    if(cmm_api4->ui->category)
-                    oyStringAdd_( &text, cmm_api4->ui->category,
-                                  oyAllocateFunc_, oyDeAllocateFunc_ );
-                    oyStringAdd_( &text, "\n        options: ",
-                                  oyAllocateFunc_, oyDeAllocateFunc_ );
-                    if(cmm_api4->ui->options)
-                    oyStringAdd_( &text, cmm_api4->ui->options,
-                                  oyAllocateFunc_, oyDeAllocateFunc_ );
-                    oyStringAdd_( &text, oyXMLgetElement_(cmm_api4->ui->options,
-                                  "freedesktop.org/default/profile",
-                                  "editing_rgb" ),
-                                  oyAllocateFunc_, oyDeAllocateFunc_ );
-                    STRING_ADD( text, "\n" );
-                  }
 
-                  if(api->type_ == oyOBJECT_CMM_API6_S)
-                  {
-                    cmm_api6 = (oyCMMapi6_s_*) api;
-                    snprintf( text_tmp, 65535,
-                            "        \"%s\" -> \"%s\"\n",
-                            cmm_api6->data_type_in,
-                            cmm_api6->data_type_out );
-                    STRING_ADD( text, text_tmp );
-                  }
+  /* add list call to module arguments */
+  error = oyOptions_SetFromString( &options_list,
+                                 "//" OY_TYPE_STD "/config/command", "list",
+                                 OY_CREATE_NEW );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_SetFromString() error: %d", error )
+  error = oyOptions_SetFromString( &options_list,
+                                 "//" OY_TYPE_STD "/config/icc_profile",
+                                 "true", OY_CREATE_NEW );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_SetFromString() error: %d", error )
 
-                  if(api->type_ == oyOBJECT_CMM_API7_S)
-                  {
-                    cmm_api7 = (oyCMMapi7_s_*) api;
-                    snprintf( text_tmp, 65535,
-                            "        context type \"%s\" plugs: %d  sockets: %d\n",
-                            cmm_api7->context_type,
-                            cmm_api7->plugs_n + cmm_api7->plugs_last_add,
-                            cmm_api7->sockets_n + cmm_api7->sockets_last_add );
-                    STRING_ADD( text, text_tmp );
-                    for(l = 0; l < (int)cmm_api7->plugs_n; ++l)
-                    {
-                      snprintf( text_tmp, 65535,
-                            "        plug[%d]: type:\"%s\" id:\"%s\" \"%s\" \"%s\"\n", l,
-                            oyNoEmptyString_m_(oyConnector_GetReg( cmm_api7->plugs[l])),
-                            oyNoEmptyString_m_(oyConnector_GetText(
-                                cmm_api7->plugs[l],"name",oyNAME_NICK)),
-                            oyNoEmptyString_m_(oyConnector_GetText(
-                                cmm_api7->plugs[l],"name",oyNAME_NAME)),
-                            oyNoEmptyString_m_(oyConnector_GetText(
-                                cmm_api7->plugs[l],"name",oyNAME_DESCRIPTION))
-                            );
-                      STRING_ADD( text, text_tmp );
-                    }
-                    for(l = 0; l < (int)cmm_api7->sockets_n; ++l)
-                    {
-                      snprintf( text_tmp, 65535,
-                            "        sock[%d]: type:\"%s\" id:\"%s\" \"%s\" \"%s\"\n", l,
-                            oyNoEmptyString_m_(oyConnector_GetReg( cmm_api7->sockets[l])),
-                            oyNoEmptyString_m_(oyConnector_GetText(
-                                cmm_api7->sockets[l],"name",oyNAME_NICK)),
-                            oyNoEmptyString_m_(oyConnector_GetText(
-                                cmm_api7->sockets[l],"name",oyNAME_NAME)),
-                            oyNoEmptyString_m_(oyConnector_GetText(
-                                cmm_api7->sockets[l],"name",oyNAME_DESCRIPTION))
-                            );
-                      STRING_ADD( text, text_tmp );
-                    }
-                  }
+  fprintf( zout, "oyConfigs_FromDomain() \"list\" call:\n" );
+  for( i = 0; texts && i < (int)count; ++i)
+  {
+    const char * registration_domain = texts[i];
+    fprintf(zout,"%d[rank %u]: %s\n", i, (unsigned int)rank_list[i], registration_domain);
 
-                  if(api->type_ == oyOBJECT_CMM_API8_S)
-                  {
-                    l = 0;
-                    cmm_api8 = (oyCMMapi8_s_*) api;
-                    snprintf( text_tmp, 65535,
-                              "        rank_map[#]:"
-                                      " \"key\"  match,none_match,not_found\n" );
-                    STRING_ADD( text, text_tmp );
-                    while(cmm_api8->rank_map && cmm_api8->rank_map[l].key)
-                    {
-                      snprintf( text_tmp, 65535,
-                              "        rank_map[%d]: \"%s\"  %d,%d,%d\n", l,
-                              cmm_api8->rank_map[l].key,
-                              cmm_api8->rank_map[l].match_value,
-                              cmm_api8->rank_map[l].none_match_value,
-                              cmm_api8->rank_map[l].not_found_value
-                              );
-                      STRING_ADD( text, text_tmp );
-                      ++l;
-                    }
-                  }
+    error = oyConfigs_FromDomain( registration_domain,
+                                  options_list, &configs, testobj );
+    if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyConfigs_FromDomain() error: %d", error )
+    j_n = oyConfigs_Count( configs );
+    for( j = 0; j < j_n; ++j )
+    {
+      oyConfigs_s * dbs = 0,
+                  * heap = 0;
+      int precise_count = 0,
+          serial_count = 0,
+          mnft_count = 0,
+          dev_name_count = 0;
 
-                  if(api->type_ == oyOBJECT_CMM_API9_S)
-                  {
-                    cmm_api9 = (oyCMMapi9_s_*) api;
-                    snprintf( text_tmp, 65535,
-                            "        \"%s\"\n"
-                            "        supported pattern: \"%s\"\n",
-                            cmm_api9->options,
-                            cmm_api9->pattern );
-                    STRING_ADD( text, text_tmp );
-                  }
+      config = oyConfigs_Get( configs, j );
 
-                  if(api->type_ == oyOBJECT_CMM_API10_S)
-                  {
-                    cmm_api10 = (oyCMMapi10_s_*) api;
-                    for(l = 0; l < 3; ++l)
-                    {
-                      if(cmm_api10->texts[l])
-                      {
-                        snprintf( text_tmp, 65535,
-                            "        \"%s\":\n"
-                            "        \"%s\"\n",
-                            cmm_api10->texts[l],
-                            cmm_api10->getText( cmm_api10->texts[l],
-                                                oyNAME_DESCRIPTION,
-                                                (oyStruct_s*)cmm_api10 ) );
-                        STRING_ADD( text, text_tmp );
-                      } else
-                        break;
-                    }
-                  }
+      fprintf(zout, "--------------------------------------------------------------------------------\n\"%s\":\n", oyConfig_FindString( config, "device_name", 0 ) );
+      {
+        oyOptions_s * options = 0;
+        const char * t = 0;
+        oyOptions_SetFromString( &options,
+                   "//" OY_TYPE_STD "/config/icc_profile.x_color_region_target",
+                         "yes", OY_CREATE_NEW );
+        error = oyDeviceGetProfile( config, options, &p );
+        if(error > 0) PRINT_SUB( oyTESTRESULT_FAIL, "oyDeviceGetProfile() error: %d", error )
+        oyOptions_Release( &options );
+        t = oyProfile_GetText( p, oyNAME_DESCRIPTION);
+        fprintf(zout, "oyDeviceGetProfile(): \"%s\"\n", t ? t : "----" );
+        oyProfile_Release( &p );
+      }
 
-                  STRING_ADD( text, "\n" );
-                  //oyCMMapiFilter_Release( &api );
-                }
-                oyCMMapiFilters_Release( &apis );
-              }
-              oyFree_m_(api_reg);
-            }
-          } else
-          if(oyIsOfTypeCMMapiFilter( type ))
-          {
-            cmm_filter = (oyCMMapiFilter_s_*) tmp;
+      error = oyConfigs_FromDB( oyConfig_GetRegistration( config ), NULL, &heap, testobj );
+      if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyConfigs_FromDB() error: %d", error )
 
-            snprintf( text_tmp, 65535, "%s: %s\n",
-                      oyStructTypeToText( tmp->type_ ),
-                      cmm_filter->registration );
-            STRING_ADD( text, text_tmp );
+      error = oyDeviceSelectSimiliar( config, heap, 0, &dbs );
+      if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyDeviceSelectSimiliar() error: %d", error )
+      precise_count = oyConfigs_Count( dbs );
+      oyConfigs_Release( &dbs );
+
+      error = oyDeviceSelectSimiliar( config, heap, 1, &dbs );
+      if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyDeviceSelectSimiliar() error: %d", error )
+      serial_count = oyConfigs_Count( dbs );
+      oyConfigs_Release( &dbs );
+
+      error = oyDeviceSelectSimiliar( config, heap, 2, &dbs );
+      if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyDeviceSelectSimiliar() error: %d", error )
+      mnft_count = oyConfigs_Count( dbs );
+      oyConfigs_Release( &dbs );
+
+      error = oyDeviceSelectSimiliar( config, heap, 4, &dbs );
+      if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyDeviceSelectSimiliar() error: %d", error )
+      dev_name_count = oyConfigs_Count( dbs );
+      oyConfigs_Release( &dbs );
+
+      oyConfigs_Release( &heap );
+
+
+      fprintf(zout, "\"%s\" has %d precise matches,\n"
+              "\t%d manufacturer/model/serial, %d manufacturer/model and\n"
+              "\t%d \"device_name\" entries in DB\n",
+              oyConfig_FindString( config, "device_name", 0 ),
+              precise_count,serial_count,mnft_count,dev_name_count );
+
+      k_n = oyConfig_Count( config );
+      for( k = 0; k < k_n; ++k )
+      {
+        char * r = 0;
+        int mnft = -1, mn, pos;
+
+        o = oyConfig_Get( config, k );
+        oi = (oyOption_s_*) o;
+
+        r = oyFilterRegistrationToText( oyOption_GetRegistration( o ),
+                                        oyFILTER_REG_OPTION, 0 );
+        if(r && strcmp(r,"supported_devices_info") == 0 &&
+           oi->value_type == oyVAL_STRING_LIST)
+        {
+          /* print first line special */
+          while(oi->value->string_list[++mnft])
+          {
+            mn = 0; pos = -1;
+            while(oi->value->string_list[mnft][++pos])
+            {
+              if(oi->value->string_list[mnft][pos] == '\n')
+              {
+                if(mn && oi->value->string_list[mnft][pos+1])
+                  putc(',', zout);
+                else if(mn == 0)
+                {
+                  putc(':', zout);
+                  putc('\n', zout);
+                  putc(' ', zout);
+                  putc(' ', zout);
+                }
+                ++mn;
 
+              } else
+                putc(oi->value->string_list[mnft][pos], zout);
+            }
+            putc('\n', zout);
           }
-          tmp = (oyCMMapi_s_*)tmp->next;
+        } else
+        {
+          val = oyOption_GetValueText( o, oyAllocateFunc_ );
+          fprintf(zout,"  %d::%d::%d \"%s\": \"%s\"\n", i,j,k,
+                 oyOption_GetRegistration(o), val?val:"(nix)" );
         }
 
-    fprintf(zout,"%d: \"%s\": %s\n\n", i, texts[i], text );
+        if(r) { oyDeAllocateFunc_(r); r = 0; }
+        if(val)
+        { oyDeAllocateFunc_( val ); val = 0; }
+        oyOption_Release( &o ); oi = 0;
+      }
+
+      oyConfig_Release( &config );
+    }
+
+    oyConfigs_Release( &configs );
+  }
+  fprintf( zout, "\n");
+  oyOptions_Release( &options_list );
+
+  fprintf( zout, "\n");
+
+  return result;
+}
+
+oyTESTRESULT_e testCMMDevicesDetails ()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+
+  fprintf(stdout, "\n" );
+
+  int i, k, l, k_n;
+  uint32_t count = 0,
+         * rank_list = 0;
+  int error = 0;
+  char ** texts = 0,
+        * val = 0;
+
+  oyConfigs_s * configs = 0;
+  oyConfig_s * config = 0;
+  oyOptions_s * options = 0;
+  oyOption_s * o = 0;
+  int devices_n = 0;
+
+#ifdef USE_GETTEXT
+  setlocale(LC_ALL,"");
+#endif
 
+  /* get all configuration filters */
+  oyConfigDomainList( "//" OY_TYPE_STD "/device/config.icc_profile",
+                      &texts, &count, &rank_list ,0 );
+
+  if( count )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyConfigDomainList Found CMM's %d     ", (int)count );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyConfigDomainList Found CMM's %d     ", (int)count );
+  }
+
+
+  fprintf( zout, "oyConfigs_FromDomain() \"properties\" call:\n" );
+  for( i = 0; rank_list && i < (int)count; ++i)
+  {
+    const char * registration_domain = texts[i];
+    fprintf(zout,"%d[rank %u]: %s\n", i, (unsigned int)rank_list[i], registration_domain);
+
+    /* set a general request */
+    error = oyOptions_SetFromString( &options,
+                                     "//" OY_TYPE_STD "/config/command",
+                                     "properties", OY_CREATE_NEW );
+    if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_SetFromString() error: %d", error )
+    /* send the query to a module */
+    error = oyConfigs_FromDomain( registration_domain,
+                                  options, &configs, testobj );
+    if(error) fprintf( zout, "oyConfigs_FromDomain(%s) error: %d", registration_domain, error );
+    devices_n = oyConfigs_Count( configs );
+    for( l = 0; l < devices_n; ++l )
+    {
+      /* display results */
+      fprintf(zout, "--------------------------------------------------------------------------------\n%s:\n", registration_domain );
+      config = oyConfigs_Get( configs, l );
+
+      k_n = oyConfig_Count( config );
+      for( k = 0; k < k_n; ++k )
+      {
+        o = oyConfig_Get( config, k );
+
+        val = oyOption_GetValueText( o, oyAllocateFunc_ );
+        fprintf(zout, "  %d::%d %s: \"%s\"\n", l,k, 
+                  oyStrrchr_(oyOption_GetRegistration(o),'/')+1, val );
+
+        if(val) { oyDeAllocateFunc_( val ); val = 0; }
+        oyOption_Release( &o );
+      }
+
+      o = oyConfig_Find( config, "icc_profile" );
+      if(o)
+      {
+        val = oyOption_GetValueText( o, oyAllocateFunc_ );
+        fprintf(zout, "  %d %s: \"%s\"\n", l, 
+                oyStrrchr_(oyOption_GetRegistration(o),'/')+1, val );
+
+        if(val) { oyDeAllocateFunc_( val ); val = 0; }
+        oyOption_Release( &o );
+      }
+
+        //error = oyConfig_SaveToDB( config );
+      oyConfig_Release( &config );
+    }
+
+    oyConfigs_Release( &configs );
+    oyOptions_Release( &options );
+  }
+
+  fprintf( zout, "\n");
+
+
+  if(texts && texts[0])
+  {
+    oyConfDomain_s * domain = oyConfDomain_FromReg( texts[0], testobj );
+    const char * device_class = oyConfDomain_GetText( domain, "device_class", oyNAME_NICK );
+    char * class_key = NULL;
+    oyStringAddPrintf( &class_key, oyAllocateFunc_, oyDeAllocateFunc_,
+                       OY_STD"/device/%s", device_class );
+    config = oyConfig_FromRegistration( class_key, 0 );
+    oyFree_m_( class_key );
+    oyConfDomain_Release( &domain );
+  }
+  error = oyConfig_AddDBData( config, "k1", "bla1", OY_CREATE_NEW );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyConfig_AddDBData() error: %d", error )
+  error = oyConfig_AddDBData( config, "k2", "bla2", OY_CREATE_NEW );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyConfig_AddDBData() error: %d", error )
+  error = oyConfig_AddDBData( config, "k3", "bla3", OY_CREATE_NEW );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyConfig_AddDBData() error: %d", error )
+
+  if( !error  && config && oyOptions_Count(*oyConfig_GetOptions( config,"db") ))
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyConfig_AddDBData                    " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyConfig_AddDBData                    " );
+  }
+
+  char * registration = 0;
+  if(config)
+    registration = oyStringCopy( oyConfig_GetRegistration( config ),
+                                  oyAllocateFunc_ );
+  error = oyConfig_SaveToDB( config, oySCOPE_USER );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyConfig_SaveToDB() error: %d", error )
+
+  error = oyConfigs_FromDB( registration, NULL, &configs, 0 );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyConfigs_FromDB() error: %d", error )
+  count = oyConfigs_Count( configs );
+  oyConfigs_Release( &configs );
+
+  if( count > 0 )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyConfigs_FromDB() %d                  ", (int)count );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyConfigs_FromDB() failed %d           ", (int)count );
+  }
+
+
+  int32_t rank = 0;
+  error = oyConfig_GetDB( config, NULL, &rank );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyConfig_GetDB() error: %d", error )
+  const char * key_set_name = oyConfig_FindString( config, "key_set_name", 0 );
+  char * key = 0;
+  STRING_ADD( key, key_set_name );
+  STRING_ADD( key, OY_SLASH );
+  STRING_ADD( key, "k1" );
+  o = oyConfig_Get( config, 0 );
+  oyOption_SetRegistration( o, key );
+  oyOption_Release( &o );
+  if(key)
+  { oyDeAllocateFunc_( key ); key = 0; }
+  error = oyConfig_EraseFromDB( config, oySCOPE_USER );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyConfig_EraseFromDB() error: %d", error )
+  oyConfig_Release( &config );
+
+  error = oyConfigs_FromDB( registration, NULL, &configs, testobj );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyConfigs_FromDB() error: %d", error )
+  i = oyConfigs_Count( configs );
+  oyConfigs_Release( &configs );
+
+  if( count - i == 1 )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyConfig_EraseFromDB() %d/%d            ", (int)count,i );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyConfig_EraseFromDB() failed %d/%d     ", (int)count,i );
+  }
+
+  if(registration)
+  { oyDeAllocateFunc_( registration ); registration = 0; }
+
+  fprintf( zout, "\n");
+
+  return result;
+}
+
+oyTESTRESULT_e testCMMRankMap ()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+
+  fprintf(stdout, "\n" );
+
+#ifdef USE_GETTEXT
+  setlocale(LC_ALL,"");
+#endif
+
+  int error = 0;
+  oyConfig_s * device;
+  oyOptions_s * options = 0;
+  oyConfigs_s * devices = 0;
+
+  oyOptions_SetFromString( &options,
+                   "//" OY_TYPE_STD "/config/icc_profile.x_color_region_target",
+                         "yes", OY_CREATE_NEW );
+  error = oyOptions_SetFromString( &options, "//" OY_TYPE_STD "/config/command",
+                                   "properties", OY_CREATE_NEW );  
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_SetFromString() error: %d", error )
+  error = oyDevicesGet( OY_TYPE_STD, "monitor", options, &devices );
+  if(error && displayFail() == oyTESTRESULT_FAIL) PRINT_SUB( oyTESTRESULT_XFAIL, "oyDevicesGet() error: %d", error )
+  oyOptions_Release( &options );
+
+  int count = oyConfigs_Count( devices ),
+      i;
+
+  if( count )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "monitor(s) found               %d (%d)", (int)count, error );
+  } else if(displayFail() == oyTESTRESULT_FAIL)
+  { PRINT_SUB( displayFail(),
+    "no monitor found               %d (%d)", (int)count, error );
+  }
+
+  for(i = 0; i < count; ++i)
+  {
+    char * json_text = 0;
+    device = oyConfigs_Get( devices, i );
+    oyDeviceToJSON( device, 0, &json_text, malloc );
+
+    if( json_text && json_text[0] )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "json from device [%d]         %d    ", i, (int)strlen(json_text) );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+    "json from device failed for [%d]      ", i );
+    }
+
+    const oyRankMap * map = oyConfig_GetRankMap( device );
+    if( map )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "Map from device  [%d]                 ", i );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+    "Map from device failed for [%d]       ", i );
+    }
+
+    char * rank_map_text = 0;
+    error = oyRankMapToJSON( map, options, &rank_map_text, malloc );
+    if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyRankMapToJSON() error: %d", error )
+    if( rank_map_text )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "JSON from Map    [%d]          %lu    ", i, (long unsigned int)strlen(rank_map_text) );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+    "JSON from Map failed  [%d]     %d     ", i, error );
+    }
+
+    oyRankMap * rank_map2 = 0;
+    error = oyRankMapFromJSON( rank_map_text, options, &rank_map2, malloc );
+    if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyRankMapFromJSON() error: %d", error )
+    if( rank_map2 )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "Map from JSON    [%d]                 ", i );
+    oyRankMapRelease( &rank_map2, free );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+    "Map from JSON failed [%d]      %d     ", i, error );
+    }
+
+    oyFree_m_(rank_map_text);
+    oyConfig_Release( &device );
+
+
+    oyDeviceFromJSON( json_text, 0, &device );
+    if(json_text) { free( json_text ); json_text = 0; }
+    oyDeviceToJSON( device, 0, &json_text, malloc );
+
+    if( json_text && strlen(json_text) )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "json from device [%d]         %d    ", i, (int)strlen(json_text) );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+    "json from device failed for %d        ", i );
+    }
+
+    oyConfig_Release( &device );
+    oyFree_m_(json_text);
+    fprintf( zout, "\n");
+  }
+  oyConfigs_Release( &devices );
+
+  char ** list = NULL;
+  error = oyRankMapList( NULL, NULL, &list, oyAllocateFunc_ );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyRankMapList() error: %d", error )
+  count = 0;
+  while( list && list[count]) ++count;
+  if( count >= 3 )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "found rank maps                 %d    ", count );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "found too few rank maps         %d %d ", count, error );
+  }
+
+  for( i = 0; i < count; ++i )
+  {
+    fprintf( zout, "%d: %s\n", i, list[i] );
+  }
+
+  oyStringListRelease_( &list, count, oyDeAllocateFunc_ );
+
+  error = oyOptions_SetFromString( &options, "//" OY_TYPE_STD "/config/path",
+                                   "1", OY_CREATE_NEW );  
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_SetFromString() error: %d", error )
+  error = oyRankMapList( NULL, options, &list, oyAllocateFunc_ );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyRankMapList() error: %d", error )
+  oyOptions_Release( &options );
+  count = 0;
+  while( list && list[count]) ++count;
+  if( count >= 1 )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "found rank map paths            %d    ", count );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "found too few rank map paths    %d %d ", count, error );
+  }
+
+  for( i = 0; i < count; ++i )
+  {
+    fprintf( zout, "%d: %s\n", i, list[i] );
+  }
+  oyStringListRelease_( &list, count, oyDeAllocateFunc_ );
+
+  fprintf( zout, "\n");
+
+  return result;
+}
+
+oyTESTRESULT_e testCMMMonitorJSON ()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+
+  fprintf(stdout, "\n" );
+
+  int i;
+  int error = 0;
+  double clck = 0;
+
+#ifdef USE_GETTEXT
+  setlocale(LC_ALL,"");
+#endif
+
+  oyConfigs_s * configs = 0;
+  oyConfig_s * config = 0;
+  int devices_n = 0;
+  oyOptions_s * options = NULL;
+  char * first_json = NULL;
+
+  clck = oyClock();
+  error = oyOptions_SetFromString( &options,
+                                     "//" OY_TYPE_STD "/config/command",
+                                     "properties", OY_CREATE_NEW );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_SetFromString() error: %d", error )
+  error = oyDevicesGet( 0, "monitor", options, &configs );
+  if( error <= 0 && configs )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyDevicesGet(\"monitor\")           " );
+  } else if(displayFail() == oyTESTRESULT_FAIL)
+  { PRINT_SUB( displayFail(),
+    "oyDevicesGet(\"monitor\")           " );
+  }
+
+  devices_n = oyConfigs_Count( configs );
+  if( error <= 0 && devices_n > 0 )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyDevicesGet(\"monitor\") count:   %d", devices_n );
+  } else if(displayFail() == oyTESTRESULT_FAIL)
+  { PRINT_SUB( displayFail(),
+    "oyDevicesGet(\"monitor\") count:   %d", devices_n );
+  }
+
+  clck = oyClock() - clck;
+  for( i = 0; i < devices_n; ++i )
+  {
+    char * json_text = 0;
+    config = oyConfigs_Get( configs, i );
+    error = oyDeviceToJSON( config, 0, &json_text, malloc );
+    fprintf(zout, "  %d oyDeviceToJSON():\n%s\n", i,
+            json_text?json_text:"---" );
+
+    oyConfig_Release( &config );
+    if( !error && json_text )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyDeviceToJSON() \"monitor\"       " );
+      if(i == 0)
+        first_json = strdup(json_text);
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyDeviceToJSON() \"monitor\"      %d", error );
+    }
+
+    if(i == 1)
+    {
+      if(strcmp(json_text,first_json) != 0)
+      { PRINT_SUB( oyTESTRESULT_SUCCESS,
+        "found second unique monitor        " );
+      } else
+      { PRINT_SUB( oyTESTRESULT_FAIL,
+        "first and second monitor are equal " );
+      }
+    }
+
+    error = oyDeviceFromJSON( json_text, 0, &config );
+    if( !error && config )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyDeviceFromJSON() %d             ", oyConfig_Count(config) );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyDeviceFromJSON() %d %d           ", oyConfig_Count(config), error );
+    }
+
+ 
+#   ifdef HAVE_X11
+    if(i == 0)
+    {
+      int r OY_UNUSED;
+      r = system("xprop -remove _ICC_PROFILE -root; xprop -remove _ICC_DEVICE_PROFILE -root");
+    }
+#   endif
+    oyProfile_s * p = NULL;
+    oyOptions_SetFromString( &options,
+                  "//" OY_TYPE_STD "/config/command",
+                           "list", OY_CREATE_NEW );
+    oyOptions_SetFromString( &options,
+                   "//" OY_TYPE_STD "/config/icc_profile.x_color_region_target",
+                          "yes", OY_CREATE_NEW );
+    error = oyDeviceGetProfile( config, options, &p );
+    if(error > 0) PRINT_SUB( oyTESTRESULT_XFAIL, "oyDeviceGetProfile() error: %d", error )
+    if( p )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyDeviceGetProfile(\"list\") \"%s\"", oyProfile_GetText(p,oyNAME_DESCRIPTION) );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyDeviceGetProfile(\"list\")  %d", error );
+    }
+    oyProfile_s * list_profile = p; p = NULL;
+
+#   ifdef HAVE_X11
+    if(i == 0)
+    {
+      int r OY_UNUSED;
+      r = system("xprop -root -len 4 | grep _ICC");
+    }
+#   endif
+
+    oyOptions_SetFromString( &options,
+                   "//" OY_TYPE_STD "/config/icc_profile.fallback",
+                          "yes", OY_CREATE_NEW );
+    error = oyDeviceGetProfile( config, options, &p );
+    if(error == -1)
+      PRINT_SUB( oyTESTRESULT_SUCCESS, "oyDeviceGetProfile(\"fallback\") error:       %d", error )
+    else
+      PRINT_SUB( oyTESTRESULT_XFAIL, "oyDeviceGetProfile(\"fallback\") error:       %d", error )
+    if( p )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyDeviceGetProfile(\"fallback\") \"%s\"", oyProfile_GetText(p,oyNAME_DESCRIPTION) );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyDeviceGetProfile(\"fallback\")    " );
+    }
+    oyProfile_Release( &p );
+    oyConfig_Release( &config );
+    oyOptions_Release( &options );
+
+
+
+    error = oyDeviceFromJSON( json_text, 0, &config );
+    if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyDeviceFromJSON() error: %d", error )
+    oyOptions_SetFromString( &options,
+                  "//" OY_TYPE_STD "/config/command",
+                           "properties", OY_CREATE_NEW );
+    oyOptions_SetFromString( &options,
+                   "//" OY_TYPE_STD "/config/icc_profile.x_color_region_target",
+                          "yes", OY_CREATE_NEW );
+    error = oyDeviceGetProfile( config, options, &p );
+    if( !error && p )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyDeviceGetProfile(\"properties\") \"%s\"", oyProfile_GetText(p,oyNAME_DESCRIPTION) );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyDeviceGetProfile(\"properties\")  %d", error );
+    }
+
+
+    if(oyProfile_Equal(p,list_profile))
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "\"list\" == \"properties\" profile" );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "\"list\" == \"properties\" profile" );
+    }
+    oyProfile_Release( &p );
+    oyProfile_Release( &list_profile );
+
+
+    oyOptions_SetFromString( &options,
+                   "//" OY_TYPE_STD "/config/icc_profile.fallback",
+                          "yes", OY_CREATE_NEW );
+    error = oyDeviceGetProfile( config, options, &p );
+    if(error == -1)
+      PRINT_SUB( oyTESTRESULT_SUCCESS, "oyDeviceGetProfile(\"fallback\") error:       %d", error )
+    else
+      PRINT_SUB( oyTESTRESULT_XFAIL, "oyDeviceGetProfile(\"fallback\") error:       %d", error )
+    if( p )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyDeviceGetProfile(\"fallback\") \"%s\"", oyProfile_GetText(p,oyNAME_DESCRIPTION) );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyDeviceGetProfile(\"fallback\")    " );
+    }
+
+
+    oyProfileTag_s * tag = oyProfile_GetTagById( p, (icTagSignature)icSigMetaDataTag );
+    if( tag )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyProfile_GetTagById(icSigMetaDataTag)" );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyProfile_GetTagById(icSigMetaDataTag)" );
+    }
+
+    int32_t texts_n = 0, tag_size = 0;
+    char ** texts = oyProfileTag_GetText( tag, &texts_n, NULL, NULL,
+                                          &tag_size, oyAllocateFunc_ );
+    if( texts_n > 2 && tag_size )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyProfileTag_GetText(meta) texts: %d tag size: %d", texts_n, tag_size );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyProfileTag_GetText(meta) texts: %d tag size: %d", texts_n, tag_size );
+    }
+
+    int edid_mnft_count = 0;
+    for(int j = 0; j < texts_n; ++j)
+    {
+      //fprintf( zout, "%s\n", texts[j] );
+      if(strstr(texts[j],"EDID_mnft_id") != NULL)
+        ++edid_mnft_count;
+    }
+    // one single key is needed
+    // otherwise the monitor is defect or
+    // there is key duplication
+    if( edid_mnft_count == 1 )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "Found EDID_mnft_id keys in meta tag: %d", edid_mnft_count );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "Found EDID_mnft_id keys in meta tag: %d", edid_mnft_count );
+    }
+
+    oyConfig_Release( &config );
+    oyOptions_Release( &options );
+    oyFree_m_( json_text );
+  }
+
+  oyConfigs_Release( &configs );
+  fprintf( zout, "\n");
+
+  if(result == oyTESTRESULT_UNKNOWN && displayFail() == oyTESTRESULT_XFAIL)
+    result = oyTESTRESULT_SUCCESS;
+
+  return result;
+}
+
+
+oyTESTRESULT_e testCMMMonitorListing ()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+
+  fprintf(stdout, "\n" );
+
+  int i, k, k_n;
+  int error = 0;
+  double clck = 0;
+
+#ifdef USE_GETTEXT
+  setlocale(LC_ALL,"");
+#endif
+
+  oyConfigs_s * configs = 0;
+  oyConfig_s * config = 0;
+  oyOption_s * o = 0;
+  int devices_n = 0;
+  char * device_name = 0;
+  char * text = 0,
+       * val = 0;
+
+  clck = oyClock();
+  error = oyDevicesGet( 0, "monitor", 0, &configs );
+  clck = oyClock() - clck;
+  devices_n = oyConfigs_Count( configs );
+  if( !error )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyDevicesGet() \"monitor\": %d                      %s", devices_n,
+                   oyProfilingToString(1,clck/(double)CLOCKS_PER_SEC,"Obj."));
+  } else if(displayFail() == oyTESTRESULT_FAIL)
+  { PRINT_SUB( displayFail(),
+    "oyDevicesGet() \"monitor\": %d     ", devices_n );
+  }
+  for( i = 0; i < devices_n; ++i )
+  {
+    config = oyConfigs_Get( configs, i );
+    fprintf(zout, "  %d oyConfig_FindString(..\"device_name\"..): %s\n", i,
+            oyConfig_FindString( config, "device_name",0 ) );
+    if(i==0)
+      device_name = oyStringCopy(oyConfig_FindString( config, "device_name",0),
+                                  oyAllocateFunc_ );
+
+    clck = oyClock();
+    error = oyDeviceProfileFromDB( config, &text, myAllocFunc );
+    if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyDeviceProfileFromDB() error: %d", error )
+    clck = oyClock() - clck;
+    if(text)
+      fprintf( zout, "  %d oyDeviceProfileFromDB(): %s %s\n", i, text,
+                   oyProfilingToString(1,clck/(double)CLOCKS_PER_SEC,"Obj."));
+    else
+      fprintf( zout, "  %d oyDeviceProfileFromDB(): ---\n", i );
+
+    clck = oyClock();
+    error = oyDeviceGetInfo( config, oyNAME_NICK, 0, &text, 0 );
+    if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyDeviceGetInfo() error: %d", error )
+    clck = oyClock() - clck;
+    fprintf( zout, "  %d oyDeviceGetInfo)(..oyNAME_NICK..): \"%s\" %s\n",
+             i, text? text:"???",
+                   oyProfilingToString(1,clck/(double)CLOCKS_PER_SEC,"Obj."));
+    clck = oyClock();
+    error = oyDeviceGetInfo( config, oyNAME_NAME, 0, &text, 0 );
+    if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyDeviceGetInfo() error: %d", error )
+    clck = oyClock() - clck;
+    fprintf( zout, "  %d oyDeviceGetInfo)(..oyNAME_NAME..): \"%s\" %s\n",
+             i, text? text:"???",
+                   oyProfilingToString(1,clck/(double)CLOCKS_PER_SEC,"Obj."));
+
+    oyConfig_Release( &config );
+  }
+  oyConfigs_Release( &configs );
+  fprintf( zout, "\n");
+
+  error = oyDeviceGet( 0, "monitor", device_name, 0, &config );
+  k_n = oyConfig_Count( config );
+  if( !error )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyDeviceGet(..\"monitor\" \"%s\"..) %d     ", device_name, k_n );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyDeviceGet(..\"monitor\" \"%s\"..) %d     ", device_name, k_n );
+  }
+    for( k = 0; k < k_n; ++k )
+    {
+      o = oyConfig_Get( config, k );
+      val = oyOption_GetValueText( o, oyAllocateFunc_ );
+
+      fprintf(zout, "  %d %s: \"%s\"\n", k, oyOption_GetRegistration(o), val );
+
+      if(val) { oyDeAllocateFunc_( val ); val = 0; }
+      oyOption_Release( &o );
+    }
+  oyConfig_Release( &config );
+  oyConfigs_Release( &configs );
+  fprintf( zout, "\n");
+
+
+  return result;
+}
+
+oyTESTRESULT_e testCMMDBListing ()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+
+  fprintf(stdout, "\n" );
+
+  int j, k, j_n, k_n;
+  int error = 0;
+  oyConfigs_s * configs = 0;
+  oyConfig_s * config = 0;
+  oyOption_s * o = 0;
+  char * val = 0;
+
+  error = oyConfigs_FromDB( OY_DEVICE_STD "/monitor", NULL, &configs, testobj );
+  j_n = oyConfigs_Count( configs );
+  if( !error )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyConfigs_FromDB( \"" OY_DEVICE_STD "/monitor" "\" ) count: %d     ", j_n );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyConfigs_FromDB( \"" OY_DEVICE_STD "/monitor" "\" ) count: %d     ", j_n );
+  }
+  for( j = 0; j < j_n; ++j )
+  {
+    config = oyConfigs_Get( configs, j );
+
+    k_n = oyConfig_Count( config );
+    for( k = 0; k < k_n; ++k )
+    {
+      o = oyConfig_Get( config, k );
+
+      val = oyOption_GetValueText( o, oyAllocateFunc_ );
+      fprintf(zout, "  %d::%d %s %s\n", j,k, oyOption_GetRegistration(o), val );
+
+      if(val) { oyDeAllocateFunc_( val ); val = 0; }
+      oyOption_Release( &o );
+    }
+
+    oyConfig_Release( &config );
+  }
+
+  return result;
+}
+
+oyTESTRESULT_e testCMMMonitorModule ()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  oyConfigs_s * devices = 0;
+  oyOptions_s * options = 0;
+  const char * t = ":0.100";
+  int error = 0;
+
+  fprintf(stdout, "\n" );
+
+  /* non existing display */
+  error = oyOptions_SetFromString( &options,
+                                 "//" OY_TYPE_STD "/config/device_name",
+                                 t, OY_CREATE_NEW );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyOptions_SetFromString() error: %d", error )
+  /* clean up */
+  error = oyOptions_SetFromString( &options,
+                                 "//" OY_TYPE_STD "/config/command",
+                                 "unset", OY_CREATE_NEW );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "(oyOptions_SetFromString) error: %d", error )
+  error = oyDevicesGet( OY_TYPE_STD, "monitor", options, &devices );
+  oyConfigs_Release( &devices );
+
+  if( error == -1
+#ifdef __APPLE__
+      ||  error == 0
+#endif
+    )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyDevicesGet( \"//" OY_TYPE_STD "\", unset, ... ) = %d", error );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyDevicesGet( \"//" OY_TYPE_STD "\", unset, ... ) = %d", error );
+  }
+
+  return result;
+}
+
+oyTESTRESULT_e testCMMmonitorDBmatch ()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+
+  fprintf(stdout, "\n" );
+
+  int k, k_n;
+  int32_t rank = 0;
+  int error = 0;
+  oyConfig_s * device = 0;
+  oyOption_s * o = 0;
+  char * val = 0;
+  double clck = 0;
+  char * device_name = NULL;
+
+  /* X11 */
+#if !defined(__APPLE__)
+  if(getenv("DISPLAY"))
+  {
+    device_name = oyStringCopy( getenv("DISPLAY"), oyAllocateFunc_ );
+    if(strchr(device_name, '.') == NULL)
+      oyStringAddPrintf( &device_name, oyAllocateFunc_, oyDeAllocateFunc_,
+                         ".0" );
+  }
+#endif
+  if(!device_name)
+    device_name = oyStringCopy( "0", oyAllocateFunc_ );
+
+  fprintf( zout, "load a device ...\n");
+  clck = oyClock();
+  error = oyDeviceGet( 0, "monitor", device_name, 0, &device );
+  clck = oyClock() - clck;
+  k_n = oyConfig_Count( device );
+  if( !error )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyDeviceGet(..\"monitor\" \"%s\".. &device) %d %s", device_name, k_n,
+                   oyProfilingToString(1,clck/(double)CLOCKS_PER_SEC,"Obj."));
+  } else if(displayFail() == oyTESTRESULT_FAIL)
+  { PRINT_SUB( displayFail(),
+    "oyDeviceGet(..\"monitor\" \"%s\".. &device) %d", device_name, k_n );
+  }
+
+  fprintf( zout, "... and search for the devices DB entry ...\n");
+  clck = oyClock();
+  error = oyConfig_GetDB( device, NULL, &rank );
+  clck = oyClock() - clck;
+  if( !error )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyConfig_GetDB( device )                  %d %s", (int)rank,
+                   oyProfilingToString(1,clck/(double)CLOCKS_PER_SEC,"Obj."));
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyConfig_GetDB( device )                    %s",
+                   oyProfilingToString(1,clck/(double)CLOCKS_PER_SEC,"Obj."));
+  }
+  if(device && rank > 0)
+  {
+    fprintf(zout,"rank: %d\n", (int)rank);
+    k_n = oyConfig_Count( device );
+    for( k = 0; k < k_n; ++k )
+    {
+      o = oyConfig_Get( device, k );
+
+      val = oyOption_GetValueText( o, oyAllocateFunc_ );
+      fprintf(zout, "  d::%d %s: \"%s\"\n", k,
+      strchr(strchr(strchr(strchr(oyOption_GetRegistration(o),'/')+1,'/')+1,'/')+1,'/')+1,
+              val );
+
+      if(val) { oyDeAllocateFunc_( val ); val = 0; }
+      oyOption_Release( &o );
+    }
+    //error = oyConfig_EraseFromDB( config );
+  }
+
+  oySetPersistentString( OY_STD "/device/test/#0/system_port", oySCOPE_USER, "TEST-port", "TESTcomment" );
+  oySetPersistentString( OY_STD "/device/test/#0/model", oySCOPE_USER, "TEST-model", "TESTcomment" );
+  oySetPersistentString( OY_STD "/device/test/#1/system_port", oySCOPE_USER, "TEST-port2", "TESTcomment2" );
+  oySetPersistentString( OY_STD "/device/test/#1/model", oySCOPE_USER, "TEST-model2", "TESTcomment2" );
+  fprintf(zout, "creating DB device class: \"%s\"\n", OY_STD "/device/test/#[0,1]/system_port: TEST-port/1" );
+
+  const char * reg = OY_STD "/device/test";
+  oyConfigs_s * configs = NULL;
+  error = oyConfigs_FromDB( reg, NULL, &configs, testobj );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyConfigs_FromDB() error: %d", error )
+  int count = oyConfigs_Count( configs );
+  oyConfig_Release( &device );
+
+  if(count == 2)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyConfigs_FromDB( %s ) %d", reg, count);
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyConfigs_FromDB( %s )  ", reg);
+  }
+
+  for(k = 0; k < count; ++k)
+  {
+    oyOptions_s * db;
+    device = oyConfigs_Get( configs, k );
+    db = *oyConfig_GetOptions(device,"db");
+    fprintf(zout, "  d::%d %d: \"%s\"\n", k, oyConfig_Count( device ),
+                  oyOptions_GetText( db, oyNAME_NICK ));
+    int k_n = oyOptions_Count(db);
+    if(k_n == 2)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyConfig_s[%d] = %d                                           ", k, k_n);
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyConfig_s[%d] = %d                                           ", k, k_n);
+    }
+  }
+
+  error = oyDBEraseKey( reg, oySCOPE_USER );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyDBEraseKey() error: %d", error )
+
+  return result;
+}
+
+
+#include "oyranos_forms.h"
+
+#define H(type,value) oyFormsAddHeadline( &t, type, value,\
+                                           oyAllocateFunc_, oyDeAllocateFunc_ );
+#define CHOICE(ref,label,help) oyFormsStartChoice( &t, ref, label, help,\
+                                           oyAllocateFunc_, oyDeAllocateFunc_ );
+#define ITEM(value,label) oyFormsAddItem( &t, value, label,\
+                                           oyAllocateFunc_, oyDeAllocateFunc_ );
+#define CHOICE_END STRING_ADD( t, "      </xf:choices>\n     </xf:select1>\n" );
+
+#include "oyCMMapi4_s_.h"
+#include "oyCMMapi6_s_.h"
+#include "oyCMMapi7_s_.h"
+#include "oyCMMapi8_s_.h"
+#include "oyCMMapi9_s_.h"
+#include "oyCMMapi10_s_.h"
+#include "oyCMMapiFilter_s_.h"
+#include "oyCMMinfo_s_.h"
+
+#include "oyranos_module.h"
+#include "oyranos_module_internal.h"
+
+oyTESTRESULT_e testCMMsShow ()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+
+  int i, j, k, l;
+  uint32_t count = 0;
+  char ** texts = 0,
+        * text = 0,
+        * text_tmp = (char*)oyAllocateFunc_(65535),
+        * t = 0,
+        * rfile = 0;
+  oyCMMinfo_s_ * cmm_info = 0;
+  oyCMMapi4_s_ * cmm_api4 = 0;
+  oyCMMapi6_s_ * cmm_api6 = 0;
+  oyCMMapi7_s_ * cmm_api7 = 0;
+  oyCMMapi8_s_ * cmm_api8 = 0;
+  oyCMMapi9_s_ * cmm_api9 = 0;
+  oyCMMapi10_s_ * cmm_api10 = 0;
+  oyCMMapi_s_ * tmp = 0;
+  oyCMMapiFilter_s_ * cmm_filter = 0;
+
+
+  fprintf(zout, "\n" );
+
+  texts = oyCMMsGetLibNames_p( &count );
+
+  /* Create a oforms style xhtml to present in a XFORMS viewer like
+   * oyranos-xforms-fltk or FF with XFORMS plug-in.
+   * Pretty large here.
+   */
+  STRING_ADD( t, "<?xml version=\"1.0\" encoding=\"UTF-8\" ?>\n\
+<html xmlns=\"http://www.w3.org/1999/xhtml\"\n\
+      xmlns:xf=\"http://www.w3.org/2002/xforms\"\n\
+      xmlns:oicc=\"http://www.oyranos.org/2009/oyranos_icc\">\n" );
+  STRING_ADD( t, "<head>\n\
+  <title>Filter options</title>\n\
+  <xf:model>\n\
+    <xf:instance xmlns=\"\">\n\
+     <shared><dummy>0</dummy></shared>\n\
+    </xf:instance>\n\
+  </xf:model>\n");
+  STRING_ADD( t, "  <style type=\"text/css\">\n\
+  @namespace xf url(\"http://www.w3.org/2002/xforms\");\n\
+  xf|label {\n\
+   font-family: Helvetica, Geneva, Lucida, sans-serif;\n\
+   width: 24ex;\n\
+   text-align: right;\n\
+   padding-right: 1em;\n\
+  }\n\
+  xf|select1 { display: table-row; }\n\
+  xf|select1 xf|label, xf|choices xf|label  { display: table-cell; }\n\
+  </style></head>\n\
+<body>\n\
+ <xf:group>\n" );
+  H(3,"Oyranos Module Overview")
+
+  for( i = 0; i < (int)count; ++i)
+  {
+    cmm_info = (oyCMMinfo_s_*)oyCMMinfoFromLibName_p( texts[i] );
+    if(cmm_info)
+      tmp = (oyCMMapi_s_*)cmm_info->api;
+    else
+      tmp = 0;
+
+    /* short skip for non compatible modules */
+    if(oyCMMapi_Check_((oyCMMapi_s*)tmp) == oyOBJECT_NONE)
+    {
+      text = oyCMMinfoPrint_( (oyCMMinfo_s*)cmm_info, 1 );
+      STRING_ADD( text, "    Not accepted by oyCMMapi_Check_() - Stop\n");
+      fprintf(zout,"%d: \"%s\": %s\n\n", i, texts[i], text );
+      continue;
+    }
+
+    text = oyCMMinfoPrint_( (oyCMMinfo_s*)cmm_info, 0 );
+
+        while(tmp)
+        {
+          oyOBJECT_e type = oyOBJECT_NONE;
+          char num[48],
+               * api_reg = 0;
+          const char * ctmp;
+
+          /* oforms */
+          CHOICE( "shared/dummy", oyStructTypeToText(tmp->type_), text )
+          ITEM( "0", cmm_info->cmm )
+          CHOICE_END
+
+          type = oyCMMapi_Check_((oyCMMapi_s*)tmp);
+
+          oySprintf_(num,"    %d:", type );
+          STRING_ADD( text, num );
+          ctmp = oyStruct_TypeToText((oyStruct_s*)tmp);
+          STRING_ADD( text, ctmp );
+          STRING_ADD( text, "\n" );
+
+          if(type == oyOBJECT_CMM_API5_S)
+          {
+            cmm_filter = (oyCMMapiFilter_s_*) tmp;
+
+            {
+              oyCMMapiFilter_s_ * api = 0;
+              oyCMMapiFilters_s * apis = 0;
+              uint32_t * rank_list = 0;
+              uint32_t apis_n = 0;
+              char * classe = 0;
+
+              classe = oyFilterRegistrationToText( cmm_filter->registration,
+                                                   oyFILTER_REG_TYPE, 0 );
+              api_reg = oyStringCopy("//", oyAllocateFunc_ );
+              STRING_ADD( api_reg, classe );
+              if(classe)
+              oyFree_m_( classe );
+
+
+              H( 4, "API(s) load from Meta module" )
+              STRING_ADD( text, "    API(s) load from Meta module:\n" );
+
+              for(j = oyOBJECT_CMM_API4_S; j <= (int)oyOBJECT_CMM_API10_S; j++)
+              {
+                apis = oyCMMsGetFilterApis_( api_reg, (oyOBJECT_e)j,
+                                             oyFILTER_REG_MODE_NONE,
+                                             &rank_list, &apis_n );
+
+                apis_n = oyCMMapiFilters_Count( apis );
+                for(k = 0; rank_list && k < (int)apis_n; ++k)
+                {
+                  api = (oyCMMapiFilter_s_*)oyCMMapiFilters_Get( apis, k );
+
+                  if(api)
+                  snprintf( text_tmp, 65535,
+                            "      [%s]: \"%s\"  %d\n        %s\n",
+                            oyStructTypeToText(api->type_),
+                            api->registration,
+                            (int)rank_list[k], api->id_ );
+                  else
+                    sprintf(text_tmp,"      no api obtained %d",k);
+                  STRING_ADD( text, text_tmp );
+                  /* oforms */
+                  CHOICE( "shared/dummy", oyStructTypeToText(api->type_), text_tmp )
+                  ITEM( "0", api->registration )
+                  CHOICE_END
+
+                  if(api->type_ == oyOBJECT_CMM_API4_S)
+                  {
+                    cmm_api4 = (oyCMMapi4_s_*) api;
+                    oyStringAdd_( &text, "        category: ",
+                                  oyAllocateFunc_, oyDeAllocateFunc_ );
+                    if(cmm_api4->ui->category)
+                    oyStringAdd_( &text, cmm_api4->ui->category,
+                                  oyAllocateFunc_, oyDeAllocateFunc_ );
+                    oyStringAdd_( &text, "\n        options: ",
+                                  oyAllocateFunc_, oyDeAllocateFunc_ );
+                    if(cmm_api4->ui->options)
+                    oyStringAdd_( &text, cmm_api4->ui->options,
+                                  oyAllocateFunc_, oyDeAllocateFunc_ );
+                    oyStringAdd_( &text, oyXMLgetElement_(cmm_api4->ui->options,
+                                  "freedesktop.org/default/profile",
+                                  "editing_rgb" ),
+                                  oyAllocateFunc_, oyDeAllocateFunc_ );
+                    STRING_ADD( text, "\n" );
+                  }
+
+                  if(api->type_ == oyOBJECT_CMM_API6_S)
+                  {
+                    cmm_api6 = (oyCMMapi6_s_*) api;
+                    snprintf( text_tmp, 65535,
+                            "        \"%s\" -> \"%s\"\n",
+                            cmm_api6->data_type_in,
+                            cmm_api6->data_type_out );
+                    STRING_ADD( text, text_tmp );
+                  }
+
+                  if(api->type_ == oyOBJECT_CMM_API7_S)
+                  {
+                    cmm_api7 = (oyCMMapi7_s_*) api;
+                    snprintf( text_tmp, 65535,
+                            "        context type \"%s\" plugs: %d  sockets: %d\n",
+                            cmm_api7->context_type,
+                            cmm_api7->plugs_n + cmm_api7->plugs_last_add,
+                            cmm_api7->sockets_n + cmm_api7->sockets_last_add );
+                    STRING_ADD( text, text_tmp );
+                    for(l = 0; l < (int)cmm_api7->plugs_n; ++l)
+                    {
+                      snprintf( text_tmp, 65535,
+                            "        plug[%d]: type:\"%s\" id:\"%s\" \"%s\" \"%s\"\n", l,
+                            oyNoEmptyString_m_(oyConnector_GetReg( cmm_api7->plugs[l])),
+                            oyNoEmptyString_m_(oyConnector_GetText(
+                                cmm_api7->plugs[l],"name",oyNAME_NICK)),
+                            oyNoEmptyString_m_(oyConnector_GetText(
+                                cmm_api7->plugs[l],"name",oyNAME_NAME)),
+                            oyNoEmptyString_m_(oyConnector_GetText(
+                                cmm_api7->plugs[l],"name",oyNAME_DESCRIPTION))
+                            );
+                      STRING_ADD( text, text_tmp );
+                    }
+                    for(l = 0; l < (int)cmm_api7->sockets_n; ++l)
+                    {
+                      snprintf( text_tmp, 65535,
+                            "        sock[%d]: type:\"%s\" id:\"%s\" \"%s\" \"%s\"\n", l,
+                            oyNoEmptyString_m_(oyConnector_GetReg( cmm_api7->sockets[l])),
+                            oyNoEmptyString_m_(oyConnector_GetText(
+                                cmm_api7->sockets[l],"name",oyNAME_NICK)),
+                            oyNoEmptyString_m_(oyConnector_GetText(
+                                cmm_api7->sockets[l],"name",oyNAME_NAME)),
+                            oyNoEmptyString_m_(oyConnector_GetText(
+                                cmm_api7->sockets[l],"name",oyNAME_DESCRIPTION))
+                            );
+                      STRING_ADD( text, text_tmp );
+                    }
+                  }
+
+                  if(api->type_ == oyOBJECT_CMM_API8_S)
+                  {
+                    l = 0;
+                    cmm_api8 = (oyCMMapi8_s_*) api;
+                    snprintf( text_tmp, 65535,
+                              "        rank_map[#]:"
+                                      " \"key\"  match,none_match,not_found\n" );
+                    STRING_ADD( text, text_tmp );
+                    while(cmm_api8->rank_map && cmm_api8->rank_map[l].key)
+                    {
+                      snprintf( text_tmp, 65535,
+                              "        rank_map[%d]: \"%s\"  %d,%d,%d\n", l,
+                              cmm_api8->rank_map[l].key,
+                              cmm_api8->rank_map[l].match_value,
+                              cmm_api8->rank_map[l].none_match_value,
+                              cmm_api8->rank_map[l].not_found_value
+                              );
+                      STRING_ADD( text, text_tmp );
+                      ++l;
+                    }
+                  }
+
+                  if(api->type_ == oyOBJECT_CMM_API9_S)
+                  {
+                    cmm_api9 = (oyCMMapi9_s_*) api;
+                    snprintf( text_tmp, 65535,
+                            "        \"%s\"\n"
+                            "        supported pattern: \"%s\"\n",
+                            cmm_api9->options,
+                            cmm_api9->pattern );
+                    STRING_ADD( text, text_tmp );
+                  }
+
+                  if(api->type_ == oyOBJECT_CMM_API10_S)
+                  {
+                    cmm_api10 = (oyCMMapi10_s_*) api;
+                    for(l = 0; l < 3; ++l)
+                    {
+                      if(cmm_api10->texts[l])
+                      {
+                        snprintf( text_tmp, 65535,
+                            "        \"%s\":\n"
+                            "        \"%s\"\n",
+                            cmm_api10->texts[l],
+                            cmm_api10->getText( cmm_api10->texts[l],
+                                                oyNAME_DESCRIPTION,
+                                                (oyStruct_s*)cmm_api10 ) );
+                        STRING_ADD( text, text_tmp );
+                      } else
+                        break;
+                    }
+                  }
+
+                  STRING_ADD( text, "\n" );
+                  //oyCMMapiFilter_Release( &api );
+                }
+                oyCMMapiFilters_Release( &apis );
+              }
+              oyFree_m_(api_reg);
+            }
+          } else
+          if(oyIsOfTypeCMMapiFilter( type ))
+          {
+            cmm_filter = (oyCMMapiFilter_s_*) tmp;
+
+            snprintf( text_tmp, 65535, "%s: %s\n",
+                      oyStructTypeToText( tmp->type_ ),
+                      cmm_filter->registration );
+            STRING_ADD( text, text_tmp );
+
+          }
+          tmp = (oyCMMapi_s_*)tmp->next;
+        }
+
+    fprintf(zout,"%d: \"%s\": %s\n\n", i, texts[i], text );
+
+  }
+  oyStringListRelease_( &texts, count, free );
+
+  if( count )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyCMMsGetLibNames_p( ) found %u                    ", (unsigned int)count );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyCMMsGetLibNames_p( ) found %u                    ", (unsigned int)count );
+  }
+
+  oyDeAllocateFunc_( text_tmp );
+
+  STRING_ADD( t, "     </xf:group>\n</body>\n</html>\n" );
+  int r OY_UNUSED;
+  r = remove("test2_CMMs.xhtml");
+  oyWriteMemToFile2_( "test2_CMMs.xhtml", t, strlen(t),0/*OY_FILE_NAME_SEARCH*/,
+                      &rfile, malloc );
+  fprintf(zout, "Wrote %s\n", rfile?rfile:"test2_CMMs.xhtml" );
+  free( rfile );
+
+  return result;
+}
+
+#include "oyFilterCore_s_.h"
+#include "oyNamedColor_s.h"
+#include "oyNamedColors_s.h"
+#include "oyranos_alpha_internal.h"
+
+oyTESTRESULT_e testCMMnmRun ()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  oyNamedColor_s * c = 0;
+  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  oyProfile_s * prof = oyProfile_FromStd( oyEDITING_XYZ, icc_profile_flags, testobj );
+  int error = 0, l_error = 0,
+      i,n = 10;
+
+  fprintf(stdout, "\n" );
+
+  fprintf(zout, "clearing caches\n" );
+  oyAlphaFinish_(0);
+
+  double clck = oyClock();
+  for(i = 0; i < n*10000; ++i)
+  {
+    c = oyNamedColor_Create( NULL, NULL,0, prof, testobj );
+    oyNamedColor_Release( &c );
+  }
+  clck = oyClock() - clck;
+
+  c = oyNamedColor_Create( NULL, NULL,0, prof, testobj );
+  if( c )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyNamedColor_Create( )             %s",
+                   oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Obj."));
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyNamedColor_Create( )                            " );
+  }
+
+
+  const char * key_domain = OY_STD"/behaviour";
+  const char * key_name = OY_STD"/behaviour/rendering_bpc";
+  clck = oyClock();
+  for(i = 0; i < n*3; ++i)
+  {
+    oyDB_s * db = oyDB_newFrom( key_domain, oySCOPE_USER_SYS, oyAllocateFunc_, oyDeAllocateFunc_ );
+    char * value = oyDB_getString(db, key_name);
+    if(!value)
+      break;
+    oyFree_m_(value);
+    oyDB_release( &db );
+  }
+  clck = oyClock() - clck;
+
+  if( i )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyDB_getString()                   %s",
+                  oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "key"));
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyDB_getString_(%s)", key_name );
+  }
+
+
+  clck = oyClock();
+  oyDB_s * db = oyDB_newFrom( key_domain, oySCOPE_USER_SYS, oyAllocateFunc_, oyDeAllocateFunc_ );
+  for(i = 0; i < n*3; ++i)
+  {
+    char * value = oyDB_getString(db, key_name);
+    if(!value)
+      break;
+    oyFree_m_(value);
+  }
+  char * value_db = oyDB_getString(db, key_name);
+  oyDB_release( &db );
+  clck = oyClock() - clck;
+
+  if( i )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyDB_getString() shared            %s",
+                  oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "key"));
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyDB_getString_(%s)", key_name );
+  }
+
+
+  char * value = oyGetPersistentString( key_name, 0, oySCOPE_USER_SYS,0 );
+  if( (!value && !value_db) ||
+      (value && value_db && strcmp(value,value_db) == 0))
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "DB and cached values are equal        ");
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "DB and cached values are equal: \"%s\"/\"%s\"", value, value_db );
+  }
+  oyFree_m_(value);
+  clck = oyClock();
+  for(i = 0; i < n*3*17; ++i)
+  {
+    char * t = oyGetPersistentString( key_name, 0, oySCOPE_USER_SYS,0 );
+    if(!t)
+      break;
+  }
+  clck = oyClock() - clck;
+
+  if( i>n )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyGetPersistentString() cached     %s",
+                  oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "key"));
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyGetPersistentString(%s)", key_name );
+  }
+
+
+  clck = oyClock();
+  oyOption_s * option = oyOption_FromRegistration(OY_STD"/behaviour/rendering_bpc", testobj);
+  oyOption_SetFromString(option, "-1", 0);
+
+  for(i = 0; i < n*3*17; ++i)
+  {
+    error = oyOption_SetValueFromDB( option );
+    if(error > 0) break;
+  }
+  clck = oyClock() - clck;
+
+  if( i > 1 && error <= 0 )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyOption_SetValueFromDB()           %s",
+                  oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Opt."));
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyOption_SetValueFromDB(%s)", oyOption_GetText(option, oyNAME_NICK) );
+  }
+
+  clck = oyClock();
+  for(i = 0; i < 1; ++i)
+  {
+    oyOptions_s * options = oyOptions_ForFilter( "//" OY_TYPE_STD "/lcm2",
+                                            oyOPTIONATTRIBUTE_ADVANCED  |
+                                            oyOPTIONATTRIBUTE_FRONT |
+                                            OY_SELECT_COMMON, testobj );
+    oyOptions_Release( &options );
+  }
+  clck = oyClock() - clck;
+
+  if( i )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyOptions_ForFilter() first        %s",
+                  oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Filter"));
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyOptions_ForFilter() first                       " );
+  }
+
+  clck = oyClock();
+  for(i = 0; i < n; ++i)
+  {
+    oyOptions_s * options = oyOptions_ForFilter( "//" OY_TYPE_STD "/lcm2",
+                                            oyOPTIONATTRIBUTE_ADVANCED  |
+                                            oyOPTIONATTRIBUTE_FRONT |
+                                            OY_SELECT_COMMON, testobj );
+    oyOptions_Release( &options );
+  }
+  clck = oyClock() - clck;
+
+  if( i )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyOptions_ForFilter()              %s",
+                  oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Filter"));
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyOptions_ForFilter()                             " );
+  }
+
+
+
+  oyOptions_s * options = oyOptions_New(0);
+  clck = oyClock();
+  for(i = 0; i < n*10000; ++i)
+  {
+    oyFilterCore_s * core = oyFilterCore_NewWith( "//" OY_TYPE_STD "/root",
+                                                  options, testobj );
+    if(!core) break;
+    oyFilterCore_Release( &core );
+  }
+  clck = oyClock() - clck;
+
+  if( i )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyFilterCore_New()                  %s",
+                 oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Cores"));
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyFilterCore_New()                                 " );
+  }
+
+
+  clck = oyClock();
+  const char * registration = "//" OY_TYPE_STD "/root";
+  for(i = 0; i < n*10000; ++i)
+  {
+    oyCMMapi4_s_ * api4 = 0;
+    api4 = (oyCMMapi4_s_*) oyCMMsGetFilterApi_(
+                                            registration, oyOBJECT_CMM_API4_S );
+    error = !api4;
+    if(!(i%30000)) { fprintf(zout, "." ); fflush(zout); }
+  }
+  fprintf(zout,"\n");
+  clck = oyClock() - clck;
+
+  if( !error )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyFilterCore_New() oyCMMapi4_s      %s",
+                 oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Cores"));
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyFilterCore_New() oyCMMapi4_s                     " );
+  }
+
+
+  oyConversion_s * s = 0;
+  oyFilterNode_s * out = 0;
+  oyImage_s * input  = NULL,
+            * output = NULL;
+  double * buf_in = &d[0],
+         * buf_out = &d[3];
+  oyDATATYPE_e buf_type_in = oyDOUBLE,
+               buf_type_out = oyDOUBLE;
+  oyProfile_s * p_in = prof,
+              * p_out = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
+
+  input =oyImage_Create( 1,1, 
+                         buf_in ,
+                         oyChannels_m(oyProfile_GetChannelsCount(p_in)) |
+                          oyDataType_m(buf_type_in),
+                         p_in,
+                         0 );
+  output=oyImage_Create( 1,1, 
+                         buf_out ,
+                         oyChannels_m(oyProfile_GetChannelsCount(p_out)) |
+                          oyDataType_m(buf_type_out),
+                         p_out,
+                         0 );
+  error = !input || !output;
+
+
+  clck = oyClock();
+  for(i = 0; i < n; ++i)
+  if(error <= 0)
+  {
+    s = oyConversion_CreateBasicPixels( input, output, options, testobj );
+    oyConversion_Release( &s );
+    //if(!(i%10)) fprintf(zout, "." ); fflush(stdout);
   }
-  oyStringListRelease_( &texts, count, free );
+  clck = oyClock() - clck;
 
-  if( count )
+  //fprintf(zout,"\n");
+  oyImage_Release( &input );
+  oyImage_Release( &output );
+
+  if( !error )
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyCMMsGetLibNames_p( ) found %u                    ", (unsigned int)count );
+    "oyConversion_CreateBasicPixels()    %s",
+                    oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Obj."));
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyCMMsGetLibNames_p( ) found %u                    ", (unsigned int)count );
+    "oyConversion_CreateBasicPixels()                   " );
   }
 
-  oyDeAllocateFunc_( text_tmp );
+  input =oyImage_Create( 1,1, 
+                         buf_in ,
+                         oyChannels_m(oyProfile_GetChannelsCount(p_in)) |
+                          oyDataType_m(buf_type_in),
+                         p_in,
+                         testobj );
+  output=oyImage_Create( 1,1, 
+                         buf_out ,
+                         oyChannels_m(oyProfile_GetChannelsCount(p_out)) |
+                          oyDataType_m(buf_type_out),
+                         p_out,
+                         testobj );
 
-  STRING_ADD( t, "     </xf:group>\n</body>\n</html>\n" );
-  int r OY_UNUSED;
-  r = remove("test2_CMMs.xhtml");
-  oyWriteMemToFile2_( "test2_CMMs.xhtml", t, strlen(t),0/*OY_FILE_NAME_SEARCH*/,
-                      &rfile, malloc );
-  fprintf(zout, "Wrote %s\n", rfile?rfile:"test2_CMMs.xhtml" );
-  free( rfile );
+  #define OY_ERR if(l_error != 0) error = l_error;
 
-  return result;
-}
+  oyFilterPlug_s * plug = 0;
+  oyPixelAccess_s * pixel_access = 0;
+  s = oyConversion_CreateBasicPixels( input,output, 0, testobj );
+  out = oyConversion_GetNode( s, OY_OUTPUT );
+  if(s && out)
+    plug = oyFilterNode_GetPlug( out, 0 );
+  else
+    error = 1;
+  pixel_access = oyPixelAccess_Create( 0,0, plug,
+                                       oyPIXEL_ACCESS_IMAGE, testobj );
+  oyFilterPlug_Release( &plug );
 
-#include "oyFilterCore_s_.h"
-#include "oyNamedColor_s.h"
-#include "oyNamedColors_s.h"
-#include "oyranos_alpha_internal.h"
+  clck = oyClock();
+  for(i = 0; i < n*1000; ++i)
+  if(error <= 0)
+    error  = oyConversion_RunPixels( s, pixel_access );
+  clck = oyClock() - clck;
 
-oyTESTRESULT_e testCMMnmRun ()
-{
-  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
-  oyNamedColor_s * c = 0;
-  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
-                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
-  oyProfile_s * prof = oyProfile_FromStd( oyEDITING_XYZ, icc_profile_flags, testobj );
-  int error = 0, l_error = 0,
-      i,n = 10;
+  oyConversion_Release ( &s );
+  oyPixelAccess_Release( &pixel_access );
 
-  fprintf(stdout, "\n" );
+  if( !error )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyConversion_RunPixels( oyPixelAcce.%s",
+                          oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Pixel"));
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyConversion_RunPixels()                           " );
+  }
 
-  fprintf(zout, "clearing caches\n" );
-  oyAlphaFinish_(0);
 
-  double clck = oyClock();
-  for(i = 0; i < n*10000; ++i)
+  s = oyConversion_CreateBasicPixels( input,output, options, testobj );
+  clck = oyClock();
+  for(i = 0; i < n; ++i)
+  if(error <= 0)
   {
-    c = oyNamedColor_Create( NULL, NULL,0, prof, testobj );
-    oyNamedColor_Release( &c );
+    error  = oyConversion_RunPixels( s, 0 );
+    //if(!(i%10)) fprintf(zout, "." ); fflush(zout);
   }
+  //printf(zout, "\n" );
   clck = oyClock() - clck;
+  oyConversion_Release ( &s );
 
-  c = oyNamedColor_Create( NULL, NULL,0, prof, testobj );
-  if( c )
+  if( !error )
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyNamedColor_Create( )             %s",
-                   oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Obj."));
+    "oyConversion_RunPixels()          %s",
+                          oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Pixel"));
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyNamedColor_Create( )                            " );
+    "oyConversion_RunPixels()                         " );
   }
 
 
-  const char * key_domain = OY_STD"/behaviour";
-  const char * key_name = OY_STD"/behaviour/rendering_bpc";
+
   clck = oyClock();
-  for(i = 0; i < n*3; ++i)
+
+  for(i = 0; i < n && error <= 0; ++i)
   {
-    oyDB_s * db = oyDB_newFrom( key_domain, oySCOPE_USER_SYS, oyAllocateFunc_, oyDeAllocateFunc_ );
-    char * value = oyDB_getString(db, key_name);
-    if(!value)
-      break;
-    oyFree_m_(value);
-    oyDB_release( &db );
+    l_error = oyNamedColor_SetColorStd ( c, oyASSUMED_WEB,
+                                           (oyPointer)d, oyDOUBLE, 0, options );
+    if(error <= 0)
+      error = l_error;
   }
   clck = oyClock() - clck;
 
-  if( i )
+  if( !error )
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyDB_getString()                   %s",
-                  oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "key"));
+    "oyNamedColor_SetColorStd()        %s",
+                          oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Pixel"));
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyDB_getString_(%s)", key_name );
+    "oyNamedColor_SetColorStd() oyASSUMED_WEB         " );
   }
 
+  p_in = oyProfile_FromStd ( oyASSUMED_WEB, icc_profile_flags, testobj );
+  p_out = oyProfile_FromStd ( oyEDITING_XYZ, icc_profile_flags, testobj );
 
   clck = oyClock();
-  oyDB_s * db = oyDB_newFrom( key_domain, oySCOPE_USER_SYS, oyAllocateFunc_, oyDeAllocateFunc_ );
-  for(i = 0; i < n*3; ++i)
+  for(i = 0; i < n; ++i)
   {
-    char * value = oyDB_getString(db, key_name);
-    if(!value)
-      break;
-    oyFree_m_(value);
+
+  oyImage_s * in  = NULL,
+            * out = NULL;
+  oyConversion_s * conv = NULL;
+
+  in    = oyImage_Create( 1,1, 
+                         buf_in ,
+                         oyChannels_m(oyProfile_GetChannelsCount(p_in)) |
+                          oyDataType_m(buf_type_in),
+                         p_in,
+                         0 );
+  out   = oyImage_Create( 1,1, 
+                         buf_out ,
+                         oyChannels_m(oyProfile_GetChannelsCount(p_out)) |
+                          oyDataType_m(buf_type_out),
+                         p_out,
+                         0 );
+
+  conv   = oyConversion_CreateBasicPixels( in,out, options, testobj );
+  if(!error)
+  error  = oyConversion_RunPixels( conv, 0 );
+
+  oyConversion_Release( &conv );
+  oyImage_Release( &in );
+  oyImage_Release( &out );
   }
-  char * value_db = oyDB_getString(db, key_name);
-  oyDB_release( &db );
   clck = oyClock() - clck;
 
-  if( i )
+
+  if( !error )
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyDB_getString() shared            %s",
-                  oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "key"));
+    "oyColorConvert_()                  %s",
+                          oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Pixel"));
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyDB_getString_(%s)", key_name );
+    "oyColorConvert_()                                 " );
   }
 
 
-  char * value = oyGetPersistentString( key_name, 0, oySCOPE_USER_SYS,0 );
-  if( (!value && !value_db) ||
-      (value && value_db && strcmp(value,value_db) == 0))
+  input  = oyImage_Create( 1,1, 
+                         buf_in ,
+                         oyChannels_m(oyProfile_GetChannelsCount(p_in)) |
+                          oyDataType_m(buf_type_in),
+                         p_in,
+                         testobj );
+  output = oyImage_Create( 1,1, 
+                         buf_out ,
+                         oyChannels_m(oyProfile_GetChannelsCount(p_out)) |
+                          oyDataType_m(buf_type_out),
+                         p_out,
+                         testobj );
+  oyConversion_s * conv   = oyConversion_CreateBasicPixels( input,output, 0,testobj );
+
+  out = oyConversion_GetNode( conv, OY_OUTPUT );
+
+  /* conversion->out_ has to be linear, so we access only the first plug */
+  if(conv)
+    plug = oyFilterNode_GetPlug( out, 0 );
+  oyFilterNode_Release (&out );
+
+  /* create a very simple pixel iterator as job ticket */
+  if(plug)
+    pixel_access = oyPixelAccess_Create( 0,0, plug,
+                                           oyPIXEL_ACCESS_IMAGE, testobj );
+  error  = oyConversion_RunPixels( conv, pixel_access );
+
+  clck = oyClock();
+  if(pixel_access)
+  for(i = 0; i < n*1000; ++i)
+  {
+    if(!error)
+      error  = oyConversion_RunPixels( conv, pixel_access );
+  }
+  clck = oyClock() - clck;
+
+
+
+  if( !error )
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "DB and cached values are equal        ");
+    "oyColorConvert_() with oyPixelAcce.%s",
+                          oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Pixel"));
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "DB and cached values are equal: \"%s\"/\"%s\"", value, value_db );
+    "oyColorConvert_() with oyPixelAccess_Create()     " );
   }
-  oyFree_m_(value);
+
   clck = oyClock();
-  for(i = 0; i < n*3*17; ++i)
+  d[0] = d[1] = d[2] = 1.0;
+  d[3] = d[4] = d[5] = 0.0;
+  if(pixel_access)
+  for(i = 0; i < n*1000; ++i)
   {
-    char * t = oyGetPersistentString( key_name, 0, oySCOPE_USER_SYS,0 );
-    if(!t)
-      break;
+    if(!error)
+      error = oyConversion_GetOnePixel( conv, 0,0, pixel_access );
   }
   clck = oyClock() - clck;
+  oyConversion_Release( &conv );
+  oyPixelAccess_Release( &pixel_access );
 
-  if( i>n )
+  if( !error  && d[3] != 0.0 )
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyGetPersistentString() cached     %s",
-                  oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "key"));
+    "oyConversion_GetOnePixel( oyPix. )  %s %.02g %.02g %.02g",
+                          oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Pixel"), d[3], d[4], d[5]);
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyGetPersistentString(%s)", key_name );
+    "oyConversion_GetOnePixel( oyPix. )  %s %.02g %.02g %.02g" ,
+                          oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Pixel"), d[3], d[4], d[5]);
   }
 
 
+  conv = oyConversion_New( testobj );
+  oyFilterNode_s * in_node = oyFilterNode_NewWith( "//" OY_TYPE_STD "/root", 0, testobj );
+  oyConversion_Set( conv, in_node, 0 );
+  oyFilterNode_SetData( in_node, (oyStruct_s*)input, 0, 0 );
+  oyFilterNode_s * out_node = oyFilterNode_NewWith( "//" OY_TYPE_STD "/output", 0, testobj );
+  /*oyFilterNode_SetData( out_node, (oyStruct_s*)output, 0, 0 );*/
+  error = oyFilterNode_Connect( in_node, "//" OY_TYPE_STD "/data",
+                                out_node, "//" OY_TYPE_STD "/data", 0 );
+  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyFilterNode_Connect() error: %d", error )
+  oyConversion_Set( conv, 0, out_node );
+  oyConversion_GetNode( conv, OY_OUTPUT );
+  plug = oyFilterNode_GetPlug( out, 0 );
+  oyFilterNode_Release (&out );
+
+  /* create a very simple pixel iterator as job ticket */
+  if(plug)
+    pixel_access = oyPixelAccess_Create( 0,0, plug,
+                                         oyPIXEL_ACCESS_IMAGE, testobj );
+  error  = oyConversion_RunPixels( conv, pixel_access );
+
   clck = oyClock();
-  oyOption_s * option = oyOption_FromRegistration(OY_STD"/behaviour/rendering_bpc", testobj);
-  oyOption_SetFromString(option, "-1", 0);
-
-  for(i = 0; i < n*3*17; ++i)
+  for(i = 0; i < n*1000; ++i)
   {
-    error = oyOption_SetValueFromDB( option );
-    if(error > 0) break;
+    if(!error)
+      error = oyConversion_RunPixels( conv, pixel_access );
   }
   clck = oyClock() - clck;
 
-  if( i > 1 && error <= 0 )
+  oyImage_Release( &input );
+  oyImage_Release( &output );
+
+  oyPixelAccess_Release( &pixel_access );
+  oyConversion_Release( &conv );
+
+
+  if( !error )
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyOption_SetValueFromDB()           %s",
-                  oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Opt."));
+    "oyConversion_RunPixels (2 nodes)    %s",
+                          oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Pixel"));
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyOption_SetValueFromDB(%s)", oyOption_GetText(option, oyNAME_NICK) );
+    "oyConversion_RunPixels (2 nodes)                   " );
   }
 
-  clck = oyClock();
-  for(i = 0; i < 1; ++i)
+
+  conv = oyConversion_CreateBasicPixelsFromBuffers(
+                                        p_in, buf_in, oyDataType_m(buf_type_in),
+                                        p_out, buf_out, oyDataType_m(buf_type_out),
+                                        0, 1 );
+  oyConversion_Release( &conv );
+
+
+
+  oyProfile_s * p_cmyk = oyProfile_FromStd( oyEDITING_CMYK, icc_profile_flags, testobj );
+  oyNamedColor_s * ncl = 0;
+  oyNamedColors_s * colors = oyNamedColors_New(testobj);
+
+  oyNamedColors_SetPrefix( colors, "test" );
+  oyNamedColors_SetSuffix( colors, "color" );
+
+  if(p_cmyk)
   {
-    oyOptions_s * options = oyOptions_ForFilter( "//" OY_TYPE_STD "/lcm2",
-                                            oyOPTIONATTRIBUTE_ADVANCED  |
-                                            oyOPTIONATTRIBUTE_FRONT |
-                                            OY_SELECT_COMMON, testobj );
-    oyOptions_Release( &options );
-  }
-  clck = oyClock() - clck;
+    clck = oyClock();
+    for( i = 0; i < 10*100; ++i )
+    {
+      char name[12];
+      double lab[3], device[4] = {0.2,0.2,0.1,0.5};
 
-  if( i )
-  { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyOptions_ForFilter() first        %s",
-                  oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Filter"));
-  } else
-  { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyOptions_ForFilter() first                       " );
+      lab[0] = i*0.001;
+      lab[1] = lab[2] = 0.5;
+      sprintf( name, "%d", i );
+
+      ncl = oyNamedColor_CreateWithName( name, name, name, NULL, NULL, NULL, 0, p_cmyk, testobj );
+
+      if(!error)
+        error = oyNamedColor_SetColorStd( ncl, oyEDITING_LAB, lab, oyDOUBLE, 0, NULL );
+      if(!error)
+        oyNamedColor_SetChannels( ncl, device, 0 );
+
+      oyNamedColors_MoveIn( colors, &ncl, i );
+    }
+    clck = oyClock() - clck;
+
+    if( !error )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyNamedColor_CreateWithName()     %s",
+                          oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Ncl"));
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyNamedColor_CreateWithName()            " );
+    }
   }
 
+  
+  return result;
+}
+
+#include "oyRectangle_s_.h"
+
+oyTESTRESULT_e testImagePixel()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  oyProfile_s * p_lab = oyProfile_FromStd( oyEDITING_LAB, icc_profile_flags, testobj );
+  oyProfile_s * p_web = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
+  oyProfile_s /** p_cmyk = oyProfile_FromStd( oyEDITING_CMYK, NULL ),*/
+              * p_in, * p_out;
+  int error = 0,
+      i,n = 1;
+  uint16_t buf_16in2x2[12] = {
+  20000,20000,20000, 10000,10000,10000,
+  0,0,0,             65535,65535,65535
+  };
+  uint16_t buf_16out2x2[12];
+  oyDATATYPE_e buf_type_in = oyUINT16,
+               buf_type_out = oyUINT16;
+  oyImage_s *input, *output;
+
+  fprintf(stdout, "\n" );
+
+  double clck = oyClock();
+  p_in = p_web;
+  p_out = p_lab;
+  input =oyImage_Create( 2,2, 
+                         buf_16in2x2,
+                         oyChannels_m(oyProfile_GetChannelsCount(p_in)) |
+                          oyDataType_m(buf_type_in),
+                         p_in,
+                         testobj );
+  output=oyImage_Create( 2,2, 
+                         buf_16out2x2,
+                         oyChannels_m(oyProfile_GetChannelsCount(p_out)) |
+                          oyDataType_m(buf_type_out),
+                         p_out,
+                         testobj );
+
+  oyFilterPlug_s * plug = 0;
+  oyPixelAccess_s * pixel_access = 0;
+  oyConversion_s * cc;
+  memset( buf_16out2x2, 0, sizeof(uint16_t)*12 );
+  cc = oyConversion_CreateBasicPixels( input,output, 0, testobj );
+  oyFilterNode_s * out = oyConversion_GetNode( cc, OY_OUTPUT );
+  if(cc && out)
+    plug = oyFilterNode_GetPlug( oyConversion_GetNode( cc, OY_OUTPUT), 0 );
+  else
+    error = 1;
+  pixel_access = oyPixelAccess_Create( 0,0, plug,
+                                           oyPIXEL_ACCESS_IMAGE, testobj );
+  oyFilterPlug_Release( &plug );
+
+  error  = oyConversion_RunPixels( cc, pixel_access );
   clck = oyClock();
-  for(i = 0; i < n; ++i)
+  for(i = 0; i < n*1000; ++i)
+  if(error <= 0)
   {
-    oyOptions_s * options = oyOptions_ForFilter( "//" OY_TYPE_STD "/lcm2",
-                                            oyOPTIONATTRIBUTE_ADVANCED  |
-                                            oyOPTIONATTRIBUTE_FRONT |
-                                            OY_SELECT_COMMON, testobj );
-    oyOptions_Release( &options );
+    error  = oyConversion_RunPixels( cc, pixel_access );
   }
   clck = oyClock() - clck;
 
-  if( i )
+  if( !error &&
+      /* check unchanged input buffer */
+      buf_16in2x2[0]==20000 && buf_16in2x2[1]==20000 && buf_16in2x2[2]==20000 &&
+      buf_16in2x2[3]==10000 && buf_16in2x2[4]==10000 && buf_16in2x2[5]==10000 &&
+      buf_16in2x2[6]==0 && buf_16in2x2[7]==0 && buf_16in2x2[8]==0 &&
+      buf_16in2x2[9]==65535 && buf_16in2x2[10]==65535 &&buf_16in2x2[11]==65535&&
+      /* check black and white in lower row with typical *ab of 32896 */
+      buf_16out2x2[6]<5000 && buf_16out2x2[7]>20000 && buf_16out2x2[7]<40000 &&
+      buf_16out2x2[9]>65000 && buf_16out2x2[10]>20000 && buf_16out2x2[10]<40000
+      )
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyOptions_ForFilter()              %s",
-                  oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Filter"));
+    "Plain Image                              %s",
+                          oyProfilingToString(4*i,clck/(double)CLOCKS_PER_SEC, "Pixel"));
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyOptions_ForFilter()                             " );
+    "Plain Image                                        " );
   }
 
+  fprintf(zout, "input:  %d,%d,%d %d,%d,%d\n        %d,%d,%d %d,%d,%d\n",
+                  buf_16in2x2[0], buf_16in2x2[1], buf_16in2x2[2],
+                  buf_16in2x2[3], buf_16in2x2[4], buf_16in2x2[5],
+                  buf_16in2x2[6], buf_16in2x2[7], buf_16in2x2[8],
+                  buf_16in2x2[9], buf_16in2x2[10], buf_16in2x2[11] );
+  fprintf(zout, "output: %d,%d,%d %d,%d,%d\n        %d,%d,%d %d,%d,%d\n",
+                  buf_16out2x2[0], buf_16out2x2[1], buf_16out2x2[2],
+                  buf_16out2x2[3], buf_16out2x2[4], buf_16out2x2[5],
+                  buf_16out2x2[6], buf_16out2x2[7], buf_16out2x2[8],
+                  buf_16out2x2[9], buf_16out2x2[10], buf_16out2x2[11] );
+
 
 
-  oyOptions_s * options = oyOptions_New(0);
+  buf_16in2x2[0]=buf_16in2x2[1]=buf_16in2x2[2]=20000;
+  buf_16in2x2[3]=buf_16in2x2[4]=buf_16in2x2[5]=10000;
+  buf_16in2x2[6]=buf_16in2x2[7]=buf_16in2x2[8]=0;
+  buf_16in2x2[9]=buf_16in2x2[10]=buf_16in2x2[11]=65535;
+  memset( buf_16out2x2, 0, sizeof(uint16_t)*12 );
+  /* use the lower left source pixel */
+  if(pixel_access)
+  {
+    oyRectangle_s * r = oyPixelAccess_GetArrayROI( pixel_access );
+    (*oyRectangle_SetGeo1(r,2)) *= 0.5;
+    (*oyRectangle_SetGeo1(r,3)) *= 0.5;
+    oyPixelAccess_ChangeRectangle( pixel_access, 0.5,0.5, r );
+  }
   clck = oyClock();
-  for(i = 0; i < n*10000; ++i)
+  for(i = 0; i < n*1000; ++i)
+  if(error <= 0)
   {
-    oyFilterCore_s * core = oyFilterCore_NewWith( "//" OY_TYPE_STD "/root",
-                                                  options, testobj );
-    if(!core) break;
-    oyFilterCore_Release( &core );
+    error  = oyConversion_RunPixels( cc, pixel_access );
   }
   clck = oyClock() - clck;
 
-  if( i )
+  if( !error &&
+      /* input should not change */
+      buf_16in2x2[0]==20000 && buf_16in2x2[1]==20000 && buf_16in2x2[2]==20000 &&
+      buf_16in2x2[3]==10000 && buf_16in2x2[4]==10000 && buf_16in2x2[5]==10000 &&
+      buf_16in2x2[6]==0 && buf_16in2x2[7]==0 && buf_16in2x2[8]==0 &&
+      buf_16in2x2[9]==65535 && buf_16in2x2[10]==65535 &&buf_16in2x2[11]==65535&&
+      /* the result shall appear in the upper left corner / first pixel */
+      buf_16out2x2[0]>65000 && buf_16out2x2[1]>20000 && buf_16out2x2[2]<40000&&
+      /* all other buffer pixels shall remain untouched */
+      buf_16out2x2[3]==0 && buf_16out2x2[4]==0 && buf_16out2x2[5]==0 &&
+      buf_16out2x2[6]==0 && buf_16out2x2[7]==0 && buf_16out2x2[8]==0 &&
+      buf_16out2x2[9]==0 && buf_16out2x2[10]==0 && buf_16out2x2[11]==0
+      )
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyFilterCore_New()                  %s",
-                 oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Cores"));
+    "lower right source pixel in 1 pixel RoI  %s",
+                          oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Pixel"));
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyFilterCore_New()                                 " );
+    "lower right source pixel in 1 pixel RoI            " );
   }
 
+  fprintf(zout, "input:  %d,%d,%d %d,%d,%d\n        %d,%d,%d %d,%d,%d\n",
+                  buf_16in2x2[0], buf_16in2x2[1], buf_16in2x2[2],
+                  buf_16in2x2[3], buf_16in2x2[4], buf_16in2x2[5],
+                  buf_16in2x2[6], buf_16in2x2[7], buf_16in2x2[8],
+                  buf_16in2x2[9], buf_16in2x2[10], buf_16in2x2[11] );
+  fprintf(zout, "output: %d,%d,%d %d,%d,%d\n        %d,%d,%d %d,%d,%d\n",
+                  buf_16out2x2[0], buf_16out2x2[1], buf_16out2x2[2],
+                  buf_16out2x2[3], buf_16out2x2[4], buf_16out2x2[5],
+                  buf_16out2x2[6], buf_16out2x2[7], buf_16out2x2[8],
+                  buf_16out2x2[9], buf_16out2x2[10], buf_16out2x2[11] );
+
 
+  buf_16in2x2[0]=buf_16in2x2[1]=buf_16in2x2[2]=20000;
+  buf_16in2x2[3]=buf_16in2x2[4]=buf_16in2x2[5]=10000;
+  buf_16in2x2[6]=buf_16in2x2[7]=buf_16in2x2[8]=0;
+  buf_16in2x2[9]=buf_16in2x2[10]=buf_16in2x2[11]=65535;
+  memset( buf_16out2x2, 0, sizeof(buf_16out2x2) );
+  if(pixel_access)
+  {
+    oyRectangle_s * r = oyPixelAccess_GetArrayROI( pixel_access );
+    oyRectangle_SetGeo(r, 0.5,0.5, 0.5,0.5);
+    oyPixelAccess_ChangeRectangle( pixel_access, 0.5,0.5, r );
+  }
   clck = oyClock();
-  const char * registration = "//" OY_TYPE_STD "/root";
-  for(i = 0; i < n*10000; ++i)
+  for(i = 0; i < n*1000; ++i)
+  if(error <= 0)
   {
-    oyCMMapi4_s_ * api4 = 0;
-    api4 = (oyCMMapi4_s_*) oyCMMsGetFilterApi_(
-                                            registration, oyOBJECT_CMM_API4_S );
-    error = !api4;
-    if(!(i%30000)) { fprintf(zout, "." ); fflush(zout); }
+    error  = oyConversion_RunPixels( cc, pixel_access );
   }
-  fprintf(zout,"\n");
   clck = oyClock() - clck;
 
-  if( !error )
+  if( !error &&
+      /* input should not change */
+      buf_16in2x2[0]==20000 && buf_16in2x2[1]==20000 && buf_16in2x2[2]==20000 &&
+      buf_16in2x2[3]==10000 && buf_16in2x2[4]==10000 && buf_16in2x2[5]==10000 &&
+      buf_16in2x2[6]==0 && buf_16in2x2[7]==0 && buf_16in2x2[8]==0 &&
+      buf_16in2x2[9]==65535 && buf_16in2x2[10]==65535 &&buf_16in2x2[11]==65535&&
+      /* the result shall appear in the lower right corner / last pixel */
+      buf_16out2x2[9]>65000 && buf_16out2x2[10]>20000&&buf_16out2x2[11]<40000&&
+      /* all other buffer pixels shall remain untouched */
+      buf_16out2x2[0]==0 && buf_16out2x2[1]==0 && buf_16out2x2[2]==0 &&
+      buf_16out2x2[3]==0 && buf_16out2x2[4]==0 && buf_16out2x2[5]==0 &&
+      buf_16out2x2[6]==0 && buf_16out2x2[7]==0 && buf_16out2x2[8]==0
+      )
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyFilterCore_New() oyCMMapi4_s      %s",
-                 oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Cores"));
+    "lower right source in lower right output %s",
+                          oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Pixel"));
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyFilterCore_New() oyCMMapi4_s                     " );
+    "lower right source in lower right output           " );
   }
 
+  fprintf(zout, "input:  %d,%d,%d %d,%d,%d\n        %d,%d,%d %d,%d,%d\n",
+                  buf_16in2x2[0], buf_16in2x2[1], buf_16in2x2[2],
+                  buf_16in2x2[3], buf_16in2x2[4], buf_16in2x2[5],
+                  buf_16in2x2[6], buf_16in2x2[7], buf_16in2x2[8],
+                  buf_16in2x2[9], buf_16in2x2[10], buf_16in2x2[11] );
+  fprintf(zout, "output: %d,%d,%d %d,%d,%d\n        %d,%d,%d %d,%d,%d\n",
+                  buf_16out2x2[0], buf_16out2x2[1], buf_16out2x2[2],
+                  buf_16out2x2[3], buf_16out2x2[4], buf_16out2x2[5],
+                  buf_16out2x2[6], buf_16out2x2[7], buf_16out2x2[8],
+                  buf_16out2x2[9], buf_16out2x2[10], buf_16out2x2[11] );
+
 
-  oyConversion_s * s = 0;
-  oyFilterNode_s * out = 0;
-  oyImage_s * input  = NULL,
-            * output = NULL;
-  double * buf_in = &d[0],
-         * buf_out = &d[3];
-  oyDATATYPE_e buf_type_in = oyDOUBLE,
-               buf_type_out = oyDOUBLE;
-  oyProfile_s * p_in = prof,
-              * p_out = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
+  oyConversion_Release ( &cc );
+  oyPixelAccess_Release( &pixel_access );
+  oyProfile_Release( &p_lab );
+  oyProfile_Release( &p_web );
 
-  input =oyImage_Create( 1,1, 
-                         buf_in ,
-                         oyChannels_m(oyProfile_GetChannelsCount(p_in)) |
-                          oyDataType_m(buf_type_in),
-                         p_in,
-                         0 );
-  output=oyImage_Create( 1,1, 
-                         buf_out ,
-                         oyChannels_m(oyProfile_GetChannelsCount(p_out)) |
-                          oyDataType_m(buf_type_out),
-                         p_out,
-                         0 );
-  error = !input || !output;
+  oyPixel_t pixel_layout = OY_TYPE_123_16;
+  oyPointer channels = 0;
+  oyRectangle_s_ roi_ = {oyOBJECT_RECTANGLE_S, 0,0,0,0,0,0,0};
+  oyRectangle_s_ a_roi_ = {oyOBJECT_RECTANGLE_S, 0,0,0,0,0,0,0};
+  oyRectangle_s * roi = (oyRectangle_s*)&roi_,
+                * a_roi = (oyRectangle_s*)&a_roi_;
 
+  oyArray2d_s * a = oyArray2d_Create( channels,
+                                      2 * oyToChannels_m(pixel_layout),
+                                      2,
+                                      oyToDataType_m(pixel_layout),
+                                      testobj );
 
-  clck = oyClock();
-  for(i = 0; i < n; ++i)
-  if(error <= 0)
-  {
-    s = oyConversion_CreateBasicPixels( input, output, options, testobj );
-    oyConversion_Release( &s );
-    //if(!(i%10)) fprintf(zout, "." ); fflush(stdout);
-  }
-  clck = oyClock() - clck;
+  oyRectangle_SetGeo( roi, 0.5,0.5,0.5,0.5 );
+  oyRectangle_SetGeo( a_roi, 0.5,0.5,0.5,0.5 );
+  buf_16out2x2[9] = buf_16out2x2[10] = buf_16out2x2[11] = 65535;
+  error = oyImage_FillArray( output, roi, 0,
+                             &a,
+                             a_roi, 0 );
 
-  //fprintf(zout,"\n");
-  oyImage_Release( &input );
-  oyImage_Release( &output );
+  uint16_t ** rows_u16 = (uint16_t**)oyArray2d_GetData(a);
+  uint16_t * output_u16 = rows_u16[0];
 
-  if( !error )
+  if(!error &&
+     rows_u16[0] != buf_16out2x2)
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyConversion_CreateBasicPixels()    %s",
-                    oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Obj."));
+    "oyImage_FillArray() keep allocation                 " );
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyConversion_CreateBasicPixels()                   " );
+    "oyImage_FillArray() keep alloc 0x%lo 0x%lo",
+    (unsigned long)rows_u16[0], (unsigned long)buf_16out2x2 );
   }
 
-  input =oyImage_Create( 1,1, 
-                         buf_in ,
-                         oyChannels_m(oyProfile_GetChannelsCount(p_in)) |
-                          oyDataType_m(buf_type_in),
-                         p_in,
-                         testobj );
-  output=oyImage_Create( 1,1, 
-                         buf_out ,
-                         oyChannels_m(oyProfile_GetChannelsCount(p_out)) |
-                          oyDataType_m(buf_type_out),
-                         p_out,
-                         testobj );
+  if(!error &&
+     output_u16[9] == 65535 && output_u16[10] == 65535 && output_u16[11] == 65535)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyImage_FillArray() place array data                " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyImage_FillArray() place array data                " );
+  }
 
-  #define OY_ERR if(l_error != 0) error = l_error;
+  fprintf(zout, "output: %d,%d,%d %d,%d,%d\n        %d,%d,%d %d,%d,%d\n",
+                  buf_16out2x2[0], buf_16out2x2[1], buf_16out2x2[2],
+                  buf_16out2x2[3], buf_16out2x2[4], buf_16out2x2[5],
+                  buf_16out2x2[6], buf_16out2x2[7], buf_16out2x2[8],
+                  buf_16out2x2[9], buf_16out2x2[10], buf_16out2x2[11] );
 
-  oyFilterPlug_s * plug = 0;
-  oyPixelAccess_s * pixel_access = 0;
-  s = oyConversion_CreateBasicPixels( input,output, 0, testobj );
-  out = oyConversion_GetNode( s, OY_OUTPUT );
-  if(s && out)
-    plug = oyFilterNode_GetPlug( out, 0 );
-  else
-    error = 1;
-  pixel_access = oyPixelAccess_Create( 0,0, plug,
-                                       oyPIXEL_ACCESS_IMAGE, testobj );
-  oyFilterPlug_Release( &plug );
+  /* set lower right pixel */
+  output_u16[0] = output_u16[1] = output_u16[2] = 2;
 
-  clck = oyClock();
-  for(i = 0; i < n*1000; ++i)
-  if(error <= 0)
-    error  = oyConversion_RunPixels( s, pixel_access );
-  clck = oyClock() - clck;
+  oyRectangle_SetGeo( a_roi, 0.0,0.0,0.5,0.5 );
+  error = oyImage_ReadArray( output, roi,
+                             a, a_roi );
 
-  oyConversion_Release ( &s );
-  oyPixelAccess_Release( &pixel_access );
 
-  if( !error )
+  rows_u16 = (uint16_t**)oyArray2d_GetData(a);
+  if(!error &&
+     rows_u16[0] != &buf_16out2x2[9] &&
+     buf_16out2x2[9]==2&& buf_16out2x2[10]==2&& buf_16out2x2[11]==2)
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyConversion_RunPixels( oyPixelAcce.%s",
-                          oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Pixel"));
+    "oyImage_ReadArray( array_roi )                      " );
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyConversion_RunPixels()                           " );
+    "oyImage_ReadArray( array_roi )                      " );
   }
 
+  /* set lower right pixel */
+  output_u16[0] = output_u16[1] = output_u16[2] = 3;
+  error = oyImage_ReadArray( output, roi,
+                             a, 0 );
 
-  s = oyConversion_CreateBasicPixels( input,output, options, testobj );
-  clck = oyClock();
-  for(i = 0; i < n; ++i)
-  if(error <= 0)
-  {
-    error  = oyConversion_RunPixels( s, 0 );
-    //if(!(i%10)) fprintf(zout, "." ); fflush(zout);
-  }
-  //printf(zout, "\n" );
-  clck = oyClock() - clck;
-  oyConversion_Release ( &s );
 
-  if( !error )
+  rows_u16 = (uint16_t**)oyArray2d_GetData(a);
+  if(!error &&
+     rows_u16[0] != &buf_16out2x2[9] &&
+     buf_16out2x2[9]==3&& buf_16out2x2[10]==3&& buf_16out2x2[11]==3)
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyConversion_RunPixels()          %s",
-                          oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Pixel"));
+    "oyImage_ReadArray()                                 " );
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyConversion_RunPixels()                         " );
+    "oyImage_ReadArray()                                 " );
   }
 
+  fprintf(zout, "output: %d,%d,%d %d,%d,%d\n        %d,%d,%d %d,%d,%d\n",
+                  buf_16out2x2[0], buf_16out2x2[1], buf_16out2x2[2],
+                  buf_16out2x2[3], buf_16out2x2[4], buf_16out2x2[5],
+                  buf_16out2x2[6], buf_16out2x2[7], buf_16out2x2[8],
+                  buf_16out2x2[9], buf_16out2x2[10], buf_16out2x2[11] );
 
+  /* move the focus to the lower left */
+  oyRectangle_s_ array_roi_pix = {oyOBJECT_RECTANGLE_S,0,0,0, 0,1,3,1};
+  oyArray2d_SetFocus( a, (oyRectangle_s*)&array_roi_pix );
 
-  clck = oyClock();
-
-  for(i = 0; i < n && error <= 0; ++i)
-  {
-    l_error = oyNamedColor_SetColorStd ( c, oyASSUMED_WEB,
-                                           (oyPointer)d, oyDOUBLE, 0, options );
-    if(error <= 0)
-      error = l_error;
-  }
-  clck = oyClock() - clck;
 
-  if( !error )
+  rows_u16 = (uint16_t**)oyArray2d_GetData(a);
+  if(!error &&
+     rows_u16[0] != output_u16)
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyNamedColor_SetColorStd()        %s",
-                          oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Pixel"));
+    "oyArray2d_SetFocus() change array                   " );
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyNamedColor_SetColorStd() oyASSUMED_WEB         " );
+    "oyArray2d_SetFocus() change 0x%lo 0x%lo",
+    (unsigned long)rows_u16[0], (unsigned long)output_u16 );
   }
 
-  p_in = oyProfile_FromStd ( oyASSUMED_WEB, icc_profile_flags, testobj );
-  p_out = oyProfile_FromStd ( oyEDITING_XYZ, icc_profile_flags, testobj );
-
-  clck = oyClock();
-  for(i = 0; i < n; ++i)
-  {
-
-  oyImage_s * in  = NULL,
-            * out = NULL;
-  oyConversion_s * conv = NULL;
-
-  in    = oyImage_Create( 1,1, 
-                         buf_in ,
-                         oyChannels_m(oyProfile_GetChannelsCount(p_in)) |
-                          oyDataType_m(buf_type_in),
-                         p_in,
-                         0 );
-  out   = oyImage_Create( 1,1, 
-                         buf_out ,
-                         oyChannels_m(oyProfile_GetChannelsCount(p_out)) |
-                          oyDataType_m(buf_type_out),
-                         p_out,
-                         0 );
 
-  conv   = oyConversion_CreateBasicPixels( in,out, options, testobj );
-  if(!error)
-  error  = oyConversion_RunPixels( conv, 0 );
+  output_u16 = (uint16_t*)rows_u16[0];
 
-  oyConversion_Release( &conv );
-  oyImage_Release( &in );
-  oyImage_Release( &out );
+  /* set lower right pixel */
+  output_u16[0] = output_u16[1] = output_u16[2] = 4;
+  error = oyImage_ReadArray( output, roi,
+                             a, 0 );
+  rows_u16 = (uint16_t**)oyArray2d_GetData(a);
+  if(!error &&
+     rows_u16[0] != &buf_16out2x2[9] &&
+     buf_16out2x2[9]==4&& buf_16out2x2[10]==4&& buf_16out2x2[11]==4)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyArray2d_SetFocus()                                " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyArray2d_SetFocus()                                " );
   }
-  clck = oyClock() - clck;
 
+  oyArray2d_Release( &a );
 
-  if( !error )
+  oyRectangle_SetGeo( a_roi, 0.5,0.5,0.5,0.5 );
+  error = oyImage_FillArray( output, roi, 0,
+                             &a, a_roi, 0 );
+
+  rows_u16 = (uint16_t**)oyArray2d_GetData(a);
+  if(!error &&
+     rows_u16[0] == &buf_16out2x2[0])
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyColorConvert_()                  %s",
-                          oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Pixel"));
+    "oyImage_FillArray() assigment                       " );
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyColorConvert_()                                 " );
+    "oyImage_FillArray() assigment 0x%lo 0x%lo",
+    (unsigned long)rows_u16[0], (unsigned long)&buf_16out2x2[9] );
   }
 
+  oyArray2d_Release( &a );
+  oyImage_Release( &input );
+  oyImage_Release( &output );
 
-  input  = oyImage_Create( 1,1, 
-                         buf_in ,
-                         oyChannels_m(oyProfile_GetChannelsCount(p_in)) |
-                          oyDataType_m(buf_type_in),
-                         p_in,
-                         testobj );
-  output = oyImage_Create( 1,1, 
-                         buf_out ,
-                         oyChannels_m(oyProfile_GetChannelsCount(p_out)) |
-                          oyDataType_m(buf_type_out),
-                         p_out,
-                         testobj );
-  oyConversion_s * conv   = oyConversion_CreateBasicPixels( input,output, 0,testobj );
+  return result;
+}
 
-  out = oyConversion_GetNode( conv, OY_OUTPUT );
+oyTESTRESULT_e testImagePixelTiled()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  oyProfile_s * p_lab = oyProfile_FromStd( oyEDITING_LAB, icc_profile_flags, testobj );
+  oyProfile_s * p_web = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
+  /* 50 mega pixel */
+  int error = 0, threads, max_threads = 1, width = 8192, height = 6144;
+  size_t i, samples = (size_t)width * height * 3;
+  uint8_t * buf_in = (uint8_t*) calloc( sizeof(uint8_t), samples ),
+          * buf_ref = (uint8_t*) calloc( sizeof(uint8_t), samples ),
+          * buf_out = (uint8_t*) calloc( sizeof(uint8_t), samples );
+  oyImage_s * input, * output, * reference;
+  oyConversion_s * cc, * cc_ref;
+  double clck;
 
-  /* conversion->out_ has to be linear, so we access only the first plug */
-  if(conv)
-    plug = oyFilterNode_GetPlug( out, 0 );
-  oyFilterNode_Release (&out );
+  fprintf(stdout, "\n" );
 
-  /* create a very simple pixel iterator as job ticket */
-  if(plug)
-    pixel_access = oyPixelAccess_Create( 0,0, plug,
-                                           oyPIXEL_ACCESS_IMAGE, testobj );
-  error  = oyConversion_RunPixels( conv, pixel_access );
+#if defined(_OPENMP)
+  max_threads = omp_get_num_procs();
+  if(max_threads < 4)
+    max_threads = 4;
+#endif
 
-  clck = oyClock();
-  if(pixel_access)
-  for(i = 0; i < n*1000; ++i)
-  {
-    if(!error)
-      error  = oyConversion_RunPixels( conv, pixel_access );
-  }
-  clck = oyClock() - clck;
+  for(i = 0; i < samples; ++i)
+    buf_in[i] = (uint8_t)(i * 7 + i / 3);
 
+  input =oyImage_Create( width,height, buf_in,
+                         oyChannels_m(3) | oyDataType_m(oyUINT8),
+                         p_web, testobj );
+  reference=oyImage_Create( width,height, buf_ref,
+                         oyChannels_m(3) | oyDataType_m(oyUINT8),
+                         p_lab, testobj );
+  output=oyImage_Create( width,height, buf_out,
+                         oyChannels_m(3) | oyDataType_m(oyUINT8),
+                         p_lab, testobj );
 
+  cc_ref = oyConversion_CreateBasicPixels( input,reference, 0, testobj );
+  cc = oyConversion_CreateBasicPixels( input,output, 0, testobj );
 
-  if( !error )
+  clck = oyClock();
+  error = oyConversion_RunPixels( cc_ref, NULL );
+  clck = oyClock() - clck;
+  if(!error)
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyColorConvert_() with oyPixelAcce.%s",
-                          oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Pixel"));
+    "oyConversion_RunPixels()               %s",
+                          oyProfilingToString(width*height,clck/(double)CLOCKS_PER_SEC, "Pixel"));
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyColorConvert_() with oyPixelAccess_Create()     " );
+    "oyConversion_RunPixels()                            " );
   }
 
-  clck = oyClock();
-  d[0] = d[1] = d[2] = 1.0;
-  d[3] = d[4] = d[5] = 0.0;
-  if(pixel_access)
-  for(i = 0; i < n*1000; ++i)
+  /* the serial result is the reference for each thread count */
+  for(threads = 1; threads <= max_threads; threads *= 2)
   {
-    if(!error)
-      error = oyConversion_GetOnePixel( conv, 0,0, pixel_access );
-  }
-  clck = oyClock() - clck;
-  oyConversion_Release( &conv );
-  oyPixelAccess_Release( &pixel_access );
+    memset( buf_out, 0, sizeof(uint8_t) * samples );
+    clck = oyClock();
+    error = oyConversion_RunPixelsTiled( cc, NULL, 0, threads );
+    clck = oyClock() - clck;
 
-  if( !error  && d[3] != 0.0 )
-  { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyConversion_GetOnePixel( oyPix. )  %s %.02g %.02g %.02g",
-                          oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Pixel"), d[3], d[4], d[5]);
-  } else
-  { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyConversion_GetOnePixel( oyPix. )  %s %.02g %.02g %.02g" ,
-                          oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Pixel"), d[3], d[4], d[5]);
+    if(!error &&
+       memcmp( buf_out, buf_ref, sizeof(uint8_t) * samples ) == 0)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyConversion_RunPixelsTiled(%d)         %s", threads,
+                          oyProfilingToString(width*height,clck/(double)CLOCKS_PER_SEC, "Pixel"));
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyConversion_RunPixelsTiled(%d)                     ", threads );
+    }
   }
 
+  oyConversion_Release( &cc );
+  oyConversion_Release( &cc_ref );
+  oyImage_Release( &input );
+  oyImage_Release( &output );
+  oyImage_Release( &reference );
+  oyProfile_Release( &p_lab );
+  oyProfile_Release( &p_web );
+  free( buf_in ); free( buf_ref ); free( buf_out );
 
-  conv = oyConversion_New( testobj );
-  oyFilterNode_s * in_node = oyFilterNode_NewWith( "//" OY_TYPE_STD "/root", 0, testobj );
-  oyConversion_Set( conv, in_node, 0 );
-  oyFilterNode_SetData( in_node, (oyStruct_s*)input, 0, 0 );
-  oyFilterNode_s * out_node = oyFilterNode_NewWith( "//" OY_TYPE_STD "/output", 0, testobj );
-  /*oyFilterNode_SetData( out_node, (oyStruct_s*)output, 0, 0 );*/
-  error = oyFilterNode_Connect( in_node, "//" OY_TYPE_STD "/data",
-                                out_node, "//" OY_TYPE_STD "/data", 0 );
-  if(error) PRINT_SUB( oyTESTRESULT_XFAIL, "oyFilterNode_Connect() error: %d", error )
-  oyConversion_Set( conv, 0, out_node );
-  oyConversion_GetNode( conv, OY_OUTPUT );
-  plug = oyFilterNode_GetPlug( out, 0 );
-  oyFilterNode_Release (&out );
+  return result;
+}
 
-  /* create a very simple pixel iterator as job ticket */
-  if(plug)
-    pixel_access = oyPixelAccess_Create( 0,0, plug,
-                                         oyPIXEL_ACCESS_IMAGE, testobj );
-  error  = oyConversion_RunPixels( conv, pixel_access );
+oyTESTRESULT_e testImagePixelStreamed()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  oyProfile_s * p_lab = oyProfile_FromStd( oyEDITING_LAB, icc_profile_flags, testobj );
+  oyProfile_s * p_web = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
+  int error = 0, i, band_height, width = 1024, height = 777,
+      samples = width * height * 3;
+  uint16_t * buf_in = (uint16_t*) calloc( sizeof(uint16_t), samples ),
+           * buf_ref = (uint16_t*) calloc( sizeof(uint16_t), samples ),
+           * buf_out = (uint16_t*) calloc( sizeof(uint16_t), samples );
+  oyImage_s * input, * output, * reference;
+  oyConversion_s * cc, * cc_ref;
+  double clck;
 
-  clck = oyClock();
-  for(i = 0; i < n*1000; ++i)
-  {
-    if(!error)
-      error = oyConversion_RunPixels( conv, pixel_access );
-  }
-  clck = oyClock() - clck;
+  fprintf(stdout, "\n" );
 
-  oyImage_Release( &input );
-  oyImage_Release( &output );
+  for(i = 0; i < samples; ++i)
+    buf_in[i] = (uint16_t)(i * 257 + i / 3);
 
-  oyPixelAccess_Release( &pixel_access );
-  oyConversion_Release( &conv );
+  input =oyImage_Create( width,height, buf_in,
+                         oyChannels_m(3) | oyDataType_m(oyUINT16),
+                         p_web, testobj );
+  reference=oyImage_Create( width,height, buf_ref,
+                         oyChannels_m(3) | oyDataType_m(oyUINT16),
+                         p_lab, testobj );
+  output=oyImage_Create( width,height, buf_out,
+                         oyChannels_m(3) | oyDataType_m(oyUINT16),
+                         p_lab, testobj );
 
+  cc_ref = oyConversion_CreateBasicPixels( input,reference, 0, testobj );
+  cc = oyConversion_CreateBasicPixels( input,output, 0, testobj );
 
-  if( !error )
+  clck = oyClock();
+  error = oyConversion_RunPixels( cc_ref, NULL );
+  clck = oyClock() - clck;
+  if(!error)
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyConversion_RunPixels (2 nodes)    %s",
-                          oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Pixel"));
+    "oyConversion_RunPixels()               %s",
+                          oyProfilingToString(width*height,clck/(double)CLOCKS_PER_SEC, "Pixel"));
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyConversion_RunPixels (2 nodes)                   " );
+    "oyConversion_RunPixels()                            " );
   }
 
+  /* odd image height leaves a short last band */
+  for(band_height = 1; band_height <= 1024; band_height *= 8)
+  {
+    memset( buf_out, 0, sizeof(uint16_t) * samples );
+    clck = oyClock();
+    error = oyConversion_RunPixelsStreamed( cc, NULL, band_height );
+    clck = oyClock() - clck;
 
-  conv = oyConversion_CreateBasicPixelsFromBuffers(
-                                        p_in, buf_in, oyDataType_m(buf_type_in),
-                                        p_out, buf_out, oyDataType_m(buf_type_out),
-                                        0, 1 );
-  oyConversion_Release( &conv );
+    if(!error &&
+       memcmp( buf_out, buf_ref, sizeof(uint16_t) * samples ) == 0)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyConversion_RunPixelsStreamed(%d)    %s", band_height,
+                          oyProfilingToString(width*height,clck/(double)CLOCKS_PER_SEC, "Pixel"));
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyConversion_RunPixelsStreamed(%d)                 ", band_height );
+    }
+  }
 
+  oyConversion_Release( &cc );
+  oyConversion_Release( &cc_ref );
+  oyImage_Release( &input );
+  oyImage_Release( &output );
+  oyImage_Release( &reference );
+  oyProfile_Release( &p_lab );
+  oyProfile_Release( &p_web );
+  free( buf_in ); free( buf_ref ); free( buf_out );
 
+  return result;
+}
 
-  oyProfile_s * p_cmyk = oyProfile_FromStd( oyEDITING_CMYK, icc_profile_flags, testobj );
-  oyNamedColor_s * ncl = 0;
-  oyNamedColors_s * colors = oyNamedColors_New(testobj);
+oyTESTRESULT_e testImagePPMRead()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  const char * fn = "test2-ppm-read.ppm";
+  int error = 0, i, x, y, width = 37, height = 11, maxval, wrong;
+  int maxvals[3] = { 255, 1000, 65535 };
+  oyImage_s * image = NULL;
+  FILE * fp;
 
-  oyNamedColors_SetPrefix( colors, "test" );
-  oyNamedColors_SetSuffix( colors, "color" );
+  fprintf(stdout, "\n" );
 
-  if(p_cmyk)
+  /* 8-bit and 16-bit big endian are read in place; 1000 is scaled */
+  for(i = 0; i < 3; ++i)
   {
+    double clck;
+    oyImage_GetLine_f getLine;
+
+    maxval = maxvals[i];
+
+    fp = fopen( fn, "wb" );
+    if(!fp) break;
+    fprintf( fp, "P6\n# test2\n%d %d\n%d\n", width, height, maxval );
+    for(y = 0; y < height; ++y)
+      for(x = 0; x < width * 3; ++x)
+      {
+        int v = (x * 7 + y * 13) % (maxval + 1);
+        if(maxval > 255)
+          fputc( v >> 8, fp );
+        fputc( v & 255, fp );
+      }
+    fclose( fp );
+
     clck = oyClock();
-    for( i = 0; i < 10*100; ++i )
+    error = oyImage_FromFile( fn, 0, &image, testobj );
+    clck = oyClock() - clck;
+    getLine = oyImage_GetLineF( image );
+
+    wrong = !image || !getLine;
+    for(y = 0; !wrong && y < height; ++y)
     {
-      char name[12];
-      double lab[3], device[4] = {0.2,0.2,0.1,0.5};
+      int h = 0, is_allocated = 0;
+      uint8_t * line = (uint8_t*) getLine( image, y, &h, -1, &is_allocated );
+      for(x = 0; line && x < width * 3; ++x)
+      {
+        int v = (x * 7 + y * 13) % (maxval + 1);
+        if(maxval > 255)
+          wrong += ((uint16_t*)line)[x] != (uint16_t)(v * 65535 / maxval);
+        else
+          wrong += line[x] != v;
+      }
+      if(!line) ++wrong;
+    }
 
-      lab[0] = i*0.001;
-      lab[1] = lab[2] = 0.5;
-      sprintf( name, "%d", i );
+    if(!error && !wrong)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyImage_FromFile( maxval %d )     %s", maxval,
+                          oyProfilingToString(1,clck/(double)CLOCKS_PER_SEC, "Image"));
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyImage_FromFile( maxval %d ) wrong: %d", maxval, wrong );
+    }
+    oyImage_Release( &image );
+  }
 
-      ncl = oyNamedColor_CreateWithName( name, name, name, NULL, NULL, NULL, 0, p_cmyk, testobj );
+  remove( fn );
 
+  return result;
+}
+
+/* root -> file_write.meta, as in oyImage_ToFile() */
+static oyConversion_s * testFileWriteGraph( oyImage_s * image, const char * fn )
+{
+  oyConversion_s * cc = oyConversion_New( testobj );
+  oyFilterNode_s * in = oyFilterNode_NewWith( "//" OY_TYPE_STD "/root", NULL, testobj ),
+                 * out = oyFilterNode_NewWith( "//" OY_TYPE_STD "/file_write.meta", NULL, testobj );
+  oyOptions_s * opts = oyFilterNode_GetOptions( in, OY_SELECT_FILTER );
+
+  oyOptions_SetFromString( &opts, "//" OY_TYPE_STD "/file_write/filename",
+                           fn, OY_CREATE_NEW );
+  oyOptions_Release( &opts );
+  oyFilterNode_SetData( in, (oyStruct_s*)image, 0, 0 );
+  oyConversion_Set( cc, in, 0 );
+  oyFilterNode_Connect( in, "//" OY_TYPE_STD "/data",
+                        out, "//" OY_TYPE_STD "/data", 0 );
+  oyConversion_Set( cc, 0, out );
+  opts = oyImage_GetTags( image );
+  oyOptions_SetFromString( &opts, "//" OY_TYPE_STD "/file_write/filename",
+                           fn, OY_CREATE_NEW );
+  oyOptions_Release( &opts );
+
+  return cc;
+}
+
+oyTESTRESULT_e testImageFileWrite()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  const char * fns[2] = { "test2-file-write.ppm", "test2-file-write.png" };
+  int error = 0, i, k, y, width = 37, height = 11, wrong;
+  size_t samples = width * height * 3;
+  uint8_t * buf = (uint8_t*) malloc( samples );
+  oyProfile_s * p_web = oyProfile_FromStd( oyASSUMED_WEB, 0, testobj );
+  oyImage_s * image, * written = NULL;
+
+  fprintf(stdout, "\n" );
+
+  for(i = 0; i < (int)samples; ++i)
+    buf[i] = (uint8_t)(i * 7 + i / 3);
+  image = oyImage_Create( width,height, buf,
+                          oyChannels_m(3) | oyDataType_m(oyUINT8),
+                          p_web, testobj );
+
+  /* k == 0: streamed bands are appended;
+   * k == 1: a partial ticket without the streamed marker writes the image */
+  for(i = 0; i < 2; ++i)
+  for(k = 0; k < 2; ++k)
+  {
+    oyConversion_s * cc = testFileWriteGraph( image, fns[i] );
+
+    remove( fns[i] );
+    if(k == 0)
+      error = oyConversion_RunPixelsStreamed( cc, NULL, 4 );
+    else
+    {
+      oyFilterNode_s * out = oyConversion_GetNode( cc, OY_OUTPUT );
+      oyFilterPlug_s * plug = oyFilterNode_GetPlug( out, 0 );
+      oyPixelAccess_s * ticket = oyPixelAccess_Create( 0,0, plug,
+                                               oyPIXEL_ACCESS_IMAGE, testobj );
+      oyRectangle_s * roi = oyRectangle_NewWith( 0,0, 1.0, 4.0/width, testobj );
+
+      error = oyPixelAccess_ChangeRectangle( ticket, 0,0, roi );
       if(!error)
-        error = oyNamedColor_SetColorStd( ncl, oyEDITING_LAB, lab, oyDOUBLE, 0, NULL );
-      if(!error)
-        oyNamedColor_SetChannels( ncl, device, 0 );
+        error = oyConversion_RunPixels( cc, ticket );
+      oyRectangle_Release( &roi );
+      oyPixelAccess_Release( &ticket );
+      oyFilterPlug_Release( &plug );
+      oyFilterNode_Release( &out );
+    }
 
-      oyNamedColors_MoveIn( colors, &ncl, i );
+    if(!error)
+      error = oyImage_FromFile( fns[i], 0, &written, testobj );
+    wrong = !written ||
+            oyImage_GetWidth( written ) != width ||
+            oyImage_GetHeight( written ) != height;
+    for(y = 0; !wrong && y < height; ++y)
+    {
+      int h = 0, is_allocated = 0;
+      oyImage_GetLine_f getLine = oyImage_GetLineF( written );
+      uint8_t * line = getLine ? (uint8_t*) getLine( written, y, &h, -1,
+                                                     &is_allocated ) : NULL;
+      wrong += !line || memcmp( line, &buf[y * width * 3], width * 3 ) != 0;
     }
-    clck = oyClock() - clck;
 
-    if( !error )
+    if(!error && !wrong)
     { PRINT_SUB( oyTESTRESULT_SUCCESS,
-      "oyNamedColor_CreateWithName()     %s",
-                          oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Ncl"));
+      "file_write %s %s", strrchr(fns[i],'.'), k ? "partial ticket" : "streamed" );
     } else
-    { PRINT_SUB( oyTESTRESULT_FAIL,
-      "oyNamedColor_CreateWithName()            " );
+    { PRINT_SUB( i ? oyTESTRESULT_XFAIL : oyTESTRESULT_FAIL,
+      "file_write %s %s error: %d wrong: %d", strrchr(fns[i],'.'),
+      k ? "partial ticket" : "streamed", error, wrong );
     }
+
+    oyImage_Release( &written );
+    oyConversion_Release( &cc );
+    remove( fns[i] );
   }
 
-  
+  oyImage_Release( &image );
+  oyProfile_Release( &p_web );
+  free( buf );
+
   return result;
 }
 
-#include "oyRectangle_s_.h"
-
-oyTESTRESULT_e testImagePixel()
+#include "oyArray2d_s_.h"           /* OY_ARRAY2D_ROW_ALIGN */
+oyTESTRESULT_e testArray2dSlab()
 {
   oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
-  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
-                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
-  oyProfile_s * p_lab = oyProfile_FromStd( oyEDITING_LAB, icc_profile_flags, testobj );
-  oyProfile_s * p_web = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
-  oyProfile_s /** p_cmyk = oyProfile_FromStd( oyEDITING_CMYK, NULL ),*/
-              * p_in, * p_out;
-  int error = 0,
-      i,n = 1;
-  uint16_t buf_16in2x2[12] = {
-  20000,20000,20000, 10000,10000,10000,
-  0,0,0,             65535,65535,65535
-  };
-  uint16_t buf_16out2x2[12];
-  oyDATATYPE_e buf_type_in = oyUINT16,
-               buf_type_out = oyUINT16;
-  oyImage_s *input, *output;
+  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  oyProfile_s * p_web = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
+  int error = 0, i, y, n = 20, width = 512, height = 10000, misaligned = 0,
+      wrong = 0;
+  uint16_t * buf = (uint16_t*) calloc( sizeof(uint16_t), width * height * 3 );
+  oyImage_s * image;
+  oyRectangle_s * roi = oyRectangle_NewWith( 0,0, 1.0, height/(double)width,
+                                             testobj );
+  oyArray2d_s * a = NULL;
+  uint16_t ** rows;
+  oyPointer row0;
+  double clck;
 
   fprintf(stdout, "\n" );
 
-  double clck = oyClock();
-  p_in = p_web;
-  p_out = p_lab;
-  input =oyImage_Create( 2,2, 
-                         buf_16in2x2,
-                         oyChannels_m(oyProfile_GetChannelsCount(p_in)) |
-                          oyDataType_m(buf_type_in),
-                         p_in,
-                         testobj );
-  output=oyImage_Create( 2,2, 
-                         buf_16out2x2,
-                         oyChannels_m(oyProfile_GetChannelsCount(p_out)) |
-                          oyDataType_m(buf_type_out),
-                         p_out,
-                         testobj );
-
-  oyFilterPlug_s * plug = 0;
-  oyPixelAccess_s * pixel_access = 0;
-  oyConversion_s * cc;
-  memset( buf_16out2x2, 0, sizeof(uint16_t)*12 );
-  cc = oyConversion_CreateBasicPixels( input,output, 0, testobj );
-  oyFilterNode_s * out = oyConversion_GetNode( cc, OY_OUTPUT );
-  if(cc && out)
-    plug = oyFilterNode_GetPlug( oyConversion_GetNode( cc, OY_OUTPUT), 0 );
-  else
-    error = 1;
-  pixel_access = oyPixelAccess_Create( 0,0, plug,
-                                           oyPIXEL_ACCESS_IMAGE, testobj );
-  oyFilterPlug_Release( &plug );
+  for(y = 0; y < height; ++y)
+    buf[(y * width + width - 1) * 3] = (uint16_t)y;
+  image = oyImage_Create( width,height, buf,
+                          oyChannels_m(3) | oyDataType_m(oyUINT16),
+                          p_web, testobj );
 
-  error  = oyConversion_RunPixels( cc, pixel_access );
+  /* a new array per fill, as for each new ticket */
   clck = oyClock();
-  for(i = 0; i < n*1000; ++i)
-  if(error <= 0)
+  for(i = 0; i < n; ++i)
   {
-    error  = oyConversion_RunPixels( cc, pixel_access );
+    error = oyImage_FillArray( image, roi, 1, &a, NULL, testobj );
+    rows = (uint16_t**) oyArray2d_GetData( a );
+    for(y = 0; rows && y < height; ++y)
+    {
+      misaligned += ((uintptr_t)rows[y] % OY_ARRAY2D_ROW_ALIGN) != 0;
+      wrong += rows[y][(width - 1) * 3] != (uint16_t)y;
+    }
+    if(i < n - 1)
+      oyArray2d_Release( &a );
   }
   clck = oyClock() - clck;
 
-  if( !error &&
-      /* check unchanged input buffer */
-      buf_16in2x2[0]==20000 && buf_16in2x2[1]==20000 && buf_16in2x2[2]==20000 &&
-      buf_16in2x2[3]==10000 && buf_16in2x2[4]==10000 && buf_16in2x2[5]==10000 &&
-      buf_16in2x2[6]==0 && buf_16in2x2[7]==0 && buf_16in2x2[8]==0 &&
-      buf_16in2x2[9]==65535 && buf_16in2x2[10]==65535 &&buf_16in2x2[11]==65535&&
-      /* check black and white in lower row with typical *ab of 32896 */
-      buf_16out2x2[6]<5000 && buf_16out2x2[7]>20000 && buf_16out2x2[7]<40000 &&
-      buf_16out2x2[9]>65000 && buf_16out2x2[10]>20000 && buf_16out2x2[10]<40000
-      )
+  if(!error && a && !misaligned && !wrong)
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "Plain Image                              %s",
-                          oyProfilingToString(4*i,clck/(double)CLOCKS_PER_SEC, "Pixel"));
+    "oyImage_FillArray( new array )  %s",
+                          oyProfilingToString(n,clck/(double)CLOCKS_PER_SEC, "Fills"));
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "Plain Image                                        " );
+    "oyImage_FillArray( new array ) misaligned: %d wrong: %d", misaligned, wrong );
   }
 
-  fprintf(zout, "input:  %d,%d,%d %d,%d,%d\n        %d,%d,%d %d,%d,%d\n",
-                  buf_16in2x2[0], buf_16in2x2[1], buf_16in2x2[2],
-                  buf_16in2x2[3], buf_16in2x2[4], buf_16in2x2[5],
-                  buf_16in2x2[6], buf_16in2x2[7], buf_16in2x2[8],
-                  buf_16in2x2[9], buf_16in2x2[10], buf_16in2x2[11] );
-  fprintf(zout, "output: %d,%d,%d %d,%d,%d\n        %d,%d,%d %d,%d,%d\n",
-                  buf_16out2x2[0], buf_16out2x2[1], buf_16out2x2[2],
-                  buf_16out2x2[3], buf_16out2x2[4], buf_16out2x2[5],
-                  buf_16out2x2[6], buf_16out2x2[7], buf_16out2x2[8],
-                  buf_16out2x2[9], buf_16out2x2[10], buf_16out2x2[11] );
-
-
-
-  buf_16in2x2[0]=buf_16in2x2[1]=buf_16in2x2[2]=20000;
-  buf_16in2x2[3]=buf_16in2x2[4]=buf_16in2x2[5]=10000;
-  buf_16in2x2[6]=buf_16in2x2[7]=buf_16in2x2[8]=0;
-  buf_16in2x2[9]=buf_16in2x2[10]=buf_16in2x2[11]=65535;
-  memset( buf_16out2x2, 0, sizeof(uint16_t)*12 );
-  /* use the lower left source pixel */
-  if(pixel_access)
-  {
-    oyRectangle_s * r = oyPixelAccess_GetArrayROI( pixel_access );
-    (*oyRectangle_SetGeo1(r,2)) *= 0.5;
-    (*oyRectangle_SetGeo1(r,3)) *= 0.5;
-    oyPixelAccess_ChangeRectangle( pixel_access, 0.5,0.5, r );
-  }
+  /* the row block survives a reset */
+  row0 = ((oyPointer*) oyArray2d_GetData( a ))[0];
   clck = oyClock();
-  for(i = 0; i < n*1000; ++i)
-  if(error <= 0)
+  for(i = 0; i < n; ++i)
   {
-    error  = oyConversion_RunPixels( cc, pixel_access );
+    oyArray2d_Reset( a, width * 3, height, oyUINT16 );
+    error = oyImage_FillArray( image, roi, 1, &a, NULL, testobj );
   }
   clck = oyClock() - clck;
+  rows = (uint16_t**) oyArray2d_GetData( a );
 
-  if( !error &&
-      /* input should not change */
-      buf_16in2x2[0]==20000 && buf_16in2x2[1]==20000 && buf_16in2x2[2]==20000 &&
-      buf_16in2x2[3]==10000 && buf_16in2x2[4]==10000 && buf_16in2x2[5]==10000 &&
-      buf_16in2x2[6]==0 && buf_16in2x2[7]==0 && buf_16in2x2[8]==0 &&
-      buf_16in2x2[9]==65535 && buf_16in2x2[10]==65535 &&buf_16in2x2[11]==65535&&
-      /* the result shall appear in the upper left corner / first pixel */
-      buf_16out2x2[0]>65000 && buf_16out2x2[1]>20000 && buf_16out2x2[2]<40000&&
-      /* all other buffer pixels shall remain untouched */
-      buf_16out2x2[3]==0 && buf_16out2x2[4]==0 && buf_16out2x2[5]==0 &&
-      buf_16out2x2[6]==0 && buf_16out2x2[7]==0 && buf_16out2x2[8]==0 &&
-      buf_16out2x2[9]==0 && buf_16out2x2[10]==0 && buf_16out2x2[11]==0
-      )
+  if(!error && rows && rows[0] == row0 &&
+     rows[height - 1][(width - 1) * 3] == (uint16_t)(height - 1))
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "lower right source pixel in 1 pixel RoI  %s",
-                          oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Pixel"));
+    "oyArray2d_Reset() keeps rows    %s",
+                          oyProfilingToString(n,clck/(double)CLOCKS_PER_SEC, "Fills"));
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "lower right source pixel in 1 pixel RoI            " );
+    "oyArray2d_Reset() keeps rows                        " );
   }
 
-  fprintf(zout, "input:  %d,%d,%d %d,%d,%d\n        %d,%d,%d %d,%d,%d\n",
-                  buf_16in2x2[0], buf_16in2x2[1], buf_16in2x2[2],
-                  buf_16in2x2[3], buf_16in2x2[4], buf_16in2x2[5],
-                  buf_16in2x2[6], buf_16in2x2[7], buf_16in2x2[8],
-                  buf_16in2x2[9], buf_16in2x2[10], buf_16in2x2[11] );
-  fprintf(zout, "output: %d,%d,%d %d,%d,%d\n        %d,%d,%d %d,%d,%d\n",
-                  buf_16out2x2[0], buf_16out2x2[1], buf_16out2x2[2],
-                  buf_16out2x2[3], buf_16out2x2[4], buf_16out2x2[5],
-                  buf_16out2x2[6], buf_16out2x2[7], buf_16out2x2[8],
-                  buf_16out2x2[9], buf_16out2x2[10], buf_16out2x2[11] );
-
+  /* a too small array is reset and shall then reference the image lines */
+  oyArray2d_Reset( a, width * 3, height / 2, oyUINT16 );
+  error = oyImage_FillArray( image, roi, 0, &a, NULL, testobj );
+  rows = (uint16_t**) oyArray2d_GetData( a );
 
-  buf_16in2x2[0]=buf_16in2x2[1]=buf_16in2x2[2]=20000;
-  buf_16in2x2[3]=buf_16in2x2[4]=buf_16in2x2[5]=10000;
-  buf_16in2x2[6]=buf_16in2x2[7]=buf_16in2x2[8]=0;
-  buf_16in2x2[9]=buf_16in2x2[10]=buf_16in2x2[11]=65535;
-  memset( buf_16out2x2, 0, sizeof(buf_16out2x2) );
-  if(pixel_access)
-  {
-    oyRectangle_s * r = oyPixelAccess_GetArrayROI( pixel_access );
-    oyRectangle_SetGeo(r, 0.5,0.5, 0.5,0.5);
-    oyPixelAccess_ChangeRectangle( pixel_access, 0.5,0.5, r );
+  if(!error && rows && rows[0] == buf &&
+     rows[height - 1] == &buf[(size_t)(height - 1) * width * 3])
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyImage_FillArray( 0 ) after reset                  " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyImage_FillArray( 0 ) after reset                  " );
   }
+
+  oyArray2d_Release( &a );
+  oyRectangle_Release( &roi );
+  oyImage_Release( &image );
+  oyProfile_Release( &p_web );
+  free( buf );
+
+  return result;
+}
+
+oyTESTRESULT_e testPixelAccessPool()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  oyProfile_s * p_web = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
+  int error = 0, i, x, y, c, n = 20, width = 640, height = 480, wrong = 0;
+  size_t size = width * height * 3;
+  uint8_t * buf_in = (uint8_t*) malloc( size ),
+          * buf_out = (uint8_t*) calloc( 1, size );
+  oyImage_s * input, * output;
+  oyFilterNode_s * in, * scale, * out;
+  oyOptions_s * opts;
+  oyConversion_s * cc;
+  oyPixelAccess_s * ticket;
+  oyFilterPlug_s * plug;
+  oyArray2d_s * a, * b, * keep;
+  double clck;
+
+  fprintf(stdout, "\n" );
+
+  for(i = 0; i < (int)size; ++i)
+    buf_in[i] = (uint8_t)(i * 7 + i / 3);
+  input = oyImage_Create( width,height, buf_in,
+                          oyChannels_m(3) | oyDataType_m(oyUINT8),
+                          p_web, testobj );
+  output = oyImage_Create( width,height, buf_out,
+                          oyChannels_m(3) | oyDataType_m(oyUINT8),
+                          p_web, testobj );
+
+  /* root -> scale -> output, like a zooming preview */
+  cc = oyConversion_New( testobj );
+  in = oyFilterNode_NewWith( "//" OY_TYPE_STD "/root", NULL, testobj );
+  oyFilterNode_SetData( in, (oyStruct_s*)input, 0, 0 );
+  oyConversion_Set( cc, in, 0 );
+  scale = oyFilterNode_NewWith( "//" OY_TYPE_STD "/scale", NULL, testobj );
+  opts = oyFilterNode_GetOptions( scale, OY_SELECT_FILTER );
+  oyOptions_SetFromDouble( &opts, OY_INTERNAL "/scale/scale", 2.0, 0,
+                           OY_CREATE_NEW );
+  oyOptions_Release( &opts );
+  error = oyFilterNode_Connect( in, "//" OY_TYPE_STD "/data",
+                                scale, "//" OY_TYPE_STD "/data", 0 );
+  oyFilterNode_SetData( scale, (oyStruct_s*)output, 0, 0 );
+  out = oyFilterNode_NewWith( "//" OY_TYPE_STD "/output", NULL, testobj );
+  error = oyFilterNode_Connect( scale, "//" OY_TYPE_STD "/data",
+                                out, "//" OY_TYPE_STD "/data", 0 );
+  oyConversion_Set( cc, 0, out );
+
   clck = oyClock();
-  for(i = 0; i < n*1000; ++i)
-  if(error <= 0)
+  for(i = 0; i < n; ++i)
   {
-    error  = oyConversion_RunPixels( cc, pixel_access );
+    memset( buf_out, 0, size );
+    error = oyConversion_RunPixels( cc, NULL );
+    for(y = 0; y < height; ++y)
+      for(x = 0; x < width; ++x)
+        for(c = 0; c < 3; ++c)
+          wrong += buf_out[(y * width + x) * 3 + c] !=
+                   buf_in[((y/2) * width + x/2) * 3 + c];
   }
   clck = oyClock() - clck;
 
-  if( !error &&
-      /* input should not change */
-      buf_16in2x2[0]==20000 && buf_16in2x2[1]==20000 && buf_16in2x2[2]==20000 &&
-      buf_16in2x2[3]==10000 && buf_16in2x2[4]==10000 && buf_16in2x2[5]==10000 &&
-      buf_16in2x2[6]==0 && buf_16in2x2[7]==0 && buf_16in2x2[8]==0 &&
-      buf_16in2x2[9]==65535 && buf_16in2x2[10]==65535 &&buf_16in2x2[11]==65535&&
-      /* the result shall appear in the lower right corner / last pixel */
-      buf_16out2x2[9]>65000 && buf_16out2x2[10]>20000&&buf_16out2x2[11]<40000&&
-      /* all other buffer pixels shall remain untouched */
-      buf_16out2x2[0]==0 && buf_16out2x2[1]==0 && buf_16out2x2[2]==0 &&
-      buf_16out2x2[3]==0 && buf_16out2x2[4]==0 && buf_16out2x2[5]==0 &&
-      buf_16out2x2[6]==0 && buf_16out2x2[7]==0 && buf_16out2x2[8]==0
-      )
+  if(!error && !wrong)
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "lower right source in lower right output %s",
-                          oyProfilingToString(i,clck/(double)CLOCKS_PER_SEC, "Pixel"));
+    "oyConversion_RunPixels( kept ticket ) %s",
+                          oyProfilingToString(n,clck/(double)CLOCKS_PER_SEC, "Frames"));
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "lower right source in lower right output           " );
+    "oyConversion_RunPixels( kept ticket ) wrong: %d", wrong );
   }
 
-  fprintf(zout, "input:  %d,%d,%d %d,%d,%d\n        %d,%d,%d %d,%d,%d\n",
-                  buf_16in2x2[0], buf_16in2x2[1], buf_16in2x2[2],
-                  buf_16in2x2[3], buf_16in2x2[4], buf_16in2x2[5],
-                  buf_16in2x2[6], buf_16in2x2[7], buf_16in2x2[8],
-                  buf_16in2x2[9], buf_16in2x2[10], buf_16in2x2[11] );
-  fprintf(zout, "output: %d,%d,%d %d,%d,%d\n        %d,%d,%d %d,%d,%d\n",
-                  buf_16out2x2[0], buf_16out2x2[1], buf_16out2x2[2],
-                  buf_16out2x2[3], buf_16out2x2[4], buf_16out2x2[5],
-                  buf_16out2x2[6], buf_16out2x2[7], buf_16out2x2[8],
-                  buf_16out2x2[9], buf_16out2x2[10], buf_16out2x2[11] );
+  /* a returned array comes back for the same geometry only */
+  plug = oyFilterNode_GetPlug( out, 0 );
+  ticket = oyPixelAccess_Create( 0,0, plug, oyPIXEL_ACCESS_IMAGE, testobj );
+  a = oyPixelAccess_TakeArray( ticket, 300, 20, oyUINT16 );
+  keep = a;
+  oyPixelAccess_GiveArray( ticket, &a );
+  b = oyPixelAccess_TakeArray( ticket, 300, 21, oyUINT16 );
+  a = oyPixelAccess_TakeArray( ticket, 300, 20, oyUINT16 );
+  if(a == keep && b != keep && oyArray2d_GetType( a ) == oyUINT16 &&
+     oyArray2d_GetWidth( a ) == 300 && oyArray2d_GetHeight( a ) == 20)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyPixelAccess_TakeArray() recycled                  " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyPixelAccess_TakeArray() recycled                  " );
+  }
 
+  /* a still referenced array is not recycled */
+  keep = oyArray2d_Copy( a, NULL );
+  oyPixelAccess_GiveArray( ticket, &a );
+  a = oyPixelAccess_TakeArray( ticket, 300, 20, oyUINT16 );
+  if(a && a != keep)
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyPixelAccess_GiveArray( referenced )               " );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyPixelAccess_GiveArray( referenced )               " );
+  }
 
-  oyConversion_Release ( &cc );
-  oyPixelAccess_Release( &pixel_access );
-  oyProfile_Release( &p_lab );
+  oyArray2d_Release( &keep );
+  oyArray2d_Release( &a );
+  oyArray2d_Release( &b );
+  oyPixelAccess_Release( &ticket );
+  oyFilterPlug_Release( &plug );
+  oyFilterNode_Release( &scale );
+  oyConversion_Release( &cc );
+  oyImage_Release( &input );
+  oyImage_Release( &output );
   oyProfile_Release( &p_web );
+  free( buf_in );
+  free( buf_out );
 
-  oyPixel_t pixel_layout = OY_TYPE_123_16;
-  oyPointer channels = 0;
-  oyRectangle_s_ roi_ = {oyOBJECT_RECTANGLE_S, 0,0,0,0,0,0,0};
-  oyRectangle_s_ a_roi_ = {oyOBJECT_RECTANGLE_S, 0,0,0,0,0,0,0};
-  oyRectangle_s * roi = (oyRectangle_s*)&roi_,
-                * a_roi = (oyRectangle_s*)&a_roi_;
+  return result;
+}
 
-  oyArray2d_s * a = oyArray2d_Create( channels,
-                                      2 * oyToChannels_m(pixel_layout),
-                                      2,
-                                      oyToDataType_m(pixel_layout),
-                                      testobj );
+oyTESTRESULT_e testMatrixShaper()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  oyProfile_s * p_web = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj ),
+              * p_rgb = oyProfile_FromStd( oyEDITING_RGB, icc_profile_flags, testobj );
+  int error = 0, i, k, r, n = 10, width = 1024, height = 256;
+  struct { oyDATATYPE_e type; int channels; const char * name; } layouts[3] = {
+    { oyUINT8, 3, "RGB 8-bit " },
+    { oyUINT8, 4, "RGBA 8-bit" },
+    { oyUINT16, 3, "RGB 16-bit" } };
+  oyOptions_s * fast = NULL, * ref = NULL;
 
-  oyRectangle_SetGeo( roi, 0.5,0.5,0.5,0.5 );
-  oyRectangle_SetGeo( a_roi, 0.5,0.5,0.5,0.5 );
-  buf_16out2x2[9] = buf_16out2x2[10] = buf_16out2x2[11] = 65535;
-  error = oyImage_FillArray( output, roi, 0,
-                             &a,
-                             a_roi, 0 );
+  fprintf(stdout, "\n" );
+
+  oyOptions_SetFromString( &fast, "////context", "lcm2", OY_CREATE_NEW );
+  oyOptions_SetFromString( &ref, "////context", "lcm2", OY_CREATE_NEW );
+  /* keep all precision inside little CMS for the reference */
+  oyOptions_SetFromString( &ref, "////precalculation", "1", OY_CREATE_NEW );
+
+  for(k = 0; k < 3; ++k)
+  {
+    int samples = width * height * layouts[k].channels,
+        bytes = oyDataTypeGetSize( layouts[k].type ),
+        max_diff = 0;
+    oyPixel_t layout = oyChannels_m( layouts[k].channels ) |
+                       oyDataType_m( layouts[k].type );
+    uint8_t * buf_in = (uint8_t*) malloc( samples * bytes ),
+            * buf_fast = (uint8_t*) calloc( samples, bytes ),
+            * buf_ref = (uint8_t*) calloc( samples, bytes );
+    oyImage_s * input, * out_fast, * out_ref;
+    oyConversion_s * cc_fast, * cc_ref;
+    double clck_fast, clck_ref, mpix = width * height * n / 1000000.0;
+    uint32_t seed = 1;
+
+    /* 8-bit covers every code per channel; 16-bit adds many dark values */
+    for(i = 0; i < samples; ++i)
+    {
+      seed = seed * 1103515245 + 12345;
+      if(bytes == 1)
+        buf_in[i] = (uint8_t)(i % 3 ? seed >> 16 : i / 3);
+      else
+        ((uint16_t*)buf_in)[i] = (uint16_t)(i % 5 ? seed >> 16 : seed >> 26);
+    }
+
+    input = oyImage_Create( width,height, buf_in, layout, p_web, testobj );
+    out_fast = oyImage_Create( width,height, buf_fast, layout, p_rgb, testobj );
+    out_ref = oyImage_Create( width,height, buf_ref, layout, p_rgb, testobj );
+    cc_fast = oyConversion_CreateBasicPixels( input, out_fast, fast, testobj );
+    cc_ref = oyConversion_CreateBasicPixels( input, out_ref, ref, testobj );
+    if(!cc_fast || !cc_ref)
+      error = 1;
+
+    /* the first run creates the contexts */
+    if(!error)
+      error = oyConversion_RunPixels( cc_fast, NULL ) ||
+              oyConversion_RunPixels( cc_ref, NULL );
+
+    clck_fast = oyClock();
+    for(r = 0; r < n && !error; ++r)
+      error = oyConversion_RunPixels( cc_fast, NULL );
+    clck_fast = (oyClock() - clck_fast) / (double)CLOCKS_PER_SEC;
+    clck_ref = oyClock();
+    for(r = 0; r < n && !error; ++r)
+      error = oyConversion_RunPixels( cc_ref, NULL );
+    clck_ref = (oyClock() - clck_ref) / (double)CLOCKS_PER_SEC;
+
+    for(i = 0; i < samples; ++i)
+    {
+      int d = bytes == 1 ? abs( buf_fast[i] - buf_ref[i] ) :
+                abs( ((uint16_t*)buf_fast)[i] - ((uint16_t*)buf_ref)[i] );
+      if(d > max_diff)
+        max_diff = d;
+    }
+
+    if(!error && max_diff <= 1)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "%s max diff: %d %.1f MPix/s (lcms %.1f MPix/s)",
+      layouts[k].name, max_diff, mpix / (clck_fast > 0 ? clck_fast : 1e-6),
+                                 mpix / (clck_ref > 0 ? clck_ref : 1e-6) );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "%s max diff: %d error: %d", layouts[k].name, max_diff, error );
+    }
+
+    oyConversion_Release( &cc_fast );
+    oyConversion_Release( &cc_ref );
+    oyImage_Release( &input );
+    oyImage_Release( &out_fast );
+    oyImage_Release( &out_ref );
+    free( buf_in );
+    free( buf_fast );
+    free( buf_ref );
+  }
+
+  oyOptions_Release( &fast );
+  oyOptions_Release( &ref );
+  oyProfile_Release( &p_web );
+  oyProfile_Release( &p_rgb );
+
+  return result;
+}
+
+static float testHalfToFloat( uint16_t h )
+{
+  int e = (h >> 10) & 0x1f, m = h & 0x3ff;
+  float f = e == 0  ? ldexpf( (float)m, -24 ) :
+            e == 31 ? (m ? NAN : INFINITY) :
+                      ldexpf( (float)(m | 0x400), e - 25 );
+  return h & 0x8000 ? -f : f;
+}
+/* finite values without overflow, which is what the test feeds */
+static uint16_t testFloatToHalf( float f )
+{
+  int e;
+  float m = frexpf( f, &e );
+  if(f < 0.0f) return 0x8000 | testFloatToHalf( -f );
+  if(f == 0.0f) return 0;
+  if(e < -13) return (uint16_t) lrintf( ldexpf( f, 24 ) );
+  return (uint16_t)(((e + 14) << 10) + lrintf( ldexpf( m, 11 ) ) - 1024);
+}
+
+oyTESTRESULT_e testImageHalf()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  oyProfile_s * p_web = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj ),
+              * p_rgb = oyProfile_FromStd( oyEDITING_RGB, icc_profile_flags, testobj );
+  int error = 0, i, width = 256, height = 64, samples = width * height * 4,
+      ulp_diff = 0, alpha_diff = 0;
+  double rt_diff = 0.0;
+  uint16_t * h_in = (uint16_t*) malloc( samples * sizeof(uint16_t) ),
+           * h_out = (uint16_t*) calloc( samples, sizeof(uint16_t) ),
+           * h_back = (uint16_t*) calloc( samples, sizeof(uint16_t) );
+  float * f_in = (float*) malloc( samples * sizeof(float) ),
+        * f_out = (float*) calloc( samples, sizeof(float) );
+  oyPixel_t half3 = oyChannels_m(3) | oyDataType_m(oyHALF),
+            half4 = oyChannels_m(4) | oyDataType_m(oyHALF),
+            float3 = oyChannels_m(3) | oyDataType_m(oyFLOAT);
+  oyImage_s * input, * output;
+  oyOptions_s * opts = NULL;
+  oyConversion_s * cc;
+  uint32_t seed = 1;
+
+  fprintf(stdout, "\n" );
+
+  oyOptions_SetFromString( &opts, "////context", "lcm2", OY_CREATE_NEW );
+
+  /* half values in [2^-10,1] and the exactly matching floats */
+  for(i = 0; i < samples; ++i)
+  {
+    seed = seed * 1103515245 + 12345;
+    h_in[i] = (uint16_t)(0x1400 + (seed >> 16) % (0x3c00 - 0x1400 + 1));
+    f_in[i] = testHalfToFloat( h_in[i] );
+  }
+
+  /* half against the float path */
+  input = oyImage_Create( width,height, f_in, float3, p_web, testobj );
+  output = oyImage_Create( width,height, f_out, float3, p_rgb, testobj );
+  cc = oyConversion_CreateBasicPixels( input, output, opts, testobj );
+  error = !cc || oyConversion_RunPixels( cc, NULL );
+  oyConversion_Release( &cc );
+  oyImage_Release( &input );
+  oyImage_Release( &output );
 
-  uint16_t ** rows_u16 = (uint16_t**)oyArray2d_GetData(a);
-  uint16_t * output_u16 = rows_u16[0];
+  input = oyImage_Create( width,height, h_in, half3, p_web, testobj );
+  output = oyImage_Create( width,height, h_out, half3, p_rgb, testobj );
+  cc = oyConversion_CreateBasicPixels( input, output, opts, testobj );
+  if(!error)
+    error = !cc || oyConversion_RunPixels( cc, NULL );
+  oyConversion_Release( &cc );
+  oyImage_Release( &input );
+  oyImage_Release( &output );
 
-  if(!error &&
-     rows_u16[0] != buf_16out2x2)
+  for(i = 0; i < width * height * 3; ++i)
+  {
+    int d = abs( h_out[i] - testFloatToHalf( f_out[i] ) );
+    if(d > ulp_diff)
+      ulp_diff = d;
+  }
+  if(!error && ulp_diff <= 1)
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyImage_FillArray() keep allocation                 " );
+    "half RGB == float RGB max diff: %d ulp", ulp_diff );
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyImage_FillArray() keep alloc 0x%lo 0x%lo",
-    (unsigned long)rows_u16[0], (unsigned long)buf_16out2x2 );
+    "half RGB == float RGB max diff: %d ulp error: %d", ulp_diff, error );
   }
 
-  if(!error &&
-     output_u16[9] == 65535 && output_u16[10] == 65535 && output_u16[11] == 65535)
+  /* round trip through the editing space */
+  input = oyImage_Create( width,height, h_out, half3, p_rgb, testobj );
+  output = oyImage_Create( width,height, h_back, half3, p_web, testobj );
+  cc = oyConversion_CreateBasicPixels( input, output, opts, testobj );
+  error = !cc || oyConversion_RunPixels( cc, NULL );
+  oyConversion_Release( &cc );
+  oyImage_Release( &input );
+  oyImage_Release( &output );
+
+  for(i = 0; i < width * height * 3; ++i)
+  {
+    double d = fabs( testHalfToFloat( h_back[i] ) - testHalfToFloat( h_in[i] ) );
+    if(d > rt_diff)
+      rt_diff = d;
+  }
+  if(!error && rt_diff < 0.002)
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyImage_FillArray() place array data                " );
+    "half round trip max diff: %g", rt_diff );
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyImage_FillArray() place array data                " );
+    "half round trip max diff: %g error: %d", rt_diff, error );
   }
 
-  fprintf(zout, "output: %d,%d,%d %d,%d,%d\n        %d,%d,%d %d,%d,%d\n",
-                  buf_16out2x2[0], buf_16out2x2[1], buf_16out2x2[2],
-                  buf_16out2x2[3], buf_16out2x2[4], buf_16out2x2[5],
-                  buf_16out2x2[6], buf_16out2x2[7], buf_16out2x2[8],
-                  buf_16out2x2[9], buf_16out2x2[10], buf_16out2x2[11] );
-
-  /* set lower right pixel */
-  output_u16[0] = output_u16[1] = output_u16[2] = 2;
-
-  oyRectangle_SetGeo( a_roi, 0.0,0.0,0.5,0.5 );
-  error = oyImage_ReadArray( output, roi,
-                             a, a_roi );
-
+  /* alpha in the output must survive the float lines */
+  for(i = 0; i < samples; ++i)
+    h_out[i] = (uint16_t)(i % 4 == 3 ? 0x3800 + i % 1000 : 0);
+  input = oyImage_Create( width,height, h_in, half4, p_web, testobj );
+  output = oyImage_Create( width,height, h_out, half4, p_rgb, testobj );
+  cc = oyConversion_CreateBasicPixels( input, output, opts, testobj );
+  error = !cc || oyConversion_RunPixels( cc, NULL );
+  oyConversion_Release( &cc );
+  oyImage_Release( &input );
+  oyImage_Release( &output );
 
-  rows_u16 = (uint16_t**)oyArray2d_GetData(a);
-  if(!error &&
-     rows_u16[0] != &buf_16out2x2[9] &&
-     buf_16out2x2[9]==2&& buf_16out2x2[10]==2&& buf_16out2x2[11]==2)
+  for(i = 3; i < samples; i += 4)
+    if(h_out[i] != 0x3800 + i % 1000)
+      ++alpha_diff;
+  if(!error && !alpha_diff)
   { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyImage_ReadArray( array_roi )                      " );
+    "half RGBA keeps alpha" );
   } else
   { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyImage_ReadArray( array_roi )                      " );
+    "half RGBA keeps alpha: %d differ error: %d", alpha_diff, error );
   }
 
-  /* set lower right pixel */
-  output_u16[0] = output_u16[1] = output_u16[2] = 3;
-  error = oyImage_ReadArray( output, roi,
-                             a, 0 );
+  oyOptions_Release( &opts );
+  oyProfile_Release( &p_web );
+  oyProfile_Release( &p_rgb );
+  free( h_in ); free( h_out ); free( h_back );
+  free( f_in ); free( f_out );
 
+  return result;
+}
 
-  rows_u16 = (uint16_t**)oyArray2d_GetData(a);
-  if(!error &&
-     rows_u16[0] != &buf_16out2x2[9] &&
-     buf_16out2x2[9]==3&& buf_16out2x2[10]==3&& buf_16out2x2[11]==3)
-  { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyImage_ReadArray()                                 " );
-  } else
-  { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyImage_ReadArray()                                 " );
-  }
+oyTESTRESULT_e testCLUT()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  oyProfile_s * p_web = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj ),
+              * p_out[2] = {
+                oyProfile_FromStd( oyEDITING_RGB, icc_profile_flags, testobj ),
+                oyProfile_FromStd( oyEDITING_CMYK, icc_profile_flags, testobj ) };
+  int error = 0, i, k, o, r, n = 10, width = 1024, height = 256;
+  /* limits from sampling smooth links on a 33^3 grid */
+  struct { oyDATATYPE_e type; int alpha; const char * name; double limit; } layouts[4] = {
+    { oyUINT8, 0, "RGB 8-bit  ", 2 },
+    { oyUINT8, 1, "RGBA 8-bit ", 2 },
+    { oyUINT16, 0, "RGB 16-bit ", 512 },
+    { oyFLOAT, 0, "RGB float  ", 0.008 } };
+  oyOptions_s * clut = NULL, * ref = NULL;
 
-  fprintf(zout, "output: %d,%d,%d %d,%d,%d\n        %d,%d,%d %d,%d,%d\n",
-                  buf_16out2x2[0], buf_16out2x2[1], buf_16out2x2[2],
-                  buf_16out2x2[3], buf_16out2x2[4], buf_16out2x2[5],
-                  buf_16out2x2[6], buf_16out2x2[7], buf_16out2x2[8],
-                  buf_16out2x2[9], buf_16out2x2[10], buf_16out2x2[11] );
+  fprintf(stdout, "\n" );
 
-  /* move the focus to the lower left */
-  oyRectangle_s_ array_roi_pix = {oyOBJECT_RECTANGLE_S,0,0,0, 0,1,3,1};
-  oyArray2d_SetFocus( a, (oyRectangle_s*)&array_roi_pix );
+  oyOptions_SetFromString( &clut, "////context", "lcm2", OY_CREATE_NEW );
+  oyOptions_SetFromString( &clut, "////renderer", "clut", OY_CREATE_NEW );
+  oyOptions_SetFromString( &ref, "////context", "lcm2", OY_CREATE_NEW );
 
+  for(o = 0; o < 2; ++o)
+  for(k = 0; k < 4; ++k)
+  {
+    /* little CMS scales CMYK floats to 0...100 */
+    if(o == 1 && layouts[k].type == oyFLOAT)
+      continue;
 
-  rows_u16 = (uint16_t**)oyArray2d_GetData(a);
-  if(!error &&
-     rows_u16[0] != output_u16)
-  { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyArray2d_SetFocus() change array                   " );
-  } else
-  { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyArray2d_SetFocus() change 0x%lo 0x%lo",
-    (unsigned long)rows_u16[0], (unsigned long)output_u16 );
-  }
+    int channels_out = oyProfile_GetChannelsCount( p_out[o] ) + layouts[k].alpha,
+        channels_in = 3 + layouts[k].alpha,
+        samples = width * height * channels_in,
+        samples_out = width * height * channels_out,
+        bytes = oyDataTypeGetSize( layouts[k].type );
+    double max_diff = 0, alpha_diff = 0;
+    uint8_t * buf_in = (uint8_t*) malloc( samples * bytes ),
+            * buf_clut = (uint8_t*) calloc( samples_out, bytes ),
+            * buf_ref = (uint8_t*) calloc( samples_out, bytes );
+    oyImage_s * input, * out_clut, * out_ref;
+    oyConversion_s * cc_clut, * cc_ref;
+    oyFilterGraph_s * graph;
+    oyFilterNode_s * icc;
+    oyPointer_s * context;
+    const char * context_type = NULL;
+    double clck_clut, clck_ref, mpix = width * height * n / 1000000.0;
+    uint32_t seed = 1;
+
+    for(i = 0; i < samples; ++i)
+    {
+      seed = seed * 1103515245 + 12345;
+      if(layouts[k].type == oyUINT8)
+        buf_in[i] = (uint8_t)(seed >> 24);
+      else if(layouts[k].type == oyUINT16)
+        ((uint16_t*)buf_in)[i] = (uint16_t)(seed >> 16);
+      else
+        ((float*)buf_in)[i] = (seed >> 8) / (float)(1 << 24);
+    }
 
+    input = oyImage_Create( width,height, buf_in,
+                            oyChannels_m( channels_in ) |
+                            oyDataType_m( layouts[k].type ), p_web, testobj );
+    out_clut = oyImage_Create( width,height, buf_clut,
+                               oyChannels_m( channels_out ) |
+                               oyDataType_m( layouts[k].type ), p_out[o], testobj );
+    out_ref = oyImage_Create( width,height, buf_ref,
+                              oyChannels_m( channels_out ) |
+                              oyDataType_m( layouts[k].type ), p_out[o], testobj );
+    cc_clut = oyConversion_CreateBasicPixels( input, out_clut, clut, testobj );
+    cc_ref = oyConversion_CreateBasicPixels( input, out_ref, ref, testobj );
+    if(!cc_clut || !cc_ref)
+      error = 1;
 
-  output_u16 = (uint16_t*)rows_u16[0];
+    /* the first run creates the contexts */
+    if(!error)
+      error = oyConversion_RunPixels( cc_clut, NULL ) ||
+              oyConversion_RunPixels( cc_ref, NULL );
+
+    graph = oyConversion_GetGraph( cc_clut );
+    icc = oyFilterGraph_GetNode( graph, -1, "///icc_color", 0 );
+    context = oyFilterNode_GetContext( icc );
+    if(context)
+      context_type = oyPointer_GetResourceName( context );
+    if(!context_type || strcmp( context_type, "cl3D" ) != 0)
+      error = 2;
+
+    clck_clut = oyClock();
+    for(r = 0; r < n && !error; ++r)
+      error = oyConversion_RunPixels( cc_clut, NULL );
+    clck_clut = (oyClock() - clck_clut) / (double)CLOCKS_PER_SEC;
+    clck_ref = oyClock();
+    for(r = 0; r < n && !error; ++r)
+      error = oyConversion_RunPixels( cc_ref, NULL );
+    clck_ref = (oyClock() - clck_ref) / (double)CLOCKS_PER_SEC;
+
+    for(i = 0; i < samples_out; ++i)
+    {
+      double d = layouts[k].type == oyUINT8 ? abs( buf_clut[i] - buf_ref[i] ) :
+                 layouts[k].type == oyUINT16 ?
+                   abs( ((uint16_t*)buf_clut)[i] - ((uint16_t*)buf_ref)[i] ) :
+                   fabs( ((float*)buf_clut)[i] - ((float*)buf_ref)[i] );
+      if(layouts[k].alpha && i % channels_out == channels_out - 1)
+      {
+        d = abs( buf_clut[i] - buf_in[i / channels_out * channels_in + 3] );
+        if(d > alpha_diff)
+          alpha_diff = d;
+      } else if(d > max_diff)
+        max_diff = d;
+    }
 
-  /* set lower right pixel */
-  output_u16[0] = output_u16[1] = output_u16[2] = 4;
-  error = oyImage_ReadArray( output, roi,
-                             a, 0 );
-  rows_u16 = (uint16_t**)oyArray2d_GetData(a);
-  if(!error &&
-     rows_u16[0] != &buf_16out2x2[9] &&
-     buf_16out2x2[9]==4&& buf_16out2x2[10]==4&& buf_16out2x2[11]==4)
-  { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyArray2d_SetFocus()                                " );
-  } else
-  { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyArray2d_SetFocus()                                " );
-  }
+    if(!error && max_diff <= layouts[k].limit && alpha_diff == 0)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "%s%s max diff: %g %.1f MPix/s (lcms %.1f MPix/s)",
+      layouts[k].name, o ? "CMYK" : "RGB ", max_diff,
+                                 mpix / (clck_clut > 0 ? clck_clut : 1e-6),
+                                 mpix / (clck_ref > 0 ? clck_ref : 1e-6) );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "%s%s max diff: %g alpha: %g context: %s error: %d",
+      layouts[k].name, o ? "CMYK" : "RGB ", max_diff, alpha_diff,
+      oyNoEmptyString_m_(context_type), error );
+    }
 
-  oyArray2d_Release( &a );
+    oyPointer_Release( &context );
+    oyFilterNode_Release( &icc );
+    oyFilterGraph_Release( &graph );
+    oyConversion_Release( &cc_clut );
+    oyConversion_Release( &cc_ref );
+    oyImage_Release( &input );
+    oyImage_Release( &out_clut );
+    oyImage_Release( &out_ref );
+    free( buf_in );
+    free( buf_clut );
+    free( buf_ref );
+    error = 0;
+  }
+
+  oyOptions_Release( &clut );
+  oyOptions_Release( &ref );
+  oyProfile_Release( &p_web );
+  oyProfile_Release( &p_out[0] );
+  oyProfile_Release( &p_out[1] );
 
-  oyRectangle_SetGeo( a_roi, 0.5,0.5,0.5,0.5 );
-  error = oyImage_FillArray( output, roi, 0,
-                             &a, a_roi, 0 );
+  return result;
+}
 
-  rows_u16 = (uint16_t**)oyArray2d_GetData(a);
-  if(!error &&
-     rows_u16[0] == &buf_16out2x2[0])
-  { PRINT_SUB( oyTESTRESULT_SUCCESS,
-    "oyImage_FillArray() assigment                       " );
-  } else
-  { PRINT_SUB( oyTESTRESULT_FAIL,
-    "oyImage_FillArray() assigment 0x%lo 0x%lo",
-    (unsigned long)rows_u16[0], (unsigned long)&buf_16out2x2[9] );
+/* root -> expose -> channel -> expose -> channel -> output */
+static oyConversion_s * testFusedChain ( oyImage_s * input, oyImage_s * output )
+{
+  oyConversion_s * cc = oyConversion_New( testobj );
+  oyFilterNode_s * in = oyFilterNode_NewWith( "//" OY_TYPE_STD "/root", NULL, testobj ),
+                 * node = NULL;
+  oyOptions_s * opts;
+  int i;
+
+  oyFilterNode_SetData( in, (oyStruct_s*)input, 0, 0 );
+  oyConversion_Set( cc, in, 0 );
+  for(i = 0; i < 4; ++i)
+  {
+    if(i % 2 == 0)
+    {
+      node = oyFilterNode_NewWith( "//" OY_TYPE_STD "/expose", NULL, testobj );
+      opts = oyFilterNode_GetOptions( node, OY_SELECT_FILTER );
+      oyOptions_SetFromDouble( &opts, "//" OY_TYPE_STD "/expose/expose",
+                               i ? 0.8 : 1.5, 0, OY_CREATE_NEW );
+    } else
+    {
+      node = oyFilterNode_NewWith( "//" OY_TYPE_STD "/channel", NULL, testobj );
+      opts = oyFilterNode_GetOptions( node, OY_SELECT_FILTER );
+      oyOptions_SetFromString( &opts, "//" OY_TYPE_STD "/channel/channel",
+                               "[\"c\", \"a\", \"b\"]", OY_CREATE_NEW );
+    }
+    oyOptions_Release( &opts );
+    oyFilterNode_Connect( in, "//" OY_TYPE_STD "/data",
+                          node, "//" OY_TYPE_STD "/data", 0 );
+    in = node;
+  }
+  oyFilterNode_SetData( in, (oyStruct_s*)output, 0, 0 );
+  node = oyFilterNode_NewWith( "//" OY_TYPE_STD "/output", NULL, testobj );
+  oyFilterNode_Connect( in, "//" OY_TYPE_STD "/data",
+                        node, "//" OY_TYPE_STD "/data", 0 );
+  oyConversion_Set( cc, 0, node );
+
+  return cc;
+}
+
+oyTESTRESULT_e testFusedPoint()
+{
+  oyTESTRESULT_e result = oyTESTRESULT_UNKNOWN;
+  uint32_t icc_profile_flags =oyICCProfileSelectionFlagsFromOptions( OY_CMM_STD,
+                                       "//" OY_TYPE_STD "/icc_color", NULL, 0 );
+  oyProfile_s * p_web = oyProfile_FromStd( oyASSUMED_WEB, icc_profile_flags, testobj );
+  int error = 0, i, k, r, n = 10, width = 4096, height = 1024, wrong = 0, changed = 0;
+  const char * env = getenv( OY_FUSED_TILE_BYTES );
+  char * env_old = env ? strdup( env ) : NULL;
+  struct { oyDATATYPE_e type; const char * name; } layouts[3] = {
+    { oyUINT8,  "RGB 8-bit " },
+    { oyUINT16, "RGB 16-bit" },
+    { oyFLOAT,  "RGB float " } };
+
+  fprintf(stdout, "\n" );
+
+  for(k = 0; k < 3; ++k)
+  {
+    int samples = width * height * 3,
+        bytes = oyDataTypeGetSize( layouts[k].type );
+    size_t size = (size_t)samples * bytes;
+    uint8_t * buf_in = (uint8_t*) malloc( size ),
+            * buf_fused = (uint8_t*) calloc( 1, size ),
+            * buf_plain = (uint8_t*) calloc( 1, size );
+    oyImage_s * input, * out_fused, * out_plain;
+    oyConversion_s * cc_fused, * cc_plain;
+    double t_fused, t_plain, mb = size * n / 1000000.0;
+    uint32_t seed = 1;
+
+    for(i = 0; i < samples; ++i)
+    {
+      seed = seed * 1103515245 + 12345;
+      if(layouts[k].type == oyUINT8)
+        buf_in[i] = (uint8_t)(seed >> 24);
+      else if(layouts[k].type == oyUINT16)
+        ((uint16_t*)buf_in)[i] = (uint16_t)(seed >> 16);
+      else
+        ((float*)buf_in)[i] = (seed >> 8) / (float)(1 << 24);
+    }
+
+    input = oyImage_Create( width,height, buf_in,
+                            oyChannels_m(3) | oyDataType_m(layouts[k].type),
+                            p_web, testobj );
+    out_fused = oyImage_Create( width,height, buf_fused,
+                            oyChannels_m(3) | oyDataType_m(layouts[k].type),
+                            p_web, testobj );
+    out_plain = oyImage_Create( width,height, buf_plain,
+                            oyChannels_m(3) | oyDataType_m(layouts[k].type),
+                            p_web, testobj );
+    cc_fused = testFusedChain( input, out_fused );
+    cc_plain = testFusedChain( input, out_plain );
+
+    /* each node walks the whole array */
+    setenv( OY_FUSED_TILE_BYTES, "0", 1 );
+    error = oyConversion_RunPixels( cc_plain, NULL );
+    t_plain = oySeconds();
+    for(r = 0; r < n && !error; ++r)
+      error = oyConversion_RunPixels( cc_plain, NULL );
+    t_plain = oySeconds() - t_plain;
+
+    /* all four nodes per cache sized tile */
+    unsetenv( OY_FUSED_TILE_BYTES );
+    if(!error)
+      error = oyConversion_RunPixels( cc_fused, NULL );
+    t_fused = oySeconds();
+    for(r = 0; r < n && !error; ++r)
+      error = oyConversion_RunPixels( cc_fused, NULL );
+    t_fused = oySeconds() - t_fused;
+
+    wrong = memcmp( buf_fused, buf_plain, size ) != 0;
+    changed = memcmp( buf_fused, buf_in, size ) != 0;
+
+    /* without fusion the array passes 4 times through memory, fused once */
+    if(!error && !wrong && changed)
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "%s fused: %.0f MB/s %.0f MB array traffic (plain: %.0f MB/s %.0f MB)",
+      layouts[k].name, mb / (t_fused > 0 ? t_fused : 1e-6), mb,
+                       mb / (t_plain > 0 ? t_plain : 1e-6), 4 * mb );
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "%s fused differs: %d changed: %d error: %d",
+      layouts[k].name, wrong, changed, error );
+    }
+
+    oyConversion_Release( &cc_fused );
+    oyConversion_Release( &cc_plain );
+    oyImage_Release( &input );
+    oyImage_Release( &out_fused );
+    oyImage_Release( &out_plain );
+    free( buf_in );
+    free( buf_fused );
+    free( buf_plain );
+    error = 0;
   }
 
-  oyArray2d_Release( &a );
-  oyImage_Release( &input );
-  oyImage_Release( &output );
+  if(env_old)
+  {
+    setenv( OY_FUSED_TILE_BYTES, env_old, 1 );
+    free( env_old );
+  }
+  oyProfile_Release( &p_web );
 
   return result;
 }
@@ -7204,7 +9659,9 @@ oyTESTRESULT_e testCCorrectFlags( )
   return result;
 }
 
+#include "oyranos_cache.h"
 #include "oyranos_generic_internal.h"
+#include "oyPointer_s.h"
 oyHash_s *   oyTestCacheListGetEntry_ ( const char        * hash_text)
 {
   if(!oy_test_cache_)
@@ -7391,6 +9848,215 @@ oyTESTRESULT_e testCache()
     "oyCacheListGetEntry_(unique short entry) " );
   }
 
+  /* lookup cost shall not depend on the cache size */
+  int sizes[2] = { 1000, 100000 };
+  double per_lookup[2] = { 0.0, 0.0 };
+  int lookups = 100000;
+  for(int k = 0; k < 2; ++k)
+  {
+    oyTestCacheListClear_();
+    count = sizes[k];
+    for(i = 0; i < count; ++i)
+    {
+      char * hash_text = NULL;
+      oyStringAddPrintf_( &hash_text, 0,0, "%s%d", hash_texts[6], i );
+      oyHash_s * hash = oyTestCacheListGetEntry_( hash_text );
+      oyHash_Release( &hash );
+      oyFree_m_(hash_text);
+    }
+
+    fprintf(zout, "%d:\n", count );
+    clck = oyClock();
+    for(i = 0; i < lookups; ++i)
+    {
+      char * hash_text = NULL;
+      oyStringAddPrintf_( &hash_text, 0,0, "%s%d", hash_texts[6],
+                          (int)((i * 7919L) % count) );
+      oyHash_s * hash = oyTestCacheListGetEntry_( hash_text );
+      oyHash_Release( &hash );
+      oyFree_m_(hash_text);
+    }
+    clck = oyClock() - clck;
+    per_lookup[k] = clck / (double)lookups;
+
+    if( oyStructList_Count( oy_test_cache_ ) == count )
+    { PRINT_SUB( oyTESTRESULT_SUCCESS,
+      "oyCacheListGetEntry_(%d entries hit) %s", count,
+                          oyProfilingToString(lookups,clck/(double)CLOCKS_PER_SEC, "lookups"));
+    } else
+    { PRINT_SUB( oyTESTRESULT_FAIL,
+      "oyCacheListGetEntry_(%d entries hit) %d", count,
+                          oyStructList_Count( oy_test_cache_ ) );
+    }
+  }
+
+  if( per_lookup[1] < per_lookup[0] * 10.0 )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyCacheListGetEntry_(%d/%d entries) constant time: %.02f",
+    sizes[1], sizes[0], per_lookup[1] / per_lookup[0] );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyCacheListGetEntry_(%d/%d entries) constant time: %.02f",
+    sizes[1], sizes[0], per_lookup[1] / per_lookup[0] );
+  }
+
+  /* LRU eviction of unreferenced entries */
+  oyTestCacheListClear_();
+  count = 1000;
+  oyHash_s * held[10];
+  for(i = 0; i < count; ++i)
+  {
+    char * hash_text = NULL;
+    oyStringAddPrintf_( &hash_text, 0,0, "%s%d", hash_texts[3], i );
+    oyHash_s * hash = oyTestCacheListGetEntry_( hash_text );
+    oyPointer_s * ptr = oyPointer_New( 0 );
+    oyPointer_SetSize( ptr, 1000 );
+    oyHash_SetPointer( hash, (oyStruct_s*) ptr );
+    oyPointer_Release( &ptr );
+    if(i >= count - 10)
+      held[i - (count - 10)] = hash;
+    else
+      oyHash_Release( &hash );
+    oyFree_m_(hash_text);
+  }
+
+  int unreferenced = 0;
+  size_t bytes = oyCacheListGetSize_( oy_test_cache_, &unreferenced );
+  if( bytes == 1000 * 1000 && unreferenced == count - 10 )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyCacheListGetSize_() %lu bytes %d unreferenced", (unsigned long)bytes, unreferenced );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyCacheListGetSize_() %lu bytes %d unreferenced", (unsigned long)bytes, unreferenced );
+  }
+
+  int released = oyCacheListTrim_( oy_test_cache_, 100000, 0 );
+  bytes = oyCacheListGetSize_( oy_test_cache_, &unreferenced );
+  int kept = 0;
+  for(i = 0; i < 10; ++i)
+  {
+    char * hash_text = NULL;
+    oyStringAddPrintf_( &hash_text, 0,0, "%s%d", hash_texts[3], count - 10 + i );
+    oyHash_s * hash = oyTestCacheListGetEntry_( hash_text );
+    if(hash == held[i])
+      ++kept;
+    oyHash_Release( &hash );
+    oyHash_Release( &held[i] );
+    oyFree_m_(hash_text);
+  }
+  if( bytes <= 75000 && released && kept == 10 )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyCacheListTrim_( 100000 bytes ) released: %d kept: %lu bytes", released, (unsigned long)bytes );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyCacheListTrim_( 100000 bytes ) released: %d kept: %lu bytes %d/10", released, (unsigned long)bytes, kept );
+  }
+
+  released = oyCacheListTrim_( oy_test_cache_, 0, 20 );
+  if( oyStructList_Count( oy_test_cache_ ) <= 15 )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyCacheListTrim_( 20 entries ) released: %d kept: %d", released, oyStructList_Count( oy_test_cache_ ) );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyCacheListTrim_( 20 entries ) released: %d kept: %d", released, oyStructList_Count( oy_test_cache_ ) );
+  }
+
+  /* persistent device link cache */
+  oyTestCacheListClear_();
+  oyCacheDiskSetDir_( "test2_device_link_cache" );
+  char blob[10000];
+  memset( blob, 'a', sizeof(blob) );
+  int written = 0;
+  count = 20;
+  for(i = 0; i < count; ++i)
+  {
+    char * hash_text = NULL;
+    oyStringAddPrintf_( &hash_text, 0,0, "%s%d", hash_texts[6], i );
+    oyHash_s * hash = oyTestCacheListGetEntry_( hash_text );
+    blob[0] = i;
+    if(oyCacheDiskWrite_( hash, "oyDL", blob, sizeof(blob) ) == 0)
+      ++written;
+    oyHash_Release( &hash );
+    oyFree_m_(hash_text);
+  }
+
+  oyTestCacheListClear_();
+  char * hash_text = NULL;
+  oyStringAddPrintf_( &hash_text, 0,0, "%s%d", hash_texts[6], 5 );
+  oyHash_s * hash = oyTestCacheListGetEntry_( hash_text );
+  size_t size = 0;
+  char * dl = (char*) oyCacheDiskRead_( hash, "oyDL", &size, oyAllocateFunc_ );
+  if( written == count && dl && size == sizeof(blob) && dl[0] == 5 )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyCacheDiskWrite_/Read_() %d %lu bytes", written, (unsigned long)size );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyCacheDiskWrite_/Read_() %d %lu bytes", written, (unsigned long)size );
+  }
+  if(dl) oyFree_m_( dl );
+  oyHash_Release( &hash );
+  oyFree_m_(hash_text);
+
+  released = oyCacheDiskTrim_( oyCacheDiskGetDir_(), 100000, 0 );
+  if( released == 13 )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyCacheDiskTrim_( 100000 bytes ) removed: %d", released );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyCacheDiskTrim_( 100000 bytes ) removed: %d", released );
+  }
+  /* a truncated file is a miss */
+  oyCacheDiskTrim_( oyCacheDiskGetDir_(), 1, 0 );
+  oyStringAddPrintf_( &hash_text, 0,0, "%s%d", hash_texts[6], 5 );
+  hash = oyTestCacheListGetEntry_( hash_text );
+  oyCacheDiskWrite_( hash, "oyDL", blob, sizeof(blob) );
+  int files_n = 0;
+  char ** files = oyGetFiles_( oyCacheDiskGetDir_(), &files_n );
+  for(i = 0; i < files_n; ++i)
+    oyWriteMemToFile_( files[i], blob, sizeof(blob)/2 );
+  oyStringListRelease( &files, files_n, oyDeAllocateFunc_ );
+  dl = (char*) oyCacheDiskRead_( hash, "oyDL", &size, oyAllocateFunc_ );
+  files = oyGetFiles_( oyCacheDiskGetDir_(), &files_n );
+  if( files_n == 0 && !dl && size == 0 )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyCacheDiskRead_( truncated ) miss" );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyCacheDiskRead_( truncated ) %lu bytes files: %d", (unsigned long)size, files_n );
+  }
+  oyStringListRelease( &files, files_n, oyDeAllocateFunc_ );
+  if(dl) oyFree_m_( dl );
+  oyHash_Release( &hash );
+  oyFree_m_(hash_text);
+
+  /* the directory is shared; other files and subdirectories stay */
+  char * foreign = NULL, * sub = NULL, * nested = NULL;
+  oyStringAddPrintf_( &foreign, 0,0, "%s/foreign.icc", oyCacheDiskGetDir_() );
+  oyStringAddPrintf_( &sub, 0,0, "%s/sub/", oyCacheDiskGetDir_() );
+  oyStringAddPrintf_( &nested, 0,0, "%s0123456789abcdef0123456789abcdef.oyDL", sub );
+  oyWriteMemToFile_( foreign, blob, sizeof(blob) );
+  oyMakeDir_( sub );
+  oyWriteMemToFile_( nested, blob, sizeof(blob) );
+  released = oyCacheDiskTrim_( oyCacheDiskGetDir_(), 1, 0 );
+  if( released == 0 && oyIsFile_( foreign ) && oyIsFile_( nested ) )
+  { PRINT_SUB( oyTESTRESULT_SUCCESS,
+    "oyCacheDiskTrim_() keeps foreign files" );
+  } else
+  { PRINT_SUB( oyTESTRESULT_FAIL,
+    "oyCacheDiskTrim_() keeps foreign files removed: %d", released );
+  }
+  oyRemoveFile_( foreign );
+  oyRemoveFile_( nested );
+  sub[strlen(sub) - 1] = '\000';
+  remove( sub );
+  oyFree_m_( foreign );
+  oyFree_m_( sub );
+  oyFree_m_( nested );
+
+  oyCacheDiskTrim_( oyCacheDiskGetDir_(), 1, 0 );
+  oyRemoveFile_( oyCacheDiskGetDir_() );
+  oyCacheDiskSetDir_( NULL );
+
   oyTestCacheListClear_();
 
   return result;